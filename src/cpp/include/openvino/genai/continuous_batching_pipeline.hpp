@@ -7,6 +7,7 @@
 #include <memory>
 #include <string>
 #include <optional>
+#include <vector>
 
 #include <openvino/runtime/tensor.hpp>
 
@@ -23,6 +24,45 @@
 
 namespace ov::genai {
 
+/**
+ * @brief Snapshot of a histogram with fixed buckets, which is used to report distributions of latencies and sizes
+ * in PipelineMetrics.
+ */
+struct OPENVINO_GENAI_EXPORTS MetricHistogram {
+    /**
+     * Inclusive upper bounds of buckets in ascending order.
+     */
+    std::vector<float> upper_bounds;
+
+    /**
+     * Number of observations in each bucket. Contains upper_bounds.size() + 1 elements,
+     * the last one counts observations above the last bound.
+     */
+    std::vector<size_t> counts;
+
+    /**
+     * Total number of observations.
+     */
+    size_t count = 0;
+
+    /**
+     * Sum of observed values.
+     */
+    double sum = 0.0;
+
+    /**
+     * @return Mean of observed values or 0 if there are no observations.
+     */
+    float get_mean() const;
+
+    /**
+     * Estimates a quantile by linear interpolation within a bucket.
+     * @param quantile Quantile in [0, 1] range, e.g. 0.99 for p99.
+     * @return Estimated value or 0 if there are no observations.
+     */
+    float get_quantile(float quantile) const;
+};
+
 /**
  * @brief Contains general pipeline metrics, either aggregated throughout the lifetime of the generation pipeline
  * or measured at the previous generation step.
@@ -57,8 +97,120 @@ struct PipelineMetrics {
      * Duration of the last generation step in microseconds.
      */
     float inference_duration = 0.0;
+
+    /**
+     * Time from adding a request to its first generated token in milliseconds, collected throughout the lifetime of the pipeline.
+     */
+    MetricHistogram ttft_ms;
+
+    /**
+     * Time per output token after the first one in milliseconds, collected throughout the lifetime of the pipeline.
+     */
+    MetricHistogram tpot_ms;
+
+    /**
+     * Time from adding a request to its first scheduling in milliseconds, collected throughout the lifetime of the pipeline.
+     */
+    MetricHistogram queue_wait_ms;
+
+    /**
+     * Number of prompt tokens of a request scheduled at a single generation step.
+     */
+    MetricHistogram prefill_chunk_size;
+
+    /**
+     * Number of requests scheduled at a single generation step.
+     */
+    MetricHistogram batch_size;
+
+    /**
+     * Duration of generation steps in milliseconds.
+     */
+    MetricHistogram step_duration_ms;
+
+    /**
+     * Number of times requests were preempted to free KV cache blocks.
+     */
+    size_t preemptions = 0;
+
+    /**
+     * Number of processed tokens dropped by preemption, which have to be computed again.
+     */
+    size_t recomputed_tokens = 0;
+
+    /**
+     * Number of prompt KV cache blocks restored from prefix cache.
+     */
+    size_t prefix_cache_hits = 0;
+
+    /**
+     * Number of prompt KV cache blocks which were not found in prefix cache when requests were added.
+     * With SchedulerConfig::prefix_aware_admission_window, some of them are restored from prefix cache
+     * at later steps and are counted in prefix_cache_hits as well.
+     */
+    size_t prefix_cache_misses = 0;
+
+    /**
+     * Number of tokens evicted from KV cache by cache eviction algorithm.
+     */
+    size_t evicted_tokens = 0;
+
+    /**
+     * Number of candidate tokens proposed by draft model or prompt lookup in speculative decoding.
+     */
+    size_t draft_tokens = 0;
+
+    /**
+     * Number of candidate tokens accepted by main model in speculative decoding.
+     */
+    size_t accepted_draft_tokens = 0;
 };
 
+/**
+ * @brief Formats pipeline metrics in Prometheus text exposition format.
+ * Latency histograms are reported in seconds as recommended for Prometheus metrics.
+ * @param metrics Metrics returned by ContinuousBatchingPipeline::get_metrics().
+ * @param prefix Prefix of metric names.
+ * @return Text to be served on a metrics endpoint.
+ */
+OPENVINO_GENAI_EXPORTS std::string to_prometheus_text(const PipelineMetrics& metrics, const std::string& prefix = "openvino_genai");
+
+/**
+ * @brief 128-bit hash of a KV cache block which is used by prefix caching.
+ * The hash of a block is computed from the hash of the previous block and tokens of the block,
+ * so equal hashes of blocks mean equal prefixes up to the end of these blocks.
+ */
+struct OPENVINO_GENAI_EXPORTS BlockHash {
+    uint64_t low = 0;
+    uint64_t high = 0;
+
+    BlockHash() = default;
+    explicit BlockHash(uint64_t low, uint64_t high = 0) : low(low), high(high) {}
+
+    bool operator==(const BlockHash& other) const {
+        return low == other.low && high == other.high;
+    }
+
+    bool operator!=(const BlockHash& other) const {
+        return !(*this == other);
+    }
+
+    bool operator<(const BlockHash& other) const {
+        return high != other.high ? high < other.high : low < other.low;
+    }
+};
+
+/**
+ * @brief Computes hashes of full KV cache blocks of a prompt in the same way as prefix caching of
+ * ContinuousBatchingPipeline does for requests without LoRA adapters. A router serving several pipeline replicas
+ * can match hashes of a new prompt with hashes of prompts sent to every replica and place the request
+ * on the replica which already has the longest prefix of it in KV cache.
+ * @param prompt_ids Token IDs of a prompt.
+ * @param block_size KV cache block size of replicas, which depends on device and KV cache precision.
+ * @return Hashes of prompt_ids.size() / block_size full blocks, the last incomplete block is not hashed.
+ */
+OPENVINO_GENAI_EXPORTS std::vector<BlockHash> get_prefix_block_hashes(const std::vector<int64_t>& prompt_ids, size_t block_size);
+
 class OPENVINO_GENAI_EXPORTS ContinuousBatchingPipeline {
 protected:
     class IContinuousBatchingPipeline;
@@ -167,6 +319,20 @@ public:
      */
     ov::genai::PipelineMetrics get_metrics() const;
 
+    /**
+     * Starts recording a timeline of steps, scheduling decisions and requests of all continuous batching pipelines
+     * in the process, previously recorded events are dropped. Recording can also be enabled at load time by
+     * OPENVINO_GENAI_TRACE_FILE environment variable holding an output path.
+     * @param output_path Path of a trace file written by stop_tracing() in Chrome trace event JSON format,
+     * which is opened by chrome://tracing and Perfetto UI.
+     */
+    void start_tracing(const std::filesystem::path& output_path);
+
+    /**
+     * Stops recording started by start_tracing() or OPENVINO_GENAI_TRACE_FILE environment variable and writes the trace.
+     */
+    void stop_tracing();
+
     /// @param request_id must be unique for every add_request() call.
     GenerationHandle add_request(uint64_t request_id, const ov::Tensor& input_ids, const ov::genai::GenerationConfig& sampling_params);
     GenerationHandle add_request(uint64_t request_id, const std::string& prompt, const ov::genai::GenerationConfig& sampling_params);
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <filesystem>
+#include <functional>
 #include <vector>
 #include <string>
 
@@ -131,6 +132,22 @@ public:
 
     ov::Tensor decode(ov::Tensor latent);
 
+    /**
+     * Decodes latent by overlapping spatial tiles, so VAE decoder memory consumption is bounded by tile size
+     * instead of image size. Overlapped areas of neighbour tiles are linearly blended.
+     * Note, that VAE decoder must have dynamic spatial dimensions, i.e. it must not be reshaped to a static image size.
+     * @param latent Latent to decode
+     * @param tile_size Tile size in pixels, must be divisible by VAE scale factor
+     * @param tile_overlap Overlap of neighbour tiles in pixels, must be divisible by VAE scale factor
+     * @param callback Optional callback which receives decoded rows of NHWC image together with index of the first row.
+     * If it's specified, the whole image is not materialized and an empty tensor is returned.
+     * @returns Decoded image in NHWC layout
+     */
+    ov::Tensor decode_tiled(ov::Tensor latent,
+                            size_t tile_size,
+                            size_t tile_overlap,
+                            const std::function<void(size_t, const ov::Tensor&)>& callback = nullptr);
+
     ov::Tensor encode(ov::Tensor image, std::shared_ptr<Generator> generator);
 
     const Config& get_config() const;
@@ -6,6 +6,7 @@
 #include <filesystem>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "openvino/genai/visibility.hpp"
 #include "openvino/genai/tokenizer.hpp"
@@ -19,6 +20,8 @@
 namespace ov {
 namespace genai {
 
+class TextEncoderCache;
+
 class OPENVINO_GENAI_EXPORTS CLIPTextModel {
 public:
     struct OPENVINO_GENAI_EXPORTS Config {
@@ -91,6 +94,18 @@ public:
 
     ov::Tensor get_output_tensor(const size_t idx);
 
+    /**
+     * Sets capacity of LRU cache of text embeddings keyed by tokenized prompts, so 'infer' is skipped
+     * for prompts which have been already encoded. 0 disables caching.
+     * Note, that cache is bypassed while LoRA adapters are applied to the model.
+     */
+    void set_embeddings_cache_size(size_t size);
+
+    /**
+     * Returns whether the last 'infer' call was served from embeddings cache
+     */
+    bool is_last_infer_cached() const;
+
     /**
      * @brief Exports compiled model to a specified directory.
      * @param export_path A path to a directory to export compiled model to
@@ -104,6 +119,9 @@ private:
     AdapterController m_adapter_controller;
     Tokenizer m_clip_tokenizer;
     bool m_slice_batch1_output = false;
+    std::shared_ptr<TextEncoderCache> m_embeddings_cache;
+    std::vector<ov::Tensor> m_cached_outputs;
+    bool m_adapters_applied = false;
 
 protected:
     ov::InferRequest m_request;
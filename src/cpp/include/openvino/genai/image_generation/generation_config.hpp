@@ -122,6 +122,32 @@ struct OPENVINO_GENAI_EXPORTS ImageGenerationConfig {
      */
     std::optional<AdapterConfig> adapters;
 
+    /**
+     * Denoiser step caching policy used by Stable Diffusion, Stable Diffusion 3 and FLUX pipelines.
+     * If 'step_cache_interval' is greater than 1, UNet / Transformer is inferred only on every N-th denoising step
+     * and its output is reused on steps in between.
+     * If 'step_cache_threshold' is greater than 0, relative L1 change of denoiser input is accumulated across steps
+     * and denoiser output is reused while accumulated change stays below the threshold.
+     * First and last denoising steps are always computed. Both policies are disabled by default.
+     */
+    float step_cache_threshold = 0.0f;
+    size_t step_cache_interval = 1;
+
+    /**
+     * Tiled VAE decoding. If 'vae_tile_size' is greater than 0, latent is decoded by overlapping tiles of
+     * 'vae_tile_size' x 'vae_tile_size' pixels, which bounds VAE decoder memory consumption for high resolution images.
+     * Overlapped areas of 'vae_tile_overlap' pixels are linearly blended. Disabled by default.
+     */
+    size_t vae_tile_size = 0;
+    size_t vae_tile_overlap = 64;
+
+    /**
+     * Capacity of LRU cache of text encoder outputs keyed by tokenized prompts. Each text encoder of a pipeline
+     * keeps its own cache, so repeated prompts (e.g. style prompts, empty negative prompts) are not encoded again.
+     * Text encoders with applied LoRA adapters bypass the cache. 0 disables caching, which is the default.
+     */
+    size_t text_embeddings_cache_size = 0;
+
     /**
      * Checks whether image generation config is valid, otherwise throws an exception.
      */
@@ -236,6 +262,35 @@ extern OPENVINO_GENAI_EXPORTS ov::Property<size_t> rng_seed;
  */
 static constexpr ov::Property<int> max_sequence_length{"max_sequence_length"};
 
+/**
+ * Accumulated relative L1 change of denoiser inputs below which the previous denoiser output is reused
+ * instead of UNet / Transformer inference. Higher values skip more steps at the cost of image quality.
+ * Typical values are within [0.05, 0.3] range; 0 disables threshold based step caching.
+ */
+static constexpr ov::Property<float> step_cache_threshold{"step_cache_threshold"};
+
+/**
+ * Denoiser is inferred only on every 'step_cache_interval'-th step, while its output is reused on other steps.
+ * 1 disables interval based step caching.
+ */
+static constexpr ov::Property<size_t> step_cache_interval{"step_cache_interval"};
+
+/**
+ * Size of tiles in pixels used to decode latent by VAE decoder. 0 disables tiled decoding.
+ * Note, that tiled decoding requires VAE decoder with dynamic spatial dimensions, i.e. pipeline must not be reshaped.
+ */
+static constexpr ov::Property<size_t> vae_tile_size{"vae_tile_size"};
+
+/**
+ * Overlap in pixels of neighbour tiles used to decode latent by VAE decoder.
+ */
+static constexpr ov::Property<size_t> vae_tile_overlap{"vae_tile_overlap"};
+
+/**
+ * Number of prompts whose text encoder outputs are cached by each text encoder. 0 disables caching.
+ */
+static constexpr ov::Property<size_t> text_embeddings_cache_size{"text_embeddings_cache_size"};
+
 /**
  * User callback for image generation pipelines, which is called within a pipeline with the following arguments:
  * - Current inference step
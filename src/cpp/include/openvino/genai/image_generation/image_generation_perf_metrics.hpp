@@ -17,6 +17,8 @@ struct RawImageGenerationPerfMetrics {
     std::vector<MicroSeconds> unet_inference_durations; // unet inference durations for each step
     std::vector<MicroSeconds> transformer_inference_durations; // transformer inference durations for each step
     std::vector<MicroSeconds> iteration_durations;  //  durations of each step
+    std::vector<size_t> cached_steps; // indices of steps where cached unet / transformer output was reused
+    std::vector<std::string> cached_text_encoders; // names of text encoders whose outputs were taken from embeddings cache
 };
 
 struct OPENVINO_GENAI_EXPORTS ImageGenerationPerfMetrics {
@@ -46,6 +48,8 @@ struct OPENVINO_GENAI_EXPORTS ImageGenerationPerfMetrics {
     float get_inference_duration();
     float get_load_time() const;
     float get_generate_duration();
+    size_t get_num_cached_steps() const;
+    size_t get_text_embeddings_cache_hits() const;
     void get_first_and_other_iter_duration(float& first_iter, float& other_iter_avg);
     void get_first_and_other_unet_infer_duration(float& first_infer, float& other_infer_avg);
     void get_first_and_other_trans_infer_duration(float& first_infer, float& other_infer_avg);
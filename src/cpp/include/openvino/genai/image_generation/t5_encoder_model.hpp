@@ -6,6 +6,7 @@
 #include <filesystem>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "openvino/genai/visibility.hpp"
 #include "openvino/genai/tokenizer.hpp"
@@ -19,6 +20,8 @@
 namespace ov {
 namespace genai {
 
+class TextEncoderCache;
+
 class OPENVINO_GENAI_EXPORTS T5EncoderModel {
 public:
     explicit T5EncoderModel(const std::filesystem::path& root_dir);
@@ -78,6 +81,17 @@ public:
 
     ov::Tensor get_prompt_attention_mask() const;
 
+    /**
+     * Sets capacity of LRU cache of text embeddings keyed by tokenized prompts, so 'infer' is skipped
+     * for prompts which have been already encoded. 0 disables caching.
+     */
+    void set_embeddings_cache_size(size_t size);
+
+    /**
+     * Returns whether the last 'infer' call was served from embeddings cache
+     */
+    bool is_last_infer_cached() const;
+
 private:
     AdapterController m_adapter_controller;
     ov::InferRequest m_request;
@@ -86,6 +100,9 @@ private:
     ov::Tensor m_prompt_attention_mask;
 
     Tokenizer m_tokenizer;
+
+    std::shared_ptr<TextEncoderCache> m_embeddings_cache;
+    std::vector<ov::Tensor> m_cached_outputs;
 };
 
 } // namespace genai
@@ -179,6 +179,17 @@ public:
 
 static constexpr AdaptersProperty adapters;
 
+/**
+ * @brief lora_num_slots property enables per-request adapters in ContinuousBatchingPipeline.
+ * Adapters passed to the pipeline with ov::genai::adapters are the ones that can be served, and each request selects
+ * its own combination of them in GenerationConfig::adapters; requests without adapters use the base model.
+ * Up to lora_num_slots distinct adapter configs are resident at a time and requests with different configs
+ * are batched together. A request waits while all slots are held by running requests with other configs.
+ * 0 (default) applies adapters passed to the pipeline to all requests.
+ * Usage: ContinuousBatchingPipeline(models_path, scheduler_config, "CPU", {ov::genai::adapters(a1, a2), ov::genai::lora_num_slots(4)}).
+ */
+static constexpr ov::Property<size_t> lora_num_slots{"lora_num_slots"};
+
 
 class OPENVINO_GENAI_EXPORTS AdapterController {
 
@@ -61,6 +61,14 @@ struct SchedulerConfig {
     // When ContinuousBatching is invoked from LLMPipeline (client scenario) by default prefix caching is turned on.
     bool enable_prefix_caching = false;
 
+    // Number of the oldest waiting prompts which are admitted in order of the number of KV blocks their prefill
+    // still requires after prefix cache lookup, rather than in arrival order.
+    // The oldest waiting prompt is bypassed by at most prefix_aware_admission_window - 1 newer prompts.
+    // When prefix caching is enabled, a prompt whose next block is computed by another prompt at the same step
+    // waits for one step and restores the block from cache, so a common prefix is computed once.
+    // 0 turns the reordering off and prompts are admitted in arrival order.
+    std::size_t prefix_aware_admission_window = 0;
+
     /** Whether to apply block-wise sparse attention to the prefill stage.
      */
     bool use_sparse_attention = false;
@@ -72,7 +80,8 @@ struct SchedulerConfig {
         return max_num_batched_tokens == other.max_num_batched_tokens && num_kv_blocks == other.num_kv_blocks &&
                cache_size == other.cache_size &&
                dynamic_split_fuse == other.dynamic_split_fuse && use_cache_eviction == other.use_cache_eviction &&
-               max_num_seqs == other.max_num_seqs && enable_prefix_caching == other.enable_prefix_caching;
+               max_num_seqs == other.max_num_seqs && enable_prefix_caching == other.enable_prefix_caching &&
+               prefix_aware_admission_window == other.prefix_aware_admission_window;
     }
 
     /**
@@ -95,6 +104,7 @@ struct SchedulerConfig {
         }
         oss << "  max_num_seqs: " << max_num_seqs << "\n";
         oss << "  enable_prefix_caching: " << std::boolalpha << enable_prefix_caching << "\n";
+        oss << "  prefix_aware_admission_window: " << prefix_aware_admission_window << "\n";
         oss << "  use_sparse_attention: " << std::boolalpha << use_sparse_attention << "\n";
         if (use_sparse_attention) {
             oss << sparse_attention_config.to_string() << "\n";
@@ -46,7 +46,9 @@ public:
     /**
      * @brief ov::genai::Tokenizer constructor.
      * @param tokenizer_path openvino_tokenizer.xml and openvino_detokenizer.xml should be located in the tokenizer_path
-     * @param properties Properties passed to ov::Core::compile_model
+     * @param properties Properties passed to ov::Core::compile_model. Batches are encoded and decoded in parallel only if
+     * models are compiled for several infer requests, e.g. with ov::hint::performance_mode(ov::hint::PerformanceMode::THROUGHPUT);
+     * under the default LATENCY hint there is a single infer request and batches are processed at once.
      */
     explicit Tokenizer(const std::filesystem::path& tokenizer_path, const ov::AnyMap& properties = {});
 
@@ -133,6 +135,8 @@ public:
     * @param prompts vector storing batch of prompts
     * @param tokenization_params AnyMap with tokenization parameters, e.g. {{"add_special_tokens", false}, {"max_length", 128}}
     * @return pair of [input_ids, attention_mask]
+    * @note Batch is split into shards encoded in parallel if each of tokenizer infer requests gets at least 16 prompts.
+    * Tokenizer has several infer requests only if it's compiled with THROUGHPUT performance hint, see constructor properties.
     */
     TokenizedInputs encode(const std::vector<std::string>& prompt, const ov::AnyMap& tokenization_params = {});
     TokenizedInputs encode(const std::initializer_list<std::string>& prompts, const ov::AnyMap& tokenization_params = {});
@@ -211,6 +215,7 @@ public:
     * @param tokens ov::Tensor with tokens with shape [batch_size, seq_len]
     * @param detokenization_params AnyMap with detokenization parameters, e.g. {"skip_special_tokens", false}
     * @return vector of std::string, with size = batch_size
+    * @note Batch is split into shards decoded in parallel under the same conditions as batch encoding.
     */
     std::vector<std::string> decode(const ov::Tensor& tokens, const ov::AnyMap& detokenization_params = {});
 
@@ -230,6 +235,7 @@ public:
     * @param tokens vector of vectors with tokens, tokens.size() is equal to batch_size
     * @param detokenization_params AnyMap with detokenization parameters, e.g. {"skip_special_tokens", false}
     * @return vector of std::string, with size equal to batch_size
+    * @note Batch is split into shards decoded in parallel under the same conditions as batch encoding.
     */
     std::vector<std::string> decode(const std::vector<std::vector<int64_t>>& tokens, const ov::AnyMap& detokenization_params = {});
 
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <filesystem>
+#include <functional>
 #include <vector>
 #include <string>
 
@@ -52,6 +53,26 @@ public:
 
     ov::Tensor decode(const ov::Tensor& latent);
 
+    /**
+     * Decodes video latent by overlapping spatial tiles and / or temporal chunks, so VAE decoder memory consumption
+     * is bounded by tile size instead of video size. Overlapped areas are linearly blended.
+     * Note, that VAE decoder must have dynamic dimensions, i.e. it must not be reshaped to a static video size.
+     * @param latent Latent to decode of [N, C, D, H, W] shape
+     * @param tile_size Spatial tile size in pixels, 0 disables spatial tiling
+     * @param tile_overlap Overlap of neighbour spatial tiles in pixels
+     * @param tile_num_frames Temporal chunk size in latent frames, 0 disables temporal tiling
+     * @param tile_frames_overlap Overlap of neighbour temporal chunks in latent frames, must be at least 1
+     * @param callback Optional callback which receives decoded frames in NDHWC layout together with index of the first frame.
+     * If it's specified, the whole video is not materialized and an empty tensor is returned.
+     * @returns Decoded video in NDHWC layout
+     */
+    ov::Tensor decode_tiled(const ov::Tensor& latent,
+                            size_t tile_size,
+                            size_t tile_overlap,
+                            size_t tile_num_frames,
+                            size_t tile_frames_overlap,
+                            const std::function<void(size_t, const ov::Tensor&)>& callback = nullptr);
+
     const Config& get_config() const;
 
     size_t get_vae_scale_factor() const;
@@ -61,6 +82,9 @@ public:
 private:
     void merge_vae_video_post_processing() const;
 
+    size_t get_spatial_compression_ratio() const;
+    size_t get_temporal_compression_ratio() const;
+
     Config m_config;
     ov::InferRequest m_encoder_request, m_decoder_request;
     std::shared_ptr<ov::Model> m_encoder_model = nullptr, m_decoder_model = nullptr;
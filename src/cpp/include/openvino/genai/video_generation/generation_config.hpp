@@ -56,6 +56,14 @@ struct VideoGenerationConfig {
     /// Video frame rate. Affects rope_interpolation_scale. Any value can be used although positive
     /// non-infinity makes the most sense. NaN corresponds to model default which is 25.0f for LTX-Video.
     std::optional<float> frame_rate = std::nullopt;
+    /// Spatial tile size in pixels for tiled VAE decoding. 0 disables spatial tiling.
+    size_t vae_tile_size = 0;
+    /// Overlap of neighbour spatial tiles in pixels for tiled VAE decoding.
+    size_t vae_tile_overlap = 64;
+    /// Number of latent frames decoded by VAE at once. 0 disables temporal tiling.
+    size_t vae_tile_num_frames = 0;
+    /// Overlap of neighbour temporal chunks in latent frames for tiled VAE decoding.
+    size_t vae_tile_frames_overlap = 1;
 };
 
 /**
@@ -81,6 +89,10 @@ static constexpr ov::Property<float> guidance_rescale{"guidance_rescale"};
 static constexpr ov::Property<size_t> num_frames{"num_frames"};
 /// Video frame rate.
 static constexpr ov::Property<float> frame_rate{"frame_rate"};
+/// Number of latent frames decoded by VAE at once. 0 disables temporal tiling.
+static constexpr ov::Property<size_t> vae_tile_num_frames{"vae_tile_num_frames"};
+/// Overlap of neighbour temporal chunks in latent frames for tiled VAE decoding.
+static constexpr ov::Property<size_t> vae_tile_frames_overlap{"vae_tile_frames_overlap"};
 
 /**
  * Function to pass 'VideoGenerationConfig' as property to 'generate()' call.
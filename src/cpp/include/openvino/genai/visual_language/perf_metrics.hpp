@@ -12,14 +12,27 @@ namespace ov::genai {
 struct OPENVINO_GENAI_EXPORTS VLMRawPerfMetrics {
     /** @brief Duration of preparation of embeddings */
     std::vector<MicroSeconds> prepare_embeddings_durations;
+    /** @brief Number of images and videos whose encodings were reused from the shared vision embeddings cache */
+    size_t vision_cache_hits = 0;
+    /** @brief Number of images and videos which were encoded by the vision encoder */
+    size_t vision_cache_misses = 0;
+    /** @brief Number of visual tokens removed from the prompt by visual token pruning */
+    size_t pruned_vision_tokens = 0;
+    /** @brief Number of KV-cache blocks the prompt did not occupy thanks to visual token pruning, reported by continuous batching */
+    size_t saved_kv_blocks = 0;
 };
 
 struct OPENVINO_GENAI_EXPORTS VLMPerfMetrics : public PerfMetrics {
     /** @brief Mean and standard deviation of preparation of embeddings in milliseconds */
     MeanStdPair prepare_embeddings_duration;
 
+    /** @brief Share of images and videos whose encodings were reused from the shared vision embeddings cache */
+    float vision_cache_hit_rate = 0.0f;
+
     MeanStdPair get_prepare_embeddings_duration();
 
+    float get_vision_cache_hit_rate();
+
     VLMPerfMetrics() = default;
 
     VLMPerfMetrics(PerfMetrics& perf_metrics) : PerfMetrics(perf_metrics), prepare_embeddings_duration(){};
@@ -303,4 +303,14 @@ private:
 static constexpr ov::Property<ov::Tensor> image{"image"};
 static constexpr ov::Property<std::vector<ov::Tensor>> images{"images"};
 static constexpr ov::Property<std::vector<ov::Tensor>> videos{"videos"};
+
+/**
+* @brief vision_embeddings_cache_size property sets capacity in megabytes of the process-wide cache of encoded
+* images and videos, so the same image passed to any VLMPipeline or ContinuousBatchingPipeline is encoded once.
+* Entries are keyed by the full content of an image or video and by the model and preprocessing configuration.
+* The cache is disabled by default; the value passed to the last constructed pipeline applies to all pipelines,
+* 0 disables caching again.
+* Pass it to pipeline constructor: VLMPipeline(models_path, "CPU", ov::genai::vision_embeddings_cache_size(512)).
+*/
+static constexpr ov::Property<size_t> vision_embeddings_cache_size{"vision_embeddings_cache_size"};
 }
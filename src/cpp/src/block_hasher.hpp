@@ -0,0 +1,112 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+#include "openvino/genai/continuous_batching_pipeline.hpp"
+
+namespace ov::genai {
+
+// Incremental 128-bit hash of a KV cache block: MurmurHash3 x64_128 over 64-bit words, seeded by the hash of
+// the previous block. The state is copyable and get_hash() does not change it, so a partially filled block
+// is hashed once per token as the block grows.
+class BlockHasher {
+public:
+    explicit BlockHasher(const BlockHash& seed = BlockHash()) : m_h1(seed.low), m_h2(seed.high) {}
+
+    void update(uint64_t word) {
+        if (m_num_words++ % 2 == 0) {
+            m_pending = word;
+        } else {
+            mix(m_pending, word);
+        }
+    }
+
+    void update(const int64_t* words, size_t num_words) {
+        for (size_t i = 0; i < num_words; ++i) {
+            update(static_cast<uint64_t>(words[i]));
+        }
+    }
+
+    // arbitrary bytes are hashed as 64-bit words followed by the zero padded tail and the byte size,
+    // so inputs differing in trailing zeros only don't collide
+    void update_bytes(const void* data, size_t byte_size) {
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        size_t i = 0;
+        for (; i + sizeof(uint64_t) <= byte_size; i += sizeof(uint64_t)) {
+            uint64_t word;
+            std::memcpy(&word, bytes + i, sizeof(word));
+            update(word);
+        }
+        if (i < byte_size) {
+            uint64_t tail = 0;
+            std::memcpy(&tail, bytes + i, byte_size - i);
+            update(tail);
+        }
+        update(static_cast<uint64_t>(byte_size));
+    }
+
+    // embeddings are hashed by their bit patterns
+    void update_float(float value) {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        update(static_cast<uint64_t>(bits));
+    }
+
+    BlockHash get_hash() const {
+        uint64_t h1 = m_h1, h2 = m_h2;
+        if (m_num_words % 2 == 1) {
+            h1 ^= mix_k1(m_pending);
+        }
+        const uint64_t length = m_num_words * sizeof(uint64_t);
+        h1 ^= length;
+        h2 ^= length;
+        h1 += h2;
+        h2 += h1;
+        h1 = fmix(h1);
+        h2 = fmix(h2);
+        h1 += h2;
+        h2 += h1;
+        return BlockHash(h1, h2);
+    }
+
+private:
+    static constexpr uint64_t c1 = 0x87c37b91114253d5ULL;
+    static constexpr uint64_t c2 = 0x4cf5ad432745937fULL;
+
+    static uint64_t rotl(uint64_t x, int r) {
+        return (x << r) | (x >> (64 - r));
+    }
+
+    static uint64_t mix_k1(uint64_t k1) {
+        return rotl(k1 * c1, 31) * c2;
+    }
+
+    static uint64_t fmix(uint64_t k) {
+        k ^= k >> 33;
+        k *= 0xff51afd7ed558ccdULL;
+        k ^= k >> 33;
+        k *= 0xc4ceb9fe1a85ec53ULL;
+        k ^= k >> 33;
+        return k;
+    }
+
+    void mix(uint64_t k1, uint64_t k2) {
+        m_h1 ^= mix_k1(k1);
+        m_h1 = rotl(m_h1, 27) + m_h2;
+        m_h1 = m_h1 * 5 + 0x52dce729;
+        m_h2 ^= rotl(k2 * c2, 33) * c1;
+        m_h2 = rotl(m_h2, 31) + m_h1;
+        m_h2 = m_h2 * 5 + 0x38495ab5;
+    }
+
+    uint64_t m_h1;
+    uint64_t m_h2;
+    uint64_t m_pending = 0;
+    size_t m_num_words = 0;
+};
+
+}  // namespace ov::genai
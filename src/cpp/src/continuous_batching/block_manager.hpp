@@ -17,7 +17,7 @@ namespace ov::genai {
 class KVCacheBlock {
     int m_ref_count;
     int m_index;
-    size_t m_hash;
+    BlockHash m_hash;
     std::chrono::time_point<std::chrono::steady_clock> m_timestamp;
 public:
     using Ptr = std::shared_ptr<KVCacheBlock>;
@@ -26,7 +26,7 @@ public:
     explicit KVCacheBlock(int index)
         : m_ref_count(0),
           m_index(index),
-          m_hash(0),
+          m_hash(),
           m_timestamp(std::chrono::steady_clock::now()) { }
 
     int get_index() const {
@@ -54,11 +54,11 @@ public:
         return m_ref_count;
     }
 
-    size_t get_hash() const {
+    const BlockHash& get_hash() const {
         return m_hash;
     }
 
-    void set_hash(size_t hash) {
+    void set_hash(const BlockHash& hash) {
         m_hash = hash;
     }
 
@@ -80,7 +80,7 @@ using BlocksPerLayer = std::vector<KVCacheBlock::Ptr>;
  * runs out of fresh blocks, or reused if their contents match to the prefix-based requested hash.
  */
 class OverwritableBlocksHashStore {
-    std::map<size_t, BlocksPerLayer> m_blocks;
+    std::map<BlockHash, BlocksPerLayer> m_blocks;
     size_t m_num_layers;
     public:
     /**
@@ -98,7 +98,7 @@ class OverwritableBlocksHashStore {
         OPENVINO_ASSERT(blocks_for_all_layers.size() == m_num_layers);
         bool is_all_free = std::all_of(blocks_for_all_layers.begin(), blocks_for_all_layers.end(), [](const KVCacheBlock::Ptr& block_ptr) { return block_ptr->is_free(); });
         OPENVINO_ASSERT(is_all_free);
-        size_t hash = blocks_for_all_layers[0]->get_hash();
+        const BlockHash hash = blocks_for_all_layers[0]->get_hash();
         for (const auto& block : blocks_for_all_layers) {
             if (block->get_hash() != hash) {
                 OPENVINO_THROW("internal error - block hashes for all layers must be equal");
@@ -115,7 +115,7 @@ class OverwritableBlocksHashStore {
       * @param hash The hash value to look up in the store.
       * @return A vector of KV cache blocks (one for each decoder layer) previously stored under this hash.
       */
-    BlocksPerLayer get_block_to_restore(size_t hash) {
+    BlocksPerLayer get_block_to_restore(const BlockHash& hash) {
         auto it = m_blocks.find(hash);
         if (it == m_blocks.end())
         {
@@ -166,10 +166,10 @@ class OverwritableBlocksHashStore {
      *   and the block added to the returned vector. If a hash is not present in the store, it is silently ignored.
      * @return A vector of blocks, each element corresponding to a removed hash.
      */
-    std::vector<BlocksPerLayer> clean_store(const std::set<uint64_t>& hashes_to_discard) {
+    std::vector<BlocksPerLayer> clean_store(const std::set<BlockHash>& hashes_to_discard) {
         std::vector<BlocksPerLayer> retval;
         retval.reserve(hashes_to_discard.size());
-        for (uint64_t hash : hashes_to_discard) {
+        for (const BlockHash& hash : hashes_to_discard) {
             auto it = m_blocks.find(hash);
             if (it != m_blocks.end()) {
                 retval.push_back(it->second);
@@ -331,7 +331,7 @@ public:
             // is_all_free == true due to assert above
             if (m_enable_prefix_caching)
             {
-                std::set<uint64_t> hashes_across_blocks;
+                std::set<BlockHash> hashes_across_blocks;
                 for (const auto& block : blocks_for_all_layers) {
                     hashes_across_blocks.insert(block->get_hash());
                 }
@@ -418,7 +418,7 @@ public:
      * @return A vector of blocks (one for each layer), either freshly allocated or reused for overwriting,
      * or an empty vector if cache is exhausted.
      */
-    BlocksPerLayer allocate_block(size_t hash, std::map<uint64_t, BlocksPerLayer>& cached_blocks) {
+    BlocksPerLayer allocate_block(const BlockHash& hash, std::map<BlockHash, BlocksPerLayer>& cached_blocks) {
         OPENVINO_ASSERT(m_enable_prefix_caching);
         OPENVINO_ASSERT(can_allocate_blocks(1));
 
@@ -461,7 +461,7 @@ public:
      * @param cached_blocks The map of known hashes to already allocated and filled blocks.
      * @return A vector of blocks (one for each layer) corresponding to this hash, or an empty vector if the hash is not found in the map.
      */
-    BlocksPerLayer get_cached_block(size_t hash, std::map<uint64_t, BlocksPerLayer>& cached_blocks) {
+    BlocksPerLayer get_cached_block(const BlockHash& hash, std::map<BlockHash, BlocksPerLayer>& cached_blocks) {
         auto blocks_for_all_layers = m_overwriteable_blocks.get_block_to_restore(hash);
         if (!blocks_for_all_layers.empty()) {
             // use cached block from internal store
@@ -519,7 +519,7 @@ class BlockManager {
     size_t m_block_size;
     size_t m_num_layers;
     // TODO: caching time can probably be improved if we use the prefix tree
-    std::map<uint64_t, BlocksPerLayer> m_prefix_hash_to_occupied_block_map;
+    std::map<BlockHash, BlocksPerLayer> m_prefix_hash_to_occupied_block_map;
 
     // stores blocks for each sequence (not sequence group)
     // the same block can be seen in multiple block_tables for different sequences
@@ -1094,7 +1094,11 @@ public:
         return copy_blocks_map;
     }
 
-    void restore_cached_blocks(SequenceGroup::Ptr group) {
+    /**
+     * Restores KV cache blocks of a prompt from prefix cache.
+     * @return Number of restored blocks.
+     */
+    size_t restore_cached_blocks(SequenceGroup::Ptr group) {
         // When add_request() is executed in multiple threads accessing to cached_blocks causes segfault.
         // The mutex is needed to prevent such segfaults.
         const std::lock_guard<std::mutex> lock(m_cached_blocks_map_mutex);
@@ -1110,6 +1114,7 @@ public:
         auto& block_table = m_block_table[seq_id];
 
         size_t content_len = 0;
+        size_t num_restored_blocks = 0;
         while (content_len < prompt_len) {
             size_t prev_iteration_content_len = content_len;
             content_len += m_block_size;
@@ -1126,6 +1131,7 @@ public:
                     block->set_timestamp(timestamp);
                     block_table[layer_idx].push_back(block);
                 }
+                ++num_restored_blocks;
                 group->update_processed_tokens_num(content_len == prompt_len ? content_len - 1 : content_len);
             } else {
             // restore partially filled block
@@ -1143,6 +1149,7 @@ public:
                             block->set_timestamp(timestamp);
                             block_table[layer_idx].push_back(block);
                         }
+                        ++num_restored_blocks;
                         group->update_processed_tokens_num(prev_iteration_content_len + i == prompt_len ? prev_iteration_content_len + i - 1 : prev_iteration_content_len + i);
 
                         break;
@@ -1151,6 +1158,58 @@ public:
                 break;
             }
         }
+        return num_restored_blocks;
+    }
+
+    /**
+     * Continues restoring of a waiting prompt from prefix cache with fully filled blocks which were cached after the
+     * previous restoring, e.g. by another prompt with the same prefix. Must be called before new blocks are
+     * allocated at the current step, since these are found in cache, but not computed yet.
+     * @param group Sequence group in prompt phase.
+     * @param blocks_in_progress Hashes of blocks which are partially computed by chunks of other prompts.
+     * @return Number of restored blocks.
+     */
+    size_t restore_newly_cached_blocks(SequenceGroup::Ptr group, const std::set<BlockHash>& blocks_in_progress) {
+        const std::lock_guard<std::mutex> lock(m_cached_blocks_map_mutex);
+        auto prompt_len = group->get_prompt_len();
+        auto sequences = group->get_not_finished_sequences();
+        OPENVINO_ASSERT(sequences.size() == 1);
+        auto sequence = sequences[0];
+        auto& block_table = m_block_table[sequence->get_id()];
+        if (block_table.empty()) {
+            block_table.resize(m_num_layers);
+        }
+
+        size_t content_len = block_table[0].size() * m_block_size;
+        if (group->get_num_processed_tokens() != content_len) {
+            // the last block is filled partially, the next blocks cannot be restored
+            return 0;
+        }
+
+        size_t num_restored_blocks = 0;
+        const auto timestamp = std::chrono::steady_clock::now();
+        while (content_len + m_block_size <= prompt_len) {
+            auto hash = sequence->get_hash(content_len + m_block_size);
+            if (blocks_in_progress.count(hash)) {
+                break;
+            }
+            auto blocks = m_allocator.get_cached_block(hash, m_prefix_hash_to_occupied_block_map);
+            if (blocks.empty()) {
+                break;
+            }
+            for (size_t layer_idx = 0; layer_idx < block_table.size(); layer_idx++) {
+                auto& block = blocks[layer_idx];
+                block->set_timestamp(timestamp);
+                block_table[layer_idx].push_back(block);
+            }
+            content_len += m_block_size;
+            ++num_restored_blocks;
+        }
+        if (num_restored_blocks > 0) {
+            // the last prompt token is computed anyway to get logits
+            group->update_processed_tokens_num(content_len == prompt_len ? content_len - 1 : content_len);
+        }
+        return num_restored_blocks;
     }
 
     void clear() {
@@ -16,6 +16,7 @@
 
 #include "continuous_batching/attention_output.hpp"
 #include "continuous_batching/cache_eviction.hpp"
+#include "lora/multi_slot_adapter_controller.hpp"
 
 namespace ov::genai {
 
@@ -118,6 +119,9 @@ class ModelRunner {
     bool m_is_use_xattention_inputs;
 
     bool m_is_use_adaptive_rkv;
+
+    // per-token LoRA slot input is added to the model when several adapter configs are served in a batch
+    bool m_is_use_lora_slots = false;
     // A model to compute token embeddings.
     // Input shape: [N, conversation length].
     // Output shape: [1, conversation length, hidden_size].
@@ -139,6 +143,7 @@ class ModelRunner {
     ov::Tensor m_cached_max_context_len;
     ov::Tensor m_cached_score_aggregation_window;
     ov::Tensor m_cached_token_type_ids;
+    ov::Tensor m_cached_lora_slot_ids;
 public:
     /**
      * Constructs the ModelRunner.
@@ -178,6 +183,9 @@ public:
           m_is_use_adaptive_rkv(m_is_use_adaptive_rkv_inputs) {
         OPENVINO_ASSERT(m_num_decoder_layers != 0, "num_decoder_layers must be non-zero");
         _reset_cache_rotation_coefficients();
+        for (const auto& input : m_request.get_compiled_model().inputs()) {
+            m_is_use_lora_slots |= input.get_names().count(MultiSlotAdapterController::SLOT_IDS_INPUT_NAME) > 0;
+        }
     }
 
     /**
@@ -277,6 +285,14 @@ public:
         ov::Tensor score_aggregation_window = _get_or_resize_tensor(m_cached_score_aggregation_window, "score_aggregation_window",
             {batch_size_in_sequences}, ov::element::i32);
 
+        ov::Tensor lora_slot_ids;
+        int32_t* lora_slot_ids_data = nullptr;
+        if (m_is_use_lora_slots) {
+            lora_slot_ids = _get_or_resize_tensor(m_cached_lora_slot_ids, MultiSlotAdapterController::SLOT_IDS_INPUT_NAME,
+                {total_num_tokens}, ov::element::i32);
+            lora_slot_ids_data = lora_slot_ids.data<int32_t>();
+        }
+
         ov::Tensor hidden_state_input = _prepare_hidden_state_input(total_num_tokens, hidden_size);
         float* hidden_state_data = nullptr;
         if (hidden_state_input) {
@@ -416,8 +432,7 @@ public:
                             sequence->get_generated_ids()[position_id - prompt_len];
                         position_ids_data[position_ids_idx] = position_id;
                     } else if (sequence_group_type == SequenceGroupType::EMBEDDINGS) {
-                        const auto& generated_embeds = sequence->get_generated_ids_embeds();
-                        const float* src = position_id < prompt_len ? sequence_group->get_input_embeds()[position_id].data() :  generated_embeds[position_id - prompt_len].data();
+                        const float* src = position_id < prompt_len ? sequence_group->get_input_embeds()[position_id].data() :  sequence->get_generated_ids_embed(position_id - prompt_len).data();
                         std::copy_n(src, hidden_size, inputs_embeds_data + token_id * hidden_size);
                         const auto& position_ids_elem = sequence->get_position_ids_list()[position_id];
                         const auto [begin, end] = Sequence::get_position_ids_elem_coordinates(position_ids_elem.get_shape(), position_ids_idx, false);
@@ -465,6 +480,11 @@ public:
 
                 block_indices_begins_data[1] = block_indices_begins_data[0] + num_blocks_utilized;
 
+                if (lora_slot_ids_data) {
+                    std::fill_n(lora_slot_ids_data, num_scheduled_tokens, sequence_group->get_adapter_slot());
+                    lora_slot_ids_data += num_scheduled_tokens;
+                }
+
                 // apply strides to shift to a next sequence
                 if (sequence_group_type == SequenceGroupType::TOKENS) {
                     input_ids_data += num_scheduled_tokens;
@@ -538,6 +558,9 @@ public:
         if (!m_cached_max_context_len) {
             m_request.set_tensor("max_context_len", max_context_len);
         }
+        if (m_is_use_lora_slots && !m_cached_lora_slot_ids) {
+            m_request.set_tensor(MultiSlotAdapterController::SLOT_IDS_INPUT_NAME, lora_slot_ids);
+        }
         if (m_is_use_rotation_inputs) {
             m_request.set_tensor("rotation_trig_lut", m_cache_rotation_trig_lut);
             _set_cache_rotation_coefficients(sequence_groups, scheduler_output);
@@ -608,7 +631,7 @@ public:
             size_t num_sequences = sequence_group->num_running_seqs();
             OPENVINO_ASSERT(sequence_group->get_sequence_group_type() == SequenceGroupType::EMBEDDINGS);
             for (auto seq: sequence_group->get_running_sequences()) {
-                num_generated_ids_without_embeddings += seq->get_generated_len() - seq->get_generated_ids_embeds().size();
+                num_generated_ids_without_embeddings += seq->get_generated_len() - seq->get_num_generated_ids_embeds();
             }
         }
         size_t hidden_size = sequence_groups[0]->get_hidden_size();
@@ -625,7 +648,7 @@ public:
             SequenceGroup::Ptr sequence_group = sequence_groups[seq_group_id];
             for (auto seq: sequence_group->get_running_sequences()) {
                 const auto& generated_ids = seq->get_generated_ids();
-                for (size_t token_idx = seq->get_generated_ids_embeds().size(); token_idx < generated_ids.size(); token_idx++) {
+                for (size_t token_idx = seq->get_num_generated_ids_embeds(); token_idx < generated_ids.size(); token_idx++) {
                     generated_ids_data[pos] = generated_ids[token_idx];
                     pos++;
 
@@ -646,7 +669,7 @@ public:
                 SequenceGroup::Ptr sequence_group = sequence_groups[seq_group_id];
                 for (auto seq: sequence_group->get_running_sequences()) {
                     auto generated_ids = seq->get_generated_ids();
-                    size_t new_embeds_count = seq->get_generated_len() - seq->get_generated_ids_embeds().size();
+                    size_t new_embeds_count = seq->get_generated_len() - seq->get_num_generated_ids_embeds();
                     ov::Coordinate start{0, embeds_pos, 0};
                     ov::Coordinate end{1, embeds_pos + new_embeds_count, hidden_size};
                     ov::Tensor embedding(generated_ids_embeds, start, end);
@@ -4,12 +4,28 @@
 #include "continuous_batching/pipeline_base.hpp"
 #include "visual_language/chat_history_state.hpp"
 #include "visual_language/vlm_chat_context.hpp"
+#include "continuous_batching/tracer.hpp"
 
 namespace ov::genai {
 
 template<class... Ts> struct overloaded : Ts... {using Ts::operator()...;};
 template<class... Ts> overloaded(Ts...) -> overloaded<Ts...>;
 
+namespace {
+
+// Number of KV-cache blocks a prompt would additionally occupy if pruned visual tokens were kept
+size_t get_saved_kv_blocks(size_t prompt_len, size_t pruned_tokens, size_t block_size) {
+    if (block_size == 0) {
+        return 0;
+    }
+    auto num_blocks = [block_size](size_t num_tokens) {
+        return (num_tokens + block_size - 1) / block_size;
+    };
+    return num_blocks(prompt_len + pruned_tokens) - num_blocks(prompt_len);
+}
+
+}  // namespace
+
 GenerationConfig ContinuousBatchingPipeline::IContinuousBatchingPipeline::get_config() const {
     return m_generation_config;
 }
@@ -19,7 +35,9 @@ void ContinuousBatchingPipeline::IContinuousBatchingPipeline::set_config(const G
 }
 
 PipelineMetrics ContinuousBatchingPipeline::IContinuousBatchingPipeline::get_metrics() const {
-    return m_pipeline_metrics;
+    PipelineMetrics metrics = m_pipeline_metrics;
+    m_metrics_collector->fill(metrics);
+    return metrics;
 }
 
 Tokenizer ContinuousBatchingPipeline::IContinuousBatchingPipeline::get_tokenizer() {
@@ -122,7 +140,11 @@ ContinuousBatchingPipeline::IContinuousBatchingPipeline::generate(
         generated.reserve(res.m_generation_ids.size());
         for (size_t idx = 0; idx < res.m_generation_ids.size(); ++idx) {
             const auto decode_start = std::chrono::steady_clock::now();
-            generated.push_back(m_tokenizer.decode(res.m_generation_ids.at(idx)));
+            {
+                tracing::TraceSpan span("detokenize");
+                span.arg("request_id", res.m_request_id).arg("tokens", res.m_generation_ids.at(idx).size());
+                generated.push_back(m_tokenizer.decode(res.m_generation_ids.at(idx)));
+            }
             raw_counters.detokenization_durations.emplace_back(std::chrono::steady_clock::now() - decode_start);
             if (m_is_chat_conversation && 0 == idx && res.m_status != ov::genai::GenerationStatus::CANCEL) {
                 m_history.push_back({{"role", "assistant"}, {"content", generated.back()}});
@@ -216,7 +238,11 @@ ContinuousBatchingPipeline::IContinuousBatchingPipeline::generate(
         decoded_outputs.reserve(encoded_result.m_generation_ids.size());
         for (size_t idx = 0; idx < encoded_result.m_generation_ids.size(); ++idx) {
             const auto decode_start = std::chrono::steady_clock::now();
-            decoded_outputs.push_back(m_tokenizer.decode(encoded_result.m_generation_ids.at(idx)));
+            {
+                tracing::TraceSpan span("detokenize");
+                span.arg("request_id", encoded_result.m_request_id).arg("tokens", encoded_result.m_generation_ids.at(idx).size());
+                decoded_outputs.push_back(m_tokenizer.decode(encoded_result.m_generation_ids.at(idx)));
+            }
 
             raw_counters.detokenization_durations.emplace_back(std::chrono::steady_clock::now() - decode_start);
         }
@@ -284,10 +310,10 @@ ContinuousBatchingPipeline::IContinuousBatchingPipeline::generate(
         const auto& prompt = prompts[0];
         auto start_get_inputs_embeds = std::chrono::steady_clock::now();
 
-        encoded_images = m_inputs_embedder->encode_images(images_vector[0]);
+        encoded_images = m_inputs_embedder->encode_images(images_vector[0], vlm_perf_metrics[0]);
         m_history_images.insert(m_history_images.end(), encoded_images.begin(), encoded_images.end());
 
-        encoded_videos = m_inputs_embedder->encode_videos(videos_vector[0]);
+        encoded_videos = m_inputs_embedder->encode_videos(videos_vector[0], vlm_perf_metrics[0]);
         m_history_videos.insert(m_history_videos.end(), encoded_videos.begin(), encoded_videos.end());
 
         auto [unified_prompt, image_sequence, video_sequence] = m_inputs_embedder->normalize_prompt(prompt, m_image_id, m_video_id, encoded_images, encoded_videos);
@@ -333,8 +359,8 @@ ContinuousBatchingPipeline::IContinuousBatchingPipeline::generate(
             
             auto images_to_encode = images_vector.size() > 0 ? images_vector[i] : std::vector<ov::Tensor>{};
             auto videos_to_encode = videos_vector.size() > 0 ? videos_vector[i] : std::vector<ov::Tensor>{};
-            const auto encoded_images = m_inputs_embedder->encode_images(images_to_encode);
-            const auto encoded_videos = m_inputs_embedder->encode_videos(videos_to_encode);
+            const auto encoded_images = m_inputs_embedder->encode_images(images_to_encode, vlm_perf_metrics[i]);
+            const auto encoded_videos = m_inputs_embedder->encode_videos(videos_to_encode, vlm_perf_metrics[i]);
 
             auto [unified_prompt, image_sequence, video_sequence] = m_inputs_embedder->normalize_prompt(prompt, m_image_id, m_video_id, encoded_images, encoded_videos);
 
@@ -367,13 +393,20 @@ ContinuousBatchingPipeline::IContinuousBatchingPipeline::generate(
         gen_result.perf_metrics = result.perf_metrics;
 
         gen_result.perf_metrics.vlm_raw_metrics = vlm_perf_metrics[i].vlm_raw_metrics;
+        gen_result.perf_metrics.vlm_raw_metrics.saved_kv_blocks = get_saved_kv_blocks(input_embeds_list[i].get_shape()[1],
+                                                                                      vlm_perf_metrics[i].vlm_raw_metrics.pruned_vision_tokens,
+                                                                                      get_block_size());
         gen_result.perf_metrics.raw_metrics.tokenization_durations = vlm_perf_metrics[i].raw_metrics.tokenization_durations;
         gen_result.perf_metrics.raw_metrics.detokenization_durations = vlm_perf_metrics[i].raw_metrics.detokenization_durations;
         
         auto decode_start_time = std::chrono::steady_clock::now();
-        for (size_t idx = 0; idx < result.m_generation_ids.size(); ++idx) {
-            gen_result.texts.push_back(m_tokenizer.decode(result.m_generation_ids.at(idx)));
-            gen_result.scores.push_back(result.m_scores.at(idx));
+        {
+            tracing::TraceSpan span("detokenize");
+            span.arg("request_id", result.m_request_id).arg("sequences", result.m_generation_ids.size());
+            for (size_t idx = 0; idx < result.m_generation_ids.size(); ++idx) {
+                gen_result.texts.push_back(m_tokenizer.decode(result.m_generation_ids.at(idx)));
+                gen_result.scores.push_back(result.m_scores.at(idx));
+            }
         }
         auto decode_end_time = std::chrono::steady_clock::now();
         gen_result.perf_metrics.raw_metrics.detokenization_durations.emplace_back(PerfMetrics::get_microsec(decode_end_time - decode_start_time));
@@ -438,6 +471,11 @@ ContinuousBatchingPipeline::IContinuousBatchingPipeline::generate(
     std::vector<VLMPerfMetrics> vlm_perf_metrics(histories.size());
     bool recalculate_merged_embeddings = images_vector.size() > 0 || videos_vector.size() > 0;
 
+    const auto& generation_config = sampling_params[0];
+    // Set visual token pruning configuration
+    m_inputs_embedder->set_vision_token_pruning_config(generation_config.pruning_ratio,
+                                                       generation_config.relevance_weight);
+
     std::vector<VLMChatContext> chat_contexts;
     chat_contexts.reserve(histories.size());
 
@@ -450,7 +488,7 @@ ContinuousBatchingPipeline::IContinuousBatchingPipeline::generate(
         VLMChatContext chat_context(histories[i], m_vision_registry, *m_inputs_embedder);
         chat_contexts.push_back(std::move(chat_context));
     
-        auto processed_chat_data = chat_contexts[i].process(images_vector[i], videos_vector[i]);
+        auto processed_chat_data = chat_contexts[i].process(images_vector[i], videos_vector[i], vlm_perf_metrics[i]);
     
         std::string templated_history = m_tokenizer.apply_chat_template(
             processed_chat_data.normalized_history,
@@ -496,13 +534,20 @@ ContinuousBatchingPipeline::IContinuousBatchingPipeline::generate(
         gen_result.perf_metrics = result.perf_metrics;
     
         gen_result.perf_metrics.vlm_raw_metrics = vlm_perf_metrics[i].vlm_raw_metrics;
+        gen_result.perf_metrics.vlm_raw_metrics.saved_kv_blocks = get_saved_kv_blocks(input_embeds_list[i].get_shape()[1],
+                                                                                      vlm_perf_metrics[i].vlm_raw_metrics.pruned_vision_tokens,
+                                                                                      get_block_size());
         gen_result.perf_metrics.raw_metrics.tokenization_durations = vlm_perf_metrics[i].raw_metrics.tokenization_durations;
         gen_result.perf_metrics.raw_metrics.detokenization_durations = vlm_perf_metrics[i].raw_metrics.detokenization_durations;
         
         auto decode_start_time = std::chrono::steady_clock::now();
-        for (size_t idx = 0; idx < result.m_generation_ids.size(); ++idx) {
-            gen_result.texts.push_back(m_tokenizer.decode(result.m_generation_ids.at(idx)));
-            gen_result.scores.push_back(result.m_scores.at(idx));
+        {
+            tracing::TraceSpan span("detokenize");
+            span.arg("request_id", result.m_request_id).arg("sequences", result.m_generation_ids.size());
+            for (size_t idx = 0; idx < result.m_generation_ids.size(); ++idx) {
+                gen_result.texts.push_back(m_tokenizer.decode(result.m_generation_ids.at(idx)));
+                gen_result.scores.push_back(result.m_scores.at(idx));
+            }
         }
         auto decode_end_time = std::chrono::steady_clock::now();
         gen_result.perf_metrics.raw_metrics.detokenization_durations.emplace_back(PerfMetrics::get_microsec(decode_end_time - decode_start_time));
@@ -534,7 +579,8 @@ ContinuousBatchingPipeline::IContinuousBatchingPipeline::add_request(uint64_t re
     {
         std::lock_guard<std::mutex> lock(m_embeddings_mutex);
         m_inputs_embedder->set_apply_chat_template_status(sampling_params.apply_chat_template);
-        const auto encoded_images = m_inputs_embedder->encode_images(rgbs);
+        m_inputs_embedder->set_vision_token_pruning_config(sampling_params.pruning_ratio, sampling_params.relevance_weight);
+        const auto encoded_images = m_inputs_embedder->encode_images(rgbs, metrics);
 
         const auto [unified_prompt, image_sequence, video_sequence] = m_inputs_embedder->normalize_prompt(prompt, 0, encoded_images);
         if (m_inputs_embedder->has_token_type_ids()) {
@@ -542,8 +588,10 @@ ContinuousBatchingPipeline::IContinuousBatchingPipeline::add_request(uint64_t re
         } else {
             inputs = m_inputs_embedder->get_inputs_embeds(unified_prompt, encoded_images, metrics, true, image_sequence);
         }
+        // position ids of (possibly pruned) embeddings are taken from the inputs embedder state,
+        // so the request has to be added before another request recomputes them
+        return add_request(request_id, inputs, sampling_params, token_type_ids);
     }
-    return add_request(request_id, inputs, sampling_params, token_type_ids);
 }
 
 GenerationHandle
@@ -559,13 +607,16 @@ ContinuousBatchingPipeline::IContinuousBatchingPipeline::add_request(
     {
         std::lock_guard<std::mutex> lock(m_embeddings_mutex);
         m_inputs_embedder->set_apply_chat_template_status(sampling_params.apply_chat_template);
-        const auto encoded_images = m_inputs_embedder->encode_images(images);
-        const auto encoded_videos = m_inputs_embedder->encode_videos(videos);
+        m_inputs_embedder->set_vision_token_pruning_config(sampling_params.pruning_ratio, sampling_params.relevance_weight);
+        const auto encoded_images = m_inputs_embedder->encode_images(images, metrics);
+        const auto encoded_videos = m_inputs_embedder->encode_videos(videos, metrics);
 
         const auto [unified_prompt, image_sequence, video_sequence] = m_inputs_embedder->normalize_prompt(prompt, 0, 0, encoded_images, encoded_videos);
         inputs = m_inputs_embedder->get_inputs_embeds(unified_prompt, encoded_images, encoded_videos, metrics, true, image_sequence, video_sequence);
+        // position ids of (possibly pruned) embeddings are taken from the inputs embedder state,
+        // so the request has to be added before another request recomputes them
+        return add_request(request_id, inputs, std::move(sampling_params));
     }
-    return add_request(request_id, inputs, std::move(sampling_params));
 }
 
 void ContinuousBatchingPipeline::IContinuousBatchingPipeline::stream_tokens(
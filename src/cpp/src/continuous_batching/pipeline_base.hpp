@@ -12,6 +12,7 @@
 #include "continuous_batching/model_runner.hpp"
 #include "continuous_batching/scheduler.hpp"
 #include "continuous_batching/threaded_streamer.hpp"
+#include "continuous_batching/pipeline_metrics.hpp"
 
 namespace ov::genai {
 
@@ -33,6 +34,8 @@ protected:
     GenerationConfig m_generation_config;
 
     PipelineMetrics m_pipeline_metrics;
+    // histograms and counters added to m_pipeline_metrics by get_metrics()
+    std::shared_ptr<PipelineMetricsCollector> m_metrics_collector = std::make_shared<PipelineMetricsCollector>();
 
     std::string m_device;
 
@@ -71,12 +74,23 @@ protected:
     std::shared_ptr<VisionRegistry> m_vision_registry;
 
     void stream_tokens(const std::shared_ptr<ThreadedStreamerWrapper>& streamer_ptr, const GenerationHandle& handle);
+
+    /**
+     * Returns number of tokens in a KV-cache block, 0 if it's not known to the pipeline
+     */
+    virtual size_t get_block_size() const {
+        return 0;
+    }
 public:
     GenerationConfig get_config() const;
     void set_config(const GenerationConfig& config);
     PipelineMetrics get_metrics() const;
     Tokenizer get_tokenizer();
 
+    std::shared_ptr<PipelineMetricsCollector> get_metrics_collector() const {
+        return m_metrics_collector;
+    }
+
     /**
      * Adds requests to awaiting queue using encoded inputs
      */
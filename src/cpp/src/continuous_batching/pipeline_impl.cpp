@@ -20,6 +20,7 @@
 #include "continuous_batching/paged_attention_transformations.hpp"
 #include "lora/helper.hpp"
 #include "continuous_batching/cache_state_dumper.hpp"
+#include "continuous_batching/tracer.hpp"
 
 namespace {
 
@@ -115,8 +116,25 @@ ContinuousBatchingPipeline::ContinuousBatchingImpl::~ContinuousBatchingImpl() {
 
 void ContinuousBatchingPipeline::ContinuousBatchingImpl::_pull_awaiting_requests() {
     std::lock_guard<std::mutex> lock{m_awaiting_requests_mutex};
-    m_requests.insert(m_requests.end(), m_awaiting_requests.begin(), m_awaiting_requests.end());
-    m_awaiting_requests.clear();
+    std::vector<SequenceGroup::Ptr> still_awaiting;
+    for (const auto& request : m_awaiting_requests) {
+        const auto& adapters = request->get_sampling_parameters().adapters;
+        if (m_adapter_slots && adapters && *adapters) {
+            // a request waits until running requests release slots, requests behind it are pulled if they fit
+            auto slot = m_adapter_slots->acquire(*adapters);
+            if (!slot) {
+                still_awaiting.push_back(request);
+                continue;
+            }
+            request->set_adapter_slot(static_cast<int32_t>(*slot));
+        }
+        if (tracing::Tracer::is_enabled()) {
+            tracing::trace_instant("admit", {{"request_id", static_cast<int64_t>(request->get_request_id())},
+                                             {"prompt_len", static_cast<int64_t>(request->get_prompt_len())}});
+        }
+        m_requests.push_back(request);
+    }
+    m_awaiting_requests = std::move(still_awaiting);
     m_pipeline_metrics.requests = m_requests.size();
 }
 
@@ -128,9 +146,23 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::initialize_pipeline(
     m_device = device;
     // apply LoRA
     auto filtered_properties = extract_adapters_from_properties(properties, &m_generation_config.adapters);
+    // Extract lora_num_slots property if exists and remove it from properties
+    size_t lora_num_slots = 0;
+    auto lora_num_slots_it = filtered_properties->find(ov::genai::lora_num_slots.name());
+    if (lora_num_slots_it != filtered_properties->end()) {
+        lora_num_slots = lora_num_slots_it->second.as<size_t>();
+        filtered_properties.fork().erase(ov::genai::lora_num_slots.name());
+    }
     if (m_generation_config.adapters) {
         m_generation_config.adapters->set_tensor_name_prefix("base_model.model.");
-        m_adapter_controller = AdapterController(model, *m_generation_config.adapters, device);   // TODO: Make the prefix name configurable
+        if (lora_num_slots > 0) {
+            // adapters passed to the pipeline are the ones that can be served, each request selects its own adapters
+            // and a request without adapters uses the base model
+            m_adapter_slots = std::make_shared<MultiSlotAdapterController>(model, *m_generation_config.adapters, lora_num_slots);
+            m_generation_config.adapters.reset();
+        } else {
+            m_adapter_controller = AdapterController(model, *m_generation_config.adapters, device);   // TODO: Make the prefix name configurable
+        }
     }
     // Extract sampler_num_threads property if exists and remove it from properties
     size_t sampler_num_threads = std::thread::hardware_concurrency();
@@ -283,20 +315,27 @@ ContinuousBatchingPipeline::ContinuousBatchingImpl::add_request(
     std::shared_ptr<SequenceGroup> sequence_group;
     if (m_model_input_type == ModelInputType::EMBEDDINGS) {
         const auto [position_ids, rope_delta] = m_inputs_embedder->get_position_ids(input_ids.get_shape()[1], 0);
-        sequence_group = std::make_shared<SequenceGroup>(request_id, 
-                                                         input_ids, 
-                                                         sampling_params_copy, 
-                                                         m_block_size, 
-                                                         token_type_ids, 
-                                                         position_ids, 
-                                                         rope_delta);
+        sequence_group = SequenceGroup::create(request_id,
+                                               input_ids,
+                                               sampling_params_copy,
+                                               m_block_size,
+                                               token_type_ids,
+                                               position_ids,
+                                               rope_delta);
     }
     else {
-        sequence_group = std::make_shared<SequenceGroup>(request_id, input_ids, sampling_params_copy, m_block_size, token_type_ids);
+        sequence_group = SequenceGroup::create(request_id, input_ids, sampling_params_copy, m_block_size, token_type_ids);
+    }
+
+    if (m_adapter_slots && sampling_params_copy.adapters && *sampling_params_copy.adapters) {
+        sequence_group->set_adapter_config_id(m_adapter_slots->get_config_id(*sampling_params_copy.adapters));
     }
 
     if (m_scheduler->get_config().enable_prefix_caching) {
-        m_scheduler->restore_cached_blocks(sequence_group);
+        const size_t num_restored_blocks = m_scheduler->restore_cached_blocks(sequence_group);
+        const size_t num_prompt_blocks = (sequence_group->get_prompt_len() + m_block_size - 1) / m_block_size;
+        m_metrics_collector->prefix_cache_hits += num_restored_blocks;
+        m_metrics_collector->prefix_cache_misses += num_prompt_blocks - num_restored_blocks;
     }
 
     {
@@ -336,22 +375,37 @@ bool ContinuousBatchingPipeline::ContinuousBatchingImpl::has_non_finished_reques
 void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
     static ManualTimer step_timer("step()");
     step_timer.start();
+    tracing::TraceSpan step_span("step");
+    const auto step_start = std::chrono::steady_clock::now();
 
     _pull_awaiting_requests();
+    if (m_adapter_slots) {
+        m_adapter_slots->apply(m_model_runner->get_infer_request());
+    }
 
     Scheduler::Output scheduler_output;
 
     {
         static ManualTimer scheduling_timer("scheduling");
         scheduling_timer.start();
-        scheduler_output = m_scheduler->schedule(m_requests);
+        {
+            tracing::TraceSpan span("schedule");
+            scheduler_output = m_scheduler->schedule(m_requests);
+            span.arg("running_requests", m_requests.size())
+                .arg("scheduled_requests", scheduler_output.m_scheduled_sequence_groups_ids.size())
+                .arg("scheduled_tokens", scheduler_output.m_total_num_scheduled_tokens)
+                .arg("is_prompt", scheduler_output.is_prompt);
+        }
         scheduling_timer.end();
+        tracing::trace_counter("requests", m_requests.size());
+        tracing::trace_counter("cache_usage_percent", static_cast<int64_t>(scheduler_output.m_cache_usage));
 
         m_pipeline_metrics.scheduled_requests = scheduler_output.m_scheduled_sequence_groups_ids.size();
         m_pipeline_metrics.cache_usage = scheduler_output.m_cache_usage;
         m_pipeline_metrics.max_cache_usage = std::max(m_pipeline_metrics.max_cache_usage, scheduler_output.m_cache_usage);
         _register_step_cache_usage(scheduler_output.m_cache_usage);
         m_pipeline_metrics.avg_cache_usage = _get_current_running_average_cache_usage();
+        _register_scheduled_requests_metrics(scheduler_output);
 
         const auto& sched_config = m_scheduler->get_config();
         if (sched_config.use_cache_eviction) {
@@ -382,6 +436,9 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
         static ManualTimer timer("forward");
         const auto infer_start = std::chrono::steady_clock::now();
         timer.start();
+        tracing::TraceSpan span("forward");
+        span.arg("scheduled_requests", scheduler_output.m_scheduled_sequence_groups_ids.size())
+            .arg("scheduled_tokens", scheduler_output.m_total_num_scheduled_tokens);
         logits = m_model_runner->forward(m_requests, scheduler_output);
         const auto infer_end = std::chrono::steady_clock::now();
         m_pipeline_metrics.inference_duration = PerfMetrics::get_microsec(infer_end - infer_start);
@@ -412,8 +469,13 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
     {
         static ManualTimer timer("sample");
         timer.start();
+        tracing::TraceSpan span("sample");
         sampler_output = m_sampler->sample(m_requests, logits, m_is_validation_mode_enabled);
         m_batch_size = sampler_output.num_generated_tokens;
+        span.arg("generated_tokens", m_batch_size)
+            .arg("forked_sequences", sampler_output.m_forked_sequences.size())
+            .arg("dropped_sequences", sampler_output.m_dropped_sequences.size());
+        _register_generated_tokens_metrics(scheduler_output);
         timer.end();
     }
 
@@ -456,6 +518,7 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
         clean_up_requests_timer.end();
     }
 
+    m_metrics_collector->step_duration_ms.observe(PerfMetrics::get_microsec(std::chrono::steady_clock::now() - step_start) / 1000.0);
     step_timer.end();
 }
 
@@ -488,12 +551,14 @@ ContinuousBatchingPipeline::ContinuousBatchingImpl::generate(const std::vector<o
     auto& raw_perf_counters = perf_metrics.raw_metrics;
     raw_perf_counters.m_inference_durations =  {{ MicroSeconds(0.0f) }};
 
-    // checks that all requests has the same LoRA adapters property value
-    for (size_t i = 1; i < sampling_params.size(); ++i) {
-        OPENVINO_ASSERT(sampling_params[i - 1].adapters == sampling_params[i].adapters,
-            "LoRA adapters value must be the same for all requests");
+    // checks that all requests has the same LoRA adapters property value, unless adapters are selected per request
+    if (!m_adapter_slots) {
+        for (size_t i = 1; i < sampling_params.size(); ++i) {
+            OPENVINO_ASSERT(sampling_params[i - 1].adapters == sampling_params[i].adapters,
+                "LoRA adapters value must be the same for all requests");
+        }
+        set_adapters(sampling_params[0].adapters);
     }
-    set_adapters(sampling_params[0].adapters);
 
     const auto streamer_ptr = std::make_shared<ThreadedStreamerWrapper>(streamer, m_tokenizer);
 
@@ -618,6 +683,10 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::_free_non_running_reque
                 }
             }
             m_sampler->clear_request_info(request->get_request_id());
+            _release_adapter_slot(request);
+            tracing::trace_instant("finish", {{"request_id", static_cast<int64_t>(request->get_request_id())},
+                                              {"processed_tokens", static_cast<int64_t>(request->get_num_processed_tokens())},
+                                              {"out_of_memory", request->out_of_memory()}});
             requests_iterator = m_requests.erase(requests_iterator);
         } else {
             requests_iterator++;
@@ -634,6 +703,48 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::_notify_requests_droppe
     }
 }
 
+void ContinuousBatchingPipeline::ContinuousBatchingImpl::_register_scheduled_requests_metrics(const Scheduler::Output& scheduler_output) {
+    const auto now = std::chrono::steady_clock::now();
+    m_metrics_collector->batch_size.observe(scheduler_output.m_scheduled_sequence_groups_ids.size());
+    m_metrics_collector->preemptions += scheduler_output.m_num_preemptions;
+    m_metrics_collector->recomputed_tokens += scheduler_output.m_num_preempted_tokens;
+    m_metrics_collector->prefix_cache_hits += scheduler_output.m_num_restored_blocks;
+    for (size_t seq_group_id : scheduler_output.m_scheduled_sequence_groups_ids) {
+        const auto& sequence_group = m_requests[seq_group_id];
+        if (!sequence_group->get_first_schedule_time()) {
+            sequence_group->set_first_schedule_time(now);
+            m_metrics_collector->queue_wait_ms.observe(PerfMetrics::get_microsec(now - sequence_group->get_arrival_time()) / 1000.0);
+        }
+        if (sequence_group->get_num_processed_tokens() < sequence_group->get_prompt_len()) {
+            m_metrics_collector->prefill_chunk_size.observe(sequence_group->get_num_scheduled_tokens());
+        }
+    }
+}
+
+void ContinuousBatchingPipeline::ContinuousBatchingImpl::_register_generated_tokens_metrics(const Scheduler::Output& scheduler_output) {
+    const auto now = std::chrono::steady_clock::now();
+    for (size_t seq_group_id : scheduler_output.m_scheduled_sequence_groups_ids) {
+        const auto& sequence_group = m_requests[seq_group_id];
+        size_t num_generated_tokens = 0;
+        for (const auto& sequence : sequence_group->get_sequences()) {
+            num_generated_tokens = std::max(num_generated_tokens, sequence->get_generated_len());
+        }
+        // the number can decrease when speculative decoding candidates are rejected
+        if (num_generated_tokens > sequence_group->get_num_timed_tokens()) {
+            const auto& last_token_time = sequence_group->get_last_token_time();
+            if (!last_token_time) {
+                m_metrics_collector->ttft_ms.observe(PerfMetrics::get_microsec(now - sequence_group->get_arrival_time()) / 1000.0);
+            } else {
+                const size_t num_new_tokens = num_generated_tokens - sequence_group->get_num_timed_tokens();
+                m_metrics_collector->tpot_ms.observe(PerfMetrics::get_microsec(now - *last_token_time) / 1000.0 / num_new_tokens);
+            }
+            sequence_group->set_last_token_time(now, num_generated_tokens);
+        } else if (num_generated_tokens < sequence_group->get_num_timed_tokens() && sequence_group->get_last_token_time()) {
+            sequence_group->set_last_token_time(*sequence_group->get_last_token_time(), num_generated_tokens);
+        }
+    }
+}
+
 void ContinuousBatchingPipeline::ContinuousBatchingImpl::_register_step_cache_usage(float step_cache_usage) {
     if (m_previous_step_cache_usages.size() >= AVG_CACHE_USAGE_WINDOW_SIZE_IN_STEPS) {
         m_previous_step_cache_usages.pop_front();
@@ -659,10 +770,18 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::drop_requests() {
             }
         }
         m_sampler->clear_request_info(request->get_request_id());
+        _release_adapter_slot(request);
     }
     m_requests.clear();
 }
 
+void ContinuousBatchingPipeline::ContinuousBatchingImpl::_release_adapter_slot(const SequenceGroup::Ptr& request) {
+    if (m_adapter_slots && request->get_adapter_slot() != MultiSlotAdapterController::NO_SLOT) {
+        m_adapter_slots->release(static_cast<size_t>(request->get_adapter_slot()));
+        request->set_adapter_slot(MultiSlotAdapterController::NO_SLOT);
+    }
+}
+
 void ContinuousBatchingPipeline::ContinuousBatchingImpl::_compute_cache_rotation_data(const std::vector<SequenceGroup::Ptr>& sequence_groups,
         const Scheduler::Output& scheduler_output) {
     size_t num_sequence_groups = scheduler_output.m_scheduled_sequence_groups_ids.size();
@@ -806,6 +925,7 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::_maybe_evict_cache_bloc
         auto seq_group_ptr = seq_group_ptr_and_num_blocks_evicted.first;
         auto num_blocks_evicted = seq_group_ptr_and_num_blocks_evicted.second;
         seq_group_ptr->register_token_eviction(num_blocks_evicted * m_block_size);
+        m_metrics_collector->evicted_tokens += num_blocks_evicted * m_block_size;
     }
 }
 
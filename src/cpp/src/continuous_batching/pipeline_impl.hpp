@@ -6,6 +6,7 @@
 #include "continuous_batching/pipeline_base.hpp"
 
 #include "openvino/genai/lora_adapter.hpp"
+#include "lora/multi_slot_adapter_controller.hpp"
 #include "continuous_batching/cache_eviction.hpp"
 #include "visual_language/inputs_embedder.hpp"
 
@@ -16,6 +17,8 @@ protected:
     std::shared_ptr<Scheduler> m_scheduler;
     std::shared_ptr<ModelRunner> m_model_runner;
     std::optional<AdapterController> m_adapter_controller;
+    // used instead of m_adapter_controller when requests with different adapters are batched together
+    std::shared_ptr<MultiSlotAdapterController> m_adapter_slots;
     std::shared_ptr<Sampler> m_sampler;
 
     // current requests to process
@@ -75,6 +78,11 @@ protected:
      */
     void _free_non_running_requests();
 
+    /**
+     * Releases LoRA slot used by a request when adapters are selected per request
+     */
+    void _release_adapter_slot(const SequenceGroup::Ptr& request);
+
     /**
      * Notify dropped requests by pushing empty output
      */
@@ -91,6 +99,16 @@ protected:
     void _maybe_evict_cache_blocks(const SchedulerConfig& sched_config, const Scheduler::Output& scheduler_output);
 
 
+    /**
+     * Updates queue wait, prefill chunk and batch size metrics with requests scheduled at the current step
+     */
+    void _register_scheduled_requests_metrics(const Scheduler::Output& scheduler_output);
+
+    /**
+     * Updates TTFT and TPOT metrics with tokens generated at the current step
+     */
+    void _register_generated_tokens_metrics(const Scheduler::Output& scheduler_output);
+
     void _register_step_cache_usage(float step_cache_usage);
     void _reset_cache_usage_statistics();
     float _get_current_running_average_cache_usage() const;
@@ -100,6 +118,10 @@ protected:
 
     virtual void drop_requests();
 
+    size_t get_block_size() const override {
+        return m_block_size;
+    }
+
 public:
     ContinuousBatchingImpl(const std::shared_ptr<ov::Model>& model,
                            const Tokenizer& tokenizer,
@@ -0,0 +1,156 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "continuous_batching/pipeline_metrics.hpp"
+
+#include <algorithm>
+#include <sstream>
+
+#include "openvino/core/except.hpp"
+
+namespace ov::genai {
+
+namespace {
+
+std::vector<float> get_latency_ms_bounds() {
+    return {1.0f, 2.5f, 5.0f, 10.0f, 25.0f, 50.0f, 100.0f, 250.0f, 500.0f, 1000.0f, 2500.0f, 5000.0f, 10000.0f, 30000.0f, 60000.0f};
+}
+
+std::vector<float> get_size_bounds(float max_bound) {
+    std::vector<float> bounds;
+    for (float bound = 1.0f; bound <= max_bound; bound *= 2.0f) {
+        bounds.push_back(bound);
+    }
+    return bounds;
+}
+
+void write_counter(std::ostream& stream, const std::string& name, const char* help, size_t value) {
+    stream << "# HELP " << name << "_total " << help << "\n"
+           << "# TYPE " << name << "_total counter\n"
+           << name << "_total " << value << "\n";
+}
+
+void write_gauge(std::ostream& stream, const std::string& name, const char* help, double value) {
+    stream << "# HELP " << name << " " << help << "\n"
+           << "# TYPE " << name << " gauge\n"
+           << name << " " << value << "\n";
+}
+
+// scale converts observed values to units of the exported metric, e.g. milliseconds to seconds
+void write_histogram(std::ostream& stream, const std::string& name, const char* help, const MetricHistogram& histogram, double scale) {
+    stream << "# HELP " << name << " " << help << "\n"
+           << "# TYPE " << name << " histogram\n";
+    size_t cumulative_count = 0;
+    for (size_t i = 0; i < histogram.upper_bounds.size(); ++i) {
+        cumulative_count += histogram.counts[i];
+        stream << name << "_bucket{le=\"" << histogram.upper_bounds[i] * scale << "\"} " << cumulative_count << "\n";
+    }
+    stream << name << "_bucket{le=\"+Inf\"} " << histogram.count << "\n"
+           << name << "_sum " << histogram.sum * scale << "\n"
+           << name << "_count " << histogram.count << "\n";
+}
+
+}  // namespace
+
+float MetricHistogram::get_mean() const {
+    return count == 0 ? 0.0f : static_cast<float>(sum / count);
+}
+
+float MetricHistogram::get_quantile(float quantile) const {
+    if (count == 0 || upper_bounds.empty()) {
+        return 0.0f;
+    }
+    const double rank = std::clamp(quantile, 0.0f, 1.0f) * static_cast<double>(count);
+    size_t cumulative_count = 0;
+    for (size_t i = 0; i < upper_bounds.size(); ++i) {
+        if (counts[i] > 0 && cumulative_count + counts[i] >= rank) {
+            const float lower_bound = i == 0 ? 0.0f : upper_bounds[i - 1];
+            const double fraction = (rank - cumulative_count) / counts[i];
+            return static_cast<float>(lower_bound + (upper_bounds[i] - lower_bound) * fraction);
+        }
+        cumulative_count += counts[i];
+    }
+    // values above the last bound are not limited, so the bound is the best estimate
+    return upper_bounds.back();
+}
+
+AtomicHistogram::AtomicHistogram(std::vector<float> upper_bounds)
+    : m_upper_bounds(std::move(upper_bounds)),
+      m_counts(new std::atomic<size_t>[m_upper_bounds.size() + 1]()) {
+    OPENVINO_ASSERT(std::is_sorted(m_upper_bounds.begin(), m_upper_bounds.end()), "Histogram bounds must be sorted");
+}
+
+void AtomicHistogram::observe(double value) {
+    const size_t bucket = std::lower_bound(m_upper_bounds.begin(), m_upper_bounds.end(), value) - m_upper_bounds.begin();
+    m_counts[bucket].fetch_add(1, std::memory_order_relaxed);
+    double sum = m_sum.load(std::memory_order_relaxed);
+    while (!m_sum.compare_exchange_weak(sum, sum + value, std::memory_order_relaxed)) {
+    }
+}
+
+MetricHistogram AtomicHistogram::snapshot() const {
+    MetricHistogram histogram;
+    histogram.upper_bounds = m_upper_bounds;
+    histogram.counts.resize(m_upper_bounds.size() + 1);
+    for (size_t i = 0; i < histogram.counts.size(); ++i) {
+        histogram.counts[i] = m_counts[i].load(std::memory_order_relaxed);
+        // count is derived from buckets, so it is consistent with them while observations are added concurrently
+        histogram.count += histogram.counts[i];
+    }
+    histogram.sum = m_sum.load(std::memory_order_relaxed);
+    return histogram;
+}
+
+PipelineMetricsCollector::PipelineMetricsCollector()
+    : ttft_ms(get_latency_ms_bounds()),
+      tpot_ms(get_latency_ms_bounds()),
+      queue_wait_ms(get_latency_ms_bounds()),
+      prefill_chunk_size(get_size_bounds(32768.0f)),
+      batch_size(get_size_bounds(1024.0f)),
+      step_duration_ms(get_latency_ms_bounds()) {}
+
+void PipelineMetricsCollector::fill(PipelineMetrics& metrics) const {
+    metrics.ttft_ms = ttft_ms.snapshot();
+    metrics.tpot_ms = tpot_ms.snapshot();
+    metrics.queue_wait_ms = queue_wait_ms.snapshot();
+    metrics.prefill_chunk_size = prefill_chunk_size.snapshot();
+    metrics.batch_size = batch_size.snapshot();
+    metrics.step_duration_ms = step_duration_ms.snapshot();
+
+    metrics.preemptions = preemptions.load(std::memory_order_relaxed);
+    metrics.recomputed_tokens = recomputed_tokens.load(std::memory_order_relaxed);
+    metrics.prefix_cache_hits = prefix_cache_hits.load(std::memory_order_relaxed);
+    metrics.prefix_cache_misses = prefix_cache_misses.load(std::memory_order_relaxed);
+    metrics.evicted_tokens = evicted_tokens.load(std::memory_order_relaxed);
+    metrics.draft_tokens = draft_tokens.load(std::memory_order_relaxed);
+    metrics.accepted_draft_tokens = accepted_draft_tokens.load(std::memory_order_relaxed);
+}
+
+std::string to_prometheus_text(const PipelineMetrics& metrics, const std::string& prefix) {
+    std::ostringstream stream;
+    const std::string name = prefix.empty() ? "" : prefix + "_";
+
+    write_gauge(stream, name + "requests", "Number of requests to be processed by the pipeline.", metrics.requests);
+    write_gauge(stream, name + "scheduled_requests", "Number of requests scheduled at the previous step.", metrics.scheduled_requests);
+    write_gauge(stream, name + "cache_usage_percent", "KV cache usage at the previous step.", metrics.cache_usage);
+    write_gauge(stream, name + "max_cache_usage_percent", "Max KV cache usage during the last generate() call.", metrics.max_cache_usage);
+    write_gauge(stream, name + "avg_cache_usage_percent", "Running average of KV cache usage during the last generate() call.", metrics.avg_cache_usage);
+
+    write_histogram(stream, name + "time_to_first_token_seconds", "Time from adding a request to its first token.", metrics.ttft_ms, 1e-3);
+    write_histogram(stream, name + "time_per_output_token_seconds", "Time per output token after the first one.", metrics.tpot_ms, 1e-3);
+    write_histogram(stream, name + "queue_wait_seconds", "Time from adding a request to its first scheduling.", metrics.queue_wait_ms, 1e-3);
+    write_histogram(stream, name + "prefill_chunk_tokens", "Prompt tokens of a request scheduled at a step.", metrics.prefill_chunk_size, 1.0);
+    write_histogram(stream, name + "batch_size_requests", "Requests scheduled at a step.", metrics.batch_size, 1.0);
+    write_histogram(stream, name + "step_duration_seconds", "Duration of generation steps.", metrics.step_duration_ms, 1e-3);
+
+    write_counter(stream, name + "preemptions", "Preemptions of requests to free KV cache blocks.", metrics.preemptions);
+    write_counter(stream, name + "recomputed_tokens", "Processed tokens dropped by preemption.", metrics.recomputed_tokens);
+    write_counter(stream, name + "prefix_cache_hits", "Prompt KV cache blocks restored from prefix cache.", metrics.prefix_cache_hits);
+    write_counter(stream, name + "prefix_cache_misses", "Prompt KV cache blocks not found in prefix cache.", metrics.prefix_cache_misses);
+    write_counter(stream, name + "evicted_tokens", "Tokens evicted from KV cache.", metrics.evicted_tokens);
+    write_counter(stream, name + "draft_tokens", "Candidate tokens proposed in speculative decoding.", metrics.draft_tokens);
+    write_counter(stream, name + "accepted_draft_tokens", "Candidate tokens accepted in speculative decoding.", metrics.accepted_draft_tokens);
+    return stream.str();
+}
+
+}  // namespace ov::genai
@@ -0,0 +1,55 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "openvino/genai/continuous_batching_pipeline.hpp"
+
+namespace ov::genai {
+
+// Histogram with fixed buckets which is updated without locks, so the pipeline step is not blocked
+// by threads reading metrics
+class AtomicHistogram {
+public:
+    explicit AtomicHistogram(std::vector<float> upper_bounds);
+
+    void observe(double value);
+
+    MetricHistogram snapshot() const;
+
+private:
+    std::vector<float> m_upper_bounds;
+    // upper_bounds.size() + 1 counters, the last one is for values above the last bound
+    std::unique_ptr<std::atomic<size_t>[]> m_counts;
+    std::atomic<double> m_sum{0.0};
+};
+
+// Live metrics of a continuous batching pipeline, updated by the generation step and read by get_metrics() at any time.
+// Speculative decoding and prompt lookup pipelines share the collector of their main pipeline.
+struct PipelineMetricsCollector {
+    AtomicHistogram ttft_ms;
+    AtomicHistogram tpot_ms;
+    AtomicHistogram queue_wait_ms;
+    AtomicHistogram prefill_chunk_size;
+    AtomicHistogram batch_size;
+    AtomicHistogram step_duration_ms;
+
+    std::atomic<size_t> preemptions{0};
+    std::atomic<size_t> recomputed_tokens{0};
+    std::atomic<size_t> prefix_cache_hits{0};
+    std::atomic<size_t> prefix_cache_misses{0};
+    std::atomic<size_t> evicted_tokens{0};
+    std::atomic<size_t> draft_tokens{0};
+    std::atomic<size_t> accepted_draft_tokens{0};
+
+    PipelineMetricsCollector();
+
+    // Copies current values of histograms and counters to a given metrics snapshot
+    void fill(PipelineMetrics& metrics) const;
+};
+
+}  // namespace ov::genai
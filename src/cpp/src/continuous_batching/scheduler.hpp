@@ -4,7 +4,10 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstdlib>
+#include <numeric>
+#include <optional>
 #include <vector>
 
 #include "openvino/runtime/intel_gpu/properties.hpp"
@@ -13,6 +16,7 @@
 #include "sequence_group.hpp"
 #include "continuous_batching/cache_manager.hpp"
 #include "continuous_batching/timer.hpp"
+#include "continuous_batching/tracer.hpp"
 #include "continuous_batching/sparse_attention.hpp"
 #include "utils.hpp"
 #include "continuous_batching/cache_eviction.hpp"
@@ -34,6 +38,15 @@ class Scheduler {
     std::shared_ptr<CacheManager> m_cache_manager;
 
     size_t m_snapkv_window_size = 1;
+
+    // preemptions made by the current schedule() call, reported in Output
+    size_t m_num_preemptions = 0;
+    size_t m_num_preempted_tokens = 0;
+
+    // the oldest waiting prompt and the number of newer prompts admitted ahead of it,
+    // see SchedulerConfig::prefix_aware_admission_window
+    std::weak_ptr<SequenceGroup> m_oldest_waiting_prompt;
+    size_t m_num_prompts_admitted_ahead = 0;
 public:
     struct Output {
         // IDs of scheduled groups
@@ -65,6 +78,11 @@ public:
         bool is_prompt = false;
         // current cache usage
         float m_cache_usage = 0.0;
+        // number of preempted sequence groups and tokens dropped by preemption at this step
+        size_t m_num_preemptions = 0;
+        size_t m_num_preempted_tokens = 0;
+        // number of prompt blocks restored from prefix cache at this step, besides ones restored when requests were added
+        size_t m_num_restored_blocks = 0;
     };
 
     Scheduler(size_t block_size, std::shared_ptr<CacheManager> cache_manager, const SchedulerConfig & config = {}, size_t num_layers = 1, bool can_use_partial_preemption = true, size_t snapkv_window_size = 1) :
@@ -83,6 +101,7 @@ public:
 
     Output schedule(std::vector<SequenceGroup::Ptr>& sequence_groups) {
         Output scheduler_output;
+        m_num_preemptions = m_num_preempted_tokens = 0;
         // map of src -> dst blocks copies, which need to be performed by CacheManager
         std::map<size_t, std::list<size_t>> block_copy_map;
 
@@ -93,6 +112,11 @@ public:
             _initialize_cache(sequence_groups);
         }
 
+        if (_is_prefix_sharing_enabled()) {
+            // prompts computed at the previous steps may have cached the prefixes of waiting prompts
+            scheduler_output.m_num_restored_blocks = _restore_newly_cached_blocks(sequence_groups);
+        }
+
         if (m_config.dynamic_split_fuse) {
             // deepspeed-mii case
             // generation phase is always scheduled first
@@ -111,9 +135,18 @@ public:
             }
         }
 
+        if (m_config.prefix_aware_admission_window > 0) {
+            _update_admission_fairness(sequence_groups);
+        }
+        // model runner lays out inputs of scheduled groups in this order, while sampler reads their logits
+        // in order of sequence_groups, so the order is kept regardless of the order of scheduling
+        std::sort(scheduler_output.m_scheduled_sequence_groups_ids.begin(), scheduler_output.m_scheduled_sequence_groups_ids.end());
+
         m_cache_manager->allocate_cache_if_needed(m_block_manager->get_total_number_of_kv_blocks());
         _clear_waiting_sequences(sequence_groups);
         scheduler_output.m_cache_usage = m_block_manager->get_used_percentage();
+        scheduler_output.m_num_preemptions = m_num_preemptions;
+        scheduler_output.m_num_preempted_tokens = m_num_preempted_tokens;
 
         static ManualTimer copy_blocks_timer("copy block");
         copy_blocks_timer.start();
@@ -156,8 +189,8 @@ public:
         m_block_manager->fork_sequence(parent_id, child_id);
     }
 
-    void restore_cached_blocks(const SequenceGroup::Ptr& sequence_group) {
-        m_block_manager->restore_cached_blocks(sequence_group);
+    size_t restore_cached_blocks(const SequenceGroup::Ptr& sequence_group) {
+        return m_block_manager->restore_cached_blocks(sequence_group);
     }
 
     const SchedulerConfig& get_config() const {
@@ -200,6 +233,11 @@ private:
                 m_block_manager->free_sequence(seq_id);
             }
             sequence_group->preempt_tokens(processed_tokens);
+            ++m_num_preemptions;
+            m_num_preempted_tokens += processed_tokens;
+            tracing::trace_instant("preempt", {{"request_id", static_cast<int64_t>(sequence_group->get_request_id())},
+                                               {"preempted_tokens", static_cast<int64_t>(processed_tokens)},
+                                               {"full", 1}});
             if (was_evicted_from) {
                 sequence_group->reset_eviction_token_count();
             }
@@ -235,6 +273,11 @@ private:
             }
         }
         sequence_group->preempt_tokens(preempted_tokens);
+        ++m_num_preemptions;
+        m_num_preempted_tokens += preempted_tokens;
+        tracing::trace_instant("preempt", {{"request_id", static_cast<int64_t>(sequence_group->get_request_id())},
+                                           {"preempted_tokens", static_cast<int64_t>(preempted_tokens)},
+                                           {"full", preempted_tokens == processed_tokens}});
         sequence_group->set_waiting();
         return m_block_manager->num_free_blocks() > prev_blocks_count;
     }
@@ -281,9 +324,14 @@ private:
         //    greedy scheduling of prompt with higher priority
         // 2. The mechanism below performs greedy scheduling of high priority prompts
 
-        for (size_t sequence_group_id = 0; sequence_group_id < sequence_groups.size(); ++sequence_group_id) {
+        const std::vector<size_t> admission_order = _get_prompt_admission_order(sequence_groups);
+        std::set<BlockHash> prefill_block_hashes;
+        for (size_t sequence_group_id : admission_order) {
             SequenceGroup::Ptr sequence_group = sequence_groups[sequence_group_id];
             if (!sequence_group->can_generate_tokens() && !sequence_group->is_waiting() && !sequence_group->handle_stopped() && !sequence_group->handle_cancelled()) {
+                if (_waits_for_prefix(sequence_group, prefill_block_hashes))
+                    continue;
+
                 size_t num_running_seqs = sequence_group->num_running_seqs();
                 // prompt phases can have a single running sequence
                 OPENVINO_ASSERT(num_running_seqs == 1);
@@ -320,6 +368,7 @@ private:
                         m_block_manager->allocate(sequence, num_scheduled_blocks, sequence_group->get_prompt_len());
                     // and schedule tokens
                     sequence_group->schedule_tokens(num_scheduled_tokens);
+                    _add_prefill_block_hashes(sequence_group, prefill_block_hashes);
 
                     // add information to scheduler_output
                     {
@@ -452,10 +501,15 @@ private:
         // TODO: it currently does not handle beam search, where beam width should contribute to total number of "num running sequences"
         size_t num_running_sequence_groups = _num_running_sequence_groups(sequence_groups);
 
-        for (size_t sequence_group_id = 0; sequence_group_id < sequence_groups.size(); ++sequence_group_id) {
+        const std::vector<size_t> admission_order = _get_prompt_admission_order(sequence_groups);
+        std::set<BlockHash> prefill_block_hashes;
+        for (size_t sequence_group_id : admission_order) {
             SequenceGroup::Ptr sequence_group = sequence_groups[sequence_group_id];
             const bool recompute_evicted_sequences = sequence_group->get_num_processed_tokens() == 0 && !m_can_use_partial_preemption;
             if ((!sequence_group->can_generate_tokens() || recompute_evicted_sequences) && !sequence_group->is_waiting() && !sequence_group->handle_stopped() && !sequence_group->handle_cancelled()) {
+                if (_waits_for_prefix(sequence_group, prefill_block_hashes))
+                    continue;
+
                 size_t num_running_seqs = sequence_group->num_running_seqs();
                 // prompt phases can have a single running sequence
                 OPENVINO_ASSERT(num_running_seqs == 1);
@@ -492,6 +546,7 @@ private:
                 {
                     // and schedule tokens
                     sequence_group->schedule_tokens(sequence_len);
+                    _add_prefill_block_hashes(sequence_group, prefill_block_hashes);
 
                     // allocate KV blocks
                     m_block_manager->append_slots(sequence_group);
@@ -522,6 +577,140 @@ private:
         }
     }
 
+    bool _is_prompt_to_admit(const SequenceGroup::Ptr& sequence_group) const {
+        // vLLM scheduling recomputes fully preempted sequences in prompt phase
+        const bool recompute_evicted_sequences = !m_config.dynamic_split_fuse && sequence_group->get_num_processed_tokens() == 0 && !m_can_use_partial_preemption;
+        return (!sequence_group->can_generate_tokens() || recompute_evicted_sequences) && !sequence_group->is_waiting() &&
+               !sequence_group->handle_stopped() && !sequence_group->handle_cancelled();
+    }
+
+    bool _is_prefix_sharing_enabled() const {
+        return m_config.prefix_aware_admission_window > 0 && m_config.enable_prefix_caching;
+    }
+
+    /**
+     * Returns indices of sequence groups in the order in which their prompts are admitted. The oldest
+     * prefix_aware_admission_window waiting prompts go first, ordered by the number of KV blocks required
+     * to compute the rest of the prompt, other sequence groups keep arrival order.
+     */
+    std::vector<size_t> _get_prompt_admission_order(const std::vector<SequenceGroup::Ptr>& sequence_groups) {
+        std::vector<size_t> order(sequence_groups.size());
+        std::iota(order.begin(), order.end(), 0);
+        const size_t window_size = m_config.prefix_aware_admission_window;
+        if (window_size <= 1) {
+            return order;
+        }
+
+        std::vector<size_t> window;
+        for (size_t sequence_group_id = 0; sequence_group_id < sequence_groups.size() && window.size() < window_size; ++sequence_group_id) {
+            if (_is_prompt_to_admit(sequence_groups[sequence_group_id]))
+                window.push_back(sequence_group_id);
+        }
+        if (window.empty()) {
+            return order;
+        }
+
+        const SequenceGroup::Ptr& oldest_prompt = sequence_groups[window.front()];
+        if (m_oldest_waiting_prompt.lock() != oldest_prompt) {
+            m_oldest_waiting_prompt = oldest_prompt;
+            m_num_prompts_admitted_ahead = 0;
+        }
+
+        const size_t block_size = get_block_size();
+        std::vector<size_t> num_required_blocks(sequence_groups.size(), 0);
+        for (size_t sequence_group_id : window) {
+            const SequenceGroup::Ptr& sequence_group = sequence_groups[sequence_group_id];
+            const size_t num_processed_tokens = sequence_group->get_num_processed_tokens();
+            const size_t num_tokens = num_processed_tokens + sequence_group->get_num_available_tokens_for_batching();
+            num_required_blocks[sequence_group_id] = (num_tokens + block_size - 1) / block_size - (num_processed_tokens + block_size - 1) / block_size;
+        }
+        // the oldest prompt is not bypassed by more than window_size - 1 prompts
+        const bool keep_oldest_first = m_num_prompts_admitted_ahead + 1 >= window_size;
+        std::stable_sort(window.begin() + (keep_oldest_first ? 1 : 0), window.end(), [&](size_t lhs, size_t rhs) {
+            return num_required_blocks[lhs] < num_required_blocks[rhs];
+        });
+
+        std::vector<bool> is_in_window(sequence_groups.size(), false);
+        for (size_t sequence_group_id : window) {
+            is_in_window[sequence_group_id] = true;
+        }
+        std::copy(window.begin(), window.end(), order.begin());
+        auto order_it = order.begin() + window.size();
+        for (size_t sequence_group_id = 0; sequence_group_id < sequence_groups.size(); ++sequence_group_id) {
+            if (!is_in_window[sequence_group_id])
+                *order_it++ = sequence_group_id;
+        }
+        return order;
+    }
+
+    void _update_admission_fairness(const std::vector<SequenceGroup::Ptr>& sequence_groups) {
+        SequenceGroup::Ptr oldest_prompt = m_oldest_waiting_prompt.lock();
+        if (!oldest_prompt) {
+            return;
+        }
+        if (oldest_prompt->is_scheduled()) {
+            m_oldest_waiting_prompt.reset();
+            m_num_prompts_admitted_ahead = 0;
+            return;
+        }
+        for (const SequenceGroup::Ptr& sequence_group : sequence_groups) {
+            if (sequence_group != oldest_prompt && sequence_group->is_scheduled() && _is_prompt_to_admit(sequence_group))
+                ++m_num_prompts_admitted_ahead;
+        }
+    }
+
+    /**
+     * Restores blocks of waiting prompts which were computed by other prompts after these ones were added.
+     * Blocks of prompts computed by chunks are skipped until the chunk ending inside the block is followed by the next one.
+     */
+    size_t _restore_newly_cached_blocks(const std::vector<SequenceGroup::Ptr>& sequence_groups) {
+        const size_t block_size = get_block_size();
+        std::set<BlockHash> blocks_in_progress;
+        for (const SequenceGroup::Ptr& sequence_group : sequence_groups) {
+            const size_t num_processed_tokens = sequence_group->get_num_processed_tokens();
+            const size_t block_end = (num_processed_tokens / block_size + 1) * block_size;
+            if (!sequence_group->can_generate_tokens() && num_processed_tokens % block_size != 0 && block_end <= sequence_group->get_prompt_len())
+                blocks_in_progress.insert((*sequence_group)[0]->get_hash(block_end));
+        }
+
+        size_t num_restored_blocks = 0;
+        for (const SequenceGroup::Ptr& sequence_group : sequence_groups) {
+            // KV cache of generated tokens of preempted sequences is recomputed together with the prompt
+            if (_is_prompt_to_admit(sequence_group) && (*sequence_group)[0]->get_generated_len() == 0)
+                num_restored_blocks += m_block_manager->restore_newly_cached_blocks(sequence_group, blocks_in_progress);
+        }
+        return num_restored_blocks;
+    }
+
+    /**
+     * Checks whether the next block of a prompt is computed by another prompt admitted at the current step.
+     * The prompt is not scheduled then, the block is restored from prefix cache at the next step instead.
+     */
+    bool _waits_for_prefix(const SequenceGroup::Ptr& sequence_group, const std::set<BlockHash>& prefill_block_hashes) {
+        if (prefill_block_hashes.empty()) {
+            return false;
+        }
+        const size_t block_size = get_block_size();
+        const size_t num_processed_tokens = sequence_group->get_num_processed_tokens();
+        if (num_processed_tokens % block_size != 0 || num_processed_tokens + block_size > sequence_group->get_prompt_len()) {
+            return false;
+        }
+        return prefill_block_hashes.count((*sequence_group)[0]->get_hash(num_processed_tokens + block_size)) > 0;
+    }
+
+    // remembers hashes of full prompt blocks which are completely computed by the tokens scheduled for a sequence group
+    void _add_prefill_block_hashes(const SequenceGroup::Ptr& sequence_group, std::set<BlockHash>& prefill_block_hashes) {
+        if (!_is_prefix_sharing_enabled()) {
+            return;
+        }
+        const size_t block_size = get_block_size();
+        const size_t num_processed_tokens = sequence_group->get_num_processed_tokens();
+        const size_t content_len = std::min(num_processed_tokens + sequence_group->get_num_scheduled_tokens(), sequence_group->get_prompt_len());
+        for (size_t block_end = (num_processed_tokens / block_size + 1) * block_size; block_end <= content_len; block_end += block_size) {
+            prefill_block_hashes.insert((*sequence_group)[0]->get_hash(block_end));
+        }
+    }
+
     void _clear_waiting_sequences(const std::vector<SequenceGroup::Ptr>& sequence_groups) {
         for (size_t sequence_group_id = 0; sequence_group_id < sequence_groups.size(); ++sequence_group_id) {
             sequence_groups[sequence_group_id]->clear_waiting_sequences();
@@ -0,0 +1,171 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "continuous_batching/tracer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+
+#include "logger.hpp"
+
+namespace ov::genai::tracing {
+
+namespace {
+
+class SpinLockGuard {
+public:
+    explicit SpinLockGuard(std::atomic_flag& flag) : m_flag(flag) {
+        while (m_flag.test_and_set(std::memory_order_acquire)) {
+        }
+    }
+    ~SpinLockGuard() {
+        m_flag.clear(std::memory_order_release);
+    }
+
+private:
+    std::atomic_flag& m_flag;
+};
+
+void write_escaped(std::ostream& stream, const char* str) {
+    for (; *str; ++str) {
+        if (*str == '"' || *str == '\\') {
+            stream << '\\';
+        }
+        stream << *str;
+    }
+}
+
+const auto s_trace_epoch = std::chrono::steady_clock::now();
+
+// Starts recording at library load when the output file is given by the environment
+const bool s_started_from_env = []() {
+    const char* path = std::getenv("OPENVINO_GENAI_TRACE_FILE");
+    if (path == nullptr || *path == '\0') {
+        return false;
+    }
+    Tracer::instance().start(path);
+    return true;
+}();
+
+}  // namespace
+
+std::atomic<bool> Tracer::s_enabled{false};
+
+Tracer& Tracer::instance() {
+    static Tracer tracer;
+    return tracer;
+}
+
+int64_t Tracer::now_us() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - s_trace_epoch).count();
+}
+
+Tracer::ThreadBuffer& Tracer::get_thread_buffer() {
+    // buffers are owned by the tracer as well, so events of finished threads are still written
+    thread_local std::shared_ptr<ThreadBuffer> buffer;
+    if (!buffer) {
+        buffer = std::make_shared<ThreadBuffer>();
+        buffer->events.resize(BUFFER_CAPACITY);
+        std::lock_guard<std::mutex> lock(m_mutex);
+        buffer->thread_id = ++m_num_threads;
+        m_buffers.push_back(buffer);
+    }
+    return *buffer;
+}
+
+void Tracer::record(const Event& event) {
+    ThreadBuffer& buffer = get_thread_buffer();
+    SpinLockGuard guard(buffer.lock);
+    buffer.events[buffer.next] = event;
+    if (++buffer.next == buffer.events.size()) {
+        buffer.next = 0;
+        buffer.wrapped = true;
+    }
+}
+
+void Tracer::start(const std::filesystem::path& output_path) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    // buffers of exited threads are referenced by the tracer only
+    m_buffers.erase(std::remove_if(m_buffers.begin(), m_buffers.end(), [](const auto& buffer) {
+        return buffer.use_count() == 1;
+    }), m_buffers.end());
+    for (const auto& buffer : m_buffers) {
+        SpinLockGuard guard(buffer->lock);
+        buffer->next = 0;
+        buffer->wrapped = false;
+    }
+    m_output_path = output_path;
+    s_enabled.store(true, std::memory_order_relaxed);
+}
+
+void Tracer::stop() {
+    s_enabled.store(false, std::memory_order_relaxed);
+    std::filesystem::path output_path;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        output_path = std::exchange(m_output_path, {});
+    }
+    if (output_path.empty()) {
+        return;
+    }
+    std::ofstream file(output_path);
+    if (!file.is_open()) {
+        GENAI_WARN("Failed to open trace file %s", output_path.string().c_str());
+        return;
+    }
+    write_chrome_trace(file);
+}
+
+void Tracer::write_chrome_trace(std::ostream& stream) {
+    std::vector<Event> events;
+    stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool is_first = true;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto& buffer : m_buffers) {
+        {
+            // copy events out, so recording threads are not blocked while the stream is written
+            SpinLockGuard guard(buffer->lock);
+            const auto end = buffer->events.begin() + buffer->next;
+            if (buffer->wrapped) {
+                events.assign(end, buffer->events.end());
+                events.insert(events.end(), buffer->events.begin(), end);
+            } else {
+                events.assign(buffer->events.begin(), end);
+            }
+        }
+        for (const Event& event : events) {
+            stream << (is_first ? "" : ",") << "\n{\"name\":\"";
+            is_first = false;
+            write_escaped(stream, event.name);
+            stream << "\",\"cat\":\"genai\",\"ph\":\"" << event.phase << "\",\"pid\":1,\"tid\":" << buffer->thread_id
+                   << ",\"ts\":" << event.timestamp_us;
+            if (event.phase == 'X') {
+                stream << ",\"dur\":" << event.duration_us;
+            } else if (event.phase == 'i') {
+                stream << ",\"s\":\"t\"";
+            }
+            if (event.num_args > 0) {
+                stream << ",\"args\":{";
+                for (size_t i = 0; i < event.num_args; ++i) {
+                    stream << (i == 0 ? "\"" : ",\"");
+                    write_escaped(stream, event.arg_names[i]);
+                    stream << "\":" << event.arg_values[i];
+                }
+                stream << "}";
+            }
+            stream << "}";
+        }
+    }
+    stream << "\n]}\n";
+}
+
+Tracer::~Tracer() {
+    // writes a trace started by the environment variable if it was not stopped explicitly
+    if (is_enabled()) {
+        stop();
+    }
+}
+
+}  // namespace ov::genai::tracing
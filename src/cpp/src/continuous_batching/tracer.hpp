@@ -0,0 +1,145 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <utility>
+#include <vector>
+
+namespace ov::genai::tracing {
+
+// A single trace event. Names are not copied, so event and argument names should be string literals.
+struct Event {
+    static constexpr size_t MAX_ARGS = 4;
+
+    const char* name = nullptr;
+    char phase = 'X';               // Chrome trace event phase: 'X' - complete span, 'i' - instant event, 'C' - counter
+    int64_t timestamp_us = 0;
+    int64_t duration_us = 0;
+    uint8_t num_args = 0;
+    std::array<const char*, MAX_ARGS> arg_names{};
+    std::array<int64_t, MAX_ARGS> arg_values{};
+
+    void add_arg(const char* arg_name, int64_t value) {
+        if (num_args < MAX_ARGS) {
+            arg_names[num_args] = arg_name;
+            arg_values[num_args++] = value;
+        }
+    }
+};
+
+// Records timeline events of continuous batching into per-thread ring buffers and exports them as
+// Chrome trace event JSON which is opened by chrome://tracing and Perfetto UI.
+// Recording is enabled at start by OPENVINO_GENAI_TRACE_FILE environment variable holding an output path,
+// or at runtime by ContinuousBatchingPipeline::start_tracing() / stop_tracing() which call start() / stop().
+// When disabled, instrumentation costs one relaxed atomic load.
+class Tracer {
+public:
+    // events kept per thread, the oldest events are overwritten when a buffer is full
+    static constexpr size_t BUFFER_CAPACITY = 1 << 15;
+
+    static Tracer& instance();
+
+    static bool is_enabled() {
+        return s_enabled.load(std::memory_order_relaxed);
+    }
+
+    static int64_t now_us();
+
+    // Drops previously recorded events and starts recording, the trace is written to a given path by stop()
+    void start(const std::filesystem::path& output_path = {});
+
+    // Stops recording and writes the trace if an output path was given to start()
+    void stop();
+
+    void record(const Event& event);
+
+    void write_chrome_trace(std::ostream& stream);
+
+    ~Tracer();
+
+private:
+    struct ThreadBuffer {
+        std::vector<Event> events;
+        size_t next = 0;
+        bool wrapped = false;
+        uint32_t thread_id = 0;
+        // taken by the owning thread for every event, so it is contended only while the trace is written
+        std::atomic_flag lock = ATOMIC_FLAG_INIT;
+    };
+
+    ThreadBuffer& get_thread_buffer();
+
+    static std::atomic<bool> s_enabled;
+
+    std::mutex m_mutex;
+    std::vector<std::shared_ptr<ThreadBuffer>> m_buffers;
+    uint32_t m_num_threads = 0;
+    std::filesystem::path m_output_path;
+};
+
+// Records a complete event for the lifetime of the object, arguments can be added while the span is open
+class TraceSpan {
+public:
+    explicit TraceSpan(const char* name) : m_enabled(Tracer::is_enabled()) {
+        if (m_enabled) {
+            m_event.name = name;
+            m_event.timestamp_us = Tracer::now_us();
+        }
+    }
+
+    TraceSpan& arg(const char* name, int64_t value) {
+        if (m_enabled) {
+            m_event.add_arg(name, value);
+        }
+        return *this;
+    }
+
+    ~TraceSpan() {
+        if (m_enabled) {
+            m_event.duration_us = Tracer::now_us() - m_event.timestamp_us;
+            Tracer::instance().record(m_event);
+        }
+    }
+
+    TraceSpan(const TraceSpan&) = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+
+private:
+    bool m_enabled;
+    Event m_event;
+};
+
+inline void trace_instant(const char* name, std::initializer_list<std::pair<const char*, int64_t>> args = {}) {
+    if (Tracer::is_enabled()) {
+        Event event;
+        event.name = name;
+        event.phase = 'i';
+        event.timestamp_us = Tracer::now_us();
+        for (const auto& [arg_name, value] : args) {
+            event.add_arg(arg_name, value);
+        }
+        Tracer::instance().record(event);
+    }
+}
+
+inline void trace_counter(const char* name, int64_t value) {
+    if (Tracer::is_enabled()) {
+        Event event;
+        event.name = name;
+        event.phase = 'C';
+        event.timestamp_us = Tracer::now_us();
+        event.add_arg("value", value);
+        Tracer::instance().record(event);
+    }
+}
+
+}  // namespace ov::genai::tracing
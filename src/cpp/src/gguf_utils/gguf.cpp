@@ -3,12 +3,17 @@
 
 #include "gguf_utils/gguf.hpp"
 
+#include <chrono>
 #include <cstdint>
 #include <cstring>
 #include <fstream>
 #include <iostream>
+#include <memory>
 #include <numeric>
 #include <optional>
+#include <sstream>
+
+#include "utils.hpp"
 
 // https://github.com/antirez/gguf-tools/blob/af7d88d808a7608a33723fba067036202910acb3/gguflib.h#L102-L108
 constexpr int gguf_array_header_size = 12;
@@ -80,14 +85,64 @@ ov::Shape get_shape(const gguf_tensor& tensor) {
     return shape;
 }
 
-ov::Tensor extract_tensor_data(gguf_tensor* tensor) {
+using GGUFContext = std::shared_ptr<gguf_ctx>;
+
+// Allocator, which places a tensor right into memory mapped GGUF file instead of allocating memory.
+// gguflib maps files shared and writable, so tensors use a separate private read-only mapping made by
+// ov::read_tensor_data: writes to such tensors fault instead of reaching the file. Tensors keep a copy of
+// allocator holding the mapping, so the file stays mapped as long as any of its tensors is alive.
+class GGUFMappedAllocator {
+public:
+    GGUFMappedAllocator(ov::Tensor mapped_file, size_t offset)
+        : m_mapped_file(std::move(mapped_file)),
+          m_offset(offset) {}
+
+    void* allocate(size_t bytes, size_t /* alignment */) {
+        OPENVINO_ASSERT(m_offset + bytes <= m_mapped_file.get_byte_size(), "[load_gguf] Tensor data is out of file bounds");
+        return m_mapped_file.data<uint8_t>() + m_offset;
+    }
+
+    void deallocate(void* /* handle */, size_t /* bytes */, size_t /* alignment */) {
+        // memory is owned by mapping
+    }
+
+    bool is_equal(const GGUFMappedAllocator& other) const {
+        return m_mapped_file.data() == other.m_mapped_file.data() && m_offset == other.m_offset;
+    }
+
+private:
+    ov::Tensor m_mapped_file;
+    size_t m_offset;
+};
+
+GGUFContext open_gguf(const std::string& file) {
+    gguf_ctx* ctx = gguf_open(file.data());
+    if (!ctx)
+        return nullptr;
+    return GGUFContext(ctx, gguf_close);
+}
+
+struct GGUFLoadStats {
+    size_t mapped_bytes = 0, copied_bytes = 0, repacked_bytes = 0;
+};
+
+ov::Tensor extract_tensor_data(const GGUFContext& ctx, const ov::Tensor& mapped_file, gguf_tensor* tensor, GGUFLoadStats& stats) {
     std::optional<ov::element::Type> equivalent_dtype = gguf_type_to_dtype(tensor->type);
-    // If there's an equivalent type, we can simply copy.
+    // If there's an equivalent type, tensor data is used in place.
     if (equivalent_dtype.has_value()) {
         auto shape = get_shape(*tensor);
-        ov::Tensor weights(equivalent_dtype.value(), shape);
+        const size_t byte_size = tensor->num_weights * equivalent_dtype.value().size();
 
-        memcpy(weights.data(), tensor->weights_data, tensor->num_weights * equivalent_dtype.value().size());
+        const size_t offset = static_cast<size_t>(tensor->weights_data - ctx->data);
+        if (reinterpret_cast<uintptr_t>(mapped_file.data<uint8_t>() + offset) % equivalent_dtype.value().size() == 0) {
+            stats.mapped_bytes += byte_size;
+            return ov::Tensor(equivalent_dtype.value(), shape, GGUFMappedAllocator(mapped_file, offset));
+        }
+
+        // GGUF aligns tensor data, but fallback to copy for files violating alignment
+        ov::Tensor weights(equivalent_dtype.value(), shape);
+        memcpy(weights.data(), tensor->weights_data, byte_size);
+        stats.copied_bytes += byte_size;
         return weights;
     }
     // Otherwise, we convert to float16.
@@ -100,6 +155,7 @@ ov::Tensor extract_tensor_data(gguf_tensor* tensor) {
     ov::Tensor weights(ov::element::f16, shape);
     memcpy(weights.data(), data, new_size);
     free(data);
+    stats.copied_bytes += new_size;
 
     return weights;
 }
@@ -263,9 +319,12 @@ std::unordered_map<std::string, GGUFMetaData> load_metadata(gguf_ctx* ctx) {
     return metadata;
 }
 
-void load_arrays(gguf_ctx* ctx,
+void load_arrays(const GGUFContext& ctx,
+                 const ov::Tensor& mapped_file,
                  std::unordered_map<std::string, ov::Tensor>& array_map,
-                 std::unordered_map<std::string, gguf_tensor_type>& qtype_map) {
+                 std::unordered_map<std::string, gguf_tensor_type>& qtype_map,
+                 std::vector<GGUFQuantizedTensor>& quantized,
+                 GGUFLoadStats& stats) {
     gguf_tensor tensor;
 
     auto check_insert = [](const auto& inserted) {
@@ -275,13 +334,14 @@ void load_arrays(gguf_ctx* ctx,
                         "'. This can happen when loading quantized tensors.");
     };
 
-    while (gguf_get_tensor(ctx, &tensor)) {
+    while (gguf_get_tensor(ctx.get(), &tensor)) {
         if (tensor.type == GGUF_TYPE_Q4_0 || tensor.type == GGUF_TYPE_Q4_1 || tensor.type == GGUF_TYPE_Q8_0 ||
             tensor.type == GGUF_TYPE_Q4_K || tensor.type == GGUF_TYPE_Q6_K) {
-            gguf_load_quantized(array_map, qtype_map, tensor);
+            gguf_load_quantized(array_map, qtype_map, tensor, quantized);
+            stats.repacked_bytes += tensor.bsize;
         } else {
             std::string name(tensor.name, tensor.namelen);
-            ov::Tensor loaded_array = extract_tensor_data(&tensor);
+            ov::Tensor loaded_array = extract_tensor_data(ctx, mapped_file, &tensor, stats);
             check_insert(array_map.emplace(name, loaded_array));
 
             constexpr std::string_view weight_suffix = ".weight";
@@ -319,26 +379,30 @@ std::vector<std::string> get_all_files(std::string file, int total_num) {
     return files;
 }
 
-GGUFLoad get_gguf_data(const std::string& file) {
+GGUFLoad get_gguf_data(const std::string& file, bool metadata_only) {
     std::unordered_map<std::string, ov::Tensor> arrays;
     std::unordered_map<std::string, gguf_tensor_type> qtype;
+    // quantized tensors are repacked after all files are parsed, so all of them are processed in parallel
+    std::vector<GGUFQuantizedTensor> quantized;
+    GGUFLoadStats stats;
 
     check_file(file);
 
-    std::unique_ptr<gguf_ctx, decltype(&gguf_close)> ctx(gguf_open(file.data()), gguf_close);
+    GGUFContext ctx = open_gguf(file);
     OPENVINO_ASSERT(ctx, "Failed to open '", file, "' with gguf_open");
 
     // get main config from first file or single file
     auto metadata = load_metadata(ctx.get());
 
+    if (metadata_only) {
+        return {metadata, arrays, qtype};
+    }
+
     std::string split_flag = "split.count";
     auto it = metadata.find(split_flag);
 
-    if (it == metadata.end())  // single GGUF file
-    {
-        load_arrays(ctx.get(), arrays, qtype);
-        return {metadata, arrays, qtype};
-    } else  // multi GGUF files
+    std::vector<GGUFContext> split_contexts;
+    if (it != metadata.end())  // multi GGUF files
     {
         auto total_num_tensor = std::get<ov::Tensor>(metadata.at(split_flag));
         int total_num = *(total_num_tensor.data<ov::element_type_traits<ov::element::u16>::value_type>());
@@ -346,16 +410,29 @@ GGUFLoad get_gguf_data(const std::string& file) {
         std::vector<std::string> files = get_all_files(file, total_num);
 
         for (size_t i = 1; i < files.size(); i++) {
-            std::unique_ptr<gguf_ctx, decltype(&gguf_close)> ctx_i(gguf_open(files.at(i).data()), gguf_close);
+            GGUFContext ctx_i = open_gguf(files.at(i));
             OPENVINO_ASSERT(ctx_i, "Failed to open '", files.at(i), "' with gguf_open");
 
             auto metadata_tmp = load_metadata(ctx_i.get());
 
-            load_arrays(ctx_i.get(), arrays, qtype);
+            load_arrays(ctx_i, ov::read_tensor_data(files.at(i)), arrays, qtype, quantized, stats);
+            split_contexts.push_back(std::move(ctx_i));
         }
-        load_arrays(ctx.get(), arrays, qtype);
-        return {metadata, arrays, qtype};
     }
+    load_arrays(ctx, ov::read_tensor_data(file), arrays, qtype, quantized, stats);
+
+    // contexts of all files must be alive here, since 'quantized' refers to raw data inside of them
+    auto unpack_start = std::chrono::steady_clock::now();
+    gguf_unpack_quantized(quantized);
+    auto unpack_ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - unpack_start).count();
+
+    std::stringstream ss;
+    ss << "Weights used in place from mapped file: " << stats.mapped_bytes / (1024 * 1024) << "MB, copied: "
+       << stats.copied_bytes / (1024 * 1024) << "MB, repacked from quantized blocks: " << stats.repacked_bytes / (1024 * 1024)
+       << "MB in " << quantized.size() << " tensors. Repacking time: " << unpack_ms << "ms";
+    ov::genai::utils::print_gguf_debug_info(ss.str());
+
+    return {metadata, arrays, qtype};
 }
 
 float metadata_to_float(const std::unordered_map<std::string, GGUFMetaData>& metadata, const std::string& key) {
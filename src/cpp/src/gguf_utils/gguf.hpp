@@ -13,6 +13,7 @@
 #include <string>
 #include <unordered_map>
 #include <variant>
+#include <vector>
 
 #include "openvino/openvino.hpp"
 
@@ -32,13 +33,26 @@ std::string format(std::string fmt, Args... args);
 
 ov::Shape get_shape(const gguf_tensor& tensor);
 
+// Quantized GGUF tensor pending repacking: 'tensor' points to raw blocks inside of memory mapped file,
+// while 'weights', 'scales' and 'biases' are allocated, but not filled yet
+struct GGUFQuantizedTensor {
+    gguf_tensor tensor;
+    ov::Tensor weights, scales, biases;
+};
+
+// Allocates weights, scales and biases for quantized 'tensor' and registers it in 'pending' for repacking
 void gguf_load_quantized(std::unordered_map<std::string, ov::Tensor>& a,
                          std::unordered_map<std::string, gguf_tensor_type>& qtype_map,
-                         const gguf_tensor& tensor);
+                         const gguf_tensor& tensor,
+                         std::vector<GGUFQuantizedTensor>& pending);
+
+// Repacks all pending quantized tensors in parallel; source GGUF files must stay mapped until it's done
+void gguf_unpack_quantized(const std::vector<GGUFQuantizedTensor>& pending);
 
 std::tuple<std::map<std::string, GGUFMetaData>,
            std::unordered_map<std::string, ov::Tensor>,
            std::unordered_map<std::string, gguf_tensor_type>>
 load_gguf(const std::string& file);
 
-GGUFLoad get_gguf_data(const std::string& file);
+// Reads metadata and tensors of GGUF file; with 'metadata_only' tensors are neither read nor unpacked
+GGUFLoad get_gguf_data(const std::string& file, bool metadata_only = false);
@@ -75,7 +75,7 @@ void extract_q8_0_data(const gguf_tensor& tensor,
     auto weights = static_cast<uint8_t*>(weights_arr.data());
     auto scales = scales_arr.data<ov::element_type_traits<ov::element::f16>::value_type>();
     auto biases = biases_arr.data<ov::element_type_traits<ov::element::f16>::value_type>();
-    for (int64_t i = 0; i < scales_arr.get_size(); i++) {
+    ov::parallel_for(scales_arr.get_size(), [&](size_t i) {
         uint8_t* block_data = data + i * bytes_per_block;
         scales[i] = ov::float16::from_bits(*(uint16_t*)block_data);
         biases[i] = ov::float16(-128.f * static_cast<float>(scales[i]));
@@ -86,7 +86,7 @@ void extract_q8_0_data(const gguf_tensor& tensor,
             x ^= 1 << 7;
             weights[i * weights_per_block + j] = x;
         }
-    }
+    });
 }
 
 void unpack_256_4(const uint8_t* data, uint8_t* dst) {
@@ -201,7 +201,8 @@ void extract_q6_k_data(const gguf_tensor& tensor,
 
 void gguf_load_quantized(std::unordered_map<std::string, ov::Tensor>& a,
                          std::unordered_map<std::string, gguf_tensor_type>& qtype_map,
-                         const gguf_tensor& tensor) {
+                         const gguf_tensor& tensor,
+                         std::vector<GGUFQuantizedTensor>& pending) {
     uint64_t weights_per_byte;
     if (tensor.type == GGUF_TYPE_Q4_0 || tensor.type == GGUF_TYPE_Q4_1 || tensor.type == GGUF_TYPE_Q4_K) {
         weights_per_byte = 2;
@@ -236,20 +237,9 @@ void gguf_load_quantized(std::unordered_map<std::string, ov::Tensor>& a,
 
     ov::Tensor scales(ov::element::f16, shape);
     ov::Tensor biases(ov::element::f16, std::move(shape));
-    if (tensor.type == GGUF_TYPE_Q4_0) {
-        extract_q4_0_data(tensor, weights, scales, biases);
-    } else if (tensor.type == GGUF_TYPE_Q4_1) {
-        extract_q4_1_data(tensor, weights, scales, biases);
-    } else if (tensor.type == GGUF_TYPE_Q8_0) {
-        extract_q8_0_data(tensor, weights, scales, biases);
-    } else if (tensor.type == GGUF_TYPE_Q6_K) {
-        // due to WA #2135, this case will not be used, extract_q6_k_data temporarily disabled.
-        extract_q6_k_data(tensor, weights, scales, biases);
-    } else if (tensor.type == GGUF_TYPE_Q4_K) {
-        extract_q4_k_data(tensor, weights, scales, biases);
-    } else {
-        OPENVINO_ASSERT("Unsupported tensor type in 'gguf_load_quantized'");
-    }
+
+    // tensors share memory, so they are filled later by gguf_unpack_quantized
+    pending.push_back({tensor, weights, scales, biases});
 
     a.emplace(name, std::move(weights));
 
@@ -267,3 +257,27 @@ void gguf_load_quantized(std::unordered_map<std::string, ov::Tensor>& a,
 
     qtype_map.emplace(name_prefix + ".qtype", static_cast<gguf_tensor_type>(tensor.type));
 }
+
+void gguf_unpack_quantized(const std::vector<GGUFQuantizedTensor>& pending) {
+    // small tensors (e.g. norms of K-quants) are processed concurrently with large ones,
+    // while large ones are additionally split into blocks by extract_* functions
+    ov::parallel_for(pending.size(), [&](size_t idx) {
+        const gguf_tensor& tensor = pending[idx].tensor;
+        ov::Tensor weights = pending[idx].weights, scales = pending[idx].scales, biases = pending[idx].biases;
+
+        if (tensor.type == GGUF_TYPE_Q4_0) {
+            extract_q4_0_data(tensor, weights, scales, biases);
+        } else if (tensor.type == GGUF_TYPE_Q4_1) {
+            extract_q4_1_data(tensor, weights, scales, biases);
+        } else if (tensor.type == GGUF_TYPE_Q8_0) {
+            extract_q8_0_data(tensor, weights, scales, biases);
+        } else if (tensor.type == GGUF_TYPE_Q6_K) {
+            // due to WA #2135, this case will not be used, extract_q6_k_data temporarily disabled.
+            extract_q6_k_data(tensor, weights, scales, biases);
+        } else if (tensor.type == GGUF_TYPE_Q4_K) {
+            extract_q4_k_data(tensor, weights, scales, biases);
+        } else {
+            OPENVINO_THROW("Unsupported tensor type in 'gguf_unpack_quantized'");
+        }
+    });
+}
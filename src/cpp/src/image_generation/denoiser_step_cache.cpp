@@ -0,0 +1,85 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "image_generation/denoiser_step_cache.hpp"
+
+#include <cmath>
+#include <cstring>
+
+#include "openvino/core/except.hpp"
+
+namespace ov {
+namespace genai {
+
+DenoiserStepCache::DenoiserStepCache(const ImageGenerationConfig& generation_config, size_t num_inference_steps)
+    : m_threshold(generation_config.step_cache_threshold),
+      m_interval(generation_config.step_cache_interval),
+      m_num_inference_steps(num_inference_steps) {
+}
+
+bool DenoiserStepCache::is_enabled() const {
+    return m_threshold > 0.0f || m_interval > 1;
+}
+
+float DenoiserStepCache::relative_l1_distance(const ov::Tensor& model_input) const {
+    const float* current = model_input.data<const float>();
+    double diff = 0.0, norm = 0.0;
+    for (size_t i = 0; i < m_prev_input.size(); ++i) {
+        diff += std::fabs(current[i] - m_prev_input[i]);
+        norm += std::fabs(m_prev_input[i]);
+    }
+    return norm > 0.0 ? static_cast<float>(diff / norm) : 0.0f;
+}
+
+bool DenoiserStepCache::should_compute(size_t inference_step, const ov::Tensor& model_input) {
+    if (!is_enabled())
+        return true;
+
+    OPENVINO_ASSERT(model_input.get_element_type() == ov::element::f32, "Denoiser step cache supports only f32 inputs");
+
+    bool can_reuse = m_cached_output && inference_step > 0 && inference_step + 1 < m_num_inference_steps;
+
+    if (m_interval > 1) {
+        can_reuse = can_reuse && inference_step - m_computed_step < m_interval;
+    }
+
+    if (m_threshold > 0.0f) {
+        const bool same_shape = m_prev_input.size() == model_input.get_size();
+        if (same_shape) {
+            m_accumulated_distance += relative_l1_distance(model_input);
+        }
+        can_reuse = can_reuse && same_shape && m_accumulated_distance < m_threshold;
+
+        // the distance is accumulated between adjacent steps, so remember current input regardless of decision
+        m_prev_input.resize(model_input.get_size());
+        std::memcpy(m_prev_input.data(), model_input.data<const float>(), model_input.get_byte_size());
+    }
+
+    if (!can_reuse) {
+        m_computed_step = inference_step;
+    }
+
+    return !can_reuse;
+}
+
+void DenoiserStepCache::update(const ov::Tensor& model_output) {
+    if (!is_enabled())
+        return;
+
+    if (!m_cached_output || m_cached_output.get_shape() != model_output.get_shape()) {
+        m_cached_output = ov::Tensor(model_output.get_element_type(), model_output.get_shape());
+        m_reused_output = ov::Tensor(model_output.get_element_type(), model_output.get_shape());
+    }
+    model_output.copy_to(m_cached_output);
+    m_accumulated_distance = 0.0f;
+}
+
+ov::Tensor DenoiserStepCache::get_cached_output() {
+    OPENVINO_ASSERT(m_cached_output, "Denoiser step cache is empty");
+    // some schedulers (e.g. PNDM) modify model output in-place, so hand out a copy
+    m_cached_output.copy_to(m_reused_output);
+    return m_reused_output;
+}
+
+} // namespace genai
+} // namespace ov
@@ -0,0 +1,56 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "openvino/runtime/tensor.hpp"
+
+#include "openvino/genai/image_generation/generation_config.hpp"
+
+namespace ov {
+namespace genai {
+
+/**
+ * Decides whether a denoiser (UNet / Transformer) inference can be skipped on a given denoising step
+ * and the output of the previous computed step reused instead.
+ *
+ * Denoiser models are opaque OpenVINO IRs, so caching is done at whole step granularity:
+ * - interval policy (DeepCache-like): denoiser is inferred on every 'step_cache_interval'-th step only
+ * - threshold policy (TeaCache-like): relative L1 change of denoiser input is accumulated across steps
+ *   and denoiser output is reused while accumulated change is below 'step_cache_threshold'
+ * First and last denoising steps are always computed.
+ */
+class DenoiserStepCache {
+public:
+    DenoiserStepCache(const ImageGenerationConfig& generation_config, size_t num_inference_steps);
+
+    bool is_enabled() const;
+
+    // Returns true if denoiser must be inferred for 'model_input' on 'inference_step'
+    bool should_compute(size_t inference_step, const ov::Tensor& model_input);
+
+    // Stores denoiser output computed on current step
+    void update(const ov::Tensor& model_output);
+
+    // Returns denoiser output of the last computed step
+    ov::Tensor get_cached_output();
+
+private:
+    float relative_l1_distance(const ov::Tensor& model_input) const;
+
+    float m_threshold;
+    size_t m_interval;
+    size_t m_num_inference_steps;
+
+    float m_accumulated_distance = 0.0f;
+    size_t m_computed_step = 0;
+
+    std::vector<float> m_prev_input;
+    ov::Tensor m_cached_output, m_reused_output;
+};
+
+} // namespace genai
+} // namespace ov
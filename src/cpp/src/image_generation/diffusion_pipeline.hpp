@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <memory>
 #include <filesystem>
 #include <fstream>
@@ -151,6 +152,43 @@ protected:
 
     virtual size_t get_config_in_channels() const = 0;
 
+    // tiling options are used only by VAE decoder, but must be checked before denoising not to waste the whole generation
+    void check_vae_tiling(const ImageGenerationConfig& generation_config) const {
+        if (generation_config.vae_tile_size == 0) {
+            return;
+        }
+        const size_t vae_scale_factor = m_vae->get_vae_scale_factor();
+        OPENVINO_ASSERT(generation_config.vae_tile_size % vae_scale_factor == 0 && generation_config.vae_tile_overlap % vae_scale_factor == 0,
+                        "Both 'vae_tile_size' and 'vae_tile_overlap' must be divisible by ", vae_scale_factor);
+    }
+
+    // decodes latent by VAE decoder taking into account tiling options from generation config
+    ov::Tensor vae_decode(const ov::Tensor latent, const ImageGenerationConfig& generation_config) {
+        if (generation_config.vae_tile_size > 0) {
+            return m_vae->decode_tiled(latent, generation_config.vae_tile_size, generation_config.vae_tile_overlap);
+        }
+        return m_vae->decode(latent);
+    }
+
+    // infers text encoder using embeddings cache configured by generation config and tracks its perf metrics under 'name'
+    template <typename TextEncoder, typename... Args>
+    ov::Tensor infer_text_encoder(const std::shared_ptr<TextEncoder>& text_encoder,
+                                  const std::string& name,
+                                  const ImageGenerationConfig& generation_config,
+                                  Args&&... args) {
+        text_encoder->set_embeddings_cache_size(generation_config.text_embeddings_cache_size);
+
+        auto infer_start = std::chrono::steady_clock::now();
+        ov::Tensor output = text_encoder->infer(std::forward<Args>(args)...);
+        auto infer_duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - infer_start).count();
+        m_perf_metrics.encoder_inference_duration[name] = infer_duration;
+
+        if (text_encoder->is_last_infer_cached()) {
+            m_perf_metrics.raw_metrics.cached_text_encoders.push_back(name);
+        }
+        return output;
+    }
+
     virtual void blend_latents(ov::Tensor image_latent, ov::Tensor noise, ov::Tensor mask, ov::Tensor latent, size_t inference_step) {
         OPENVINO_ASSERT(m_pipeline_type == PipelineType::INPAINTING, "'blend_latents' can be called for inpainting pipeline only");
         OPENVINO_ASSERT(image_latent.get_shape() == latent.get_shape(), "Shapes for current", latent.get_shape(), "and initial image latents ", image_latent.get_shape(), " must match");
@@ -200,7 +200,7 @@ public:
 
         latents = unpack_latents(latents, m_custom_generation_config.height, m_custom_generation_config.width, vae_scale_factor);
         const auto decode_start = std::chrono::steady_clock::now();
-        auto image = m_vae->decode(latents);
+        auto image = vae_decode(latents, m_custom_generation_config);
         m_perf_metrics.vae_decoder_inference_duration =
             std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - decode_start)
                 .count();
@@ -226,6 +226,7 @@ private:
         OPENVINO_ASSERT(m_pipeline_type == PipelineType::INPAINTING, "FluxFillPipeline supports inpainting mode only");
 
         check_image_size(generation_config.height, generation_config.width);
+        check_vae_tiling(generation_config);
 
         OPENVINO_ASSERT(generation_config.max_sequence_length <= 512, "T5's 'max_sequence_length' must be less or equal to 512");
         OPENVINO_ASSERT(generation_config.negative_prompt == std::nullopt, "Negative prompt is not used by FluxFillPipeline");
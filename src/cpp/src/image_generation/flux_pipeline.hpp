@@ -6,6 +6,7 @@
 #include <cassert>
 
 #include "image_generation/diffusion_pipeline.hpp"
+#include "image_generation/denoiser_step_cache.hpp"
 #include "image_generation/numpy_utils.hpp"
 #include "image_generation/threaded_callback.hpp"
 
@@ -301,15 +302,10 @@ public:
         // encode_prompt
         std::string prompt_2_str = generation_config.prompt_2 != std::nullopt ? *generation_config.prompt_2 : positive_prompt;
 
-        auto infer_start = std::chrono::steady_clock::now();
-        m_clip_text_encoder->infer(positive_prompt, {}, false);
-        auto infer_duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - infer_start).count();
-        m_perf_metrics.encoder_inference_duration["text_encoder"] = infer_duration;
+        infer_text_encoder(m_clip_text_encoder, "text_encoder", generation_config, positive_prompt, std::string{}, false);
         ov::Tensor pooled_prompt_embeds = m_clip_text_encoder->get_output_tensor(1);
-        infer_start = std::chrono::steady_clock::now();
-        ov::Tensor prompt_embeds = m_t5_text_encoder->infer(prompt_2_str, "", false, generation_config.max_sequence_length);
-        infer_duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - infer_start).count();
-        m_perf_metrics.encoder_inference_duration["text_encoder_2"] = infer_duration;
+        ov::Tensor prompt_embeds = infer_text_encoder(m_t5_text_encoder, "text_encoder_2", generation_config,
+            prompt_2_str, std::string{}, false, generation_config.max_sequence_length);
 
         pooled_prompt_embeds = numpy_utils::repeat(pooled_prompt_embeds, generation_config.num_images_per_prompt);
         prompt_embeds = numpy_utils::repeat(prompt_embeds, generation_config.num_images_per_prompt);
@@ -507,15 +503,23 @@ public:
         // Denoising loop
         ov::Tensor timestep(ov::element::f32, {1});
         float* timestep_data = timestep.data<float>();
+        DenoiserStepCache step_cache(m_custom_generation_config, timesteps.size());
 
         for (size_t inference_step = 0; inference_step < timesteps.size(); ++inference_step) {
             auto step_start = std::chrono::steady_clock::now();
             timestep_data[0] = timesteps[inference_step] / 1000.0f;
 
-            auto infer_start = std::chrono::steady_clock::now();
-            ov::Tensor noise_pred_tensor = m_transformer->infer(latents, timestep);
-            auto infer_duration = ov::genai::PerfMetrics::get_microsec(std::chrono::steady_clock::now() - infer_start);
-            m_perf_metrics.raw_metrics.transformer_inference_durations.emplace_back(MicroSeconds(infer_duration));
+            ov::Tensor noise_pred_tensor;
+            if (step_cache.should_compute(inference_step, latents)) {
+                auto infer_start = std::chrono::steady_clock::now();
+                noise_pred_tensor = m_transformer->infer(latents, timestep);
+                auto infer_duration = ov::genai::PerfMetrics::get_microsec(std::chrono::steady_clock::now() - infer_start);
+                m_perf_metrics.raw_metrics.transformer_inference_durations.emplace_back(MicroSeconds(infer_duration));
+                step_cache.update(noise_pred_tensor);
+            } else {
+                noise_pred_tensor = step_cache.get_cached_output();
+                m_perf_metrics.raw_metrics.cached_steps.push_back(inference_step);
+            }
 
             auto scheduler_step_result = m_scheduler->step(noise_pred_tensor, latents, inference_step, m_custom_generation_config.generator);
             latents = scheduler_step_result["latent"];
@@ -546,7 +550,7 @@ public:
 
         latents = unpack_latents(latents, m_custom_generation_config.height, m_custom_generation_config.width, vae_scale_factor);
         const auto decode_start = std::chrono::steady_clock::now();
-        auto image = m_vae->decode(latents);
+        auto image = vae_decode(latents, m_custom_generation_config);
         m_perf_metrics.vae_decoder_inference_duration =
             std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - decode_start)
                 .count();
@@ -560,7 +564,7 @@ public:
                                      m_custom_generation_config.height,
                                      m_custom_generation_config.width,
                                      m_vae->get_vae_scale_factor());
-        return m_vae->decode(unpacked_latent);
+        return vae_decode(unpacked_latent, m_custom_generation_config);
     }
 
     ImageGenerationPerfMetrics get_performance_metrics() override {
@@ -622,6 +626,7 @@ protected:
 
     void check_inputs(const ImageGenerationConfig& generation_config, ov::Tensor initial_image) const override {
         check_image_size(generation_config.height, generation_config.width);
+        check_vae_tiling(generation_config);
 
         OPENVINO_ASSERT(generation_config.max_sequence_length <= 512, "T5's 'max_sequence_length' must be less or equal to 512");
 
@@ -66,6 +66,11 @@ void ImageGenerationConfig::update_generation_config(const ov::AnyMap& propertie
     read_anymap_param(properties, "strength", strength);
     read_anymap_param(properties, "adapters", adapters);
     read_anymap_param(properties, "max_sequence_length", max_sequence_length);
+    read_anymap_param(properties, "step_cache_threshold", step_cache_threshold);
+    read_anymap_param(properties, "step_cache_interval", step_cache_interval);
+    read_anymap_param(properties, "vae_tile_size", vae_tile_size);
+    read_anymap_param(properties, "vae_tile_overlap", vae_tile_overlap);
+    read_anymap_param(properties, "text_embeddings_cache_size", text_embeddings_cache_size);
 
     // 'generator' has higher priority than 'seed' parameter
     const bool have_generator_param = properties.find(ov::genai::generator.name()) != properties.end();
@@ -93,6 +98,9 @@ void ImageGenerationConfig::validate() const {
     OPENVINO_ASSERT(guidance_scale > 1.0f || negative_prompt == std::nullopt, "Guidance scale <= 1.0 ignores negative prompt");
     OPENVINO_ASSERT(guidance_scale > 1.0f || negative_prompt_2 == std::nullopt, "Guidance scale <= 1.0 ignores negative prompt 2");
     OPENVINO_ASSERT(guidance_scale > 1.0f || negative_prompt_3 == std::nullopt, "Guidance scale <= 1.0 ignores negative prompt 3");
+    OPENVINO_ASSERT(step_cache_threshold >= 0.0f, "'step_cache_threshold' must be non-negative");
+    OPENVINO_ASSERT(step_cache_interval >= 1, "'step_cache_interval' must be greater than 0");
+    OPENVINO_ASSERT(vae_tile_size == 0 || vae_tile_size > vae_tile_overlap, "'vae_tile_size' must be greater than 'vae_tile_overlap'");
 }
 
 }  // namespace genai
@@ -43,6 +43,8 @@ void ImageGenerationPerfMetrics::clean_up() {
     raw_metrics.unet_inference_durations.clear();
     raw_metrics.transformer_inference_durations.clear();
     raw_metrics.iteration_durations.clear();
+    raw_metrics.cached_steps.clear();
+    raw_metrics.cached_text_encoders.clear();
 }
 
 void ImageGenerationPerfMetrics::evaluate_statistics() {
@@ -159,6 +161,14 @@ float ImageGenerationPerfMetrics::get_generate_duration() {
     return generate_duration;
 }
 
+size_t ImageGenerationPerfMetrics::get_num_cached_steps() const {
+    return raw_metrics.cached_steps.size();
+}
+
+size_t ImageGenerationPerfMetrics::get_text_embeddings_cache_hits() const {
+    return raw_metrics.cached_text_encoders.size();
+}
+
 void ImageGenerationPerfMetrics::get_first_and_other_iter_duration(float &first_iter, float &other_iter_avg) {
     first_iter = 0.0f;
     other_iter_avg = 0.0f;
@@ -16,6 +16,7 @@
 
 #include "utils.hpp"
 
+#include "image_generation/vae_tiling.hpp"
 #include "json_utils.hpp"
 #include "lora/helper.hpp"
 
@@ -277,6 +278,30 @@ ov::Tensor AutoencoderKL::decode(ov::Tensor latent) {
     return m_decoder_request.get_output_tensor();
 }
 
+ov::Tensor AutoencoderKL::decode_tiled(ov::Tensor latent,
+                                       size_t tile_size,
+                                       size_t tile_overlap,
+                                       const std::function<void(size_t, const ov::Tensor&)>& callback) {
+    OPENVINO_ASSERT(m_decoder_request, "VAE decoder model must be compiled first. Cannot infer non-compiled model");
+
+    const size_t vae_scale_factor = get_vae_scale_factor();
+    OPENVINO_ASSERT(tile_size % vae_scale_factor == 0 && tile_overlap % vae_scale_factor == 0,
+                    "Both tile size and tile overlap must be divisible by ", vae_scale_factor);
+
+    const ov::Shape latent_shape = latent.get_shape();
+    const size_t latent_tile_size = tile_size / vae_scale_factor;
+    const bool single_tile = latent_shape[2] <= latent_tile_size && latent_shape[3] <= latent_tile_size;
+
+    const ov::PartialShape input_shape = m_decoder_request.get_compiled_model().input(0).get_partial_shape();
+    OPENVINO_ASSERT(single_tile || (input_shape[2].is_dynamic() && input_shape[3].is_dynamic()),
+                    "Tiled decoding requires VAE decoder with dynamic spatial dimensions, but it's reshaped to ", input_shape);
+
+    return vae_tiling::spatial_tiled_decode(latent, vae_scale_factor, latent_tile_size, tile_overlap / vae_scale_factor,
+        [this] (const ov::Tensor& latent_tile) {
+            return decode(latent_tile);
+        }, callback);
+}
+
 ov::Tensor AutoencoderKL::encode(ov::Tensor image, std::shared_ptr<Generator> generator) {
     OPENVINO_ASSERT(m_encoder_request || m_encoder_model, "AutoencoderKL is created without 'VAE encoder' capability. Please, pass extra argument to constructor to create 'VAE encoder'");
     OPENVINO_ASSERT(m_encoder_request, "VAE encoder model must be compiled first. Cannot infer non-compiled model");
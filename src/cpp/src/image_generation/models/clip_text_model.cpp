@@ -10,6 +10,7 @@
 #include "json_utils.hpp"
 #include "lora/helper.hpp"
 #include "utils.hpp"
+#include "image_generation/text_encoder_cache.hpp"
 
 namespace ov {
 namespace genai {
@@ -89,6 +90,11 @@ std::shared_ptr<CLIPTextModel> CLIPTextModel::clone() {
         cloned->m_request = m_request.get_compiled_model().create_infer_request();
     }
 
+    // clone can have different adapters applied, so it uses own cache
+    if (m_embeddings_cache) {
+        cloned->m_embeddings_cache = std::make_shared<TextEncoderCache>(m_embeddings_cache->get_capacity());
+    }
+
     return cloned;
 }
 
@@ -128,9 +134,25 @@ CLIPTextModel& CLIPTextModel::compile(const std::string& device, const ov::AnyMa
 void CLIPTextModel::set_adapters(const std::optional<AdapterConfig>& adapters) {
     if (adapters) {
         m_adapter_controller.apply(m_request, *adapters);
+        m_adapters_applied = !adapters->get_adapters().empty();
+        if (m_embeddings_cache) {
+            m_embeddings_cache->clear();
+        }
     }
 }
 
+void CLIPTextModel::set_embeddings_cache_size(size_t size) {
+    if (m_embeddings_cache) {
+        m_embeddings_cache->set_capacity(size);
+    } else if (size > 0) {
+        m_embeddings_cache = std::make_shared<TextEncoderCache>(size);
+    }
+}
+
+bool CLIPTextModel::is_last_infer_cached() const {
+    return !m_cached_outputs.empty();
+}
+
 ov::Tensor CLIPTextModel::infer(const std::string& pos_prompt, const std::string& neg_prompt, bool do_classifier_free_guidance) {
     OPENVINO_ASSERT(m_request, "CLIP text encoder model must be compiled first. Cannot infer non-compiled model");
 
@@ -181,8 +203,24 @@ ov::Tensor CLIPTextModel::infer(const std::string& pos_prompt, const std::string
                          ov::Tensor(input_ids, {current_batch_idx    , 0},
                                                {current_batch_idx + 1, m_config.max_position_embeddings}));
 
+    m_cached_outputs.clear();
+    std::string cache_key;
+    if (m_embeddings_cache && m_embeddings_cache->get_capacity() > 0 && !m_adapters_applied) {
+        // rows of input_ids, which are not used in case of batch size mismatch, are not a part of key
+        const size_t first_batch_idx = input_ids.get_shape()[0] - text_embedding_batch_size;
+        cache_key = TextEncoderCache::make_key({ov::Tensor(input_ids, {first_batch_idx, 0}, ov::Coordinate(input_ids.get_shape()))});
+        if (auto cached_outputs = m_embeddings_cache->find(cache_key)) {
+            m_cached_outputs = std::move(*cached_outputs);
+        }
+    }
+
     // text embeddings
-    m_request.infer();
+    if (m_cached_outputs.empty()) {
+        m_request.infer();
+        if (!cache_key.empty()) {
+            m_embeddings_cache->insert(cache_key, m_request);
+        }
+    }
 
     // This is true when text_embedding_batch_size is 1, but model was reshaped / compiled as batch size 2.
     m_slice_batch1_output = (text_embedding_batch_size != input_ids.get_shape()[0]);
@@ -191,7 +229,7 @@ ov::Tensor CLIPTextModel::infer(const std::string& pos_prompt, const std::string
 }
 
 ov::Tensor CLIPTextModel::get_output_tensor(const size_t idx) {
-    auto infer_out_tensor = m_request.get_output_tensor(idx);
+    auto infer_out_tensor = m_cached_outputs.empty() ? m_request.get_output_tensor(idx) : m_cached_outputs.at(idx);
     if (m_slice_batch1_output) {
         //Slice and return batch index 1 output.
         auto out_shape = infer_out_tensor.get_shape();
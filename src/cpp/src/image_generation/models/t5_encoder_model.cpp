@@ -8,6 +8,7 @@
 #include "json_utils.hpp"
 #include "lora/helper.hpp"
 #include "utils.hpp"
+#include "image_generation/text_encoder_cache.hpp"
 
 namespace ov {
 namespace genai {
@@ -55,6 +56,10 @@ std::shared_ptr<T5EncoderModel> T5EncoderModel::clone() {
         cloned->m_request = m_request.get_compiled_model().create_infer_request();
     }
 
+    if (m_embeddings_cache) {
+        cloned->m_embeddings_cache = std::make_shared<TextEncoderCache>(m_embeddings_cache->get_capacity());
+    }
+
     return cloned;
 }
 
@@ -153,14 +158,40 @@ ov::Tensor T5EncoderModel::infer(const std::string& pos_prompt, const std::strin
                          ov::Tensor(m_prompt_attention_mask, {current_batch_idx    , 0},
                                                {current_batch_idx + 1, input_ids.get_shape()[1]}));
 
+    m_cached_outputs.clear();
+    std::string cache_key;
+    if (m_embeddings_cache && m_embeddings_cache->get_capacity() > 0) {
+        cache_key = TextEncoderCache::make_key({input_ids, m_prompt_attention_mask});
+        if (auto cached_outputs = m_embeddings_cache->find(cache_key)) {
+            m_cached_outputs = std::move(*cached_outputs);
+        }
+    }
+
     // text embeddings
-    m_request.infer();
+    if (m_cached_outputs.empty()) {
+        m_request.infer();
+        if (!cache_key.empty()) {
+            m_embeddings_cache->insert(cache_key, m_request);
+        }
+    }
 
-    return m_request.get_output_tensor(0);
+    return get_output_tensor(0);
 }
 
 ov::Tensor T5EncoderModel::get_output_tensor(const size_t idx) {
-    return m_request.get_output_tensor(idx);
+    return m_cached_outputs.empty() ? m_request.get_output_tensor(idx) : m_cached_outputs.at(idx);
+}
+
+void T5EncoderModel::set_embeddings_cache_size(size_t size) {
+    if (m_embeddings_cache) {
+        m_embeddings_cache->set_capacity(size);
+    } else if (size > 0) {
+        m_embeddings_cache = std::make_shared<TextEncoderCache>(size);
+    }
+}
+
+bool T5EncoderModel::is_last_infer_cached() const {
+    return !m_cached_outputs.empty();
 }
 
 ov::Tensor T5EncoderModel::get_prompt_attention_mask() const {
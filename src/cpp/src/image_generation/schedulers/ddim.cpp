@@ -130,8 +130,16 @@ void DDIMScheduler::set_timesteps(size_t num_inference_steps, float strength) {
 }
 
 std::map<std::string, ov::Tensor> DDIMScheduler::step(ov::Tensor noise_pred, ov::Tensor latents, size_t inference_step, std::shared_ptr<Generator> generator) {
-    // noise_pred - model_output
-    // latents - sample
+    return _step(step_kernels::ModelOutput::plain(noise_pred), latents, inference_step);
+}
+
+std::map<std::string, ov::Tensor> DDIMScheduler::guided_step(ov::Tensor noise_pred, float guidance_scale, ov::Tensor latents, size_t inference_step, std::shared_ptr<Generator> generator) {
+    return _step(step_kernels::ModelOutput::guided(noise_pred, guidance_scale), latents, inference_step);
+}
+
+std::map<std::string, ov::Tensor> DDIMScheduler::_step(const step_kernels::ModelOutput& model_output, ov::Tensor latents, size_t inference_step) {
+    // model_output - noise_pred
+    // latents - sample, updated in place
     // inference_step
 
     size_t timestep = m_timesteps[inference_step];
@@ -146,31 +154,31 @@ std::map<std::string, ov::Tensor> DDIMScheduler::step(ov::Tensor noise_pred, ov:
 
     // compute predicted original sample from predicted noise also called
     // "predicted x_0" of formula (12) from https://arxiv.org/pdf/2010.02502.pdf
-    std::vector<float> pred_original_sample, pred_epsilon;
-    float pos_val, pe_val;
-    for (size_t j = 0; j < noise_pred.get_size(); j++) {
-        switch (m_config.prediction_type) {
-            case PredictionType::EPSILON:
-                pos_val = (latents.data<float>()[j] - std::sqrt(beta_prod_t) * noise_pred.data<float>()[j]) / std::sqrt(alpha_prod_t);
-                pe_val = noise_pred.data<float>()[j];
-                pred_original_sample.push_back(pos_val);
-                pred_epsilon.push_back(pe_val);
-                break;
-            case PredictionType::SAMPLE:
-                pos_val = noise_pred.data<float>()[j];
-                pe_val = (latents.data<float>()[j] - std::sqrt(alpha_prod_t) * pos_val) / std::sqrt(beta_prod_t);
-                pred_original_sample.push_back(pos_val);
-                pred_epsilon.push_back(pe_val);
-                break;
-            case PredictionType::V_PREDICTION:
-                pos_val = std::sqrt(alpha_prod_t) * latents.data<float>()[j] - std::sqrt(beta_prod_t) * noise_pred.data<float>()[j];
-                pe_val = std::sqrt(alpha_prod_t) * noise_pred.data<float>()[j] + std::sqrt(beta_prod_t) * latents.data<float>()[j];
-                pred_original_sample.push_back(pos_val);
-                pred_epsilon.push_back(pe_val);
-                break;
-            default:
-                OPENVINO_THROW("Unsupported value for 'PredictionType'");
-        }
+    // and predicted epsilon; both are linear in sample and model output:
+    // pred_original_sample = pos_sample_coeff * sample + pos_model_coeff * model_output
+    // pred_epsilon = pe_sample_coeff * sample + pe_model_coeff * model_output
+    float pos_sample_coeff = 0.0f, pos_model_coeff = 0.0f, pe_sample_coeff = 0.0f, pe_model_coeff = 0.0f;
+    switch (m_config.prediction_type) {
+        case PredictionType::EPSILON:
+            pos_sample_coeff = 1.0f / std::sqrt(alpha_prod_t);
+            pos_model_coeff = -std::sqrt(beta_prod_t) / std::sqrt(alpha_prod_t);
+            pe_sample_coeff = 0.0f;
+            pe_model_coeff = 1.0f;
+            break;
+        case PredictionType::SAMPLE:
+            pos_sample_coeff = 0.0f;
+            pos_model_coeff = 1.0f;
+            pe_sample_coeff = 1.0f / std::sqrt(beta_prod_t);
+            pe_model_coeff = -std::sqrt(alpha_prod_t) / std::sqrt(beta_prod_t);
+            break;
+        case PredictionType::V_PREDICTION:
+            pos_sample_coeff = std::sqrt(alpha_prod_t);
+            pos_model_coeff = -std::sqrt(beta_prod_t);
+            pe_sample_coeff = std::sqrt(beta_prod_t);
+            pe_model_coeff = std::sqrt(alpha_prod_t);
+            break;
+        default:
+            OPENVINO_THROW("Unsupported value for 'PredictionType'");
     }
 
     // TODO: support m_config.thresholding
@@ -180,20 +188,17 @@ std::map<std::string, ov::Tensor> DDIMScheduler::step(ov::Tensor noise_pred, ov:
     OPENVINO_ASSERT(!m_config.clip_sample,
                     "Parameter 'clip_sample' is not supported. Please, add support.");
 
-    // compute "direction pointing to x_t" of formula (12) from https://arxiv.org/pdf/2010.02502.pdf
-    std::vector<float> pred_sample_direction(pred_epsilon.size());
-    std::transform(pred_epsilon.begin(), pred_epsilon.end(), pred_sample_direction.begin(), [alpha_prod_t_prev](auto x) {
-        return std::sqrt(1 - alpha_prod_t_prev) * x;
-    });
-
     // compute x_t without "random noise" of formula (12) from https://arxiv.org/pdf/2010.02502.pdf
-    ov::Tensor prev_sample(latents.get_element_type(), latents.get_shape());
-    float* prev_sample_data = prev_sample.data<float>();
-    for (size_t i = 0; i < prev_sample.get_size(); ++i) {
-        prev_sample_data[i] = std::sqrt(alpha_prod_t_prev) * pred_original_sample[i] + pred_sample_direction[i];
-    }
-
-    std::map<std::string, ov::Tensor> result{{"latent", prev_sample}};
+    // prev_sample = sqrt(alpha_prod_t_prev) * pred_original_sample + sqrt(1 - alpha_prod_t_prev) * pred_epsilon,
+    // where the second term is "direction pointing to x_t"
+    const float pos_scale = std::sqrt(alpha_prod_t_prev), pe_scale = std::sqrt(1 - alpha_prod_t_prev);
+    float* sample_data = latents.data<float>();
+    step_kernels::step_combination(sample_data,
+                                   pos_scale * pos_sample_coeff + pe_scale * pe_sample_coeff, sample_data,
+                                   pos_scale * pos_model_coeff + pe_scale * pe_model_coeff, model_output,
+                                   latents.get_size());
+
+    std::map<std::string, ov::Tensor> result{{"latent", latents}};
 
     return result;
 }
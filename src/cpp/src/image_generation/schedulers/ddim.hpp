@@ -45,6 +45,8 @@ public:
 
     std::map<std::string, ov::Tensor> step(ov::Tensor noise_pred, ov::Tensor latents, size_t inference_step, std::shared_ptr<Generator> generator) override;
 
+    std::map<std::string, ov::Tensor> guided_step(ov::Tensor noise_pred, float guidance_scale, ov::Tensor latents, size_t inference_step, std::shared_ptr<Generator> generator) override;
+
     virtual void add_noise(ov::Tensor init_latent, ov::Tensor noise, int64_t timestep) const override;
 
 private:
@@ -55,6 +57,8 @@ private:
 
     size_t m_num_inference_steps;
     std::vector<int64_t> m_timesteps;
+
+    std::map<std::string, ov::Tensor> _step(const step_kernels::ModelOutput& model_output, ov::Tensor latents, size_t inference_step);
 };
 
 } // namespace genai
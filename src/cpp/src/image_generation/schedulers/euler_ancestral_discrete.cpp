@@ -157,59 +157,63 @@ void EulerAncestralDiscreteScheduler::set_timesteps(size_t num_inference_steps,
 }
 
 std::map<std::string, ov::Tensor> EulerAncestralDiscreteScheduler::step(ov::Tensor noise_pred, ov::Tensor latents, size_t inference_step, std::shared_ptr<Generator> generator) {
-    // noise_pred - model_output
-    // latents - sample
-    // inference_step
+    return _step(step_kernels::ModelOutput::plain(noise_pred), latents, generator);
+}
+
+std::map<std::string, ov::Tensor> EulerAncestralDiscreteScheduler::guided_step(ov::Tensor noise_pred, float guidance_scale, ov::Tensor latents, size_t inference_step, std::shared_ptr<Generator> generator) {
+    return _step(step_kernels::ModelOutput::guided(noise_pred, guidance_scale), latents, generator);
+}
 
-    size_t timestep = m_timesteps[inference_step];
+std::map<std::string, ov::Tensor> EulerAncestralDiscreteScheduler::_step(const step_kernels::ModelOutput& model_output, ov::Tensor latents, std::shared_ptr<Generator> generator) {
+    // model_output - noise_pred
+    // latents - sample, updated in place
 
     if (m_step_index == -1)
         m_step_index = m_begin_index;
 
     float sigma = m_sigmas[m_step_index];
 
-    float* model_output_data = noise_pred.data<float>();
     float* sample_data = latents.data<float>();
+    const size_t size = latents.get_size();
 
-    ov::Tensor pred_original_sample(noise_pred.get_element_type(), noise_pred.get_shape());
-    float* pred_original_sample_data = pred_original_sample.data<float>();
+    step_kernels::ensure_buffer(m_pred_original_sample, latents.get_shape());
+    float* pred_original_sample_data = m_pred_original_sample.data<float>();
 
+    // pred_original_sample = sample_coeff * sample + model_coeff * model_output
+    float sample_coeff = 0.0f, model_coeff = 0.0f;
     switch (m_config.prediction_type) {
     case PredictionType::EPSILON:
-        for (size_t i = 0; i < noise_pred.get_size(); ++i) {
-            pred_original_sample_data[i] = sample_data[i] - sigma * model_output_data[i];
-        }
+        sample_coeff = 1.0f;
+        model_coeff = -sigma;
         break;
     case PredictionType::V_PREDICTION:
-        for (size_t i = 0; i < noise_pred.get_size(); ++i) {
-            pred_original_sample_data[i] = model_output_data[i] * (-sigma / std::pow((std::pow(sigma, 2) + 1), 0.5)) +
-                                           (sample_data[i] / (std::pow(sigma, 2) + 1));
-        }
+        sample_coeff = 1.0f / (std::pow(sigma, 2) + 1);
+        model_coeff = -sigma / std::pow((std::pow(sigma, 2) + 1), 0.5);
         break;
     default:
         OPENVINO_THROW("Unsupported value for 'PredictionType': must be one of `epsilon`, or `v_prediction`");
     }
 
+    step_kernels::step_combination(pred_original_sample_data, sample_coeff, sample_data, model_coeff, model_output, size);
+
     float sigma_from = m_sigmas[m_step_index];
     float sigma_to = m_sigmas[m_step_index + 1];
     float sigma_up = std::sqrt(std::pow(sigma_to, 2) * (std::pow(sigma_from, 2) - std::pow(sigma_to, 2)) / std::pow(sigma_from, 2));
     float sigma_down = std::sqrt(std::pow(sigma_to, 2) - std::pow(sigma_up, 2));
     float dt = sigma_down - sigma;
 
-    ov::Tensor prev_sample = ov::Tensor(latents.get_element_type(), latents.get_shape());
-    float* prev_sample_data = prev_sample.data<float>();
+    ov::Tensor noise = generator->randn_tensor(latents.get_shape());
 
-    ov::Tensor noise = generator->randn_tensor(noise_pred.get_shape());
-    const float* noise_data = noise.data<float>();
-
-    for (size_t i = 0; i < prev_sample.get_size(); ++i) {
-        float derivative = (sample_data[i] - pred_original_sample_data[i]) / sigma;
-        prev_sample_data[i] = (sample_data[i] + derivative * dt) + noise_data[i] * sigma_up;
-    }
+    // derivative = (sample - pred_original_sample) / sigma
+    // prev_sample = (sample + derivative * dt) + noise * sigma_up
+    step_kernels::linear_combination<3>(sample_data,
+                                        {1.0f + dt / sigma, -dt / sigma, sigma_up},
+                                        {sample_data, pred_original_sample_data, noise.data<const float>()},
+                                        size);
 
     m_step_index++;
 
-    return {{"latent", prev_sample}, {"denoised", pred_original_sample}};
+    return {{"latent", latents}, {"denoised", m_pred_original_sample}};
 }
 
 size_t EulerAncestralDiscreteScheduler::_index_for_timestep(int64_t timestep) const {
@@ -213,11 +213,16 @@ void EulerDiscreteScheduler::set_timesteps(size_t num_inference_steps, float str
 }
 
 std::map<std::string, ov::Tensor> EulerDiscreteScheduler::step(ov::Tensor noise_pred, ov::Tensor latents, size_t inference_step, std::shared_ptr<Generator> generator) {
-    // noise_pred - model_output
-    // latents - sample
-    // inference_step
+    return _step(step_kernels::ModelOutput::plain(noise_pred), latents);
+}
+
+std::map<std::string, ov::Tensor> EulerDiscreteScheduler::guided_step(ov::Tensor noise_pred, float guidance_scale, ov::Tensor latents, size_t inference_step, std::shared_ptr<Generator> generator) {
+    return _step(step_kernels::ModelOutput::guided(noise_pred, guidance_scale), latents);
+}
 
-    size_t timestep = m_timesteps[inference_step];
+std::map<std::string, ov::Tensor> EulerDiscreteScheduler::_step(const step_kernels::ModelOutput& model_output, ov::Tensor latents) {
+    // model_output - noise_pred
+    // latents - sample, updated in place
 
     if (m_step_index == -1)
         m_step_index = m_begin_index;
@@ -227,47 +232,43 @@ std::map<std::string, ov::Tensor> EulerDiscreteScheduler::step(ov::Tensor noise_
     float gamma = 0.0f;
     float sigma_hat = sigma * (gamma + 1);
 
-    float* model_output_data = noise_pred.data<float>();
     float* sample_data = latents.data<float>();
+    const size_t size = latents.get_size();
 
-    ov::Tensor pred_original_sample(noise_pred.get_element_type(), noise_pred.get_shape());
-    float* pred_original_sample_data = pred_original_sample.data<float>();
-
-    ov::Tensor prev_sample(noise_pred.get_element_type(), noise_pred.get_shape());
-    float* prev_sample_data = prev_sample.data<float>();
+    step_kernels::ensure_buffer(m_pred_original_sample, latents.get_shape());
+    float* pred_original_sample_data = m_pred_original_sample.data<float>();
 
     // 1. compute predicted original sample (x_0) from sigma-scaled predicted noise
+    // as pred_original_sample = sample_coeff * sample + model_coeff * model_output
+    float sample_coeff = 0.0f, model_coeff = 0.0f;
     switch (m_config.prediction_type) {
     case PredictionType::EPSILON:
-        for (size_t i = 0; i < noise_pred.get_size(); ++i) {
-            pred_original_sample_data[i] = sample_data[i] - model_output_data[i] * sigma_hat;
-        }
+        sample_coeff = 1.0f;
+        model_coeff = -sigma_hat;
         break;
     case PredictionType::SAMPLE:
-        for (size_t i = 0; i < noise_pred.get_size(); ++i) {
-            pred_original_sample_data[i] = model_output_data[i];
-        }
+        sample_coeff = 0.0f;
+        model_coeff = 1.0f;
         break;
     case PredictionType::V_PREDICTION:
-        for (size_t i = 0; i < noise_pred.get_size(); ++i) {
-            pred_original_sample_data[i] = model_output_data[i] * (-sigma / std::pow((std::pow(sigma, 2) + 1), 0.5)) +
-                                           (sample_data[i] / (std::pow(sigma, 2) + 1));
-        }
+        sample_coeff = 1.0f / (std::pow(sigma, 2) + 1);
+        model_coeff = -sigma / std::pow((std::pow(sigma, 2) + 1), 0.5);
         break;
     default:
         OPENVINO_THROW("Unsupported value for 'PredictionType'");
     }
 
+    step_kernels::step_combination(pred_original_sample_data, sample_coeff, sample_data, model_coeff, model_output, size);
+
     float dt = m_sigmas[m_step_index + 1] - sigma_hat;
 
     // 2. Convert to an ODE derivative
-    for (size_t i = 0; i < prev_sample.get_size(); ++i) {
-        prev_sample_data[i] = ((sample_data[i] - pred_original_sample_data[i]) / sigma_hat) * dt + sample_data[i];
-    }
+    // prev_sample = ((sample - pred_original_sample) / sigma_hat) * dt + sample
+    step_kernels::linear_combination<2>(sample_data, {1.0f + dt / sigma_hat, -dt / sigma_hat}, {sample_data, pred_original_sample_data}, size);
 
     m_step_index += 1;
 
-    return {{"latent", prev_sample}, {"denoised", pred_original_sample}};
+    return {{"latent", latents}, {"denoised", m_pred_original_sample}};
 }
 
 std::vector<int64_t> EulerDiscreteScheduler::get_timesteps() const {
@@ -47,6 +47,8 @@ public:
 
     std::map<std::string, ov::Tensor> step(ov::Tensor noise_pred, ov::Tensor latents, size_t inference_step, std::shared_ptr<Generator> generator) override;
 
+    std::map<std::string, ov::Tensor> guided_step(ov::Tensor noise_pred, float guidance_scale, ov::Tensor latents, size_t inference_step, std::shared_ptr<Generator> generator) override;
+
     void add_noise(ov::Tensor init_latent, ov::Tensor noise, int64_t latent_timestep) const override;
 
 private:
@@ -58,7 +60,11 @@ private:
 
     int m_step_index, m_begin_index;
 
+    ov::Tensor m_pred_original_sample;
+
     size_t _index_for_timestep(int64_t timestep) const;
+
+    std::map<std::string, ov::Tensor> _step(const step_kernels::ModelOutput& model_output, ov::Tensor latents);
 };
 
 } // namespace genai
@@ -124,28 +124,30 @@ void FlowMatchEulerDiscreteScheduler::set_timesteps(size_t num_inference_steps,
 }
 
 std::map<std::string, ov::Tensor> FlowMatchEulerDiscreteScheduler::step(ov::Tensor noise_pred, ov::Tensor latents, size_t inference_step, std::shared_ptr<Generator> generator) {
-    // noise_pred - model_output
-    // latents - sample
-    // inference_step
+    return _step(step_kernels::ModelOutput::plain(noise_pred), latents);
+}
+
+std::map<std::string, ov::Tensor> FlowMatchEulerDiscreteScheduler::guided_step(ov::Tensor noise_pred, float guidance_scale, ov::Tensor latents, size_t inference_step, std::shared_ptr<Generator> generator) {
+    return _step(step_kernels::ModelOutput::guided(noise_pred, guidance_scale), latents);
+}
 
-    const float* model_output_data = noise_pred.data<const float>();
-    const float* sample_data = latents.data<const float>();
+std::map<std::string, ov::Tensor> FlowMatchEulerDiscreteScheduler::_step(const step_kernels::ModelOutput& model_output, ov::Tensor latents) {
+    // model_output - noise_pred
+    // latents - sample, updated in place
 
     if (m_step_index == -1)
         init_step_index();
 
-    ov::Tensor prev_sample(latents.get_element_type(), latents.get_shape());
-    float* prev_sample_data = prev_sample.data<float>();
+    float* sample_data = latents.data<float>();
 
     float sigma_diff = m_sigmas[m_step_index + 1] - m_sigmas[m_step_index];
 
-    for (size_t i = 0; i < prev_sample.get_size(); ++i) {
-        prev_sample_data[i] = sample_data[i] + sigma_diff * model_output_data[i];
-    }
+    // prev_sample = sample + sigma_diff * model_output
+    step_kernels::step_combination(sample_data, 1.0f, sample_data, sigma_diff, model_output, latents.get_size());
 
     m_step_index++;
 
-    return {{"latent", prev_sample}};
+    return {{"latent", latents}};
 }
 
 std::vector<float> FlowMatchEulerDiscreteScheduler::get_float_timesteps() {
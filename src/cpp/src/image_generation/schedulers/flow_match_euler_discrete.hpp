@@ -41,6 +41,8 @@ public:
 
     std::map<std::string, ov::Tensor> step(ov::Tensor noise_pred, ov::Tensor latents, size_t inference_step, std::shared_ptr<Generator> generator) override;
 
+    std::map<std::string, ov::Tensor> guided_step(ov::Tensor noise_pred, float guidance_scale, ov::Tensor latents, size_t inference_step, std::shared_ptr<Generator> generator) override;
+
     void add_noise(ov::Tensor init_latent, ov::Tensor noise, int64_t latent_timestep) const override;
 
     void scale_noise(ov::Tensor sample, float timestep, ov::Tensor noise) override;
@@ -62,6 +64,7 @@ private:
     double sigma_to_t(double simga);
     size_t _index_for_timestep(float timestep);
     float calculate_shift(size_t image_seq_len);
+    std::map<std::string, ov::Tensor> _step(const step_kernels::ModelOutput& model_output, ov::Tensor latents);
 };
 
 } // namespace genai
@@ -12,6 +12,8 @@
 
 #include "openvino/runtime/tensor.hpp"
 
+#include "image_generation/schedulers/step_kernels.hpp"
+
 namespace ov {
 namespace genai {
 
@@ -23,9 +25,27 @@ public:
 
     virtual void scale_model_input(ov::Tensor sample, size_t inference_step) = 0;
 
+    // Note, that schedulers may update 'latents' in place and return it as "latent" output
     virtual std::map<std::string, ov::Tensor> step(
         ov::Tensor noise_pred, ov::Tensor latents, size_t inference_step, std::shared_ptr<Generator> generator) = 0;
 
+    // Performs classifier-free guidance over 'noise_pred' of [2 * N, ...] shape, where the first half is unconditional
+    // and the second half is text conditioned noise prediction, followed by a scheduler step.
+    // Schedulers whose step is linear in noise prediction override it to fuse both into a single pass over latents.
+    virtual std::map<std::string, ov::Tensor> guided_step(
+        ov::Tensor noise_pred, float guidance_scale, ov::Tensor latents, size_t inference_step, std::shared_ptr<Generator> generator) {
+        ov::Shape guided_shape = noise_pred.get_shape();
+        guided_shape[0] /= 2;
+        step_kernels::ensure_buffer(m_guided_noise_pred, guided_shape);
+
+        // noise_pred_uncond + guidance_scale * (noise_pred_text - noise_pred_uncond)
+        step_kernels::linear_combination<2>(m_guided_noise_pred.data<float>(),
+                                            {1.0f - guidance_scale, guidance_scale},
+                                            step_kernels::split_guidance_batch(noise_pred),
+                                            m_guided_noise_pred.get_size());
+        return step(m_guided_noise_pred, latents, inference_step, generator);
+    }
+
     virtual void add_noise(ov::Tensor init_latent, ov::Tensor noise, int64_t latent_timestep) const = 0;
 
     virtual void set_timesteps(size_t image_seq_len, size_t num_inference_steps, float strength) {
@@ -46,6 +66,8 @@ public:
 
     virtual void set_begin_index(size_t begin_index) {};
 
+protected:
+    ov::Tensor m_guided_noise_pred;
 };
 
 } // namespace genai
@@ -123,9 +123,16 @@ void LCMScheduler::set_timesteps(size_t num_inference_steps, float strength) {
 }
 
 std::map<std::string, ov::Tensor> LCMScheduler::step(ov::Tensor noise_pred, ov::Tensor latents, size_t inference_step, std::shared_ptr<Generator> generator) {
+    return _step(step_kernels::ModelOutput::plain(noise_pred), latents, inference_step, generator);
+}
+
+std::map<std::string, ov::Tensor> LCMScheduler::guided_step(ov::Tensor noise_pred, float guidance_scale, ov::Tensor latents, size_t inference_step, std::shared_ptr<Generator> generator) {
+    return _step(step_kernels::ModelOutput::guided(noise_pred, guidance_scale), latents, inference_step, generator);
+}
+
+std::map<std::string, ov::Tensor> LCMScheduler::_step(const step_kernels::ModelOutput& model_output, ov::Tensor latents, size_t inference_step, std::shared_ptr<Generator> generator) {
     ov::Shape shape = latents.get_shape();
     size_t batch_size = shape[0], latent_size = ov::shape_size(shape) / batch_size;
-    float* noise_pred_data = noise_pred.data<float>();
     float* latents_data = latents.data<float>();
 
     // 1. get previous step value
@@ -148,61 +155,69 @@ std::map<std::string, ov::Tensor> LCMScheduler::step(ov::Tensor noise_pred, ov::
     float c_out = scaled_timestep / std::sqrt((std::pow(scaled_timestep, 2) + std::pow(m_sigma_data, 2)));
 
     // 4. Compute the predicted original sample x_0 based on the model parameterization
-    std::vector<std::vector<float>> predicted_original_sample(batch_size);
-    // "epsilon" by default
-    if (m_config.prediction_type == PredictionType::EPSILON) {
-        for (std::size_t i = 0; i < batch_size; ++i) {
-            std::vector<float>& predicted_original_sample_l = predicted_original_sample[i];
-            predicted_original_sample_l.resize(latent_size);
-
-            for (std::size_t j = 0; j < latent_size; ++j)
-                predicted_original_sample_l[j] = (latents_data[i * latent_size + j] -
-                    beta_prod_t_sqrt * noise_pred_data[i * latent_size + j]) / alpha_prod_t_sqrt;
-        }
+    // predicted_original_sample = sample_coeff * sample + model_coeff * model_output
+    float sample_coeff = 0.0f, model_coeff = 0.0f;
+    switch (m_config.prediction_type) {
+        case PredictionType::EPSILON:
+            sample_coeff = 1.0f / alpha_prod_t_sqrt;
+            model_coeff = -beta_prod_t_sqrt / alpha_prod_t_sqrt;
+            break;
+        case PredictionType::SAMPLE:
+            sample_coeff = 0.0f;
+            model_coeff = 1.0f;
+            break;
+        case PredictionType::V_PREDICTION:
+            sample_coeff = alpha_prod_t_sqrt;
+            model_coeff = -beta_prod_t_sqrt;
+            break;
+        default:
+            OPENVINO_THROW("Unsupported value for 'PredictionType'");
     }
 
-    // 5. Clip or threshold "predicted x_0"
-    if (m_config.thresholding) {
-        for (std::size_t i = 0; i < batch_size; ++i) {
-            predicted_original_sample[i] = threshold_sample(predicted_original_sample[i]);
-        }
-    } else if (m_config.clip_sample) {
-        for (std::size_t i = 0; i < batch_size; ++i) {
-            for (float& value : predicted_original_sample[i]) {
-                value = std::clamp(value, - m_config.clip_sample_range, m_config.clip_sample_range);
+    step_kernels::ensure_buffer(m_denoised, shape);
+    float* denoised_data = m_denoised.data<float>();
+
+    if (m_config.thresholding || m_config.clip_sample) {
+        step_kernels::step_combination(denoised_data, sample_coeff, latents_data, model_coeff, model_output, latents.get_size());
+
+        // 5. Clip or threshold "predicted x_0"
+        if (m_config.thresholding) {
+            for (std::size_t i = 0; i < batch_size; ++i) {
+                float* predicted_original_sample_l = denoised_data + i * latent_size;
+                std::vector<float> thresholded_sample = threshold_sample(std::vector<float>(predicted_original_sample_l, predicted_original_sample_l + latent_size));
+                std::copy(thresholded_sample.begin(), thresholded_sample.end(), predicted_original_sample_l);
+            }
+        } else {
+            for (std::size_t i = 0; i < batch_size * latent_size; ++i) {
+                denoised_data[i] = std::clamp(denoised_data[i], - m_config.clip_sample_range, m_config.clip_sample_range);
             }
         }
-    }
 
-    // 6. Denoise model output using boundary conditions
-    ov::Tensor denoised(latents.get_element_type(), shape);
-    float* denoised_data = denoised.data<float>();
-    for (std::size_t i = 0; i < batch_size; ++i) {
-        for (std::size_t j = 0; j < latent_size; ++j) {
-            denoised_data[i * latent_size + j] = c_out * predicted_original_sample[i][j] + c_skip * latents_data[i * latent_size + j];
-        }
+        // 6. Denoise model output using boundary conditions
+        step_kernels::linear_combination<2>(denoised_data, {c_out, c_skip}, {denoised_data, latents_data}, latents.get_size());
+    } else {
+        // 6. Denoise model output using boundary conditions
+        // denoised = c_out * predicted_original_sample + c_skip * sample is computed in a single pass
+        step_kernels::step_combination(denoised_data, c_out * sample_coeff + c_skip, latents_data, c_out * model_coeff, model_output, latents.get_size());
     }
 
     /// 7. Sample and inject noise z ~ N(0, I) for MultiStep Inference
     // Noise is not used on the final timestep of the timestep schedule.
     // This also means that noise is not used for one-step sampling.
-    ov::Tensor prev_sample(latents.get_element_type(), shape);
-    float* prev_sample_data = prev_sample.data<float>();
-
     if (inference_step != m_num_inference_steps - 1) {
         ov::Tensor rand_tensor = generator->randn_tensor(shape);
-        const float * rand_tensor_data = rand_tensor.data<float>();
 
-        for (std::size_t i = 0; i < batch_size * latent_size; ++i) {
-            prev_sample_data[i] = alpha_prod_t_prev_sqrt * denoised_data[i] + beta_prod_t_prev_sqrt * rand_tensor_data[i];
-        }
+        step_kernels::linear_combination<2>(latents_data,
+                                            {alpha_prod_t_prev_sqrt, beta_prod_t_prev_sqrt},
+                                            {denoised_data, rand_tensor.data<const float>()},
+                                            latents.get_size());
     } else {
-        std::copy_n(denoised_data, denoised.get_size(), prev_sample_data);
+        std::copy_n(denoised_data, m_denoised.get_size(), latents_data);
     }
 
     return {
-        {"latent", prev_sample},
-        {"denoised", denoised}
+        {"latent", latents},
+        {"denoised", m_denoised}
     };
 }
 
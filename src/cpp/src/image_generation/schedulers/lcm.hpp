@@ -52,6 +52,8 @@ public:
 
     std::map<std::string, ov::Tensor> step(ov::Tensor noise_pred, ov::Tensor latents, size_t inference_step, std::shared_ptr<Generator> generator) override;
 
+    std::map<std::string, ov::Tensor> guided_step(ov::Tensor noise_pred, float guidance_scale, ov::Tensor latents, size_t inference_step, std::shared_ptr<Generator> generator) override;
+
     void add_noise(ov::Tensor init_latent, ov::Tensor noise, int64_t latent_timestep) const override;
 
 private:
@@ -64,7 +66,11 @@ private:
 
     std::vector<int64_t> m_timesteps;
 
+    ov::Tensor m_denoised;
+
     std::vector<float> threshold_sample(const std::vector<float>& flat_sample);
+
+    std::map<std::string, ov::Tensor> _step(const step_kernels::ModelOutput& model_output, ov::Tensor latents, size_t inference_step, std::shared_ptr<Generator> generator);
 };
 
 } // namespace genai
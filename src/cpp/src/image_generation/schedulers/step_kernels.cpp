@@ -0,0 +1,155 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "image_generation/schedulers/step_kernels.hpp"
+
+#include <algorithm>
+
+#include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/core/visibility.hpp"
+
+// SIMD headers
+#if defined(OPENVINO_ARCH_X86_64)
+#    ifdef _MSC_VER
+#        include <intrin.h>
+#    else
+#        include <x86intrin.h>
+#    endif
+#endif
+
+namespace ov {
+namespace genai {
+namespace step_kernels {
+
+namespace {
+
+// 64KB of f32 values per task, so inputs and output of a chunk fit into L2 cache
+constexpr size_t CHUNK_SIZE = 16 * 1024;
+
+template <size_t N>
+inline void combine_chunk(float* out, const std::array<float, N>& coeffs, const std::array<const float*, N>& inputs, size_t begin, size_t end) {
+    size_t i = begin;
+
+#ifdef __AVX__
+    // AVX: Process 8 floats at a time
+    __m256 coeffs_vec[N];
+    for (size_t k = 0; k < N; ++k)
+        coeffs_vec[k] = _mm256_set1_ps(coeffs[k]);
+    for (; i + 8 <= end; i += 8) {
+        __m256 acc = _mm256_mul_ps(coeffs_vec[0], _mm256_loadu_ps(inputs[0] + i));
+        for (size_t k = 1; k < N; ++k)
+            acc = _mm256_add_ps(acc, _mm256_mul_ps(coeffs_vec[k], _mm256_loadu_ps(inputs[k] + i)));
+        _mm256_storeu_ps(out + i, acc);
+    }
+#elif defined(__SSE2__)
+    // SSE2: Process 4 floats at a time
+    __m128 coeffs_vec[N];
+    for (size_t k = 0; k < N; ++k)
+        coeffs_vec[k] = _mm_set1_ps(coeffs[k]);
+    for (; i + 4 <= end; i += 4) {
+        __m128 acc = _mm_mul_ps(coeffs_vec[0], _mm_loadu_ps(inputs[0] + i));
+        for (size_t k = 1; k < N; ++k)
+            acc = _mm_add_ps(acc, _mm_mul_ps(coeffs_vec[k], _mm_loadu_ps(inputs[k] + i)));
+        _mm_storeu_ps(out + i, acc);
+    }
+#endif
+
+    // Process remaining elements with scalar code
+    for (; i < end; ++i) {
+        float acc = coeffs[0] * inputs[0][i];
+        for (size_t k = 1; k < N; ++k)
+            acc += coeffs[k] * inputs[k][i];
+        out[i] = acc;
+    }
+}
+
+} // namespace
+
+template <size_t N>
+void linear_combination(float* out, const std::array<float, N>& coeffs, const std::array<const float*, N>& inputs, size_t size) {
+    const size_t num_chunks = (size + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    if (num_chunks <= 1) {
+        combine_chunk(out, coeffs, inputs, 0, size);
+        return;
+    }
+
+    ov::parallel_for(num_chunks, [&](size_t chunk) {
+        const size_t begin = chunk * CHUNK_SIZE;
+        combine_chunk(out, coeffs, inputs, begin, std::min(begin + CHUNK_SIZE, size));
+    });
+}
+
+template void linear_combination<1>(float*, const std::array<float, 1>&, const std::array<const float*, 1>&, size_t);
+template void linear_combination<2>(float*, const std::array<float, 2>&, const std::array<const float*, 2>&, size_t);
+template void linear_combination<3>(float*, const std::array<float, 3>&, const std::array<const float*, 3>&, size_t);
+template void linear_combination<4>(float*, const std::array<float, 4>&, const std::array<const float*, 4>&, size_t);
+
+std::array<const float*, 2> split_guidance_batch(const ov::Tensor& noise_pred) {
+    OPENVINO_ASSERT(noise_pred.get_shape()[0] % 2 == 0, "Noise prediction for classifier-free guidance must have even batch size");
+    const float* noise_pred_uncond = noise_pred.data<const float>();
+    return {noise_pred_uncond, noise_pred_uncond + noise_pred.get_size() / 2};
+}
+
+ModelOutput ModelOutput::plain(const ov::Tensor& noise_pred) {
+    ModelOutput model_output;
+    model_output.data[0] = noise_pred.data<const float>();
+    model_output.weights[0] = 1.0f;
+    model_output.num_terms = 1;
+    return model_output;
+}
+
+ModelOutput ModelOutput::guided(const ov::Tensor& noise_pred, float guidance_scale) {
+    // noise_pred_uncond + guidance_scale * (noise_pred_text - noise_pred_uncond)
+    ModelOutput model_output;
+    model_output.data = split_guidance_batch(noise_pred);
+    model_output.weights = {1.0f - guidance_scale, guidance_scale};
+    model_output.num_terms = 2;
+    return model_output;
+}
+
+void step_combination(float* out,
+                      float sample_coeff, const float* sample,
+                      float model_coeff, const ModelOutput& model_output,
+                      size_t size,
+                      float extra_coeff, const float* extra) {
+    OPENVINO_ASSERT(model_output.num_terms == 1 || model_output.num_terms == 2, "Unexpected number of model output terms");
+
+    std::array<float, 4> coeffs{sample_coeff};
+    std::array<const float*, 4> inputs{sample};
+    size_t num_inputs = 1;
+
+    for (size_t k = 0; k < model_output.num_terms; ++k, ++num_inputs) {
+        coeffs[num_inputs] = model_coeff * model_output.weights[k];
+        inputs[num_inputs] = model_output.data[k];
+    }
+    if (extra) {
+        coeffs[num_inputs] = extra_coeff;
+        inputs[num_inputs] = extra;
+        ++num_inputs;
+    }
+
+    switch (num_inputs) {
+    case 2:
+        linear_combination<2>(out, {coeffs[0], coeffs[1]}, {inputs[0], inputs[1]}, size);
+        break;
+    case 3:
+        linear_combination<3>(out, {coeffs[0], coeffs[1], coeffs[2]}, {inputs[0], inputs[1], inputs[2]}, size);
+        break;
+    default:
+        linear_combination<4>(out, coeffs, inputs, size);
+        break;
+    }
+}
+
+void ensure_buffer(ov::Tensor& buffer, const ov::Shape& shape) {
+    if (!buffer) {
+        buffer = ov::Tensor(ov::element::f32, shape);
+    } else if (buffer.get_shape() != shape) {
+        buffer.set_shape(shape);
+    }
+}
+
+} // namespace step_kernels
+} // namespace genai
+} // namespace ov
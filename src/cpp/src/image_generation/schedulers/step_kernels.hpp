@@ -0,0 +1,68 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include "openvino/runtime/tensor.hpp"
+
+namespace ov {
+namespace genai {
+namespace step_kernels {
+
+/**
+ * Computes out[i] = coeffs[0] * inputs[0][i] + ... + coeffs[N - 1] * inputs[N - 1][i] in a single pass.
+ * Scheduler steps and classifier-free guidance are linear in latents and noise predictions, so they are
+ * expressed as such combinations with step-dependent coefficients.
+ * Work is split into cache-friendly chunks processed in parallel and vectorized within a chunk.
+ * 'out' may alias any of 'inputs', since each element is computed from the same index only.
+ */
+template <size_t N>
+void linear_combination(float* out, const std::array<float, N>& coeffs, const std::array<const float*, N>& inputs, size_t size);
+
+extern template void linear_combination<1>(float*, const std::array<float, 1>&, const std::array<const float*, 1>&, size_t);
+extern template void linear_combination<2>(float*, const std::array<float, 2>&, const std::array<const float*, 2>&, size_t);
+extern template void linear_combination<3>(float*, const std::array<float, 3>&, const std::array<const float*, 3>&, size_t);
+extern template void linear_combination<4>(float*, const std::array<float, 4>&, const std::array<const float*, 4>&, size_t);
+
+/**
+ * Splits noise prediction of [2 * N, ...] shape into unconditional (first half) and text conditioned (second half)
+ * predictions and returns pointers to them.
+ */
+std::array<const float*, 2> split_guidance_batch(const ov::Tensor& noise_pred);
+
+/**
+ * Model output consumed by a scheduler step: either noise prediction as is, or classifier-free guidance
+ * weights[0] * data[0] + weights[1] * data[1] over unconditional and text conditioned predictions.
+ * Guided prediction is never materialized, instead it's folded into coefficients of a step.
+ */
+struct ModelOutput {
+    std::array<const float*, 2> data = {};
+    std::array<float, 2> weights = {};
+    size_t num_terms = 0;
+
+    static ModelOutput plain(const ov::Tensor& noise_pred);
+
+    static ModelOutput guided(const ov::Tensor& noise_pred, float guidance_scale);
+};
+
+/**
+ * Computes out = sample_coeff * sample + model_coeff * model_output + extra_coeff * extra in a single pass,
+ * where 'extra' term (e.g. noise injected by ancestral samplers) is optional.
+ */
+void step_combination(float* out,
+                      float sample_coeff, const float* sample,
+                      float model_coeff, const ModelOutput& model_output,
+                      size_t size,
+                      float extra_coeff = 0.0f, const float* extra = nullptr);
+
+/**
+ * Resizes 'buffer' to 'shape' reusing its memory when possible.
+ */
+void ensure_buffer(ov::Tensor& buffer, const ov::Shape& shape);
+
+} // namespace step_kernels
+} // namespace genai
+} // namespace ov
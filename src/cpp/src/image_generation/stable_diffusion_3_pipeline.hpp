@@ -6,6 +6,7 @@
 #include <cassert>
 
 #include "image_generation/diffusion_pipeline.hpp"
+#include "image_generation/denoiser_step_cache.hpp"
 #include "image_generation/threaded_callback.hpp"
 
 #include "openvino/genai/image_generation/clip_text_model.hpp"
@@ -326,20 +327,16 @@ public:
         std::string negative_prompt_3_str = generation_config.negative_prompt_3 != std::nullopt ? *generation_config.negative_prompt_3 : negative_prompt_1_str;
 
         // text_encoder_1_output - stores positive and negative pooled_prompt_embeds
-        auto infer_start = std::chrono::steady_clock::now();
-        ov::Tensor text_encoder_1_output = m_clip_text_encoder_1->infer(positive_prompt, negative_prompt_1_str, do_classifier_free_guidance(generation_config.guidance_scale));
-        auto infer_duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - infer_start).count();
-        m_perf_metrics.encoder_inference_duration["text_encode"] = infer_duration;
+        ov::Tensor text_encoder_1_output = infer_text_encoder(m_clip_text_encoder_1, "text_encode", generation_config,
+            positive_prompt, negative_prompt_1_str, do_classifier_free_guidance(generation_config.guidance_scale));
 
         // text_encoder_1_hidden_state - stores positive and negative prompt_embeds
         size_t idx_hidden_state_1 = m_clip_text_encoder_1->get_config().num_hidden_layers + 1;
         ov::Tensor text_encoder_1_hidden_state = m_clip_text_encoder_1->get_output_tensor(idx_hidden_state_1);
 
         // text_encoder_2_output - stores positive and negative pooled_prompt_2_embeds
-        infer_start = std::chrono::steady_clock::now();
-        ov::Tensor text_encoder_2_output = m_clip_text_encoder_2->infer(prompt_2_str, negative_prompt_2_str, do_classifier_free_guidance(generation_config.guidance_scale));
-        infer_duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - infer_start).count();
-        m_perf_metrics.encoder_inference_duration["text_encode_2"] = infer_duration;
+        ov::Tensor text_encoder_2_output = infer_text_encoder(m_clip_text_encoder_2, "text_encode_2", generation_config,
+            prompt_2_str, negative_prompt_2_str, do_classifier_free_guidance(generation_config.guidance_scale));
 
         // text_encoder_2_hidden_state - stores positive and negative prompt_2_embeds
         size_t idx_hidden_state_2 = m_clip_text_encoder_2->get_config().num_hidden_layers + 1;
@@ -347,15 +344,11 @@ public:
 
         ov::Tensor text_encoder_3_output;
         if (m_t5_text_encoder) {
-            infer_start = std::chrono::steady_clock::now();
-            text_encoder_3_output = m_t5_text_encoder->infer(prompt_3_str,
-                                                             negative_prompt_3_str,
-                                                             do_classifier_free_guidance(generation_config.guidance_scale),
-                                                             generation_config.max_sequence_length);
-            auto infer_duration =
-                std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - infer_start)
-                    .count();
-            m_perf_metrics.encoder_inference_duration["text_encode_3"] = infer_duration;
+            text_encoder_3_output = infer_text_encoder(m_t5_text_encoder, "text_encode_3", generation_config,
+                                                       prompt_3_str,
+                                                       negative_prompt_3_str,
+                                                       do_classifier_free_guidance(generation_config.guidance_scale),
+                                                       generation_config.max_sequence_length);
         } else {
             ov::Shape t5_prompt_embed_shape = {batch_size_multiplier,
                                                m_clip_text_encoder_1->get_config().max_position_embeddings,
@@ -562,7 +555,7 @@ public:
         ov::Tensor latent_cfg(ov::element::f32, latent_shape_cfg);
 
         // 7. Denoising loop
-        ov::Tensor noisy_residual_tensor(ov::element::f32, {});
+        DenoiserStepCache step_cache(generation_config, timesteps.size());
 
         for (size_t inference_step = 0; inference_step < timesteps.size(); ++inference_step) {
             auto step_start = std::chrono::steady_clock::now();
@@ -575,31 +568,22 @@ public:
                 latent_cfg = latent;
             }
             ov::Tensor timestep(ov::element::f32, {1}, &timesteps[inference_step]);
-            auto infer_start = std::chrono::steady_clock::now();
-            ov::Tensor noise_pred_tensor = m_transformer->infer(latent_cfg, timestep);
-            auto infer_duration = ov::genai::PerfMetrics::get_microsec(std::chrono::steady_clock::now() - infer_start);
-            m_perf_metrics.raw_metrics.transformer_inference_durations.emplace_back(MicroSeconds(infer_duration));
-
-            ov::Shape noise_pred_shape = noise_pred_tensor.get_shape();
-            noise_pred_shape[0] /= batch_size_multiplier;
-
-            if (batch_size_multiplier > 1) {
-                noisy_residual_tensor.set_shape(noise_pred_shape);
-
-                // perform guidance
-                float* noisy_residual = noisy_residual_tensor.data<float>();
-                const float* noise_pred_uncond = noise_pred_tensor.data<const float>();
-                const float* noise_pred_text = noise_pred_uncond + noisy_residual_tensor.get_size();
-
-                for (size_t i = 0; i < noisy_residual_tensor.get_size(); ++i) {
-                    noisy_residual[i] = noise_pred_uncond[i] +
-                                        generation_config.guidance_scale * (noise_pred_text[i] - noise_pred_uncond[i]);
-                }
+            ov::Tensor noise_pred_tensor;
+            if (step_cache.should_compute(inference_step, latent_cfg)) {
+                auto infer_start = std::chrono::steady_clock::now();
+                noise_pred_tensor = m_transformer->infer(latent_cfg, timestep);
+                auto infer_duration = ov::genai::PerfMetrics::get_microsec(std::chrono::steady_clock::now() - infer_start);
+                m_perf_metrics.raw_metrics.transformer_inference_durations.emplace_back(MicroSeconds(infer_duration));
+                step_cache.update(noise_pred_tensor);
             } else {
-                noisy_residual_tensor = noise_pred_tensor;
+                noise_pred_tensor = step_cache.get_cached_output();
+                m_perf_metrics.raw_metrics.cached_steps.push_back(inference_step);
             }
 
-            auto scheduler_step_result = m_scheduler->step(noisy_residual_tensor, latent, inference_step, generation_config.generator);
+            // perform guidance fused with scheduler step
+            auto scheduler_step_result = batch_size_multiplier > 1 ?
+                m_scheduler->guided_step(noise_pred_tensor, generation_config.guidance_scale, latent, inference_step, generation_config.generator) :
+                m_scheduler->step(noise_pred_tensor, latent, inference_step, generation_config.generator);
             latent = scheduler_step_result["latent"];
 
             if (m_pipeline_type == PipelineType::INPAINTING && !is_inpainting_model()) {
@@ -625,7 +609,7 @@ public:
             callback_ptr->end();
         }
         auto decode_start = std::chrono::steady_clock::now();
-        auto image = decode(latent);
+        auto image = vae_decode(latent, generation_config);
         m_perf_metrics.vae_decoder_inference_duration =
             std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - decode_start)
                 .count();
@@ -635,7 +619,7 @@ public:
     }
 
     ov::Tensor decode(const ov::Tensor latent) override {
-        return m_vae->decode(latent);
+        return vae_decode(latent, m_generation_config);
     }
 
     ImageGenerationPerfMetrics get_performance_metrics() override {
@@ -746,6 +730,7 @@ private:
 
     void check_inputs(const ImageGenerationConfig& generation_config, ov::Tensor initial_image) const override {
         check_image_size(generation_config.height, generation_config.width);
+        check_vae_tiling(generation_config);
 
         const bool is_classifier_free_guidance = do_classifier_free_guidance(generation_config.guidance_scale);
 
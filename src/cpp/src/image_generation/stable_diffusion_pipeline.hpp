@@ -9,6 +9,7 @@
 #include <filesystem>
 
 #include "image_generation/diffusion_pipeline.hpp"
+#include "image_generation/denoiser_step_cache.hpp"
 #include "image_generation/threaded_callback.hpp"
 
 #include "openvino/genai/image_generation/clip_text_model.hpp"
@@ -196,11 +197,8 @@ public:
         const size_t batch_size_multiplier = m_unet->do_classifier_free_guidance(generation_config.guidance_scale) ? 2 : 1;  // Unet accepts 2x batch in case of CFG
 
         std::string negative_prompt = generation_config.negative_prompt != std::nullopt ? *generation_config.negative_prompt : std::string{};
-        auto infer_start = std::chrono::steady_clock::now();
-        ov::Tensor encoder_hidden_states = m_clip_text_encoder->infer(positive_prompt, negative_prompt,
-            batch_size_multiplier > 1);
-        auto infer_duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - infer_start).count();
-        m_perf_metrics.encoder_inference_duration["text_encoder"] = infer_duration;
+        ov::Tensor encoder_hidden_states = infer_text_encoder(m_clip_text_encoder, "text_encoder", generation_config,
+            positive_prompt, negative_prompt, batch_size_multiplier > 1);
 
         // replicate encoder hidden state to UNet model
         if (generation_config.num_images_per_prompt == 1) {
@@ -346,7 +344,8 @@ public:
         ov::Shape latent_shape_cfg = latent.get_shape();
         latent_shape_cfg[0] *= batch_size_multiplier;
 
-        ov::Tensor latent_cfg(ov::element::f32, latent_shape_cfg), denoised, noisy_residual_tensor(ov::element::f32, {}), latent_model_input;
+        ov::Tensor latent_cfg(ov::element::f32, latent_shape_cfg), denoised, latent_model_input;
+        DenoiserStepCache step_cache(generation_config, timesteps.size());
 
         for (size_t inference_step = 0; inference_step < timesteps.size(); inference_step++) {
             auto step_start = std::chrono::steady_clock::now();
@@ -360,31 +359,22 @@ public:
 
             ov::Tensor latent_model_input = is_inpainting_model() ? numpy_utils::concat(numpy_utils::concat(latent_cfg, mask, 1), masked_image_latent, 1) : latent_cfg;
             ov::Tensor timestep(ov::element::i64, {1}, &timesteps[inference_step]);
-            auto infer_start = std::chrono::steady_clock::now();
-            ov::Tensor noise_pred_tensor = m_unet->infer(latent_model_input, timestep);
-            auto infer_duration = ov::genai::PerfMetrics::get_microsec(std::chrono::steady_clock::now() - infer_start);
-            m_perf_metrics.raw_metrics.unet_inference_durations.emplace_back(MicroSeconds(infer_duration));
-
-            ov::Shape noise_pred_shape = noise_pred_tensor.get_shape();
-            noise_pred_shape[0] /= batch_size_multiplier;
-
-            if (batch_size_multiplier > 1) {
-                noisy_residual_tensor.set_shape(noise_pred_shape);
-
-                // perform guidance
-                float* noisy_residual = noisy_residual_tensor.data<float>();
-                const float* noise_pred_uncond = noise_pred_tensor.data<const float>();
-                const float* noise_pred_text = noise_pred_uncond + noisy_residual_tensor.get_size();
-
-                for (size_t i = 0; i < noisy_residual_tensor.get_size(); ++i) {
-                    noisy_residual[i] = noise_pred_uncond[i] +
-                        generation_config.guidance_scale * (noise_pred_text[i] - noise_pred_uncond[i]);
-                }
+            ov::Tensor noise_pred_tensor;
+            if (step_cache.should_compute(inference_step, latent_model_input)) {
+                auto infer_start = std::chrono::steady_clock::now();
+                noise_pred_tensor = m_unet->infer(latent_model_input, timestep);
+                auto infer_duration = ov::genai::PerfMetrics::get_microsec(std::chrono::steady_clock::now() - infer_start);
+                m_perf_metrics.raw_metrics.unet_inference_durations.emplace_back(MicroSeconds(infer_duration));
+                step_cache.update(noise_pred_tensor);
             } else {
-                noisy_residual_tensor = noise_pred_tensor;
+                noise_pred_tensor = step_cache.get_cached_output();
+                m_perf_metrics.raw_metrics.cached_steps.push_back(inference_step);
             }
 
-            auto scheduler_step_result = m_scheduler->step(noisy_residual_tensor, latent, inference_step, generation_config.generator);
+            // perform guidance fused with scheduler step
+            auto scheduler_step_result = batch_size_multiplier > 1 ?
+                m_scheduler->guided_step(noise_pred_tensor, generation_config.guidance_scale, latent, inference_step, generation_config.generator) :
+                m_scheduler->step(noise_pred_tensor, latent, inference_step, generation_config.generator);
             latent = scheduler_step_result["latent"];
 
             // in case of non-specialized inpainting model, we need manually mask current denoised latent and initial image latent
@@ -415,7 +405,7 @@ public:
             callback_ptr->end();
         }
         auto decode_start = std::chrono::steady_clock::now();
-        auto image = decode(denoised);
+        auto image = vae_decode(denoised, generation_config);
         m_perf_metrics.vae_decoder_inference_duration =
             std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - decode_start)
                 .count();
@@ -425,7 +415,7 @@ public:
     }
 
     ov::Tensor decode(const ov::Tensor latent) override {
-        return m_vae->decode(latent);
+        return vae_decode(latent, m_generation_config);
     }
 
     ImageGenerationPerfMetrics get_performance_metrics() override {
@@ -493,6 +483,7 @@ protected:
 
     void check_inputs(const ImageGenerationConfig& generation_config, ov::Tensor initial_image) const override {
         check_image_size(generation_config.height, generation_config.width);
+        check_vae_tiling(generation_config);
 
         const bool is_classifier_free_guidance = m_unet->do_classifier_free_guidance(generation_config.guidance_scale);
         const bool is_lcm = m_unet->get_config().time_cond_proj_dim > 0;
@@ -265,14 +265,10 @@ public:
         ov::Tensor encoder_hidden_states(ov::element::f32, {}), add_text_embeds(ov::element::f32, {});
 
         if (compute_negative_prompt) {
-            auto infer_start = std::chrono::steady_clock::now();
-            add_text_embeds = m_clip_text_encoder_with_projection->infer(positive_prompt, negative_prompt_1_str, batch_size_multiplier > 1);
-            auto infer_duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - infer_start).count();
-            m_perf_metrics.encoder_inference_duration["text_encoder_2"] = infer_duration;
-            infer_start = std::chrono::steady_clock::now();
-            m_clip_text_encoder->infer(prompt_2_str, negative_prompt_2_str, batch_size_multiplier > 1);
-            infer_duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - infer_start).count();
-            m_perf_metrics.encoder_inference_duration["text_encoder"] = infer_duration;
+            add_text_embeds = infer_text_encoder(m_clip_text_encoder_with_projection, "text_encoder_2", generation_config,
+                positive_prompt, negative_prompt_1_str, batch_size_multiplier > 1);
+            infer_text_encoder(m_clip_text_encoder, "text_encoder", generation_config,
+                prompt_2_str, negative_prompt_2_str, batch_size_multiplier > 1);
 
             // prompt_embeds = prompt_embeds.hidden_states[-2]
             ov::Tensor encoder_hidden_states_1 = m_clip_text_encoder->get_output_tensor(idx_hidden_state_1);
@@ -280,14 +276,10 @@ public:
 
             encoder_hidden_states = numpy_utils::concat(encoder_hidden_states_1, encoder_hidden_states_2, -1);
         } else {
-            auto infer_start = std::chrono::steady_clock::now();
-            ov::Tensor add_text_embeds_positive = m_clip_text_encoder_with_projection->infer(positive_prompt, negative_prompt_1_str, false);
-            auto infer_duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - infer_start).count();
-            m_perf_metrics.encoder_inference_duration["text_encoder_2"] = infer_duration;
-            infer_start = std::chrono::steady_clock::now();
-            m_clip_text_encoder->infer(prompt_2_str, negative_prompt_2_str, false);
-            infer_duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - infer_start).count();
-            m_perf_metrics.encoder_inference_duration["text_encoder"] = infer_duration;
+            ov::Tensor add_text_embeds_positive = infer_text_encoder(m_clip_text_encoder_with_projection, "text_encoder_2", generation_config,
+                positive_prompt, negative_prompt_1_str, false);
+            infer_text_encoder(m_clip_text_encoder, "text_encoder", generation_config,
+                prompt_2_str, negative_prompt_2_str, false);
 
             ov::Tensor encoder_hidden_states_1_positive = m_clip_text_encoder->get_output_tensor(idx_hidden_state_1);
             ov::Tensor encoder_hidden_states_2_positive = m_clip_text_encoder_with_projection->get_output_tensor(idx_hidden_state_2);
@@ -441,6 +433,7 @@ private:
 
     void check_inputs(const ImageGenerationConfig& generation_config, ov::Tensor initial_image) const override {
         check_image_size(generation_config.height, generation_config.width);
+        check_vae_tiling(generation_config);
 
         const bool is_classifier_free_guidance = m_unet->do_classifier_free_guidance(generation_config.guidance_scale);
         const char * const pipeline_name = "Stable Diffusion XL";
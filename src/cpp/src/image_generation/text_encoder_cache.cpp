@@ -0,0 +1,119 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "image_generation/text_encoder_cache.hpp"
+
+namespace ov {
+namespace genai {
+
+namespace {
+
+std::vector<ov::Tensor> copy_tensors(const std::vector<ov::Tensor>& tensors) {
+    std::vector<ov::Tensor> copies;
+    copies.reserve(tensors.size());
+    for (const auto& tensor : tensors) {
+        ov::Tensor copy(tensor.get_element_type(), tensor.get_shape());
+        tensor.copy_to(copy);
+        copies.push_back(copy);
+    }
+    return copies;
+}
+
+} // namespace
+
+TextEncoderCache::TextEncoderCache(size_t capacity)
+    : m_capacity(capacity) {
+}
+
+void TextEncoderCache::set_capacity(size_t capacity) {
+    m_capacity = capacity;
+    evict();
+}
+
+size_t TextEncoderCache::get_capacity() const {
+    return m_capacity;
+}
+
+size_t TextEncoderCache::size() const {
+    return m_entries.size();
+}
+
+void TextEncoderCache::clear() {
+    m_entries.clear();
+    m_index.clear();
+}
+
+std::string TextEncoderCache::make_key(const std::vector<ov::Tensor>& inputs) {
+    size_t key_size = 0;
+    for (const auto& input : inputs)
+        key_size += input.get_byte_size() + (input.get_shape().size() + 2) * sizeof(size_t);
+
+    std::string key;
+    key.reserve(key_size);
+
+    auto append = [&key] (const void* data, size_t size) {
+        key.append(static_cast<const char*>(data), size);
+    };
+
+    // element type and shape are a part of key, so inputs of different layouts never collide
+    for (const auto& input : inputs) {
+        const ov::Shape& shape = input.get_shape();
+        const size_t type_hash = input.get_element_type().hash(), rank = shape.size();
+        append(&type_hash, sizeof(type_hash));
+        append(&rank, sizeof(rank));
+        append(shape.data(), rank * sizeof(size_t));
+        append(input.data(), input.get_byte_size());
+    }
+
+    return key;
+}
+
+std::optional<std::vector<ov::Tensor>> TextEncoderCache::find(const std::string& key) {
+    auto it = m_index.find(key);
+    if (it == m_index.end())
+        return std::nullopt;
+
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+    return copy_tensors(it->second->second);
+}
+
+void TextEncoderCache::insert(const std::string& key, const ov::InferRequest& request) {
+    if (m_capacity == 0)
+        return;
+
+    const auto outputs = request.get_compiled_model().outputs();
+    std::vector<ov::Tensor> output_tensors;
+    output_tensors.reserve(outputs.size());
+    for (size_t idx = 0; idx < outputs.size(); ++idx)
+        output_tensors.push_back(request.get_output_tensor(idx));
+    insert(key, output_tensors);
+}
+
+void TextEncoderCache::insert(const std::string& key, const std::vector<ov::Tensor>& outputs) {
+    if (m_capacity == 0)
+        return;
+
+    // infer request outputs are overwritten by next inference, so keep own copies
+    std::vector<ov::Tensor> copies = copy_tensors(outputs);
+
+    auto it = m_index.find(key);
+    if (it != m_index.end()) {
+        it->second->second = std::move(copies);
+        m_entries.splice(m_entries.begin(), m_entries, it->second);
+        return;
+    }
+
+    m_entries.emplace_front(key, std::move(copies));
+    m_index.emplace(key, m_entries.begin());
+    evict();
+}
+
+void TextEncoderCache::evict() {
+    while (m_entries.size() > m_capacity) {
+        m_index.erase(m_entries.back().first);
+        m_entries.pop_back();
+    }
+}
+
+} // namespace genai
+} // namespace ov
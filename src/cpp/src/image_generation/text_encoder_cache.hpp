@@ -0,0 +1,61 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <list>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "openvino/runtime/tensor.hpp"
+#include "openvino/runtime/infer_request.hpp"
+
+namespace ov {
+namespace genai {
+
+/**
+ * Bounded LRU cache of text encoder outputs (hidden states, pooled embeddings) keyed by tokenized model inputs.
+ * Diffusion pipelines often encode the same prompts (e.g. style prompts, empty negative prompts) over and over,
+ * so text encoder inference can be skipped for them.
+ * Cache is owned by a single text encoder model: clones get their own empty cache, since they can have different
+ * adapters applied. It's not synchronized, as the model's infer request must not be used concurrently either.
+ */
+class TextEncoderCache {
+public:
+    explicit TextEncoderCache(size_t capacity);
+
+    // Changes cache capacity evicting least recently used entries; 0 disables caching
+    void set_capacity(size_t capacity);
+
+    size_t get_capacity() const;
+
+    size_t size() const;
+
+    void clear();
+
+    // Builds a key from exact content of tokenized model inputs
+    static std::string make_key(const std::vector<ov::Tensor>& inputs);
+
+    // Returns copies of cached model outputs, so callers may modify them, and marks entry as most recently used
+    std::optional<std::vector<ov::Tensor>> find(const std::string& key);
+
+    // Stores copies of all 'request' outputs; does nothing if capacity is 0
+    void insert(const std::string& key, const ov::InferRequest& request);
+
+    void insert(const std::string& key, const std::vector<ov::Tensor>& outputs);
+
+private:
+    using Entry = std::pair<std::string, std::vector<ov::Tensor>>;
+
+    void evict();
+
+    size_t m_capacity;
+    std::list<Entry> m_entries;  // most recently used entries go first
+    std::unordered_map<std::string, std::list<Entry>::iterator> m_index;
+};
+
+} // namespace genai
+} // namespace ov
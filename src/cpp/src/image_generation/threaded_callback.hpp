@@ -34,7 +34,10 @@ public:
             return CallbackStatus::STOP;
         }
 
-        m_squeue.push(std::make_tuple(step, num_steps, latent));
+        // schedulers update latents in place, while callback is processed asynchronously
+        ov::Tensor latent_copy(latent.get_element_type(), latent.get_shape());
+        latent.copy_to(latent_copy);
+        m_squeue.push(std::make_tuple(step, num_steps, latent_copy));
 
         return CallbackStatus::RUNNING;
     }
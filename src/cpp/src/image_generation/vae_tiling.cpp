@@ -0,0 +1,304 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "image_generation/vae_tiling.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <optional>
+
+#include "openvino/core/except.hpp"
+
+namespace ov {
+namespace genai {
+namespace vae_tiling {
+
+namespace {
+
+// Linear ramp weights over tile borders shared with neighbour tiles
+// Weights are never zero to keep normalization well defined
+std::vector<float> blend_weights(size_t size, size_t ramp, bool has_prev, bool has_next) {
+    std::vector<float> weights(size, 1.0f);
+    const float denominator = static_cast<float>(ramp + 1);
+    for (size_t i = 0; i < size; ++i) {
+        if (has_prev)
+            weights[i] = std::min(weights[i], static_cast<float>(i + 1) / denominator);
+        if (has_next)
+            weights[i] = std::min(weights[i], static_cast<float>(size - i) / denominator);
+    }
+    return weights;
+}
+
+// Accumulates weighted tiles within a band of lines of [outer, line, width, channels] layout
+// and emits normalized lines once they are complete
+class BlendBand {
+public:
+    BlendBand(size_t outer, size_t band_length, size_t width, size_t channels)
+        : m_outer(outer),
+          m_band_length(band_length),
+          m_width(width),
+          m_channels(channels),
+          m_accumulated(outer * band_length * width * channels, 0.0f),
+          m_weights(band_length * width, 0.0f) {}
+
+    // 'tile' is u8 data of [outer, line_weights.size(), x_weights.size(), channels] layout
+    void accumulate(const uint8_t* tile,
+                    size_t line_offset,
+                    size_t x_offset,
+                    const std::vector<float>& line_weights,
+                    const std::vector<float>& x_weights) {
+        const size_t num_lines = line_weights.size(), tile_width = x_weights.size();
+        OPENVINO_ASSERT(line_offset + num_lines <= m_band_length && x_offset + tile_width <= m_width,
+                        "Decoded tile is out of blending band");
+
+        for (size_t o = 0; o < m_outer; ++o) {
+            for (size_t l = 0; l < num_lines; ++l) {
+                const uint8_t* src = tile + (o * num_lines + l) * tile_width * m_channels;
+                float* dst = m_accumulated.data() + ((o * m_band_length + line_offset + l) * m_width + x_offset) * m_channels;
+                for (size_t x = 0; x < tile_width; ++x) {
+                    const float weight = line_weights[l] * x_weights[x];
+                    for (size_t c = 0; c < m_channels; ++c) {
+                        dst[x * m_channels + c] += weight * src[x * m_channels + c];
+                    }
+                }
+            }
+        }
+
+        for (size_t l = 0; l < num_lines; ++l) {
+            float* weights = m_weights.data() + (line_offset + l) * m_width + x_offset;
+            for (size_t x = 0; x < tile_width; ++x) {
+                weights[x] += line_weights[l] * x_weights[x];
+            }
+        }
+    }
+
+    // Writes 'num_lines' first lines to 'dst' which has 'dst_outer_stride' elements between outer slices
+    // and shifts the rest of band to its beginning
+    void flush(size_t num_lines, uint8_t* dst, size_t dst_outer_stride) {
+        OPENVINO_ASSERT(num_lines <= m_band_length, "Cannot flush more lines than blending band has");
+        const size_t line_size = m_width * m_channels;
+
+        for (size_t o = 0; o < m_outer; ++o) {
+            const float* band = m_accumulated.data() + o * m_band_length * line_size;
+            uint8_t* dst_slice = dst + o * dst_outer_stride;
+            for (size_t l = 0; l < num_lines; ++l) {
+                for (size_t x = 0; x < m_width; ++x) {
+                    const float weight = m_weights[l * m_width + x];
+                    const float scale = weight > 0.0f ? 1.0f / weight : 0.0f;
+                    for (size_t c = 0; c < m_channels; ++c) {
+                        const size_t idx = (l * m_width + x) * m_channels + c;
+                        dst_slice[idx] = static_cast<uint8_t>(std::clamp(std::round(band[idx] * scale), 0.0f, 255.0f));
+                    }
+                }
+            }
+        }
+
+        for (size_t o = 0; o < m_outer; ++o) {
+            float* band = m_accumulated.data() + o * m_band_length * line_size;
+            std::copy(band + num_lines * line_size, band + m_band_length * line_size, band);
+            std::fill(band + (m_band_length - num_lines) * line_size, band + m_band_length * line_size, 0.0f);
+        }
+        std::copy(m_weights.begin() + num_lines * m_width, m_weights.end(), m_weights.begin());
+        std::fill(m_weights.end() - num_lines * m_width, m_weights.end(), 0.0f);
+    }
+
+private:
+    size_t m_outer, m_band_length, m_width, m_channels;
+    std::vector<float> m_accumulated, m_weights;
+};
+
+// Passes 'num_lines' lines to callback or writes them to 'output' at 'offset'
+void emit_lines(BlendBand& band,
+                ov::Tensor& output,
+                const ov::Shape& output_shape,
+                size_t line_axis,
+                size_t offset,
+                size_t num_lines,
+                const DecodedCallback& callback) {
+    size_t line_size = 1;
+    for (size_t i = line_axis + 1; i < output_shape.size(); ++i)
+        line_size *= output_shape[i];
+
+    if (callback) {
+        ov::Shape shape = output_shape;
+        shape[line_axis] = num_lines;
+        ov::Tensor decoded(ov::element::u8, shape);
+        band.flush(num_lines, decoded.data<uint8_t>(), num_lines * line_size);
+        callback(offset, decoded);
+    } else {
+        band.flush(num_lines, output.data<uint8_t>() + offset * line_size, output_shape[line_axis] * line_size);
+    }
+}
+
+} // namespace
+
+std::vector<std::pair<size_t, size_t>> split_into_tiles(size_t length, size_t tile_size, size_t tile_overlap) {
+    OPENVINO_ASSERT(tile_size > tile_overlap, "Tile size ", tile_size, " must be greater than tile overlap ", tile_overlap);
+    if (length <= tile_size)
+        return {{0, length}};
+
+    std::vector<std::pair<size_t, size_t>> tiles;
+    const size_t stride = tile_size - tile_overlap;
+    for (size_t start = 0; ; start += stride) {
+        if (start + tile_size >= length) {
+            tiles.emplace_back(length - tile_size, tile_size);
+            break;
+        }
+        tiles.emplace_back(start, tile_size);
+    }
+    return tiles;
+}
+
+ov::Tensor spatial_tiled_decode(const ov::Tensor& latent,
+                                size_t scale_factor,
+                                size_t tile_size,
+                                size_t tile_overlap,
+                                const TileDecoder& decode_tile,
+                                const DecodedCallback& callback) {
+    const ov::Shape latent_shape = latent.get_shape();
+    const size_t rank = latent_shape.size();
+    OPENVINO_ASSERT(rank >= 4 && latent.get_element_type() == ov::element::f32,
+                    "Tiled decoding expects f32 latent of [N, C, (D,) H, W] shape");
+
+    const size_t height = latent_shape[rank - 2], width = latent_shape[rank - 1];
+    const auto tile_rows = split_into_tiles(height, tile_size, tile_overlap);
+    const auto tile_cols = split_into_tiles(width, tile_size, tile_overlap);
+
+    size_t latent_outer = 1;
+    for (size_t i = 0; i < rank - 2; ++i)
+        latent_outer *= latent_shape[i];
+
+    ov::Shape output_shape;
+    ov::Tensor output;
+    std::optional<BlendBand> band;
+
+    for (size_t r = 0; r < tile_rows.size(); ++r) {
+        const auto [y, tile_height] = tile_rows[r];
+        const std::vector<float> line_weights =
+            blend_weights(tile_height * scale_factor, tile_overlap * scale_factor, r > 0, r + 1 < tile_rows.size());
+
+        for (size_t c = 0; c < tile_cols.size(); ++c) {
+            const auto [x, tile_width] = tile_cols[c];
+
+            ov::Shape tile_shape = latent_shape;
+            tile_shape[rank - 2] = tile_height;
+            tile_shape[rank - 1] = tile_width;
+            ov::Tensor latent_tile(ov::element::f32, tile_shape);
+
+            const float* src = latent.data<const float>();
+            float* dst = latent_tile.data<float>();
+            for (size_t o = 0; o < latent_outer; ++o) {
+                for (size_t row = 0; row < tile_height; ++row) {
+                    std::memcpy(dst + (o * tile_height + row) * tile_width,
+                                src + (o * height + y + row) * width + x,
+                                tile_width * sizeof(float));
+                }
+            }
+
+            ov::Tensor decoded = decode_tile(latent_tile);
+            const ov::Shape& decoded_shape = decoded.get_shape();
+            const size_t decoded_rank = decoded_shape.size();
+            OPENVINO_ASSERT(decoded.get_element_type() == ov::element::u8 && decoded_rank >= 4 &&
+                            decoded_shape[decoded_rank - 3] == tile_height * scale_factor &&
+                            decoded_shape[decoded_rank - 2] == tile_width * scale_factor,
+                            "Unexpected shape of decoded tile ", decoded_shape);
+
+            if (!band) {
+                output_shape = decoded_shape;
+                output_shape[decoded_rank - 3] = height * scale_factor;
+                output_shape[decoded_rank - 2] = width * scale_factor;
+
+                size_t outer = 1;
+                for (size_t i = 0; i < decoded_rank - 3; ++i)
+                    outer *= decoded_shape[i];
+                const size_t band_length = std::min(tile_size, height) * scale_factor;
+                band.emplace(outer, band_length, width * scale_factor, decoded_shape.back());
+
+                if (!callback)
+                    output = ov::Tensor(ov::element::u8, output_shape);
+            }
+
+            band->accumulate(decoded.data<const uint8_t>(), 0, x * scale_factor, line_weights,
+                             blend_weights(tile_width * scale_factor, tile_overlap * scale_factor, c > 0, c + 1 < tile_cols.size()));
+        }
+
+        // rows above the next tile row are final
+        const size_t next_row = r + 1 < tile_rows.size() ? tile_rows[r + 1].first : height;
+        emit_lines(*band, output, output_shape, output_shape.size() - 3, y * scale_factor, (next_row - y) * scale_factor, callback);
+    }
+
+    return output;
+}
+
+ov::Tensor temporal_tiled_decode(const ov::Tensor& latent,
+                                 size_t temporal_scale,
+                                 size_t tile_num_frames,
+                                 size_t tile_frames_overlap,
+                                 const TileDecoder& decode_chunk,
+                                 const DecodedCallback& callback) {
+    const ov::Shape latent_shape = latent.get_shape();
+    OPENVINO_ASSERT(latent_shape.size() == 5 && latent.get_element_type() == ov::element::f32,
+                    "Temporal tiled decoding expects f32 latent of [N, C, D, H, W] shape");
+    OPENVINO_ASSERT(tile_frames_overlap >= 1, "Temporal tiles must overlap by at least one latent frame");
+
+    const size_t latent_frames = latent_shape[2], frame_size = latent_shape[3] * latent_shape[4];
+    const size_t latent_outer = latent_shape[0] * latent_shape[1];
+    const size_t num_frames = (latent_frames - 1) * temporal_scale + 1;
+    const size_t ramp = (tile_frames_overlap - 1) * temporal_scale + 1;
+    const auto chunks = split_into_tiles(latent_frames, tile_num_frames, tile_frames_overlap);
+
+    ov::Shape output_shape;
+    ov::Tensor output;
+    std::optional<BlendBand> band;
+
+    for (size_t k = 0; k < chunks.size(); ++k) {
+        const auto [start, chunk_size] = chunks[k];
+
+        ov::Shape chunk_shape = latent_shape;
+        chunk_shape[2] = chunk_size;
+        ov::Tensor latent_chunk(ov::element::f32, chunk_shape);
+
+        const float* src = latent.data<const float>();
+        float* dst = latent_chunk.data<float>();
+        for (size_t o = 0; o < latent_outer; ++o) {
+            std::memcpy(dst + o * chunk_size * frame_size,
+                        src + (o * latent_frames + start) * frame_size,
+                        chunk_size * frame_size * sizeof(float));
+        }
+
+        // first latent frame of a chunk is decoded into a single frame, which corresponds to the last frame of
+        // the previous latent frame, so decoded frame 'j' of the chunk is frame 'start * temporal_scale + j' of the video
+        const size_t chunk_frames = (chunk_size - 1) * temporal_scale + 1;
+        ov::Tensor decoded = decode_chunk(latent_chunk);
+        const ov::Shape& decoded_shape = decoded.get_shape();
+        OPENVINO_ASSERT(decoded.get_element_type() == ov::element::u8 && decoded_shape.size() == 5 &&
+                        decoded_shape[1] == chunk_frames,
+                        "Unexpected shape of decoded chunk ", decoded_shape);
+
+        if (!band) {
+            output_shape = decoded_shape;
+            output_shape[1] = num_frames;
+
+            const size_t band_length = (std::min(tile_num_frames, latent_frames) - 1) * temporal_scale + 1;
+            band.emplace(decoded_shape[0], band_length, 1, decoded_shape[2] * decoded_shape[3] * decoded_shape[4]);
+
+            if (!callback)
+                output = ov::Tensor(ov::element::u8, output_shape);
+        }
+
+        band->accumulate(decoded.data<const uint8_t>(), 0, 0,
+                         blend_weights(chunk_frames, ramp, k > 0, k + 1 < chunks.size()), {1.0f});
+
+        // frames before the next chunk are final
+        const size_t offset = start * temporal_scale;
+        const size_t next_offset = k + 1 < chunks.size() ? chunks[k + 1].first * temporal_scale : num_frames;
+        emit_lines(*band, output, output_shape, 1, offset, next_offset - offset, callback);
+    }
+
+    return output;
+}
+
+} // namespace vae_tiling
+} // namespace genai
+} // namespace ov
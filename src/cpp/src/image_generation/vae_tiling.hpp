@@ -0,0 +1,60 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "openvino/runtime/tensor.hpp"
+
+namespace ov {
+namespace genai {
+namespace vae_tiling {
+
+// decodes a single latent tile / chunk via VAE decoder
+using TileDecoder = std::function<ov::Tensor(const ov::Tensor& latent_tile)>;
+
+// receives decoded output rows / frames which are not going to be changed anymore
+// together with index of the first row / frame within the whole output
+using DecodedCallback = std::function<void(size_t offset, const ov::Tensor& decoded)>;
+
+// Splits [0, length) into tiles of 'tile_size' with at least 'tile_overlap' overlap
+// Returns pairs of (start, size); the last tile is aligned to the end of range
+std::vector<std::pair<size_t, size_t>> split_into_tiles(size_t length, size_t tile_size, size_t tile_overlap);
+
+/**
+ * Decodes latent of [N, C, (D,) H, W] shape by overlapping spatial tiles and linearly blends overlapped areas.
+ * 'decode_tile' must return u8 tensor of [N, (D',) H * scale_factor, W * scale_factor, C'] shape.
+ * Tiles are decoded row by row and only a band of 'tile_size' rows is kept in memory, so if 'callback' is specified,
+ * decoded rows are passed to callback as soon as they are blended and an empty tensor is returned.
+ * @param tile_size Tile size in latent space
+ * @param tile_overlap Tile overlap in latent space
+ */
+ov::Tensor spatial_tiled_decode(const ov::Tensor& latent,
+                                size_t scale_factor,
+                                size_t tile_size,
+                                size_t tile_overlap,
+                                const TileDecoder& decode_tile,
+                                const DecodedCallback& callback = nullptr);
+
+/**
+ * Decodes video latent of [N, C, D, H, W] shape by overlapping temporal chunks for causal video VAE, where
+ * the first latent frame of a chunk is decoded into a single frame and other latent frames into 'temporal_scale' frames.
+ * 'decode_chunk' must return u8 tensor of [N, (d - 1) * temporal_scale + 1, H', W', C'] shape for chunk of 'd' latent frames.
+ * If 'callback' is specified, decoded frames are passed to callback as soon as they are blended and an empty tensor is returned.
+ * @param tile_num_frames Chunk size in latent frames
+ * @param tile_frames_overlap Chunk overlap in latent frames, must be at least 1
+ */
+ov::Tensor temporal_tiled_decode(const ov::Tensor& latent,
+                                 size_t temporal_scale,
+                                 size_t tile_num_frames,
+                                 size_t tile_frames_overlap,
+                                 const TileDecoder& decode_chunk,
+                                 const DecodedCallback& callback = nullptr);
+
+} // namespace vae_tiling
+} // namespace genai
+} // namespace ov
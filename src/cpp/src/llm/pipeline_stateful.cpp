@@ -160,7 +160,7 @@ DecodedResults StatefulLLMPipeline::generate(
             m_history.push_back({{"role", "user"}, {"content", (*input_vector)[0]}});
             constexpr bool add_generation_prompt = true;
             auto new_templated_chat_history = m_tokenizer.apply_chat_template(m_history, add_generation_prompt);
-            auto new_chat_tokens = m_tokenizer.encode(new_templated_chat_history, ov::genai::add_special_tokens(false));
+            auto new_chat_tokens = m_chat_tokenization_cache.encode(m_tokenizer, new_templated_chat_history);
 
             if (m_use_full_chat_history) {
                 encoded_input = new_chat_tokens;
@@ -188,7 +188,7 @@ DecodedResults StatefulLLMPipeline::generate(
             constexpr bool add_generation_prompt = true;
             auto new_templated_chat_history = m_tokenizer.apply_chat_template(m_history, add_generation_prompt);
             // Do not add special tokens in chat scenario to be aligned with HF.
-            auto new_chat_tokens = m_tokenizer.encode(new_templated_chat_history, ov::genai::add_special_tokens(false));
+            auto new_chat_tokens = m_chat_tokenization_cache.encode(m_tokenizer, new_templated_chat_history);
 
             if (m_use_full_chat_history) {
                 encoded_input = new_chat_tokens;
@@ -263,13 +263,14 @@ DecodedResults StatefulLLMPipeline::generate(
         reset_kv_state();
         m_model_runner.get_tensor("attention_mask").set_shape({1, 0});
         m_kv_cache_state.reset_state();
+        m_chat_tokenization_cache.reset();
     }
 
     m_history = history;
 
     constexpr bool add_generation_prompt = true;
     auto new_templated_chat_history = m_tokenizer.apply_chat_template(m_history, add_generation_prompt);
-    auto new_chat_tokens = m_tokenizer.encode(new_templated_chat_history, ov::genai::add_special_tokens(false));
+    auto new_chat_tokens = m_chat_tokenization_cache.encode(m_tokenizer, new_templated_chat_history);
 
     TokenizedInputs encoded_input;
     if (m_use_full_chat_history) {
@@ -512,6 +513,7 @@ void StatefulLLMPipeline::finish_chat() {
         m_tokenized_chat_history.clear();
         m_kv_cache_state.reset_state();
     }
+    m_chat_tokenization_cache.reset();
 }
 
 StatefulLLMPipeline::~StatefulLLMPipeline() {
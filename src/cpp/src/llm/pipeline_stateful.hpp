@@ -7,6 +7,7 @@
 #include "llm/pipeline_base.hpp"
 #include "lm_encoding.hpp"
 #include "sampling/sampler.hpp"
+#include "tokenizer/chat_tokenization_cache.hpp"
 #include "utils.hpp"
 
 namespace ov::genai {
@@ -19,6 +20,8 @@ class StatefulLLMPipeline final : public LLMPipelineImplBase {
     bool is_chat_conversation = false;
     ChatHistory m_history;
     std::vector<int64_t> m_tokenized_chat_history;
+    // tokens of templated history from previous iteration, so only new messages are tokenized
+    ChatTokenizationCache m_chat_tokenization_cache;
     ov::genai::utils::GenerationChatInputsType m_chat_input_type = ov::genai::utils::GenerationChatInputsType::UNDEF;
     // Finish reason of last generation for chat scenario
     ov::genai::GenerationStatus m_chat_generation_finish_status = ov::genai::GenerationStatus::RUNNING;
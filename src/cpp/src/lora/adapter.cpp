@@ -5,6 +5,7 @@
 #include <set>
 #include <map>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <fstream>
 #include <optional>
@@ -15,6 +16,10 @@
 #include <functional>
 #include <memory>
 #include <cmath>
+#include <mutex>
+#include <atomic>
+#include <list>
+#include <sstream>
 
 #include "openvino/op/add.hpp"
 #include "openvino/op/multiply.hpp"
@@ -31,17 +36,23 @@
 #include "openvino/op/gather.hpp"
 #include "openvino/op/divide.hpp"
 #include "openvino/op/shape_of.hpp"
+#include "openvino/op/equal.hpp"
+#include "openvino/op/unsqueeze.hpp"
+#include "openvino/op/parameter.hpp"
 #include "openvino/op/util/variable.hpp"
 #include "openvino/pass/pattern/matcher.hpp"
 #include "openvino/pass/pattern/op/wrap_type.hpp"
 #include "openvino/pass/graph_rewrite.hpp"
 #include "openvino/pass/manager.hpp"
+#include "openvino/runtime/properties.hpp"
 
 #include "openvino/genai/lora_adapter.hpp"
 
 #include "utils.hpp"
 #include "lora/common.hpp"
 #include "lora/names_mapping.hpp"
+#include "lora/multi_slot_adapter_controller.hpp"
+#include "lora/fused_delta_cache.hpp"
 
 #ifdef ENABLE_GGUF
 #include <algorithm>
@@ -137,22 +148,72 @@ ConstantMap read_safetensors(const std::filesystem::path& filename) {
     return safetensor_to_constant_map(safetensor);
 }
 
+bool is_lora_name_separator(char c) {
+    return c == '_' || c == '.';
+}
+
+bool ends_with(std::string_view name, std::string_view suffix) {
+    return name.size() >= suffix.size() && name.compare(name.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+namespace ov {
+namespace genai {
+namespace utils {
+
+std::optional<std::string> parse_lora_weight_name(std::string_view name, std::initializer_list<std::string_view> kinds, std::string_view legacy_kind) {
+    constexpr std::string_view weight_suffix = ".weight", lora = "lora";
+    if (!ends_with(name, weight_suffix)) {
+        return std::nullopt;
+    }
+    const std::string_view stem = name.substr(0, name.size() - weight_suffix.size());
+    for (std::string_view kind : kinds) {
+        const size_t tail_size = 1 + lora.size() + 1 + kind.size();
+        if (stem.size() >= tail_size && ends_with(stem, kind) &&
+            is_lora_name_separator(stem[stem.size() - kind.size() - 1]) &&
+            stem.substr(stem.size() - tail_size + 1, lora.size()) == lora &&
+            is_lora_name_separator(stem[stem.size() - tail_size])) {
+            return std::string(stem.substr(0, stem.size() - tail_size));
+        }
+    }
+    if (stem.size() > legacy_kind.size() && ends_with(stem, legacy_kind) && stem[stem.size() - legacy_kind.size() - 1] == '.') {
+        const std::string_view prefix = stem.substr(0, stem.size() - legacy_kind.size() - 1);
+        if (!prefix.empty() && (prefix.back() == '1' || prefix.back() == '2') && ends_with(prefix.substr(0, prefix.size() - 1), lora)) {
+            return std::string(prefix);
+        }
+    }
+    return std::nullopt;
+}
+
+}  // namespace utils
+}  // namespace genai
+}  // namespace ov
+
+// Returns a part of the name before a given suffix, or the whole name if keep_suffix is set
+std::optional<std::string> parse_name_with_suffix(std::string_view name, std::string_view suffix, bool keep_suffix) {
+    if (!ends_with(name, suffix)) {
+        return std::nullopt;
+    }
+    return std::string(keep_suffix ? name : name.substr(0, name.size() - suffix.size()));
+}
+
 // Default LoRA tensor name patterns observed in the existing LoRA adapters, captures the prefix that should correspond
 // to a layer name in the base model
 LoRAPartsParser default_lora_patterns () {
     return LoRAPartsParser(
-        RegexParser("(.*)\\.alpha", 1),
-        RegexParser("((.*)[_.](lora[_.](A|down)\\.weight))|((.*lora[12])\\.(down\\.weight))", {2, 6}),
-        RegexParser("((.*)[_.](lora[_.](B|up)\\.weight))|((.*lora[12])\\.(up\\.weight))", {2, 6})
+        [](const std::string& name) { return parse_name_with_suffix(name, ".alpha", false); },
+        [](const std::string& name) { return parse_lora_weight_name(name, {"A", "down"}, "down"); },
+        [](const std::string& name) { return parse_lora_weight_name(name, {"B", "up"}, "up"); }
     );
 }
 
+using LoRAConstantNameParser = std::function<std::optional<std::string>(const std::string& name)>;
+
 // Default LoRA tensor name patterns observed in the existing LoRA weights, captures the prefix that should correspond
 // to a layer name in the base model. Example: https://hf-mirror.com/hfl/llama-3-chinese-8b-lora
-std::vector<RegexParser> default_lora_constant_patterns () {
+std::vector<LoRAConstantNameParser> default_lora_constant_patterns () {
     return {
-        RegexParser("(.*)\\.lm_head\\.weight", 0),
-        RegexParser("(.*)\\.embed_tokens\\.weight", 0),
+        [](const std::string& name) { return parse_name_with_suffix(name, ".lm_head.weight", true); },
+        [](const std::string& name) { return parse_name_with_suffix(name, ".embed_tokens.weight", true); },
     };
 }
 
@@ -182,7 +243,7 @@ LoRATensors group_lora_tensors(const ConstantMap& tensors, const LoRAPartsParser
 using LoRAConstantTensors = std::map<std::string, NodePtr>;
 
 // Group constant tensors loaded from LoRA adapter file into constants
-LoRAConstantTensors group_lora_constant_tensors(const ConstantMap& tensors, const std::vector<RegexParser>& const_parsers) {
+LoRAConstantTensors group_lora_constant_tensors(const ConstantMap& tensors, const std::vector<LoRAConstantNameParser>& const_parsers) {
     LoRAConstantTensors  result;
     for(const auto& named_tensor: tensors) {
         for (const auto& const_parser : const_parsers) {
@@ -741,12 +802,20 @@ class InferRequestSignatureCache {
         std::vector<std::pair<size_t, size_t>> bypass; // a set of index pairs [j, k], where j is an index of input tensor to be forwarded to k-th output tensor
         std::vector<size_t> inputs; // inputs[i] gives an index in the original input tensor vector to be set to i-th input of the request
         std::vector<size_t> outputs;  // outputs[i] gives an index in the original output tensor vector to be set as an i-th output of the request
+        std::vector<ov::InferRequest> pool;  // requests for parallel evaluation, created on demand
     };
 
 public:
     using Signature = std::string;
 
-    InferRequestSignatureCache (const std::string& device) : device(device) {}
+    // A group of input and output tensors to be evaluated by a model with a given signature
+    struct Job {
+        Signature signature;
+        ov::TensorVector inputs;
+        ov::TensorVector outputs;
+    };
+
+    InferRequestSignatureCache (const std::string& device, const ov::AnyMap& properties = {}) : device(device), properties(properties) {}
 
     bool exist (const Signature& signature) {
         return requests.count(signature);
@@ -791,7 +860,7 @@ public:
 
         ov::Core core = ov::genai::utils::singleton_core();
         auto model = std::make_shared<ov::Model>(request_results, request_parameters);
-        auto compiled_model = core.compile_model(model, device);
+        auto compiled_model = core.compile_model(model, device, properties);
         ov::genai::utils::print_compiled_model_properties(compiled_model, "Infer Request Signature Cache");
         rwb.request = compiled_model.create_infer_request();
         requests.emplace(signature, rwb);
@@ -799,8 +868,44 @@ public:
 
     void evaluate(const Signature& signature, const ov::TensorVector& inputs, ov::TensorVector& outputs) {
         auto& rwb = at(signature);
-        auto request = rwb.request;
-        auto compiled_model = request.get_compiled_model();
+        set_tensors(rwb, rwb.request, inputs, outputs);
+        rwb.request.infer();    // TODO: Consider using async to increase throughput, requires more complicated archestration
+    }
+
+    // Evaluates independent jobs overlapping their execution by several infer requests created for each signature.
+    // Jobs run concurrently if models are compiled with a throughput performance hint.
+    void evaluate_parallel(std::vector<Job>& jobs) {
+        std::map<Signature, std::vector<Job*>> jobs_by_signature;
+        for(auto& job: jobs) {
+            jobs_by_signature[job.signature].push_back(&job);
+        }
+        for(auto& [signature, signature_jobs]: jobs_by_signature) {
+            auto& rwb = at(signature);
+            if(rwb.pool.empty()) {
+                auto compiled_model = rwb.request.get_compiled_model();
+                const size_t num_requests = std::max<uint32_t>(1, compiled_model.get_property(ov::optimal_number_of_infer_requests));
+                rwb.pool.push_back(rwb.request);
+                while(rwb.pool.size() < num_requests) {
+                    rwb.pool.push_back(compiled_model.create_infer_request());
+                }
+            }
+            for(size_t wave_begin = 0; wave_begin < signature_jobs.size(); wave_begin += rwb.pool.size()) {
+                const size_t wave_size = std::min(rwb.pool.size(), signature_jobs.size() - wave_begin);
+                for(size_t i = 0; i < wave_size; ++i) {
+                    Job& job = *signature_jobs[wave_begin + i];
+                    set_tensors(rwb, rwb.pool[i], job.inputs, job.outputs);
+                    rwb.pool[i].start_async();
+                }
+                for(size_t i = 0; i < wave_size; ++i) {
+                    rwb.pool[i].wait();
+                }
+            }
+        }
+    }
+
+private:
+
+    void set_tensors(const RequestWithBypass& rwb, ov::InferRequest& request, const ov::TensorVector& inputs, ov::TensorVector& outputs) {
         for(size_t i = 0; i < rwb.inputs.size(); ++i) {
             request.set_input_tensor(i, inputs[rwb.inputs[i]]);
         }
@@ -816,29 +921,57 @@ public:
         for(auto bypass: rwb.bypass) {
             outputs[bypass.second] = inputs[bypass.first];
         }
-        request.infer();    // TODO: Consider using async to increase throughput, requires more complicated archestration
     }
 
-private:
-
     RequestWithBypass& at(const Signature& signature) {
         return requests.at(signature);
     }
 
     std::unordered_map<Signature, RequestWithBypass> requests;
     std::string device;
+    ov::AnyMap properties;
+};
+
+
+// Deltas of a particular adapter config in FusedLoRADeltaCache addressed by a layer
+struct LoRADeltaCacheAccessor {
+    std::string config_key;                 // identifies adapters and alphas, empty key disables caching
+
+    bool enabled() const {
+        return !config_key.empty() && FusedLoRADeltaCache::instance().get_capacity() > 0;
+    }
+
+    ov::Tensor get(const std::string& layer_key) const {
+        return FusedLoRADeltaCache::instance().get(config_key + '|' + layer_key);
+    }
+
+    void put(const std::string& layer_key, const ov::Tensor& delta) const {
+        FusedLoRADeltaCache::instance().put(config_key + '|' + layer_key, delta);
+    }
 };
 
 
 // Transformation that modifies existing weights in the base model fusing an arbitrary number of LoRA adapters.
 // This is one-way LoRA fusion that cannot be undone.
 // By default it uses CPU plugin to modify the base model weights.
+// Weights are replaced during the pass and their values are computed by `fuse_pending` for all layers at once,
+// running several small fusion models concurrently. Deltas are taken from and stored to FusedLoRADeltaCache.
 // TODO: This transformation unpacks potentially compressed to f16/bf16 weights to f32,
 // we should pack it back into the original precision to maintain the same weight size.
 // But it will work well if all plugins equally support fp-compressed weights and can unpack them on-line.
 class LoRAFuseTransform : public LoRATransformBase {
 
+    // Fusion of a layer postponed till `fuse_pending` call
+    struct PendingFusion {
+        NodePtr weights_constant;       // holds memory of the original weights and LoRA tensors till fusion is done
+        ConstantVector adapter;
+        std::string delta_key;          // not empty if computed delta should be cached
+    };
+
     InferRequestSignatureCache fusers;
+    LoRADeltaCacheAccessor delta_cache;
+    std::vector<InferRequestSignatureCache::Job> jobs;
+    std::vector<PendingFusion> pending;
 
     void signature_push_back(InferRequestSignatureCache::Signature& signature, ov::Output<ov::Node> input) const {
         // TODO: Define hash function on vector<tuple<element_type, PartialShape>> to make it C++ish
@@ -849,9 +982,12 @@ public:
 
     OPENVINO_RTTI("LoRAFuseTransform", "genai", LoRATransformBase);
 
-    LoRAFuseTransform(const LoRAWeightByNodeGetter& lora_weight_getter, const std::string& device_for_fusion = "CPU") :
+    LoRAFuseTransform(const LoRAWeightByNodeGetter& lora_weight_getter,
+                      const LoRADeltaCacheAccessor& delta_cache = {},
+                      const std::string& device_for_fusion = "CPU") :
         LoRATransformBase(lora_weight_getter),
-        fusers(device_for_fusion)
+        fusers(device_for_fusion, {ov::hint::performance_mode(ov::hint::PerformanceMode::THROUGHPUT)}),
+        delta_cache(delta_cache)
     {}
 
     bool apply (NodePtr node, const LoRANode& lora_weight) override {
@@ -865,37 +1001,13 @@ public:
             std::dynamic_pointer_cast<v0::Constant>(lora_weight.A)};
         InferRequestSignatureCache::Signature signature;
         signature_push_back(signature, weights_input);
-        for(auto multiplier : adapter) {
-            signature_push_back(signature, multiplier);
-        }
+        const std::string delta_key = delta_cache.enabled() ? node->get_friendly_name() + signature : std::string();
+        ov::Tensor cached_delta = delta_key.empty() ? ov::Tensor() : delta_cache.get(delta_key);
 
         // TODO: In case when compressed repacking of newly created weights is retained,
         // replace weights_input by weigths_constant to keep decompression Convert in the model.
         auto consumers = weights_input.get_target_inputs();
 
-        if(!fusers.exist(signature)) {
-            // Build a small model for weight and LoRA fusion, and stash it into `fusers` cache.
-            ov::ParameterVector parameters;
-            auto target_parameter = std::make_shared<v0::Parameter>(weights_constant.get_element_type(), weights_constant.get_partial_shape());
-            parameters.push_back(target_parameter);   // original weights input is one of the parameters
-            ov::Output<ov::Node> target = weights_convert ? weights_convert->clone_with_new_inputs({target_parameter}) : target_parameter;
-            for(auto multiplier : adapter) {
-                parameters.push_back(std::make_shared<v0::Parameter>(multiplier->get_output_element_type(0), multiplier->get_output_partial_shape(0)));
-            }
-
-            auto result = std::make_shared<v0::Result>(
-                tensors_multiplication(nullptr,
-                                       NodeVector{parameters.begin() + 1, parameters.end()},
-                                       target,
-                                       false,
-                                       1, // alpha idx
-                                       2, // A idx
-                                       false));
-
-            ov::ResultVector results{result};
-            fusers.insert(signature, results, parameters);
-        }
-
         // Newly created constants in the next line are not mapped unlike original weights, so it will inflate required memory
         // eventually allocating up to 2x of the base model size.
         // 2X is due to usually applied compression in the base model that is not retained in the current version of this code.
@@ -904,21 +1016,87 @@ public:
         // Constant sub-expression can be a solution, but it requires improvements inside plugins, because currently it works extremely slow.
         auto replacement_const = std::make_shared<v0::Constant>(weights_input.get_element_type(), weights_input.get_shape());
 
-        ov::TensorVector outputs{replacement_const->get_tensor_view()};
-        // set input constants
-        ov::TensorVector inputs;
-        inputs.reserve(1 + adapter.size());
-        inputs.push_back(std::dynamic_pointer_cast<v0::Constant>(weights_constant.get_node_shared_ptr())->get_tensor_view());
-        for(size_t i = 0; i < adapter.size(); ++i) {
-            inputs.push_back(adapter[i]->get_tensor_view());
+        InferRequestSignatureCache::Job job;
+        job.inputs.push_back(std::dynamic_pointer_cast<v0::Constant>(weights_constant.get_node_shared_ptr())->get_tensor_view());
+        job.outputs.push_back(replacement_const->get_tensor_view());
+        PendingFusion fusion{weights_constant.get_node_shared_ptr(), adapter, {}};
+
+        if(cached_delta) {
+            // Only add a previously computed delta to the weights
+            signature = "add" + signature;
+            signature_push_back(signature, weights_input);
+            if(!fusers.exist(signature)) {
+                auto target_parameter = std::make_shared<v0::Parameter>(weights_constant.get_element_type(), weights_constant.get_partial_shape());
+                auto delta_parameter = std::make_shared<v0::Parameter>(weights_input_type, weights_input.get_partial_shape());
+                ov::Output<ov::Node> target = weights_convert ? weights_convert->clone_with_new_inputs({target_parameter}) : target_parameter;
+                ov::ResultVector results{std::make_shared<v0::Result>(std::make_shared<v1::Add>(target, delta_parameter))};
+                ov::ParameterVector parameters{target_parameter, delta_parameter};
+                fusers.insert(signature, results, parameters);
+            }
+            job.inputs.push_back(cached_delta);
+        } else {
+            for(auto multiplier : adapter) {
+                signature_push_back(signature, multiplier);
+            }
+            if(!delta_key.empty()) {
+                signature += "(delta)";
+            }
+
+            if(!fusers.exist(signature)) {
+                // Build a small model for weight and LoRA fusion, and stash it into `fusers` cache.
+                ov::ParameterVector parameters;
+                auto target_parameter = std::make_shared<v0::Parameter>(weights_constant.get_element_type(), weights_constant.get_partial_shape());
+                parameters.push_back(target_parameter);   // original weights input is one of the parameters
+                ov::Output<ov::Node> target = weights_convert ? weights_convert->clone_with_new_inputs({target_parameter}) : target_parameter;
+                for(auto multiplier : adapter) {
+                    parameters.push_back(std::make_shared<v0::Parameter>(multiplier->get_output_element_type(0), multiplier->get_output_partial_shape(0)));
+                }
+
+                auto fused = tensors_multiplication(nullptr,
+                                                    NodeVector{parameters.begin() + 1, parameters.end()},
+                                                    target,
+                                                    false,
+                                                    1, // alpha idx
+                                                    2, // A idx
+                                                    false);
+
+                ov::ResultVector results{std::make_shared<v0::Result>(fused)};
+                if(!delta_key.empty()) {
+                    // the second Add input is the delta
+                    results.push_back(std::make_shared<v0::Result>(fused->input_value(1)));
+                }
+                fusers.insert(signature, results, parameters);
+            }
+
+            for(size_t i = 0; i < adapter.size(); ++i) {
+                job.inputs.push_back(adapter[i]->get_tensor_view());
+            }
+            if(!delta_key.empty()) {
+                job.outputs.push_back(ov::Tensor(weights_input_type, weights_input.get_shape()));
+                fusion.delta_key = delta_key;
+            }
         }
-        fusers.evaluate(signature, inputs, outputs);
+        job.signature = signature;
+        jobs.push_back(std::move(job));
+        pending.push_back(std::move(fusion));
 
         for (auto consumer : consumers) {
             consumer.replace_source_output(replacement_const->output(0));
         }
         return true;
     }
+
+    // Computes values of all weights replaced by the pass
+    void fuse_pending() {
+        fusers.evaluate_parallel(jobs);
+        for(size_t i = 0; i < pending.size(); ++i) {
+            if(!pending[i].delta_key.empty()) {
+                delta_cache.put(pending[i].delta_key, jobs[i].outputs[1]);
+            }
+        }
+        jobs.clear();
+        pending.clear();
+    }
 };
 
 
@@ -1032,6 +1210,19 @@ public:
     virtual const LoRAConstantTensors& get_constant_tensors() const = 0;
     virtual const LoRATensors& get_tensors() const = 0;
     virtual bool eq(const AdapterImpl* other) const = 0;
+
+    // Unique over the process lifetime unlike the object address, so it can't address data of a destroyed adapter
+    uint64_t get_id() const {
+        return id;
+    }
+
+private:
+    static uint64_t next_id() {
+        static std::atomic<uint64_t> counter{0};
+        return ++counter;
+    }
+
+    const uint64_t id = next_id();
 };
 
 class SafetensorsAdapterImpl : public AdapterImpl {
@@ -1341,6 +1532,7 @@ struct AdapterControllerImpl {
         };
 
         ov::pass::Manager pm;
+        std::shared_ptr<LoRAFuseTransform> fuse_transform;
         auto mode = current_config.get_mode();
         if(mode == AdapterConfig::MODE_DYNAMIC || mode == AdapterConfig::MODE_STATIC_RANK || mode == AdapterConfig::MODE_AUTO) {
             // State mode
@@ -1357,13 +1549,16 @@ struct AdapterControllerImpl {
             
         } else if(mode == AdapterConfig::MODE_FUSE) {
             // Fuse mode
-            pm.register_pass<LoRAFuseTransform>(weight_as_constant);
+            fuse_transform = pm.register_pass<LoRAFuseTransform>(weight_as_constant, fused_delta_cache_accessor());
             pm.register_pass<LoRAReplaceConstantTransformStatic>(const_replacement_getter);
         } else {
             OPENVINO_THROW("Unrecognized AdapterConfig::Mode was used: ", mode);
         }
 
         pm.run_passes(model);
+        if(fuse_transform) {
+            fuse_transform->fuse_pending();
+        }
 
         // Collect all variable names to quickly detect which state tensor belongs to this adapter controller later
         for(const auto& var: variable_ids) {
@@ -1380,6 +1575,17 @@ struct AdapterControllerImpl {
         return adapter.m_pimpl;
     }
 
+    // Fused deltas are identified by unique ids of adapter objects and alphas
+    LoRADeltaCacheAccessor fused_delta_cache_accessor() const {
+        std::ostringstream config_key;
+        config_key << std::hexfloat;
+        for(const auto& adapter : current_config.get_adapters()) {
+            config_key << get_adapter_impl(adapter)->get_id() << ':' << current_config.get_alpha(adapter) << ';';
+        }
+        config_key << current_config.get_tensor_name_prefix().value_or("");
+        return LoRADeltaCacheAccessor{config_key.str()};
+    }
+
     struct ConfigChanged {
         bool mode = false;
         bool alpha = false;
@@ -1741,6 +1947,337 @@ struct AdapterControllerImpl {
 };
 
 
+// Injects LoRA of all adapter slots alongside MatMul nodes: LoRA tensors of the slots are stacked along the rank dimension
+// and a per-token mask over the stacked rank selects the slot of each token, so A and B are applied by a single MatMul
+// each for the whole batch. Per token: target += ((x * A^T) * (mask * alpha)) * B^T
+class LoRASlotTransform : public LoRATransformBase {
+public:
+
+    OPENVINO_RTTI("LoRASlotTransform", "genai", LoRATransformBase);
+
+    LoRASlotTransform(const LoRAWeightByNodeGetter& lora_getter, const ov::Output<ov::Node>& slot_mask) :
+        LoRATransformBase(lora_getter), m_slot_mask(slot_mask) {}
+
+    bool apply (NodePtr node, const LoRANode& lora_weight) override {
+        auto target = node->output(0);
+        auto consumers = target.get_target_inputs();
+        const auto target_type = target.get_element_type();
+        auto to_target_type = [target_type](const ov::Output<ov::Node>& input) -> ov::Output<ov::Node> {
+            if (input.get_element_type() == target_type) {
+                return input;
+            }
+            return std::make_shared<v0::Convert>(input, target_type);
+        };
+
+        NodePtr lora_input = std::make_shared<v0::MatMul>(node->input_value(0), to_target_type(lora_weight.A), false, true);
+        // [tokens, num_slots * slot_rank] mask is reshaped to the token dimensions of the activations
+        auto scale = std::make_shared<v1::Multiply>(m_slot_mask, lora_weight.alpha);
+        auto scale_reshaped = std::make_shared<v1::Reshape>(to_target_type(scale), std::make_shared<v3::ShapeOf>(lora_input), false);
+        lora_input = std::make_shared<v1::Multiply>(lora_input, scale_reshaped);
+        lora_input = std::make_shared<v0::MatMul>(lora_input, to_target_type(lora_weight.B), false, true);
+        auto replacement = std::make_shared<v1::Add>(target, lora_input);
+
+        replacement->get_output_tensor(0).add_names(target.get_names());
+        for (auto consumer : consumers) {
+            consumer.replace_source_output(replacement->output(0));
+        }
+        return true;
+    }
+
+private:
+    ov::Output<ov::Node> m_slot_mask;
+};
+
+
+struct MultiSlotAdapterControllerImpl {
+    struct Slot {
+        std::optional<AdapterConfig> config;
+        size_t num_users = 0;
+        size_t last_used = 0;
+    };
+
+    // host copies of the stacked state tensors, a loaded slot overwrites its rows of A, columns of B and alpha
+    std::map<std::string, LoRAParts<ov::Tensor>> slot_tensors;
+    // the same tensors addressed by variable_id to set the state
+    std::unordered_map<std::string, ov::Tensor> state_tensors;
+    std::vector<Slot> slots;
+    // ids of configs which are resident in slots or were seen since the last slot eviction. Ids are never reused,
+    // since they are a part of prefix cache hashes, so a config dropped from this list gets a new id next time
+    std::vector<std::pair<AdapterConfig, size_t>> known_configs;
+    size_t next_config_id = 1;
+    std::mutex known_configs_mutex;
+    std::string tensor_name_prefix;
+    size_t slot_rank = 0;
+    size_t use_counter = 0;
+    bool need_apply = true;
+
+    MultiSlotAdapterControllerImpl(std::shared_ptr<ov::Model> model, const AdapterConfig& config, size_t num_slots) :
+        slots(num_slots),
+        tensor_name_prefix(config.get_tensor_name_prefix().value_or("")) {
+        OPENVINO_ASSERT(num_slots > 0, "Number of LoRA slots should be positive");
+        OPENVINO_ASSERT(!config.get_adapters().empty(), "Adapters to be served should be passed to enable LoRA slots");
+
+        std::vector<LoRAWeightGetter> weight_getters;
+        for (const auto& adapter : config.get_adapters()) {
+            auto adapter_impl = AdapterControllerImpl::get_adapter_impl(adapter);
+            OPENVINO_ASSERT(adapter_impl->get_constant_tensors().empty(), "LoRA adapters with constants are not supported with LoRA slots");
+            weight_getters.push_back(LoRAWeightGetterDefault<LoRAWeight, LoRANode>(&adapter_impl->get_tensors(), tensor_name_prefix));
+        }
+
+        // logits are computed for sampled tokens only, so the per-token mask is not applicable after the gathering
+        std::unordered_set<ov::Node*> after_gathering;
+        for (const auto& parameter : model->get_parameters()) {
+            if (parameter->get_output_tensor(0).get_names().count("sampled_tokens_indices")) {
+                std::vector<ov::Node*> queue{parameter.get()};
+                while (!queue.empty()) {
+                    ov::Node* node = queue.back();
+                    queue.pop_back();
+                    for (const auto& output : node->outputs()) {
+                        for (const auto& consumer : output.get_target_inputs()) {
+                            if (after_gathering.insert(consumer.get_node()).second) {
+                                queue.push_back(consumer.get_node());
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        auto is_adaptable = [&after_gathering](const NodePtr& node) {
+            return !after_gathering.count(node.get()) && std::dynamic_pointer_cast<v0::MatMul>(node);
+        };
+
+        // a slot can hold any combination of the adapters, so it is sized by the largest sum of their ranks over the layers
+        for (const auto& node : model->get_ordered_ops()) {
+            if (!is_adaptable(node)) {
+                continue;
+            }
+            size_t rank = 0;
+            for (const auto& getter : weight_getters) {
+                if (auto lora_tensors = getter(node->get_friendly_name())) {
+                    rank += lora_tensors->A->get_output_shape(0)[0];
+                }
+            }
+            slot_rank = std::max(slot_rank, rank);
+        }
+        OPENVINO_ASSERT(slot_rank > 0, "None of the LoRA adapters passed to enable LoRA slots is applicable to the model");
+        const size_t stacked_rank = num_slots * slot_rank;
+
+        // the slot of a token is matched against the slot owning each column of the stacked rank dimension
+        auto slot_ids = std::make_shared<v0::Parameter>(ov::element::i32, ov::PartialShape{ov::Dimension::dynamic()});
+        slot_ids->set_friendly_name(MultiSlotAdapterController::SLOT_IDS_INPUT_NAME);
+        slot_ids->get_output_tensor(0).set_names({MultiSlotAdapterController::SLOT_IDS_INPUT_NAME});
+        model->add_parameters({slot_ids});
+        std::vector<int32_t> column_slots(stacked_rank);
+        for (size_t column = 0; column < stacked_rank; ++column) {
+            column_slots[column] = static_cast<int32_t>(column / slot_rank);
+        }
+        auto slot_ids_column = std::make_shared<v0::Unsqueeze>(slot_ids, v0::Constant::create(ov::element::i32, {1}, {1}));
+        auto columns = v0::Constant::create(ov::element::i32, {stacked_rank}, column_slots);
+        auto slot_mask = std::make_shared<v0::Convert>(std::make_shared<v1::Equal>(slot_ids_column, columns), ov::element::f32);
+
+        auto slot_variables_getter = [&, this](NodePtr node) -> std::optional<LoRANode> {
+            if (!is_adaptable(node)) {
+                return std::nullopt;
+            }
+            const std::string name = node->get_friendly_name();
+            if (!std::count_if(weight_getters.begin(), weight_getters.end(), [&name](const LoRAWeightGetter& getter) {
+                    return bool(getter(name));
+            })) {
+                return std::nullopt;
+            }
+            ov::Dimension input_dim, output_dim;
+            deduce_input_output_dims(node, input_dim, output_dim);
+            OPENVINO_ASSERT(input_dim.is_static() && output_dim.is_static(), "LoRA slots require static weight shapes, got dynamic shape for ", name);
+
+            const std::string variable_id_prefix = "lora_slot_state_" + name;
+            LoRAVarIDs var_ids;
+            var_ids.A = ov::op::util::VariableInfo{ov::PartialShape{stacked_rank, input_dim}, ov::element::f32, variable_id_prefix + ".A"};
+            var_ids.alpha = ov::op::util::VariableInfo{ov::PartialShape{1, stacked_rank}, ov::element::f32, variable_id_prefix + ".alpha"};
+            var_ids.B = ov::op::util::VariableInfo{ov::PartialShape{output_dim, stacked_rank}, ov::element::f32, variable_id_prefix + ".B"};
+            LoRANode result(add_variable(var_ids.alpha, model), add_variable(var_ids.A, model), add_variable(var_ids.B, model));
+
+            LoRAParts<ov::Tensor> tensors;
+            for (auto [variable_info, tensor] : {std::make_pair(&var_ids.alpha, &tensors.alpha), std::make_pair(&var_ids.A, &tensors.A), std::make_pair(&var_ids.B, &tensors.B)}) {
+                *tensor = ov::Tensor(ov::element::f32, variable_info->data_shape.to_shape());
+                std::memset(tensor->data(), 0, tensor->get_byte_size());
+                state_tensors.emplace(variable_info->variable_id, *tensor);
+            }
+            slot_tensors.emplace(name, tensors);
+            return result;
+        };
+
+        ov::pass::Manager pm;
+        pm.register_pass<LoRASlotTransform>(slot_variables_getter, slot_mask->output(0));
+        pm.run_passes(model);
+    }
+
+    static bool same_adapters(const AdapterConfig& config1, const AdapterConfig& config2) {
+        return config1.get_adapters_and_alphas() == config2.get_adapters_and_alphas();
+    }
+
+    size_t get_config_id(const AdapterConfig& config) {
+        std::lock_guard<std::mutex> lock(known_configs_mutex);
+        auto it = std::find_if(known_configs.begin(), known_configs.end(), [&config](const auto& known) {
+            return same_adapters(known.first, config);
+        });
+        if (it == known_configs.end()) {
+            it = known_configs.emplace(known_configs.end(), config, next_config_id++);
+        }
+        return it->second;
+    }
+
+    // drops ids of configs that are not resident anymore, so adapters of evicted configs are not kept alive
+    void forget_evicted_configs() {
+        std::lock_guard<std::mutex> lock(known_configs_mutex);
+        known_configs.erase(std::remove_if(known_configs.begin(), known_configs.end(), [this](const auto& known) {
+            return std::none_of(slots.begin(), slots.end(), [&known](const Slot& slot) {
+                return slot.config && same_adapters(*slot.config, known.first);
+            });
+        }), known_configs.end());
+    }
+
+    std::optional<size_t> acquire(const AdapterConfig& config) {
+        std::optional<size_t> victim;
+        for (size_t slot = 0; slot < slots.size(); ++slot) {
+            if (slots[slot].config && same_adapters(*slots[slot].config, config)) {
+                victim = slot;
+                break;
+            }
+            // prefer never loaded slots, then the least recently used one among the slots without users
+            if (slots[slot].num_users == 0 && (!victim || (slots[*victim].config && (!slots[slot].config || slots[slot].last_used < slots[*victim].last_used)))) {
+                victim = slot;
+            }
+        }
+        if (!victim) {
+            return std::nullopt;
+        }
+
+        Slot& slot = slots[*victim];
+        if (!slot.config || !same_adapters(*slot.config, config)) {
+            const bool evicts = slot.config.has_value();
+            load(*victim, config);
+            slot.config = config;
+            if (evicts) {
+                forget_evicted_configs();
+            }
+        }
+        ++slot.num_users;
+        slot.last_used = ++use_counter;
+        return victim;
+    }
+
+    void release(size_t slot) {
+        OPENVINO_ASSERT(slot < slots.size() && slots[slot].num_users > 0, "LoRA slot ", slot, " was not acquired");
+        --slots[slot].num_users;
+    }
+
+    void load(size_t slot, const AdapterConfig& config) {
+        std::vector<LoRAWeightGetter> weight_getters;
+        for (const auto& adapter : config.get_adapters()) {
+            weight_getters.push_back(LoRAWeightGetterDefault<LoRAWeight, LoRANode>(&AdapterControllerImpl::get_adapter_impl(adapter)->get_tensors(), tensor_name_prefix));
+        }
+        const auto& adapters = config.get_adapters();
+        const size_t stacked_rank = slots.size() * slot_rank;
+
+        // LoRA tensors of the config are checked for all layers before the slot is overwritten,
+        // so a config that doesn't fit the slot leaves the resident config intact
+        struct AdapterWeight {
+            float alpha;
+            std::shared_ptr<v0::Constant> A, B;
+        };
+        std::map<std::string, std::vector<AdapterWeight>> layer_weights;
+        for (const auto& [name, tensors] : slot_tensors) {
+            auto& weights = layer_weights[name];
+            size_t rank = 0;
+            for (size_t i = 0; i < adapters.size(); ++i) {
+                auto lora_tensors = weight_getters[i](name);
+                if (!lora_tensors) {
+                    continue;
+                }
+                AdapterWeight weight{config.get_alpha(adapters[i]),
+                    std::dynamic_pointer_cast<v0::Constant>(lora_tensors->A),
+                    std::dynamic_pointer_cast<v0::Constant>(lora_tensors->B)};
+                OPENVINO_ASSERT(weight.A && weight.B, "LoRA slots expect LoRA A and B tensors to be constants for ", name);
+                rank += weight.A->get_shape()[0];
+                weights.push_back(std::move(weight));
+            }
+            OPENVINO_ASSERT(rank <= slot_rank, "Accumulated LoRA rank ", rank, " of adapters in a config exceeds LoRA slot rank ", slot_rank,
+                " for ", name, ", only adapters passed to enable LoRA slots can be used in a config");
+        }
+
+        for (auto& [name, tensors] : slot_tensors) {
+            const size_t input_dim = tensors.A.get_shape()[1], output_dim = tensors.B.get_shape()[0];
+            float* A = tensors.A.data<float>();
+            float* B = tensors.B.data<float>();
+            float* alpha = tensors.alpha.data<float>();
+            std::fill_n(A + slot * slot_rank * input_dim, slot_rank * input_dim, 0.0f);
+            std::fill_n(alpha + slot * slot_rank, slot_rank, 0.0f);
+            for (size_t row = 0; row < output_dim; ++row) {
+                std::fill_n(B + row * stacked_rank + slot * slot_rank, slot_rank, 0.0f);
+            }
+
+            size_t offset = slot * slot_rank;
+            for (const auto& weight : layer_weights.at(name)) {
+                const size_t rank = weight.A->get_shape()[0];
+                const auto A_values = weight.A->cast_vector<float>();
+                const auto B_values = weight.B->cast_vector<float>();
+                OPENVINO_ASSERT(A_values.size() == rank * input_dim && B_values.size() == output_dim * rank,
+                    "LoRA tensors shapes do not match base model layer ", name);
+                std::copy(A_values.begin(), A_values.end(), A + offset * input_dim);
+                for (size_t row = 0; row < output_dim; ++row) {
+                    std::copy_n(B_values.begin() + row * rank, rank, B + row * stacked_rank + offset);
+                }
+                std::fill_n(alpha + offset, rank, weight.alpha);
+                offset += rank;
+            }
+        }
+        need_apply = true;
+    }
+
+    void apply(ov::InferRequest& infer_request) {
+        if (!need_apply) {
+            return;
+        }
+        need_apply = false;
+        for (auto& state : infer_request.query_state()) {
+            auto it = state_tensors.find(state.get_name());
+            if (it != state_tensors.end()) {
+                state.set_state(it->second);
+            }
+        }
+    }
+};
+
+
+MultiSlotAdapterController::MultiSlotAdapterController(std::shared_ptr<ov::Model> model, const AdapterConfig& config, size_t num_slots) :
+    m_pimpl(std::make_shared<MultiSlotAdapterControllerImpl>(model, config, num_slots)) {}
+
+size_t MultiSlotAdapterController::get_config_id(const AdapterConfig& config) {
+    return m_pimpl->get_config_id(config);
+}
+
+std::optional<size_t> MultiSlotAdapterController::acquire(const AdapterConfig& config) {
+    return m_pimpl->acquire(config);
+}
+
+void MultiSlotAdapterController::release(size_t slot) {
+    m_pimpl->release(slot);
+}
+
+void MultiSlotAdapterController::apply(ov::InferRequest& request) {
+    m_pimpl->apply(request);
+}
+
+size_t MultiSlotAdapterController::get_num_slots() const {
+    return m_pimpl->slots.size();
+}
+
+bool MultiSlotAdapterController::has_state_name(const std::string& name) const {
+    return m_pimpl->state_tensors.count(name);
+}
+
+
 AdapterController::AdapterController(std::shared_ptr<ov::Model> model, const AdapterConfig& config, std::string device)
 {
     // If AdapterConfig::MODE_AUTO is used, then set real mode depending on the device capabilities
@@ -7,6 +7,8 @@
 #include <memory>
 #include <string>
 #include <optional>
+#include <string_view>
+#include <initializer_list>
 #include <vector>
 
 #include "openvino/op/constant.hpp"
@@ -30,6 +32,11 @@ struct LoRAParts {
 using LoRAWeight = LoRAParts<std::shared_ptr<ov::op::v0::Constant>>;
 using LoRATensors = std::map<std::string, LoRAWeight>;
 
+// Matches LoRA tensor names of "<prefix>[_.]lora[_.]<kind>.weight" or "<prefix>lora[12].<legacy_kind>.weight" form and
+// returns the captured prefix. Equivalent to "((.*)[_.](lora[_.](<kind>)\\.weight))|((.*lora[12])\\.(<legacy_kind>\\.weight))"
+// regular expression, but checks a fixed-length suffix only instead of running std::regex for every tensor in an adapter.
+std::optional<std::string> parse_lora_weight_name(std::string_view name, std::initializer_list<std::string_view> kinds, std::string_view legacy_kind);
+
 }
 }
 }
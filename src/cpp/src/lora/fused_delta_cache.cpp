@@ -0,0 +1,76 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "lora/fused_delta_cache.hpp"
+
+#include <cstdlib>
+
+namespace ov {
+namespace genai {
+
+namespace {
+
+constexpr size_t BYTES_IN_MB = 1024 * 1024;
+
+size_t read_capacity_from_env() {
+    if (const char* env = std::getenv("LORA_FUSED_DELTAS_CACHE_SIZE_MB")) {
+        try {
+            return std::stoull(env) * BYTES_IN_MB;
+        } catch (const std::exception&) {
+            // fall through to default value
+        }
+    }
+    return FusedLoRADeltaCache::DEFAULT_CAPACITY_MB * BYTES_IN_MB;
+}
+
+}  // namespace
+
+FusedLoRADeltaCache::FusedLoRADeltaCache(size_t capacity_bytes) : m_capacity_bytes(capacity_bytes) {}
+
+FusedLoRADeltaCache& FusedLoRADeltaCache::instance() {
+    static FusedLoRADeltaCache cache(read_capacity_from_env());
+    return cache;
+}
+
+size_t FusedLoRADeltaCache::get_capacity() const {
+    return m_capacity_bytes;
+}
+
+ov::Tensor FusedLoRADeltaCache::get(const std::string& key) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_entries.find(key);
+    if (it == m_entries.end()) {
+        return {};
+    }
+    m_lru.splice(m_lru.begin(), m_lru, it->second.lru_it);
+    return it->second.delta;
+}
+
+void FusedLoRADeltaCache::put(const std::string& key, const ov::Tensor& delta) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_entries.count(key) || delta.get_byte_size() > m_capacity_bytes) {
+        return;
+    }
+    m_lru.push_front(key);
+    m_entries.emplace(key, Entry{delta, m_lru.begin()});
+    m_memory_usage += delta.get_byte_size();
+    while (m_memory_usage > m_capacity_bytes) {
+        auto evicted = m_entries.find(m_lru.back());
+        m_memory_usage -= evicted->second.delta.get_byte_size();
+        m_entries.erase(evicted);
+        m_lru.pop_back();
+    }
+}
+
+size_t FusedLoRADeltaCache::size() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_entries.size();
+}
+
+size_t FusedLoRADeltaCache::get_memory_usage() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_memory_usage;
+}
+
+}  // namespace genai
+}  // namespace ov
@@ -0,0 +1,59 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "openvino/runtime/tensor.hpp"
+
+namespace ov {
+namespace genai {
+
+/**
+ * Process-wide LRU cache of LoRA weight deltas (alpha * B * A) computed for MODE_FUSE. A delta depends on adapters,
+ * their alphas and a layer only, so fusing adapters that were already fused once costs one addition per layer.
+ * Keys are built of unique adapter ids that are never reused, so the cache doesn't keep adapters alive: deltas of
+ * destroyed adapters are not addressed anymore and are evicted as least recently used ones.
+ * Capacity is taken from LORA_FUSED_DELTAS_CACHE_SIZE_MB environment variable, the cache is disabled by default.
+ */
+class FusedLoRADeltaCache {
+public:
+    static constexpr size_t DEFAULT_CAPACITY_MB = 0;
+
+    explicit FusedLoRADeltaCache(size_t capacity_bytes);
+
+    static FusedLoRADeltaCache& instance();
+
+    size_t get_capacity() const;
+
+    // Returns an empty tensor if there is no delta for 'key'
+    ov::Tensor get(const std::string& key);
+
+    // Deltas larger than the capacity are not kept
+    void put(const std::string& key, const ov::Tensor& delta);
+
+    // Number of cached deltas
+    size_t size() const;
+
+    // Total byte size of cached deltas
+    size_t get_memory_usage() const;
+
+private:
+    struct Entry {
+        ov::Tensor delta;
+        std::list<std::string>::iterator lru_it;
+    };
+
+    const size_t m_capacity_bytes;
+    size_t m_memory_usage = 0;
+    std::list<std::string> m_lru;  // most recently used keys go first
+    std::unordered_map<std::string, Entry> m_entries;
+    mutable std::mutex m_mutex;
+};
+
+}  // namespace genai
+}  // namespace ov
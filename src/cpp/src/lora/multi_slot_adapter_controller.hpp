@@ -0,0 +1,57 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "openvino/runtime/infer_request.hpp"
+#include "openvino/genai/lora_adapter.hpp"
+
+namespace ov {
+namespace genai {
+
+struct MultiSlotAdapterControllerImpl;
+
+// Serves several adapter configurations in a single batch.
+// LoRA tensors of a bounded number of slots are stacked in the model state, each token selects its slot
+// via `lora_slot_ids` model input, so requests with different adapters can be scheduled together.
+// A slot holds one AdapterConfig and is shared by all requests with the same config; configs are paged
+// into slots that are not used by any running request, the least recently used slot is replaced first.
+class MultiSlotAdapterController {
+public:
+    static constexpr const char* SLOT_IDS_INPUT_NAME = "lora_slot_ids";
+    static constexpr int32_t NO_SLOT = -1;
+
+    // `config` lists adapters that can be served, they define layers to be adapted and the LoRA rank of a slot,
+    // which fits any combination of these adapters
+    MultiSlotAdapterController(std::shared_ptr<ov::Model> model, const AdapterConfig& config, size_t num_slots);
+
+    // Returns a positive id that is the same for equal adapter configs, KV cache produced with different adapters
+    // should not be shared, so the id is a part of prefix cache hashes. Ids are never reused; an id of a config is
+    // forgotten when a slot eviction finds the config not resident, then the config gets a new id. Thread safe.
+    size_t get_config_id(const AdapterConfig& config);
+
+    // Returns a slot holding a given config, loading the config to a free slot if it is not resident yet.
+    // Returns std::nullopt if all slots are used by running requests.
+    std::optional<size_t> acquire(const AdapterConfig& config);
+
+    // Releases a slot acquired for a request, the config stays resident until the slot is reused
+    void release(size_t slot);
+
+    // Sets state tensors of slots loaded since the previous call, must be called before inference
+    void apply(ov::InferRequest& request);
+
+    size_t get_num_slots() const;
+
+    bool has_state_name(const std::string& name) const;
+
+private:
+    std::shared_ptr<MultiSlotAdapterControllerImpl> m_pimpl;
+};
+
+}  // namespace genai
+}  // namespace ov
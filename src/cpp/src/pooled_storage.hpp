@@ -0,0 +1,161 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace ov::genai {
+
+// Thread-safe pool of memory blocks of the same size. Blocks are carved from slabs and returned to a free list,
+// so objects created and destroyed with every request reuse memory instead of going to the system allocator.
+// Slabs are never released, the pool grows up to the peak number of live objects.
+template <size_t Size, size_t Alignment>
+class FixedSizePool {
+public:
+    static FixedSizePool& instance() {
+        // not destroyed at exit, objects may still be released by static destructors of other translation units
+        static FixedSizePool* pool = new FixedSizePool();
+        return *pool;
+    }
+
+    void* allocate() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_free_list == nullptr) {
+            add_slab();
+        }
+        FreeBlock* block = m_free_list;
+        m_free_list = block->next;
+        return block;
+    }
+
+    void deallocate(void* ptr) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        FreeBlock* block = static_cast<FreeBlock*>(ptr);
+        block->next = m_free_list;
+        m_free_list = block;
+    }
+
+private:
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    static constexpr size_t alignment = std::max(Alignment, alignof(FreeBlock));
+    static constexpr size_t block_size = (std::max(Size, sizeof(FreeBlock)) + alignment - 1) / alignment * alignment;
+    static constexpr size_t slab_size = 16 * 1024;
+    static constexpr size_t blocks_per_slab = std::max<size_t>(1, slab_size / block_size);
+    static_assert(alignment <= alignof(std::max_align_t), "Over-aligned types are not supported by the pool");
+
+    FixedSizePool() = default;
+
+    void add_slab() {
+        char* slab = static_cast<char*>(::operator new(block_size * blocks_per_slab));
+        for (size_t i = blocks_per_slab; i-- > 0;) {
+            FreeBlock* block = reinterpret_cast<FreeBlock*>(slab + i * block_size);
+            block->next = m_free_list;
+            m_free_list = block;
+        }
+    }
+
+    std::mutex m_mutex;
+    FreeBlock* m_free_list = nullptr;
+};
+
+// Allocator of single objects from FixedSizePool. Used with std::allocate_shared, so an object and its
+// control block take one pooled block. Arrays are allocated by std::allocator.
+template <typename T>
+class PoolAllocator {
+public:
+    using value_type = T;
+
+    PoolAllocator() noexcept = default;
+
+    template <typename U>
+    PoolAllocator(const PoolAllocator<U>&) noexcept {}
+
+    T* allocate(size_t n) {
+        if (n == 1) {
+            return static_cast<T*>(FixedSizePool<sizeof(T), alignof(T)>::instance().allocate());
+        }
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* ptr, size_t n) noexcept {
+        if (n == 1) {
+            FixedSizePool<sizeof(T), alignof(T)>::instance().deallocate(ptr);
+        } else {
+            std::allocator<T>().deallocate(ptr, n);
+        }
+    }
+
+    template <typename U>
+    bool operator==(const PoolAllocator<U>&) const noexcept {
+        return true;
+    }
+
+    template <typename U>
+    bool operator!=(const PoolAllocator<U>&) const noexcept {
+        return false;
+    }
+};
+
+// Vector shared by all its copies until one of them is modified, the modified copy gets its own data then.
+// Forked sequences share generated tokens, KV block hashes and position ids of a parent this way.
+// Not synchronized: copies sharing data must be modified from one thread, as sequences of a group are.
+template <typename T>
+class CopyOnWriteVector {
+public:
+    const std::vector<T>& get() const {
+        return m_data ? *m_data : get_empty();
+    }
+
+    size_t size() const {
+        return m_data ? m_data->size() : 0;
+    }
+
+    bool empty() const {
+        return size() == 0;
+    }
+
+    const T& operator[](size_t idx) const {
+        return (*m_data)[idx];
+    }
+
+    const T& back() const {
+        return m_data->back();
+    }
+
+    // Returns data which is not shared with other copies, copies it if needed
+    std::vector<T>& edit() {
+        if (!m_data) {
+            m_data = std::allocate_shared<std::vector<T>>(PoolAllocator<std::vector<T>>());
+        } else if (m_data.use_count() > 1) {
+            auto data = std::allocate_shared<std::vector<T>>(PoolAllocator<std::vector<T>>());
+            // the copy is going to grow as the original did
+            data->reserve(m_data->capacity());
+            data->assign(m_data->begin(), m_data->end());
+            m_data = std::move(data);
+        }
+        return *m_data;
+    }
+
+    bool is_shared() const {
+        return m_data && m_data.use_count() > 1;
+    }
+
+private:
+    static const std::vector<T>& get_empty() {
+        static const std::vector<T> empty;
+        return empty;
+    }
+
+    std::shared_ptr<std::vector<T>> m_data;
+};
+
+}  // namespace ov::genai
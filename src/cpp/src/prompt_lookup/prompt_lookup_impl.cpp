@@ -71,6 +71,8 @@ void ContinuousBatchingPipeline::PromptLookupImpl::step() {
         }        
         m_sd_metrics.update_acceptance_rate(request_id, acceptance_rate * 100);
         m_sd_metrics.update_draft_accepted_tokens(request_id, num_matches);
+        m_metrics_collector->draft_tokens += prev_validation_len;
+        m_metrics_collector->accepted_draft_tokens += num_matches;
     }
 
     // update perf metrics
@@ -29,6 +29,7 @@ public:
         m_tokenizer = tokenizer;
         m_perf_metrics.raw_metrics.m_inference_durations = {{ MicroSeconds(0.0f) }};
         m_pipeline = std::make_shared<ContinuousBatchingForPromptLookupImpl>(model, tokenizer, scheduler_config, device, properties, generation_config);
+        m_metrics_collector = m_pipeline->get_metrics_collector();
     };
 
     GenerationHandle add_request(uint64_t request_id,
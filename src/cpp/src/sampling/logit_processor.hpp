@@ -16,8 +16,8 @@ protected:
     std::vector<std::shared_ptr<LogitTransformers::ILogitTransformer>> m_logit_transformers;
     std::vector<std::shared_ptr<LogitTransformers::IStatefulLogitTransformer>> m_stateful_logit_transformers;
     
-    std::shared_ptr<std::map<int64_t, size_t>> m_unique_generated_token_ids = std::shared_ptr<std::map<int64_t, size_t>>(new std::map<int64_t, size_t>);
-    std::shared_ptr<std::set<int64_t>> m_unique_prompt_token_ids = std::shared_ptr<std::set<int64_t>>(new std::set<int64_t>);
+    // tracked only when penalties are enabled
+    std::shared_ptr<LogitTransformers::TokenOccurrences> m_token_occurrences = nullptr;
     size_t m_generated_tokens = 0;
 
     // speculative decoding parameters
@@ -29,10 +29,6 @@ public:
                    const LogitTransformers::TokenIds& input_ids,
                    std::shared_ptr<ov::genai::StructuredOutputController> structured_output_controller = nullptr
     ) {
-        for (const auto& input_id : input_ids) {
-            m_unique_prompt_token_ids->insert(input_id);
-        }
-
         if (sampling_params.min_new_tokens > 0) {
             m_logit_transformers.emplace_back(
                 new LogitTransformers::EOSPenaltyTransform(sampling_params.stop_token_ids, sampling_params.min_new_tokens)
@@ -47,24 +43,18 @@ public:
         }
 
         if (sampling_params.is_multinomial() || sampling_params.is_greedy_decoding()) {
-            if (sampling_params.repetition_penalty != 1.0f) {
-                std::shared_ptr<LogitTransformers::RepetitionPenaltyTransform> transformer =
-                    std::shared_ptr<LogitTransformers::RepetitionPenaltyTransform>(new LogitTransformers::RepetitionPenaltyTransform(sampling_params.repetition_penalty));
-                transformer->set_unique_prompt_token_ids(m_unique_prompt_token_ids);
-                transformer->set_unique_generated_token_ids(m_unique_generated_token_ids);
-                m_logit_transformers.push_back(transformer);
-            }
-            if (sampling_params.presence_penalty != 0.0f) {
-                std::shared_ptr<LogitTransformers::PresencePenaltyTransform> transformer = 
-                    std::shared_ptr<LogitTransformers::PresencePenaltyTransform>(new LogitTransformers::PresencePenaltyTransform(sampling_params.presence_penalty)); 
-                transformer->set_unique_generated_token_ids(m_unique_generated_token_ids);
-                m_logit_transformers.push_back(transformer);
-                
-            }
-            if (sampling_params.frequency_penalty != 0.0f) {
-                std::shared_ptr<LogitTransformers::FrequencyPenaltyTransform> transformer = 
-                    std::shared_ptr<LogitTransformers::FrequencyPenaltyTransform>(new LogitTransformers::FrequencyPenaltyTransform(sampling_params.frequency_penalty));
-                transformer->set_unique_generated_token_ids(m_unique_generated_token_ids);
+            if (sampling_params.repetition_penalty != 1.0f || sampling_params.presence_penalty != 0.0f || sampling_params.frequency_penalty != 0.0f) {
+                m_token_occurrences = std::make_shared<LogitTransformers::TokenOccurrences>();
+                // only repetition penalty takes prompt tokens into account
+                if (sampling_params.repetition_penalty != 1.0f) {
+                    for (const auto& input_id : input_ids) {
+                        m_token_occurrences->add_prompt_token(input_id);
+                    }
+                }
+                auto transformer = std::make_shared<LogitTransformers::PenaltyTransform>(sampling_params.repetition_penalty,
+                                                                                         sampling_params.presence_penalty,
+                                                                                         sampling_params.frequency_penalty);
+                transformer->set_token_occurrences(m_token_occurrences);
                 m_logit_transformers.push_back(transformer);
             }
 
@@ -104,11 +94,8 @@ public:
     }
 
     void register_new_generated_token(int64_t new_token_id) {
-        auto it = m_unique_generated_token_ids->find(new_token_id);
-        if (it == m_unique_generated_token_ids->end()) {
-            m_unique_generated_token_ids->insert({new_token_id, 1});
-        } else {
-            it->second++;
+        if (m_token_occurrences) {
+            m_token_occurrences->add_generated_token(new_token_id);
         }
         for (const auto& transformer : m_stateful_logit_transformers) {
             if (transformer->is_applicable(m_generated_tokens)) {
@@ -118,8 +105,9 @@ public:
     }
 
     void decrease_generated_token_occurance(int64_t token_id) {
-        OPENVINO_ASSERT(m_unique_generated_token_ids->count(token_id) > 0);
-        m_unique_generated_token_ids->at(token_id)--;
+        if (m_token_occurrences) {
+            m_token_occurrences->remove_generated_token(token_id);
+        }
     }
 
 };
@@ -5,6 +5,8 @@
 
 #include <algorithm>
 #include <cmath>
+#include <limits>
+#include <memory>
 
 #include "openvino/genai/generation_config.hpp"
 
@@ -170,81 +172,155 @@ protected:
 };
 
 
-class IPenaltyTransformer : public ILogitTransformer {
+/**
+ * @brief Occurrences of tokens in a prompt and generated tokens which are seen by penalties.
+ *
+ * Tokens are kept in a compact vector in the order of their first occurrence and located by an open addressing table,
+ * so a generated token updates a single entry and penalties visit only tokens which occurred.
+ */
+class TokenOccurrences {
 public:
-    void set_unique_generated_token_ids(const std::shared_ptr<std::map<int64_t, size_t>>& unique_generated_token_ids) {
-        if (unique_generated_token_ids != nullptr) {
-            m_unique_generated_token_ids = unique_generated_token_ids;
-        } else {
-            m_unique_generated_token_ids = std::shared_ptr<std::map<int64_t, size_t>>(new std::map<int64_t, size_t>);
+    struct Entry {
+        int64_t token_id;
+        size_t generated_count = 0;
+        bool is_in_prompt = false;
+    };
+
+    void add_prompt_token(int64_t token_id) {
+        find_or_insert(token_id).is_in_prompt = true;
+    }
+
+    void add_generated_token(int64_t token_id) {
+        ++find_or_insert(token_id).generated_count;
+    }
+
+    void remove_generated_token(int64_t token_id) {
+        const size_t entry_idx = find(token_id);
+        OPENVINO_ASSERT(entry_idx != EMPTY_SLOT, "Token ", token_id, " was not generated");
+        Entry& entry = m_entries[entry_idx];
+        if (entry.generated_count > 0) {
+            --entry.generated_count;
         }
     }
 
-    void extract_generated_tokens(const TokenIds& input_ids) {
-        set_unique_generated_token_ids(m_unique_generated_token_ids);
+    size_t get_generated_count(int64_t token_id) const {
+        const size_t entry_idx = find(token_id);
+        return entry_idx == EMPTY_SLOT ? 0 : m_entries[entry_idx].generated_count;
+    }
 
-        for (const auto& input_id : input_ids) {
-            if (m_unique_generated_token_ids->count(input_id)) {
-                m_unique_generated_token_ids->at(input_id)++;
-            } else {
-                m_unique_generated_token_ids->insert({input_id, 1});
+    const std::vector<Entry>& get_entries() const {
+        return m_entries;
+    }
+
+private:
+    static constexpr uint32_t EMPTY_SLOT = std::numeric_limits<uint32_t>::max();
+
+    size_t get_slot(int64_t token_id) const {
+        // Fibonacci hashing spreads consecutive token ids over the table
+        return static_cast<size_t>((static_cast<uint64_t>(token_id) * 0x9E3779B97F4A7C15ull) >> 32) & (m_slots.size() - 1);
+    }
+
+    size_t find(int64_t token_id) const {
+        if (m_slots.empty()) {
+            return EMPTY_SLOT;
+        }
+        for (size_t slot = get_slot(token_id); m_slots[slot] != EMPTY_SLOT; slot = (slot + 1) & (m_slots.size() - 1)) {
+            if (m_entries[m_slots[slot]].token_id == token_id) {
+                return m_slots[slot];
             }
         }
+        return EMPTY_SLOT;
     }
 
-protected:
-    std::shared_ptr<std::map<int64_t, size_t>> m_unique_generated_token_ids = nullptr;
-    double m_penalty = 0.f;
+    Entry& find_or_insert(int64_t token_id) {
+        // load factor is kept below 1/2, so probe sequences are short
+        if (2 * (m_entries.size() + 1) > m_slots.size()) {
+            m_slots.assign(std::max<size_t>(16, 2 * m_slots.size()), EMPTY_SLOT);
+            for (size_t entry_idx = 0; entry_idx < m_entries.size(); ++entry_idx) {
+                size_t slot = get_slot(m_entries[entry_idx].token_id);
+                while (m_slots[slot] != EMPTY_SLOT) {
+                    slot = (slot + 1) & (m_slots.size() - 1);
+                }
+                m_slots[slot] = static_cast<uint32_t>(entry_idx);
+            }
+        }
+        size_t slot = get_slot(token_id);
+        for (; m_slots[slot] != EMPTY_SLOT; slot = (slot + 1) & (m_slots.size() - 1)) {
+            if (m_entries[m_slots[slot]].token_id == token_id) {
+                return m_entries[m_slots[slot]];
+            }
+        }
+        m_slots[slot] = static_cast<uint32_t>(m_entries.size());
+        return m_entries.emplace_back(Entry{token_id});
+    }
+
+    std::vector<Entry> m_entries;
+    // indices of entries, power of 2 size
+    std::vector<uint32_t> m_slots;
 };
 
-class RepetitionPenaltyTransform : public IPenaltyTransformer {
+/**
+ * @brief Applies repetition, presence and frequency penalties in a single pass over occurred tokens.
+ *
+ * The result is the same as applying the penalties one after another in this order. Penalties are applied to the raw logits
+ * buffer, so the transform must precede ones which initialize the sorted vector.
+ */
+class PenaltyTransform : public ILogitTransformer {
 public:
-    RepetitionPenaltyTransform(double repetition_penalty) {
-        m_penalty = repetition_penalty;
-    };
+    PenaltyTransform(double repetition_penalty, double presence_penalty, double frequency_penalty) :
+        m_repetition_penalty(repetition_penalty), m_presence_penalty(presence_penalty), m_frequency_penalty(frequency_penalty) {}
 
-    void apply(Logits& logits) override {
-        size_t vocab_size = logits.m_size;
-        for (const auto& prompt_id : *m_unique_prompt_token_ids) {
-            OPENVINO_ASSERT((prompt_id >= 0) && (prompt_id < vocab_size), "input_ids token out of bounds");
-            if (logits.m_data[prompt_id] >= 0) {
-                logits.m_data[prompt_id] /= m_penalty;
-            } else {
-                logits.m_data[prompt_id] *= m_penalty;
-            };
+    void set_token_occurrences(const std::shared_ptr<TokenOccurrences>& token_occurrences) {
+        m_token_occurrences = token_occurrences != nullptr ? token_occurrences : std::make_shared<TokenOccurrences>();
+    }
+
+    void extract_generated_tokens(const TokenIds& input_ids) {
+        for (const auto& input_id : input_ids) {
+            m_token_occurrences->add_generated_token(input_id);
         }
-        for (const auto& input_id_pair : *m_unique_generated_token_ids) {
-            const auto& input_id = input_id_pair.first;
-            if (1 == m_unique_prompt_token_ids->count(input_id)) {
-                // repetition_penalty was already accounted by the for
-                // loop above.
+    }
+
+    void apply(Logits& logits) override {
+        OPENVINO_ASSERT(!logits.is_vector_initialized(), "Penalties must be applied before logits are sorted");
+        const size_t vocab_size = logits.m_size;
+        const bool has_repetition_penalty = m_repetition_penalty != 1.0;
+        for (const auto& entry : m_token_occurrences->get_entries()) {
+            const bool is_generated = entry.generated_count > 0;
+            if (!is_generated && !(has_repetition_penalty && entry.is_in_prompt)) {
                 continue;
             }
-            OPENVINO_ASSERT((input_id >= 0) && (input_id < vocab_size), "input_ids token out of bounds");
-            if (logits.m_data[input_id] >= 0) {
-                logits.m_data[input_id] /= m_penalty;
-            } else {
-                logits.m_data[input_id] *= m_penalty;
-            };
+            OPENVINO_ASSERT((entry.token_id >= 0) && (entry.token_id < vocab_size), "input_ids token out of bounds");
+            float& logit = logits.m_data[entry.token_id];
+            if (has_repetition_penalty) {
+                logit = logit >= 0 ? logit / m_repetition_penalty : logit * m_repetition_penalty;
+            }
+            if (is_generated) {
+                if (m_presence_penalty != 0.0) {
+                    logit = logit >= 0 ? logit - m_presence_penalty : logit + m_presence_penalty;
+                }
+                if (m_frequency_penalty != 0.0) {
+                    const double penalty = m_frequency_penalty * entry.generated_count;
+                    logit = logit >= 0 ? logit - penalty : logit + penalty;
+                }
+            }
         }
     }
 
     void apply(Logits& logits, const TokenIds& input_ids) {
-        set_unique_prompt_token_ids(nullptr);
         extract_generated_tokens(input_ids);
         apply(logits);
     }
 
-    void set_unique_prompt_token_ids(const std::shared_ptr<std::set<int64_t>>& unique_prompt_token_ids) {
-        if (unique_prompt_token_ids != nullptr) {
-            m_unique_prompt_token_ids = unique_prompt_token_ids;
-        } else {
-            m_unique_prompt_token_ids = std::shared_ptr<std::set<int64_t>>(new std::set<int64_t>);
-        }
-    }
-
 protected:
-    std::shared_ptr<std::set<int64_t>> m_unique_prompt_token_ids = nullptr;
+    std::shared_ptr<TokenOccurrences> m_token_occurrences = std::make_shared<TokenOccurrences>();
+    double m_repetition_penalty = 1.0;
+    double m_presence_penalty = 0.0;
+    double m_frequency_penalty = 0.0;
+};
+
+class RepetitionPenaltyTransform : public PenaltyTransform {
+public:
+    RepetitionPenaltyTransform(double repetition_penalty) : PenaltyTransform(repetition_penalty, 0.0, 0.0) {}
 };
 
 class EOSPenaltyTransform : public ILogitTransformer {
@@ -269,54 +345,14 @@ protected:
     std::set<int64_t> m_stop_token_ids;
 };
 
-class FrequencyPenaltyTransform : public IPenaltyTransformer {
+class FrequencyPenaltyTransform : public PenaltyTransform {
 public:
-    FrequencyPenaltyTransform(double value) {
-        m_penalty = value;
-    };
-
-    void apply(Logits& logits) override {
-        size_t vocab_size = logits.m_size;
-        for (const auto& input_id_pair : *m_unique_generated_token_ids) {
-            const auto& input_id = input_id_pair.first;
-            OPENVINO_ASSERT((input_id >= 0) && (input_id < vocab_size), "input_ids token out of bounds");
-            if (logits.m_data[input_id] >= 0) {
-                logits.m_data[input_id] -= m_penalty * input_id_pair.second;
-            } else {
-                logits.m_data[input_id] += m_penalty * input_id_pair.second;
-            };
-        }
-    }
-
-    void apply(Logits& logits, const TokenIds& input_ids) {
-        extract_generated_tokens(input_ids);
-        apply(logits);
-    }
+    FrequencyPenaltyTransform(double value) : PenaltyTransform(1.0, 0.0, value) {}
 };
 
-class PresencePenaltyTransform : public IPenaltyTransformer {
+class PresencePenaltyTransform : public PenaltyTransform {
 public:
-    PresencePenaltyTransform(double value) {
-        m_penalty = value;
-    };
-
-    void apply(Logits& logits) override {
-        size_t vocab_size = logits.m_size;
-        for (const auto& input_id_pair : *m_unique_generated_token_ids) {
-            const auto& input_id = input_id_pair.first;
-            OPENVINO_ASSERT((input_id >= 0) && (input_id < vocab_size), "input_ids token out of bounds");
-            if (logits.m_data[input_id] >= 0) {
-                logits.m_data[input_id] -= m_penalty;
-            } else {
-                logits.m_data[input_id] += m_penalty;
-            };
-        }
-    }
-
-    void apply(Logits& logits, const TokenIds& input_ids) {
-        extract_generated_tokens(input_ids);
-        apply(logits);
-    }
+    PresencePenaltyTransform(double value) : PenaltyTransform(1.0, value, 0.0) {}
 };
 
 } // namespace LogitTransformers
@@ -2,10 +2,21 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include <future>
+#include <queue>
 
+#include "openvino/core/visibility.hpp"
 #include "sampling/sampler.hpp"
 #include "tokenizer/tokenizer_impl.hpp"
 
+// SIMD headers
+#if defined(OPENVINO_ARCH_X86_64)
+#    ifdef _MSC_VER
+#        include <intrin.h>
+#    else
+#        include <x86intrin.h>
+#    endif
+#endif
+
 namespace ov::genai {
 // Modified Knuth–Morris–Pratt algorithm which returns tokens following after every needle occurrence in haystack
 std::vector<int64_t> kmp_search(const std::vector<int64_t>& haystack, const std::vector<int64_t>& needle) {
@@ -70,6 +81,97 @@ std::vector<Token> log_softmax(const ov::Tensor& logits, size_t batch_idx) {
     return tokens;
 }
 
+#if defined(__AVX2__)
+// Cephes single precision exp for x in [-87.3, 0], which is enough to normalize logits by their max
+inline __m256 exp256_ps(__m256 x) {
+    x = _mm256_max_ps(x, _mm256_set1_ps(-87.3f));
+    __m256 fx = _mm256_floor_ps(_mm256_add_ps(_mm256_mul_ps(x, _mm256_set1_ps(1.44269504088896341f)), _mm256_set1_ps(0.5f)));
+    x = _mm256_sub_ps(x, _mm256_mul_ps(fx, _mm256_set1_ps(0.693359375f)));
+    x = _mm256_sub_ps(x, _mm256_mul_ps(fx, _mm256_set1_ps(-2.12194440e-4f)));
+    __m256 y = _mm256_set1_ps(1.9875691500E-4f);
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), _mm256_set1_ps(1.3981999507E-3f));
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), _mm256_set1_ps(8.3334519073E-3f));
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), _mm256_set1_ps(4.1665795894E-2f));
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), _mm256_set1_ps(1.6666665459E-1f));
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), _mm256_set1_ps(5.0000001201E-1f));
+    y = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(y, x), x), x), _mm256_set1_ps(1.0f));
+    // 2^fx is built in exponent bits
+    __m256i pow2n = _mm256_slli_epi32(_mm256_add_epi32(_mm256_cvttps_epi32(fx), _mm256_set1_epi32(127)), 23);
+    return _mm256_mul_ps(y, _mm256_castsi256_ps(pow2n));
+}
+#endif
+
+// Computes sum of exp(data[i] - max_value) for max_value >= data[i]
+float sum_exp(const float* data, size_t size, float max_value) {
+    size_t i = 0;
+    float sum = 0.0f;
+#if defined(__AVX2__)
+    __m256 max_vec = _mm256_set1_ps(max_value);
+    __m256 sum_vec = _mm256_setzero_ps();
+    for (; i + 8 <= size; i += 8) {
+        sum_vec = _mm256_add_ps(sum_vec, exp256_ps(_mm256_sub_ps(_mm256_loadu_ps(data + i), max_vec)));
+    }
+    alignas(32) float partial_sums[8];
+    _mm256_store_ps(partial_sums, sum_vec);
+    for (float partial_sum : partial_sums) {
+        sum += partial_sum;
+    }
+#endif
+    for (; i < size; ++i) {
+        sum += std::exp(data[i] - max_value);
+    }
+    return sum;
+}
+
+std::vector<Token> log_softmax_top_k(const float* logits, size_t vocab_size, size_t top_k,
+                                     const std::unordered_map<int64_t, float>& adjustments) {
+    OPENVINO_ASSERT(vocab_size > 0, "Logits are empty");
+    // higher log probability first, lower token index wins a tie
+    auto better = [](const Token& left, const Token& right) {
+        return left.m_log_prob > right.m_log_prob || (left.m_log_prob == right.m_log_prob && left.m_index < right.m_index);
+    };
+
+    // adjusted tokens may leave the top, so as many extra tokens are selected to keep top_k others
+    const size_t num_selected = std::min(vocab_size, top_k + adjustments.size());
+    std::vector<Token> heap;
+    heap.reserve(num_selected);
+    for (size_t idx = 0; idx < num_selected; ++idx) {
+        heap.emplace_back(logits[idx], int64_t(idx));
+    }
+    // the worst selected token is in front
+    std::make_heap(heap.begin(), heap.end(), better);
+    float threshold = heap.front().m_log_prob;
+    for (size_t idx = num_selected; idx < vocab_size; ++idx) {
+        if (logits[idx] > threshold) {
+            std::pop_heap(heap.begin(), heap.end(), better);
+            heap.back() = Token(logits[idx], int64_t(idx));
+            std::push_heap(heap.begin(), heap.end(), better);
+            threshold = heap.front().m_log_prob;
+        }
+    }
+
+    const float max_logit = std::max_element(heap.begin(), heap.end(), [](const Token& left, const Token& right) {
+        return left.m_log_prob < right.m_log_prob;
+    })->m_log_prob;
+    const float log_norm = max_logit + std::log(sum_exp(logits, vocab_size, max_logit));
+
+    std::vector<Token> tokens;
+    tokens.reserve(num_selected + adjustments.size());
+    for (const Token& token : heap) {
+        if (!adjustments.count(token.m_index)) {
+            tokens.emplace_back(token.m_log_prob - log_norm, token.m_index);
+        }
+    }
+    for (const auto& [token_id, adjustment] : adjustments) {
+        OPENVINO_ASSERT(token_id >= 0 && size_t(token_id) < vocab_size, "Adjusted token ", token_id, " is out of vocabulary");
+        tokens.emplace_back(logits[token_id] - log_norm + adjustment, token_id);
+    }
+    const size_t num_tokens = std::min(top_k, tokens.size());
+    std::partial_sort(tokens.begin(), tokens.begin() + num_tokens, tokens.end(), better);
+    tokens.resize(num_tokens);
+    return tokens;
+}
+
 std::vector<int64_t> wrap_tokens(const std::vector<int64_t>& tokens, const std::vector<int64_t>& prefix_tokens, const std::vector<int64_t>& suffix_tokens) {
     std::vector<int64_t> all_tokens = prefix_tokens;
     all_tokens.insert(all_tokens.end(), tokens.begin(), tokens.end());
@@ -88,101 +190,6 @@ std::string clean_wrapped_text(const std::string& wrapped_text, const std::strin
     return clean_text;
 }
 
-std::vector<int64_t> encode_and_process_string(const std::string& stop_string, ov::genai::Tokenizer& tokenizer) {
-    // encode stop_string
-    std::string stop_string_copy = stop_string;
-    ov::Tensor ov_encoded_stop_string = tokenizer.encode(stop_string_copy, ov::genai::add_special_tokens(false)).input_ids;
-    size_t tensor_size = ov_encoded_stop_string.get_size();
-    std::vector<int64_t> encoded_stop_string(tensor_size);
-    std::copy_n(ov_encoded_stop_string.data<int64_t>(), tensor_size, encoded_stop_string.begin());
-    return encoded_stop_string;
-}
-
-struct MatchStopStringResult {
-    size_t to_remove = 0;
-    // int64_t last_token_id = 0;
-    // bool is_to_update_last_token = false;
-    bool is_matched = false;
-};
-
-// Return number of last tokens that match one of the stop_strings. If there's no match 0 is returned.
-MatchStopStringResult match_stop_string(Tokenizer& tokenizer,
-                      const TokenIds& generated_tokens,
-                      const std::pair<size_t, std::set<std::string>>& stop_strings,
-                      bool is_include_to_output,
-                      size_t draft_generated_tokens = 0) {
-    MatchStopStringResult result;
-    if (generated_tokens.size() >= stop_strings.first) {
-        // draft_generated_tokens is to handle case with >= 1 generated tokens per step
-        size_t offset = generated_tokens.size() - draft_generated_tokens;
-        if (offset < stop_strings.first) {
-            return result;
-        }
-        offset -= stop_strings.first;
-        TokenIds buffer(generated_tokens.begin() + offset, generated_tokens.end());
-        std::string decoded_buffer = tokenizer.decode(buffer);
-        for (const auto& stop_string : stop_strings.second) {
-            auto pos = decoded_buffer.find(stop_string);
-            if (pos != std::string::npos) {
-                result.is_matched = true;
-
-                auto stop_string_len = is_include_to_output ? stop_string.length() : 0;
-                decoded_buffer = decoded_buffer.substr(0, pos + stop_string_len);
-                // to remove word splitting symbols from tail
-                while (decoded_buffer.back() == ' ' || decoded_buffer.back() == '\n') {
-                    decoded_buffer.pop_back();
-                }
-                if (decoded_buffer.empty()) {
-                    result.to_remove = buffer.size();
-                    return result;
-                }
-
-                // find token cnt to be removed from sequence by decoding token by token
-                std::string decoded_partially_string;
-                for (size_t i = 0; i < buffer.size(); ++i) {
-                    decoded_partially_string = tokenizer.decode(TokenIds{buffer.begin(), buffer.begin() + i + 1});
-                    if (decoded_partially_string.find(decoded_buffer) != std::string::npos) {
-                        result.to_remove = buffer.size() - i - 1;
-                        break;
-                    }
-                }
-                return result;
-            }
-        }
-    }
-    return result;
-}
-
-// Return number of last tokens that match one of the stop_strings. If there's no match 0 is returned.
-// Number of tokens might not be exact as if there's no direct token match, we decode generated tokens incrementally expanding decoding scope
-// with 4 next tokens with each iteration until we check all tokens.
-int match_stop_string2(Tokenizer & tokenizer, const TokenIds & generated_tokens, const std::set<std::string> & stop_strings) {
-    for (const auto& stop_string: stop_strings) {
-        auto stop_tokens_ov = tokenizer.encode(stop_string).input_ids;
-        size_t num_tokens = stop_tokens_ov.get_size();
-        if(num_tokens > generated_tokens.size())
-            continue;
-
-        // Check direct token match
-        std::vector<int64_t> stop_tokens(stop_tokens_ov.data<int64_t>(), stop_tokens_ov.data<int64_t>() + num_tokens);
-        std::vector<int64_t> last_generated_tokens(generated_tokens.end()-num_tokens, generated_tokens.end());
-        if (stop_tokens == last_generated_tokens)
-            return num_tokens;
-        
-        // Continue checking chunks of 4 tokens
-        num_tokens += 4;
-        while (num_tokens <= generated_tokens.size()) {
-            std::vector<int64_t> last_generated_tokens(generated_tokens.end()-num_tokens, generated_tokens.end());
-            std::string decoded_last_tokens = tokenizer.decode(last_generated_tokens);
-            if (decoded_last_tokens.find(stop_string) != std::string::npos) {
-                return num_tokens;
-            }
-            num_tokens += 4;
-        }
-    }
-    return 0;
-}
-
 void Sampler::GroupBeamSearcher::finalize(SamplerOutput& sampler_output) {
     for (Group& group : m_groups) {
         if (!group.done) {
@@ -259,7 +266,7 @@ void Sampler::clear_structured_output_compile_times() {
 
 void Sampler::GroupBeamSearcher::select_next_tokens(const ov::Tensor& logits,
     SamplerOutput& sampler_output,
-    const std::pair<size_t, std::set<std::string>>& stop_strings) {
+    StopStringMatcher* stop_string_matcher) {
     assert(m_parameters.num_beams % m_parameters.num_beam_groups == 0 &&
         "number of beams should be divisible by number of groups");
     size_t group_size = m_parameters.num_beams / m_parameters.num_beam_groups;
@@ -337,58 +344,75 @@ void Sampler::GroupBeamSearcher::select_next_tokens(const ov::Tensor& logits,
         if (group.done)
             continue;
 
-        std::vector<Beam> candidates;
-        candidates.reserve(group_size * 2 * group_size);
+        const TokenIds& prompt_ids = m_sequence_group->get_prompt_ids();
+        const ov::Shape logits_shape = logits.get_shape();
+        OPENVINO_ASSERT(logits_shape.size() == 3);
+        const size_t seq_len = logits_shape[1], vocab_size = logits_shape[2];
+
+        // candidates of every beam sorted by score
+        std::vector<std::vector<Beam>> beam_candidates;
+        beam_candidates.reserve(group.ongoing.size());
         for (const Beam& beam : group.ongoing) {
-            std::vector<Token> tokens = log_softmax(logits, beam.m_global_beam_idx);
+            OPENVINO_ASSERT(beam.m_global_beam_idx < logits_shape[0], "Logits batch size doesn't match the number of beams");
+            // token => value added to its log probability
+            std::unordered_map<int64_t, float> adjustments;
 
             // apply diversity penalty
             for (auto prev_group_id = 0; prev_group_id < group_id; ++prev_group_id) {
                 for (const Beam& prev_beam : child_beams_per_group[prev_group_id]) {
-                    tokens[prev_beam.m_token_id].m_log_prob -= m_parameters.diversity_penalty;
+                    adjustments[prev_beam.m_token_id] -= m_parameters.diversity_penalty;
                 }
             }
 
             // apply n_gramm
-            std::vector<int64_t> full_text{m_sequence_group->get_prompt_ids()};
-            full_text.insert(full_text.end(), beam.m_sequence->get_generated_ids().begin(), beam.m_sequence->get_generated_ids().end());
-            if (full_text.size() > 1 && full_text.size() >= m_parameters.no_repeat_ngram_size) {
+            const TokenIds& generated_ids = beam.m_sequence->get_generated_ids();
+            const size_t full_text_len = prompt_ids.size() + generated_ids.size();
+            if (full_text_len > 1 && full_text_len >= m_parameters.no_repeat_ngram_size) {
+                std::vector<int64_t> full_text{prompt_ids};
+                full_text.insert(full_text.end(), generated_ids.begin(), generated_ids.end());
                 auto tail_start = full_text.end() - ptrdiff_t(m_parameters.no_repeat_ngram_size) + 1;
                 for (int64_t banned_token : kmp_search(full_text, {tail_start, full_text.end()})) {
-                    tokens[banned_token].m_log_prob = -std::numeric_limits<float>::infinity();
+                    adjustments[banned_token] = -std::numeric_limits<float>::infinity();
                 }
             }
 
-            // sort tokens
-            std::sort(tokens.begin(), tokens.end(), [](Token left, Token right) {
-                return left.m_log_prob > right.m_log_prob;  // Most probable tokens in front
-            });
-
-            size_t add_count = 0;
-            for (Token token : tokens) {
+            // only 2 * group_size best tokens of a beam may be selected, so the rest of vocabulary is not sorted
+            const float* beam_logits = logits.data<const float>() + (beam.m_global_beam_idx * seq_len + seq_len - 1) * vocab_size;
+            std::vector<Beam>& candidates = beam_candidates.emplace_back();
+            candidates.reserve(2 * group_size);
+            for (const Token& token : log_softmax_top_k(beam_logits, vocab_size, 2 * group_size, adjustments)) {
                 Beam new_candidate = beam;
                 new_candidate.m_score += new_candidate.m_log_prob = token.m_log_prob;
                 new_candidate.m_token_id = token.m_index;
+                candidates.push_back(new_candidate);
+            }
+        }
 
-                // TODO: fix it
-                // and ensure cumulative_log prob is used
-                if (/* m_parameters.early_finish(new_candidate) */ false) {
-                    try_to_finish_candidate(group, new_candidate);
-                } else {
-                    candidates.push_back(new_candidate);
-                    if (++add_count == 2 * group_size) {
-                        break;
-                    }
-                }
+        // merge sorted candidates of beams, the queue holds the best remaining candidate of every beam
+        using CandidatePosition = std::pair<size_t, size_t>;
+        auto is_worse_position = [&beam_candidates](const CandidatePosition& left, const CandidatePosition& right) {
+            return greater(beam_candidates[right.first][right.second], beam_candidates[left.first][left.second]);
+        };
+        std::priority_queue<CandidatePosition, std::vector<CandidatePosition>, decltype(is_worse_position)> best_positions(is_worse_position);
+        for (size_t beam_idx = 0; beam_idx < beam_candidates.size(); ++beam_idx) {
+            if (!beam_candidates[beam_idx].empty()) {
+                best_positions.push({beam_idx, 0});
+            }
+        }
+        std::vector<Beam> candidates;
+        candidates.reserve(group_size * 2 * group_size);
+        while (!best_positions.empty()) {
+            auto [beam_idx, candidate_idx] = best_positions.top();
+            best_positions.pop();
+            candidates.push_back(beam_candidates[beam_idx][candidate_idx]);
+            if (candidate_idx + 1 < beam_candidates[beam_idx].size()) {
+                best_positions.push({beam_idx, candidate_idx + 1});
             }
         }
 
         // Sample 2 * group_size highest score tokens to get at least 1 non EOS token per beam
         OPENVINO_ASSERT(candidates.size() >= 2 * group_size, "No beams left to search");
 
-        auto to_sort = candidates.begin() + ptrdiff_t(2 * group_size);
-        std::partial_sort(candidates.begin(), to_sort, candidates.end(), greater);
-
         for (size_t cand_idx = 0; cand_idx < candidates.size(); ++cand_idx) {
             Beam & candidate = candidates[cand_idx];
             if (is_stop_token_id_hit(candidate.m_token_id, m_sequence_group->get_sampling_parameters().stop_token_ids)) {
@@ -401,12 +425,11 @@ void Sampler::GroupBeamSearcher::select_next_tokens(const ov::Tensor& logits,
                 continue;
             }
 
-            if (!m_parameters.stop_strings.empty()) {
-                // We need to include candidate token to already generated tokens to check if stop string has been generated
-                // There's probably a better way to do that, than copying whole vector...
-                std::vector<int64_t> token_ids = candidate.m_sequence->get_generated_ids();
-                token_ids.push_back(candidate.m_token_id);
-                auto match_result = match_stop_string(m_tokenizer, token_ids, stop_strings, m_parameters.include_stop_str_in_output);
+            if (stop_string_matcher) {
+                // candidate token is matched after already generated tokens of its parent sequence
+                auto match_result = stop_string_matcher->match_candidate(candidate.m_sequence->get_id(),
+                                                                         candidate.m_sequence->get_generated_ids(),
+                                                                         candidate.m_token_id);
                 if (match_result.is_matched) {
                     // If beam_token does not belong to top num_beams tokens, it should not be added
                     if (cand_idx >= group_size)
@@ -567,7 +590,7 @@ std::vector<Token> Sampler::_multinomial_sample(const Logits& logits, size_t num
     return out_tokens;
 }
 
-std::vector<int64_t> Sampler::_try_finish_generation(SequenceGroup::Ptr & sequence_group) {
+std::vector<int64_t> Sampler::_try_finish_generation(SequenceGroup::Ptr & sequence_group, StopStringMatcher* stop_string_matcher) {
     const auto& sampling_params = sequence_group->get_sampling_parameters();
     std::vector<int64_t> dropped_seq_ids;
     for (auto& running_sequence : sequence_group->get_running_sequences()) {
@@ -587,10 +610,8 @@ std::vector<int64_t> Sampler::_try_finish_generation(SequenceGroup::Ptr & sequen
             continue;
         }
 
-        if (!sampling_params.stop_strings.empty()) {
-            auto& stop_strings = m_stop_strings.at(sequence_group->get_request_id());
-            auto match_result = match_stop_string(m_tokenizer, running_sequence->get_generated_ids(), stop_strings,
-                                                  sampling_params.include_stop_str_in_output, sequence_group->get_num_tokens_to_validate());
+        if (stop_string_matcher) {
+            auto match_result = stop_string_matcher->match(running_sequence->get_id(), running_sequence->get_generated_ids());
             if (match_result.is_matched) {
                 running_sequence->remove_last_tokens(match_result.to_remove);
 
@@ -756,21 +777,8 @@ float get_p_prime(Sequence::Ptr& running_sequence,
     return p_prime;
 }
 
-std::pair<size_t, std::set<std::string>>
-process_stop_strings(const std::set<std::string>& stop_strings, Tokenizer& tokenizer) {
-    std::pair<size_t, std::set<std::string>> result;
-    for (const auto& stop_string : stop_strings) {
-        auto encoded_stop_string = encode_and_process_string(stop_string, tokenizer);
-        if (result.first < encoded_stop_string.size()) {
-            result.first = encoded_stop_string.size();
-        }
-        result.second.insert(stop_string);
-    }
-    return result;
-}
-
 SequenceGroupSamplingInfo Sampler::sample_from_sequence_group(SequenceGroup::Ptr sequence_group, ov::Tensor sequence_group_logits, 
-                                                              LogitProcessor& logit_processor, const std::pair<size_t, std::set<std::string>>& stop_strings, 
+                                                              LogitProcessor& logit_processor, StopStringMatcher* stop_string_matcher,
                                                               bool is_validation_mode_enabled) {
     SequenceGroupSamplingInfo sg_sampling_info;
     // Assistant pipeline info is relevant for speculative and prompt lookup decoding
@@ -891,7 +899,7 @@ SequenceGroupSamplingInfo Sampler::sample_from_sequence_group(SequenceGroup::Ptr
             assisting_pipeline_info.min_generated_len = std::min(assisting_pipeline_info.min_generated_len, running_sequence->get_generated_len());
         }
         align_all_sequence_len(sequence_group, assisting_pipeline_info.min_generated_len, logit_processor);
-        for (const auto& dropped_seq_id : _try_finish_generation(sequence_group)) {
+        for (const auto& dropped_seq_id : _try_finish_generation(sequence_group, stop_string_matcher)) {
             sg_sampling_info.sampler_output.m_dropped_sequences.push_back(dropped_seq_id);
         }
     } else if (sampling_params.is_beam_search()) {
@@ -912,7 +920,7 @@ SequenceGroupSamplingInfo Sampler::sample_from_sequence_group(SequenceGroup::Ptr
         }
 
         // current algorithm already adds new tokens to running sequences and
-        beam_searcher->select_next_tokens(sequence_group_logits, sg_sampling_info.sampler_output, stop_strings);
+        beam_searcher->select_next_tokens(sequence_group_logits, sg_sampling_info.sampler_output, stop_string_matcher);
 
         // check max length stop criteria
         std::vector<Sequence::Ptr> running_sequences = sequence_group->get_running_sequences();
@@ -956,24 +964,25 @@ SamplerOutput Sampler::sample(const std::vector<SequenceGroup::Ptr> & sequence_g
             }
             m_logit_processors.insert({request_id, LogitProcessor(sampling_params, sequence_group->get_prompt_ids(), structured_output_controller)});
         }
-        if (!m_stop_strings.count(request_id)) {
+        if (!m_stop_string_matchers.count(request_id)) {
+            std::shared_ptr<StopStringMatcher> stop_string_matcher;
             if (!sampling_params.stop_strings.empty()) {
                 OPENVINO_ASSERT(m_tokenizer.m_pimpl != nullptr, "Stop strings require a valid tokenizer");
-                auto processed_stop_string = process_stop_strings(sampling_params.stop_strings, m_tokenizer);
-                m_stop_strings.insert({static_cast<int64_t>(request_id), processed_stop_string});
-                sequence_group->set_stream_window_size(processed_stop_string.first);
-            } else {
-                m_stop_strings.insert({static_cast<int64_t>(request_id), {size_t(0), {}}});
+                stop_string_matcher = std::make_shared<StopStringMatcher>(get_compiled_stop_strings(sampling_params.stop_strings),
+                                                                          get_token_text_cache(),
+                                                                          sampling_params.include_stop_str_in_output);
+                sequence_group->set_stream_window_size(stop_string_matcher->get_max_encoded_len());
             }
+            m_stop_string_matchers.insert({static_cast<int64_t>(request_id), stop_string_matcher});
         }
-        const auto& stop_strings = m_stop_strings.at(request_id);
+        StopStringMatcher* stop_string_matcher = m_stop_string_matchers.at(request_id).get();
         auto& logit_processor = m_logit_processors.at(request_id);
         const void * sequence_group_logits_data = logits_data + vocab_size * currently_processed_tokens;
         ov::Tensor sequence_group_logits(ov::element::f32, ov::Shape{num_running_sequences, output_seq_len, vocab_size}, (void *)sequence_group_logits_data);
         if (sequence_group->requires_sampling()) {
             // Call sample_from_sequence_group asynchronously
             sg_sampling_future_map[request_id] = m_thread_pool.submit(&Sampler::sample_from_sequence_group, this, sequence_group, sequence_group_logits,
-                                                                      logit_processor, stop_strings, is_validation_mode_enabled);
+                                                                      logit_processor, stop_string_matcher, is_validation_mode_enabled);
         } else {
             // we are in prompt processing phase when prompt is split into chunks and processed step by step
         }
@@ -1042,7 +1051,28 @@ void Sampler::create_logit_processor(uint64_t request_id, const GenerationConfig
 void Sampler::clear_request_info(uint64_t request_id) {
     m_beam_search_info.erase(request_id);
     m_logit_processors.erase(request_id);
-    m_stop_strings.erase(request_id);
+    m_stop_string_matchers.erase(request_id);
+}
+
+std::shared_ptr<const CompiledStopStrings> Sampler::get_compiled_stop_strings(const std::set<std::string>& stop_strings) {
+    auto it = m_compiled_stop_strings.find(stop_strings);
+    if (it != m_compiled_stop_strings.end()) {
+        return it->second;
+    }
+    // requests usually share a few sets of stop strings, so the cache is just dropped when it grows
+    if (m_compiled_stop_strings.size() >= MAX_COMPILED_STOP_STRINGS) {
+        m_compiled_stop_strings.clear();
+    }
+    auto compiled = compile_stop_strings(stop_strings, m_tokenizer);
+    m_compiled_stop_strings.emplace(stop_strings, compiled);
+    return compiled;
+}
+
+std::shared_ptr<TokenTextCache> Sampler::get_token_text_cache() {
+    if (!m_token_text_cache) {
+        m_token_text_cache = std::make_shared<TokenTextCache>(m_tokenizer);
+    }
+    return m_token_text_cache;
 }
 
 int64_t Sampler::GroupBeamSearcher::Group::finish(Beam beam, const ov::genai::GenerationConfig& sampling_params) {
@@ -18,6 +18,7 @@
 
 #include "sampling/logit_transformers.hpp"
 #include "sampling/logit_processor.hpp"
+#include "sampling/stop_string_matcher.hpp"
 #include "continuous_batching/scheduler.hpp"
 #include "sequence_group.hpp"
 #include "threadpool.hpp"
@@ -45,6 +46,11 @@ inline bool is_stop_token_id_hit_in_sequence_group(SequenceGroup::Ptr sequence_g
 
 std::vector<Token> log_softmax(const ov::Tensor& logits, size_t batch_idx);
 
+// Returns top_k tokens of the highest log probabilities, the most probable first, without normalizing and sorting whole vocabulary.
+// Adjustments are added to log probabilities of given tokens, e.g. -inf bans a token.
+std::vector<Token> log_softmax_top_k(const float* logits, size_t vocab_size, size_t top_k,
+                                     const std::unordered_map<int64_t, float>& adjustments = {});
+
 struct SamplerOutput {
     // IDs of sequences that need to be dropped
     std::vector<uint64_t> m_dropped_sequences;
@@ -76,15 +82,18 @@ class Sampler {
     Logits _get_logit_vector(ov::Tensor logits, size_t batch_idx, size_t token_idx);
     Token _greedy_sample(const Logits& logits, size_t top_logprobs) const;
     std::vector<Token> _multinomial_sample(const Logits& logits, size_t num_tokens_per_sequence);
-    std::vector<int64_t> _try_finish_generation(SequenceGroup::Ptr & sequence_group);
+    std::vector<int64_t> _try_finish_generation(SequenceGroup::Ptr & sequence_group, StopStringMatcher* stop_string_matcher);
 
     bool validate_candidate(Sequence::Ptr running_sequence, size_t& token_idx, Token& sampled_token,
                             bool& is_extend_sequence, size_t& max_removed_tokens, bool do_sample, bool has_real_probolities);
 
     SequenceGroupSamplingInfo sample_from_sequence_group(SequenceGroup::Ptr sequence_group, ov::Tensor sequence_group_logits,
-                                                        LogitProcessor& logit_processor, const std::pair<size_t, std::set<std::string>>& stop_strings,
+                                                        LogitProcessor& logit_processor, StopStringMatcher* stop_string_matcher,
                                                         bool is_validation_mode_enabled);
 
+    std::shared_ptr<const CompiledStopStrings> get_compiled_stop_strings(const std::set<std::string>& stop_strings);
+    std::shared_ptr<TokenTextCache> get_token_text_cache();
+
     // request ID => beam search tracking information
     std::map<uint64_t, GroupBeamSearcher> m_beam_search_info;
     std::mutex m_beam_search_info_mutex;
@@ -93,8 +102,12 @@ class Sampler {
     size_t seed = rng_engine.default_seed;
     // { request_id, logit_processor }
     std::map<uint64_t, LogitProcessor> m_logit_processors;
-    // { request_id, { max_encoded_len, { stop_strings }}}
-    std::map<int64_t, std::pair<size_t, std::set<std::string>>> m_stop_strings;
+    // { request_id, stop_string_matcher }, nullptr for requests without stop strings
+    std::map<int64_t, std::shared_ptr<StopStringMatcher>> m_stop_string_matchers;
+    static constexpr size_t MAX_COMPILED_STOP_STRINGS = 64;
+    std::map<std::set<std::string>, std::shared_ptr<const CompiledStopStrings>> m_compiled_stop_strings;
+    // texts of tokens are shared by all requests, created on the first request with stop strings
+    std::shared_ptr<TokenTextCache> m_token_text_cache;
 
     Tokenizer m_tokenizer;
 
@@ -115,6 +128,8 @@ public:
 
     void set_tokenizer(const Tokenizer& tokenizer) {
         m_tokenizer = tokenizer;
+        m_compiled_stop_strings.clear();
+        m_token_text_cache.reset();
     }
 
     void clear_request_info(uint64_t request_id);
@@ -172,7 +187,7 @@ class Sampler::GroupBeamSearcher {
 public:
     explicit GroupBeamSearcher(SequenceGroup::Ptr sequence_group, Tokenizer tokenizer);
 
-    void select_next_tokens(const ov::Tensor& logits, SamplerOutput& sampler_output, const std::pair<size_t, std::set<std::string>>& stop_strings);
+    void select_next_tokens(const ov::Tensor& logits, SamplerOutput& sampler_output, StopStringMatcher* stop_string_matcher);
     void finalize(SamplerOutput& sampler_output);
     std::map<size_t, int32_t> get_beam_idxs();
 };
@@ -0,0 +1,417 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "sampling/stop_string_matcher.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <mutex>
+#include <queue>
+
+#include "openvino/core/except.hpp"
+
+namespace ov::genai {
+
+namespace {
+
+// states are not pruned on every call, since sequences of a request are matched one after another
+constexpr size_t STATES_PRUNE_PERIOD = 256;
+
+// UTF-8 encoded U+FFFD, which detokenizer returns for incomplete characters
+const std::string REPLACEMENT_CHARACTER = "\xEF\xBF\xBD";
+
+std::vector<int64_t> get_anchor(Tokenizer& tokenizer) {
+    ov::Tensor input_ids = tokenizer.encode(std::string("a"), ov::genai::add_special_tokens(false)).input_ids;
+    if (input_ids.get_size() == 0) {
+        return {};
+    }
+    return {input_ids.data<int64_t>()[0]};
+}
+
+// Removes word splitting symbols from the tail of kept text, returns new end of kept text
+size_t trim_kept_text(const std::string& text, size_t kept_end) {
+    while (kept_end > 0 && (text[kept_end - 1] == ' ' || text[kept_end - 1] == '\n')) {
+        --kept_end;
+    }
+    return kept_end;
+}
+
+}  // namespace
+
+AhoCorasickAutomaton::AhoCorasickAutomaton() : m_transitions(1, root), m_match_lens(1, 0) {}
+
+AhoCorasickAutomaton::AhoCorasickAutomaton(const std::vector<std::vector<uint32_t>>& patterns, size_t num_classes)
+    : m_num_classes(num_classes) {
+    OPENVINO_ASSERT(num_classes > 0, "Aho-Corasick automaton requires at least one symbol class");
+    constexpr uint32_t none = std::numeric_limits<uint32_t>::max();
+    m_transitions.assign(num_classes, none);
+    m_match_lens.assign(1, 0);
+
+    // build trie of patterns, indices are used since the table grows
+    for (const auto& pattern : patterns) {
+        uint32_t state = root;
+        for (uint32_t symbol_class : pattern) {
+            OPENVINO_ASSERT(symbol_class > 0 && symbol_class < num_classes, "Symbol class ", symbol_class, " is out of range");
+            const size_t transition_idx = state * num_classes + symbol_class;
+            if (m_transitions[transition_idx] == none) {
+                m_transitions[transition_idx] = static_cast<uint32_t>(m_match_lens.size());
+                m_match_lens.push_back(0);
+                m_transitions.resize(m_transitions.size() + num_classes, none);
+            }
+            state = m_transitions[transition_idx];
+        }
+        // trie depth of a state is the length of its pattern
+        m_match_lens[state] = pattern.size();
+    }
+
+    // breadth first traversal completes transitions with the ones of failure states, which are closer to root
+    std::vector<uint32_t> failures(m_match_lens.size(), root);
+    std::queue<uint32_t> states;
+    for (size_t symbol_class = 0; symbol_class < num_classes; ++symbol_class) {
+        uint32_t& child = m_transitions[symbol_class];
+        if (child == none) {
+            child = root;
+        } else {
+            states.push(child);
+        }
+    }
+    while (!states.empty()) {
+        const uint32_t state = states.front();
+        states.pop();
+        const uint32_t failure = failures[state];
+        if (m_match_lens[state] == 0) {
+            m_match_lens[state] = m_match_lens[failure];
+        }
+        for (size_t symbol_class = 0; symbol_class < num_classes; ++symbol_class) {
+            uint32_t& child = m_transitions[state * num_classes + symbol_class];
+            const uint32_t failure_child = m_transitions[failure * num_classes + symbol_class];
+            if (child == none) {
+                child = failure_child;
+            } else {
+                failures[child] = failure_child;
+                states.push(child);
+            }
+        }
+    }
+}
+
+CompiledStopStrings::CompiledStopStrings(const std::set<std::string>& stop_strings,
+                                         const std::vector<std::vector<int64_t>>& encoded_stop_strings)
+    : stop_strings(stop_strings) {
+    OPENVINO_ASSERT(stop_strings.size() == encoded_stop_strings.size(),
+                    "Number of encoded stop strings ", encoded_stop_strings.size(), " doesn't match number of stop strings ", stop_strings.size());
+
+    uint32_t num_byte_classes = 1;
+    std::vector<std::vector<uint32_t>> byte_patterns;
+    for (const auto& stop_string : stop_strings) {
+        max_stop_string_len = std::max(max_stop_string_len, stop_string.size());
+        std::vector<uint32_t>& pattern = byte_patterns.emplace_back();
+        for (char symbol : stop_string) {
+            uint32_t& byte_class = byte_classes[static_cast<uint8_t>(symbol)];
+            if (byte_class == 0) {
+                byte_class = num_byte_classes++;
+            }
+            pattern.push_back(byte_class);
+        }
+    }
+    byte_automaton = AhoCorasickAutomaton(byte_patterns, num_byte_classes);
+
+    std::vector<std::vector<uint32_t>> token_patterns;
+    for (const auto& encoded_stop_string : encoded_stop_strings) {
+        max_encoded_len = std::max(max_encoded_len, encoded_stop_string.size());
+        std::vector<uint32_t>& pattern = token_patterns.emplace_back();
+        for (int64_t token : encoded_stop_string) {
+            const uint32_t next_class = static_cast<uint32_t>(token_classes.size() + 1);
+            pattern.push_back(token_classes.emplace(token, next_class).first->second);
+        }
+    }
+    token_automaton = AhoCorasickAutomaton(token_patterns, token_classes.size() + 1);
+}
+
+std::shared_ptr<const CompiledStopStrings> compile_stop_strings(const std::set<std::string>& stop_strings, Tokenizer& tokenizer) {
+    const std::vector<std::string> prompts(stop_strings.begin(), stop_strings.end());
+    TokenizedInputs encoded = tokenizer.encode(prompts, ov::genai::add_special_tokens(false));
+    const ov::Shape shape = encoded.input_ids.get_shape();
+    OPENVINO_ASSERT(shape.size() == 2 && shape[0] == prompts.size(), "Unexpected shape of encoded stop strings ", shape);
+    OPENVINO_ASSERT(encoded.attention_mask.get_shape() == shape, "Attention mask of encoded stop strings doesn't match input ids");
+
+    // padding side depends on tokenizer, so tokens are selected by attention mask
+    const int64_t* input_ids = encoded.input_ids.data<const int64_t>();
+    const int64_t* attention_mask = encoded.attention_mask.data<const int64_t>();
+    std::vector<std::vector<int64_t>> encoded_stop_strings(prompts.size());
+    for (size_t batch_idx = 0; batch_idx < shape[0]; ++batch_idx) {
+        for (size_t token_idx = batch_idx * shape[1]; token_idx < (batch_idx + 1) * shape[1]; ++token_idx) {
+            if (attention_mask[token_idx] != 0) {
+                encoded_stop_strings[batch_idx].push_back(input_ids[token_idx]);
+            }
+        }
+    }
+    return std::make_shared<const CompiledStopStrings>(stop_strings, encoded_stop_strings);
+}
+
+TokenTextCache::TokenTextCache(DecodeFunction decode, std::vector<int64_t> anchor)
+    : m_decode(std::move(decode)),
+      m_anchor(std::move(anchor)) {
+    if (!m_anchor.empty()) {
+        m_anchor_text = m_decode(m_anchor);
+    }
+}
+
+TokenTextCache::TokenTextCache(Tokenizer tokenizer)
+    : TokenTextCache([tokenizer](const std::vector<int64_t>& tokens) mutable { return tokenizer.decode(tokens); },
+                     get_anchor(tokenizer)) {}
+
+const std::string* TokenTextCache::get_text(int64_t token) {
+    {
+        std::shared_lock lock(m_mutex);
+        auto it = m_texts.find(token);
+        if (it != m_texts.end()) {
+            return it->second ? &*it->second : nullptr;
+        }
+    }
+
+    std::vector<int64_t> tokens = m_anchor;
+    tokens.push_back(token);
+    std::string decoded = m_decode(tokens);
+    std::optional<std::string> text;
+    if (decoded.compare(0, m_anchor_text.size(), m_anchor_text) == 0 && decoded.find(REPLACEMENT_CHARACTER) == std::string::npos) {
+        text = decoded.substr(m_anchor_text.size());
+    }
+
+    std::unique_lock lock(m_mutex);
+    // references to elements of unordered_map stay valid on insertion
+    const auto& cached_text = m_texts.try_emplace(token, std::move(text)).first->second;
+    return cached_text ? &*cached_text : nullptr;
+}
+
+StopStringMatcher::StopStringMatcher(std::shared_ptr<const CompiledStopStrings> stop_strings,
+                                     std::shared_ptr<TokenTextCache> token_texts,
+                                     bool is_include_to_output)
+    : m_stop_strings(std::move(stop_strings)),
+      m_token_texts(std::move(token_texts)),
+      m_is_include_to_output(is_include_to_output) {
+    OPENVINO_ASSERT(m_stop_strings && m_token_texts, "Stop string matcher requires compiled stop strings and token texts");
+    m_num_retained = std::max<size_t>(m_stop_strings->max_encoded_len + m_stop_strings->max_stop_string_len, 1);
+}
+
+StopStringMatcher::Match StopStringMatcher::match(uint64_t sequence_id, const std::vector<int64_t>& generated_tokens) {
+    SequenceState& state = get_state(sequence_id, generated_tokens);
+    const size_t num_processed = state.get_num_tokens();
+    Match result;
+    for (size_t token_idx = num_processed; token_idx < generated_tokens.size() && !result.is_matched; ++token_idx) {
+        result = feed(state, generated_tokens[token_idx]);
+        if (result.is_matched) {
+            // tokens after the matched one are generated in the same step by speculative decoding
+            result.to_remove += generated_tokens.size() - token_idx - 1;
+        }
+    }
+
+    // text around tokens without stable text is known only after decoding them together
+    const size_t window_begin = get_window_begin(num_processed);
+    if (state.unstable_end > window_begin) {
+        Match decoded = decode_and_match({generated_tokens.begin() + window_begin, generated_tokens.end()});
+        if (decoded.is_matched) {
+            result = decoded;
+        }
+    }
+
+    if (result.is_matched) {
+        m_states.erase(sequence_id);
+    } else {
+        trim(state);
+    }
+    return result;
+}
+
+StopStringMatcher::Match StopStringMatcher::match_candidate(uint64_t parent_id,
+                                                            const std::vector<int64_t>& parent_generated_tokens,
+                                                            int64_t candidate_token) {
+    SequenceState& state = get_state(parent_id, parent_generated_tokens);
+    // parent tokens were matched as candidates at previous steps
+    for (size_t token_idx = state.get_num_tokens(); token_idx < parent_generated_tokens.size(); ++token_idx) {
+        feed(state, parent_generated_tokens[token_idx]);
+    }
+    trim(state);
+
+    Match result;
+    const std::string* text = m_token_texts->get_text(candidate_token);
+    if (text != nullptr) {
+        const size_t num_retained = state.tokens.size();
+        result = append(state, candidate_token, *text);
+        truncate(state, num_retained);
+    }
+
+    const size_t window_begin = get_window_begin(parent_generated_tokens.size());
+    if (text == nullptr || state.unstable_end > window_begin) {
+        std::vector<int64_t> window(parent_generated_tokens.begin() + window_begin, parent_generated_tokens.end());
+        window.push_back(candidate_token);
+        Match decoded = decode_and_match(window);
+        if (decoded.is_matched) {
+            result = decoded;
+        }
+    }
+    return result;
+}
+
+size_t StopStringMatcher::get_window_begin(size_t num_processed) const {
+    // previously processed tokens which may hold the beginning of a stop string together with new ones
+    const size_t num_context_tokens = std::max<size_t>(get_max_encoded_len(), 1) - 1;
+    return num_processed - std::min(num_processed, num_context_tokens);
+}
+
+StopStringMatcher::SequenceState& StopStringMatcher::get_state(uint64_t sequence_id, const std::vector<int64_t>& generated_tokens) {
+    // drop states of sequences which are finished or replaced by beam search
+    if (++m_num_calls % STATES_PRUNE_PERIOD == 0) {
+        for (auto it = m_states.begin(); it != m_states.end();) {
+            if (it->second.last_used + STATES_PRUNE_PERIOD < m_num_calls) {
+                it = m_states.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    auto [it, is_inserted] = m_states.try_emplace(sequence_id);
+    SequenceState& state = it->second;
+    state.last_used = m_num_calls;
+    const size_t num_generated = generated_tokens.size();
+    if (is_inserted || num_generated < state.first_token) {
+        // a new sequence, e.g. forked by beam search, whose earlier tokens were already matched as a part of its parent
+        reset(state, num_generated - std::min(num_generated, m_num_retained));
+        state.unstable_end = 0;
+    } else {
+        size_t num_common = 0;
+        while (num_common < state.tokens.size() && state.first_token + num_common < num_generated &&
+               state.tokens[num_common] == generated_tokens[state.first_token + num_common]) {
+            ++num_common;
+        }
+        truncate(state, num_common);
+    }
+    return state;
+}
+
+void StopStringMatcher::reset(SequenceState& state, size_t first_token) const {
+    state.first_token = first_token;
+    state.first_byte_state = AhoCorasickAutomaton::root;
+    state.first_token_state = AhoCorasickAutomaton::root;
+    state.tokens.clear();
+    state.byte_states.clear();
+    state.token_states.clear();
+    state.text.clear();
+    state.token_ends.clear();
+}
+
+void StopStringMatcher::truncate(SequenceState& state, size_t num_retained) const {
+    state.tokens.resize(num_retained);
+    state.byte_states.resize(num_retained);
+    state.token_states.resize(num_retained);
+    state.token_ends.resize(num_retained);
+    state.text.resize(num_retained == 0 ? 0 : state.token_ends.back());
+}
+
+void StopStringMatcher::trim(SequenceState& state) const {
+    if (state.tokens.size() <= 2 * m_num_retained) {
+        return;
+    }
+    const size_t num_dropped = state.tokens.size() - m_num_retained;
+    const size_t dropped_text_len = state.token_ends[num_dropped - 1];
+    state.first_token += num_dropped;
+    state.first_byte_state = state.byte_states[num_dropped - 1];
+    state.first_token_state = state.token_states[num_dropped - 1];
+    state.tokens.erase(state.tokens.begin(), state.tokens.begin() + num_dropped);
+    state.byte_states.erase(state.byte_states.begin(), state.byte_states.begin() + num_dropped);
+    state.token_states.erase(state.token_states.begin(), state.token_states.begin() + num_dropped);
+    state.token_ends.erase(state.token_ends.begin(), state.token_ends.begin() + num_dropped);
+    for (size_t& token_end : state.token_ends) {
+        token_end -= dropped_text_len;
+    }
+    state.text.erase(0, dropped_text_len);
+}
+
+StopStringMatcher::Match StopStringMatcher::append(SequenceState& state, int64_t token, const std::string& text) const {
+    const CompiledStopStrings& compiled = *m_stop_strings;
+    uint32_t byte_state = state.byte_states.empty() ? state.first_byte_state : state.byte_states.back();
+    uint32_t token_state = state.token_states.empty() ? state.first_token_state : state.token_states.back();
+
+    // the first match ends the sequence, but the state is kept consistent for candidates which are rolled back
+    size_t match_end = 0, match_len = 0;
+    const size_t text_begin = state.text.size();
+    state.text += text;
+    for (size_t pos = text_begin; pos < state.text.size(); ++pos) {
+        byte_state = compiled.byte_automaton.next(byte_state, compiled.byte_classes[static_cast<uint8_t>(state.text[pos])]);
+        const size_t len = compiled.byte_automaton.get_match_len(byte_state);
+        if (len > 0 && match_len == 0) {
+            match_end = pos + 1;
+            match_len = len;
+        }
+    }
+    auto token_class = compiled.token_classes.find(token);
+    token_state = compiled.token_automaton.next(token_state, token_class == compiled.token_classes.end() ? 0 : token_class->second);
+
+    state.tokens.push_back(token);
+    state.byte_states.push_back(byte_state);
+    state.token_states.push_back(token_state);
+    state.token_ends.push_back(state.text.size());
+
+    Match result;
+    if (match_len > 0) {
+        result.is_matched = true;
+        // beginning of a stop string may be in already dropped text, then all retained tokens are removed
+        size_t kept_end = m_is_include_to_output ? match_end : match_end - std::min(match_end, match_len);
+        kept_end = trim_kept_text(state.text, kept_end);
+        // kept text ends within the first token which reaches kept_end
+        const size_t num_kept = kept_end == 0 ? 0 :
+            std::lower_bound(state.token_ends.begin(), state.token_ends.end(), kept_end) - state.token_ends.begin() + 1;
+        result.to_remove = state.tokens.size() - num_kept;
+    } else if (const size_t len = compiled.token_automaton.get_match_len(token_state); len > 0) {
+        result.is_matched = true;
+        result.to_remove = m_is_include_to_output ? 0 : len;
+    }
+    return result;
+}
+
+StopStringMatcher::Match StopStringMatcher::feed(SequenceState& state, int64_t token) {
+    const std::string* text = m_token_texts->get_text(token);
+    if (text == nullptr) {
+        // matching restarts after the token, stop strings around it are found by decoding
+        reset(state, state.get_num_tokens() + 1);
+        state.unstable_end = state.first_token;
+        return {};
+    }
+    return append(state, token, *text);
+}
+
+StopStringMatcher::Match StopStringMatcher::decode_and_match(const std::vector<int64_t>& tokens) const {
+    const CompiledStopStrings& compiled = *m_stop_strings;
+    const std::string text = m_token_texts->decode(tokens);
+    uint32_t state = AhoCorasickAutomaton::root;
+    size_t match_end = 0, match_len = 0;
+    for (size_t pos = 0; pos < text.size() && match_len == 0; ++pos) {
+        state = compiled.byte_automaton.next(state, compiled.byte_classes[static_cast<uint8_t>(text[pos])]);
+        match_len = compiled.byte_automaton.get_match_len(state);
+        match_end = pos + 1;
+    }
+    Match result;
+    if (match_len == 0) {
+        return result;
+    }
+
+    result.is_matched = true;
+    const size_t kept_end = trim_kept_text(text, m_is_include_to_output ? match_end : match_end - match_len);
+    if (kept_end == 0) {
+        result.to_remove = tokens.size();
+        return result;
+    }
+
+    // find token cnt to be removed from sequence by decoding token by token
+    const std::string kept_text = text.substr(0, kept_end);
+    for (size_t i = 0; i < tokens.size(); ++i) {
+        if (m_token_texts->decode({tokens.begin(), tokens.begin() + i + 1}).find(kept_text) != std::string::npos) {
+            result.to_remove = tokens.size() - i - 1;
+            break;
+        }
+    }
+    return result;
+}
+
+}  // namespace ov::genai
@@ -0,0 +1,163 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <array>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <set>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "openvino/genai/tokenizer.hpp"
+
+namespace ov::genai {
+
+// Deterministic Aho-Corasick automaton over symbol classes. Class 0 stands for all symbols which do not occur in patterns,
+// so the transition table has num_states * num_classes entries and every step is a single lookup.
+class AhoCorasickAutomaton {
+public:
+    static constexpr uint32_t root = 0;
+
+    AhoCorasickAutomaton();
+    // patterns are sequences of symbol classes from [1, num_classes)
+    AhoCorasickAutomaton(const std::vector<std::vector<uint32_t>>& patterns, size_t num_classes);
+
+    uint32_t next(uint32_t state, uint32_t symbol_class) const {
+        return m_transitions[state * m_num_classes + symbol_class];
+    }
+
+    // Length of the longest pattern which ends in a given state, 0 if no pattern ends there
+    size_t get_match_len(uint32_t state) const {
+        return m_match_lens[state];
+    }
+
+    size_t get_num_states() const {
+        return m_match_lens.size();
+    }
+
+private:
+    size_t m_num_classes = 1;
+    std::vector<uint32_t> m_transitions;
+    std::vector<size_t> m_match_lens;
+};
+
+// Stop strings of a request compiled to automata over bytes of generated text and over generated token IDs.
+// Immutable, so requests with the same stop strings share it.
+struct CompiledStopStrings {
+    CompiledStopStrings(const std::set<std::string>& stop_strings, const std::vector<std::vector<int64_t>>& encoded_stop_strings);
+
+    std::set<std::string> stop_strings;
+    // max number of tokens in encoded stop strings, so many last tokens are held back from streaming
+    size_t max_encoded_len = 0;
+    size_t max_stop_string_len = 0;
+
+    std::array<uint32_t, 256> byte_classes{};
+    AhoCorasickAutomaton byte_automaton;
+    // token automaton catches stop strings which are not visible in decoded text, e.g. special tokens
+    std::unordered_map<int64_t, uint32_t> token_classes;
+    AhoCorasickAutomaton token_automaton;
+};
+
+// Encodes all stop strings with a single tokenizer call and compiles them
+std::shared_ptr<const CompiledStopStrings> compile_stop_strings(const std::set<std::string>& stop_strings, Tokenizer& tokenizer);
+
+// Text which every token adds to a decoded sequence, shared by all requests of a sampler.
+// Decoding a token alone may differ from its text inside a sequence (e.g. SentencePiece drops a leading space),
+// so a token is decoded after an anchor token and the anchor text is cut off.
+class TokenTextCache {
+public:
+    using DecodeFunction = std::function<std::string(const std::vector<int64_t>&)>;
+
+    TokenTextCache(DecodeFunction decode, std::vector<int64_t> anchor);
+    explicit TokenTextCache(Tokenizer tokenizer);
+
+    // Returns nullptr if text of a token depends on neighbouring tokens, e.g. a token holds a part of UTF-8 character
+    const std::string* get_text(int64_t token);
+
+    std::string decode(const std::vector<int64_t>& tokens) const {
+        return m_decode(tokens);
+    }
+
+private:
+    DecodeFunction m_decode;
+    std::vector<int64_t> m_anchor;
+    std::string m_anchor_text;
+
+    std::shared_mutex m_mutex;
+    std::unordered_map<int64_t, std::optional<std::string>> m_texts;
+};
+
+// Incremental stop strings matching of a request. Every sequence keeps states of both automata together with
+// a short tail of its tokens, so only tokens generated since the previous call are processed. Tokens are compared
+// with the tail before matching, so tokens removed or replaced by speculative decoding and beam search roll the state back.
+// Tokens without stable text are matched by decoding the last tokens like the whole window was matched before.
+class StopStringMatcher {
+public:
+    struct Match {
+        bool is_matched = false;
+        // number of last tokens to be removed from a sequence
+        size_t to_remove = 0;
+    };
+
+    StopStringMatcher(std::shared_ptr<const CompiledStopStrings> stop_strings,
+                      std::shared_ptr<TokenTextCache> token_texts,
+                      bool is_include_to_output);
+
+    size_t get_max_encoded_len() const {
+        return m_stop_strings->max_encoded_len;
+    }
+
+    // Matches tokens generated since the previous call for a given sequence
+    Match match(uint64_t sequence_id, const std::vector<int64_t>& generated_tokens);
+
+    // Matches a candidate token appended to parent tokens, state of the parent sequence stays at its own tokens.
+    // to_remove counts the candidate token as well.
+    Match match_candidate(uint64_t parent_id, const std::vector<int64_t>& parent_generated_tokens, int64_t candidate_token);
+
+private:
+    struct SequenceState {
+        // position of the first retained token in generated tokens
+        size_t first_token = 0;
+        uint32_t first_byte_state = AhoCorasickAutomaton::root;
+        uint32_t first_token_state = AhoCorasickAutomaton::root;
+        // automata states after every retained token
+        std::vector<int64_t> tokens;
+        std::vector<uint32_t> byte_states;
+        std::vector<uint32_t> token_states;
+        std::string text;
+        std::vector<size_t> token_ends;
+        // position after the last token without stable text, 0 if there is no such token
+        size_t unstable_end = 0;
+        size_t last_used = 0;
+
+        size_t get_num_tokens() const {
+            return first_token + tokens.size();
+        }
+    };
+
+    // first token of a window which is decoded when text of its tokens is not stable
+    size_t get_window_begin(size_t num_processed) const;
+    SequenceState& get_state(uint64_t sequence_id, const std::vector<int64_t>& generated_tokens);
+    void reset(SequenceState& state, size_t first_token) const;
+    void truncate(SequenceState& state, size_t num_retained) const;
+    void trim(SequenceState& state) const;
+    Match append(SequenceState& state, int64_t token, const std::string& text) const;
+    Match feed(SequenceState& state, int64_t token);
+    Match decode_and_match(const std::vector<int64_t>& tokens) const;
+
+    std::shared_ptr<const CompiledStopStrings> m_stop_strings;
+    std::shared_ptr<TokenTextCache> m_token_texts;
+    bool m_is_include_to_output;
+    // number of tokens kept per sequence, enough to compute tokens to remove for any stop string
+    size_t m_num_retained;
+
+    std::unordered_map<uint64_t, SequenceState> m_states;
+    size_t m_num_calls = 0;
+};
+
+}  // namespace ov::genai
@@ -1,7 +1,6 @@
 // Copyright (C) 2023-2026 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 
-#include <string_view>
 #include "sequence_group.hpp"
 
 namespace ov {
@@ -9,94 +8,109 @@ namespace genai {
 
 std::mutex Sequence::m_counter_mutex;
 
-size_t Sequence::_make_hash(size_t content_length) {
-        auto sequence_group = get_sequence_group_ptr();
-        auto block_size = sequence_group->get_block_size();
-        size_t block_start_idx = content_length - (content_length % block_size);
-        if (block_start_idx == content_length) {
-            block_start_idx -= block_size;
-        }
-
-        // hash of current block depends on prefix hashes
-        std::vector<int64_t> content;
-        size_t filled_blocks_count = block_start_idx / block_size;
-        OPENVINO_ASSERT(filled_blocks_count <= m_prefix_hashes.size());
-        if (filled_blocks_count > 0) {
-            content.emplace_back(m_prefix_hashes[filled_blocks_count - 1]);
-        }
+BlockHasher Sequence::_start_block_hash(size_t block_idx) const {
+    if (block_idx > 0) {
+        OPENVINO_ASSERT(block_idx <= m_prefix_hashes.size());
+        return BlockHasher(m_prefix_hashes[block_idx - 1]);
+    }
+    // KV cache depends on LoRA adapters applied to a request, the first block hash is propagated to the next ones
+    return BlockHasher(BlockHash(m_sequence_group->get_adapter_config_id()));
+}
 
-        // get tokens corresponding to current block
-        if (sequence_group->get_sequence_group_type() == SequenceGroupType::TOKENS) {
-            const auto& prompt_ids = sequence_group->get_prompt_ids();
-            OPENVINO_ASSERT(content_length <= prompt_ids.size() + m_generated_ids.size());
-            if (block_start_idx < prompt_ids.size()) {
-                content.insert(content.end(), prompt_ids.begin() + block_start_idx, prompt_ids.begin() + std::min(prompt_ids.size(), content_length));
-            }
-            if (content_length > prompt_ids.size()) {
-                size_t start = block_start_idx < prompt_ids.size() ? 0 : block_start_idx - prompt_ids.size();
-                // Use parentheses around (content_length - prompt_ids.size()) to suppress MSVC debug assert: "cannot seek vector iterator after end"
-                content.insert(content.end(), m_generated_ids.begin() + start, m_generated_ids.begin() + (content_length - prompt_ids.size()));
-            }
+void Sequence::_update_hash(BlockHasher& hasher, size_t begin, size_t end) const {
+    if (m_sequence_group->get_sequence_group_type() == SequenceGroupType::TOKENS) {
+        const auto& prompt_ids = m_sequence_group->get_prompt_ids();
+        const auto& generated_ids = m_generated_ids.get();
+        OPENVINO_ASSERT(end <= prompt_ids.size() + generated_ids.size());
+        for (size_t idx = begin; idx < end; idx++) {
+            hasher.update(static_cast<uint64_t>(idx < prompt_ids.size() ? prompt_ids[idx] : generated_ids[idx - prompt_ids.size()]));
         }
-        else if (sequence_group->get_sequence_group_type() == SequenceGroupType::EMBEDDINGS) {
-            const auto& input_embeds = sequence_group->get_input_embeds();
-            const auto& generated_embeds = m_generated_ids_embeds;
-            OPENVINO_ASSERT(content_length <= input_embeds.size() + generated_embeds.size());
-
-            // get inputs embeddings
-            if (block_start_idx < input_embeds.size()) {
-                for (size_t idx = block_start_idx; idx < std::min(input_embeds.size(), content_length); idx++) {
-                    auto embed = _reduce_embedding(input_embeds[idx]);
-                    content.insert(content.end(), embed.begin(), embed.end());
-                }
-            }
-
-            // get generated ids embeddings
-            if (content_length > input_embeds.size()) {
-                size_t start = block_start_idx < input_embeds.size() ? 0 : block_start_idx - input_embeds.size();
-                for (size_t idx = start; idx < content_length - input_embeds.size(); idx++) {
-                    auto embed = _reduce_embedding(generated_embeds[idx]);
-                    content.insert(content.end(), embed.begin(), embed.end());
+    }
+    else if (m_sequence_group->get_sequence_group_type() == SequenceGroupType::EMBEDDINGS) {
+        const auto& input_embeds = m_sequence_group->get_input_embeds();
+        const auto& generated_embeds = m_generated_ids_embeds.get();
+        const auto& position_ids_list = m_position_ids_list.get();
+        OPENVINO_ASSERT(end <= input_embeds.size() + generated_embeds.size());
+        for (size_t idx = begin; idx < end; idx++) {
+            if (idx < input_embeds.size()) {
+                _update_embedding_hash(hasher, input_embeds[idx]);
+                // KV of a prompt token depends on its position as well. After visual token pruning
+                // the remaining tokens keep their original (e.g. 3D RoPE) positions, so equal embeddings
+                // at different positions must not share KV blocks.
+                if (idx < position_ids_list.size()) {
+                    const ov::Tensor& position_ids_elem = position_ids_list[idx];
+                    hasher.update(position_ids_elem.data<const int64_t>(), position_ids_elem.get_size());
                 }
+            } else {
+                _update_embedding_hash(hasher, *generated_embeds[idx - input_embeds.size()]);
             }
         }
-        else {
-            OPENVINO_THROW("Hash calculation is not supported for this sequence type.");
-        }
-        const char* data = reinterpret_cast<const char*>(content.data());
-        std::size_t size = content.size() * sizeof(content[0]);
-        return std::hash<std::string_view>{}(std::string_view(data, size));
+    }
+    else {
+        OPENVINO_THROW("Hash calculation is not supported for this sequence type.");
+    }
 }
 
-std::vector<int64_t> Sequence::_reduce_embedding(const std::vector<float>& embedding) {
-    size_t res_size = std::min((size_t)ceil(float(embedding.size()) / m_embeddings_hash_calculation_stride), m_embeddings_hash_max_num_values);
-    std::vector<int64_t> res(res_size, 0);
-    for (size_t i = 0, idx=0; idx < res_size; i+= m_embeddings_hash_calculation_stride, idx++) {
-        std::memcpy(&(res[idx]), &(embedding[i]), sizeof(embedding[i]));
+void Sequence::_update_embedding_hash(BlockHasher& hasher, const std::vector<float>& embedding) {
+    for (size_t i = 0, idx = 0; i < embedding.size() && idx < m_embeddings_hash_max_num_values; i += m_embeddings_hash_calculation_stride, idx++) {
+        hasher.update_float(embedding[i]);
+    }
+}
+
+void Sequence::_truncate_hashes(size_t generated_len) {
+    if (m_sequence_group == nullptr) {
+        return;
+    }
+    const size_t content_len = m_sequence_group->get_prompt_len() + generated_len;
+    const size_t num_full_blocks = content_len / m_sequence_group->get_block_size();
+    if (m_prefix_hashes.size() > num_full_blocks) {
+        m_prefix_hashes.edit().resize(num_full_blocks);
+    }
+    if (m_partial_block_content_len > content_len) {
+        m_partial_block_content_len = 0;
     }
-    return res;
 }
 
-// Each KV block can be uniquely identified by 
+// Each KV block can be uniquely identified by
 // the tokens within the block and the tokens in the prefix before the block.
 // hash(prefix tokens + block tokens) <--> KV Block
-size_t Sequence::get_hash(size_t content_length) {
-
-    auto sequence_group = get_sequence_group_ptr();
-    OPENVINO_ASSERT(sequence_group, "Hash computation requires setting of sequence_group ptr.");
-    auto content_len = content_length == 0 ? sequence_group->get_context_len() : content_length;
-    auto block_size = sequence_group->get_block_size();
-    size_t cur_content = block_size * (m_prefix_hashes.size() + 1);
-    while (cur_content <= content_len)
-    {
-        m_prefix_hashes.push_back(_make_hash(cur_content));
-        cur_content += block_size;
+BlockHash Sequence::get_hash(size_t content_length) {
+    OPENVINO_ASSERT(m_sequence_group, "Hash computation requires setting of sequence_group ptr.");
+    auto content_len = content_length == 0 ? m_sequence_group->get_context_len() : content_length;
+    auto block_size = m_sequence_group->get_block_size();
+    const size_t num_full_blocks = content_len / block_size;
+    while (m_prefix_hashes.size() < num_full_blocks) {
+        const size_t block_idx = m_prefix_hashes.size();
+        BlockHasher hasher = _start_block_hash(block_idx);
+        _update_hash(hasher, block_idx * block_size, (block_idx + 1) * block_size);
+        m_prefix_hashes.edit().push_back(hasher.get_hash());
     }
     if (content_len % block_size == 0) {
-        return m_prefix_hashes[content_len / block_size - 1];
+        return m_prefix_hashes[num_full_blocks - 1];
+    }
+
+    // the hasher of the partially filled block continues from the previous call within the same block
+    const size_t block_start = num_full_blocks * block_size;
+    if (m_partial_block_content_len <= block_start || m_partial_block_content_len > content_len) {
+        m_partial_block_hasher = _start_block_hash(num_full_blocks);
+        m_partial_block_content_len = block_start;
+    }
+    _update_hash(m_partial_block_hasher, m_partial_block_content_len, content_len);
+    m_partial_block_content_len = content_len;
+    return m_partial_block_hasher.get_hash();
+}
+
+std::vector<BlockHash> get_prefix_block_hashes(const std::vector<int64_t>& prompt_ids, size_t block_size) {
+    OPENVINO_ASSERT(block_size > 0, "Block size must be positive");
+    // the same chain as Sequence::get_hash() builds for a request without adapters
+    std::vector<BlockHash> hashes;
+    hashes.reserve(prompt_ids.size() / block_size);
+    for (size_t block_start = 0; block_start + block_size <= prompt_ids.size(); block_start += block_size) {
+        BlockHasher hasher(hashes.empty() ? BlockHash() : hashes.back());
+        hasher.update(prompt_ids.data() + block_start, block_size);
+        hashes.push_back(hasher.get_hash());
     }
-    
-    return _make_hash(content_len);
+    return hashes;
 }
 }  // namespace genai
 }  // namespace ov
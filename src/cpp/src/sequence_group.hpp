@@ -5,6 +5,7 @@
 
 #include <vector>
 #include <cassert>
+#include <chrono>
 #include <set>
 #include <cstdlib>
 #include <string_view>
@@ -13,7 +14,9 @@
 
 #include "openvino/genai/generation_handle.hpp"
 #include "openvino/genai/generation_config.hpp"
+#include "block_hasher.hpp"
 #include "generation_stream.hpp"
+#include "pooled_storage.hpp"
 
 namespace ov::genai {
 enum class SequenceStatus {
@@ -40,34 +43,55 @@ class Sequence {
         return m_counter++;
     }
 
-    TokenIds m_generated_ids;
-    LogProbs m_generated_log_probs;
+    // token storage is shared with forked sequences until they diverge
+    CopyOnWriteVector<int64_t> m_generated_ids;
+    CopyOnWriteVector<float> m_generated_log_probs;
     uint64_t m_grouped_id;
     uint64_t m_id = _get_next_global_sequence_id();
     ov::Tensor m_hidden_state = ov::Tensor();
     SequenceStatus m_status = SequenceStatus::RUNNING;
     GenerationFinishReason m_finish_reason = GenerationFinishReason::NONE;
     float m_cumulative_log_prob = 0.0f;
-    std::vector<int64_t> m_prefix_hashes;
+    // hashes of full KV blocks, every hash is chained with the previous one
+    CopyOnWriteVector<BlockHash> m_prefix_hashes;
+    // hasher of the last partially filled block and the content length it has consumed
+    BlockHasher m_partial_block_hasher;
+    size_t m_partial_block_content_len = 0;
     SequenceGroup* m_sequence_group = nullptr;
     static std::mutex m_counter_mutex;
-    std::vector<std::vector<float>> m_generated_ids_embeds;
+    // embeddings are immutable once appended, so sequences which diverged still share them
+    CopyOnWriteVector<std::shared_ptr<const std::vector<float>>> m_generated_ids_embeds;
     SequenceGroupType m_type;
     size_t m_hidden_size;
-    std::vector<ov::Tensor> m_position_ids_list;
+    CopyOnWriteVector<ov::Tensor> m_position_ids_list;
     int64_t m_rope_delta;
 
     // Embeddings hash calculation params
     static constexpr size_t m_embeddings_hash_max_num_values = 10; // max number of values used for embeddings hash calculation
     static constexpr size_t m_embeddings_hash_calculation_stride = 50; // the stride with which values are taken from embeddings vector
 
-    size_t _make_hash(size_t content_length);
+    BlockHasher _start_block_hash(size_t block_idx) const;
 
-    static std::vector<int64_t> _reduce_embedding(const std::vector<float>& embedding);
+    // feeds content of positions [begin, end) to a hasher
+    void _update_hash(BlockHasher& hasher, size_t begin, size_t end) const;
 
-    explicit Sequence(const uint64_t id, const SequenceGroupType type, const size_t hidden_size) : m_grouped_id(id), m_type(type), m_hidden_size(hidden_size) {}
+    static void _update_embedding_hash(BlockHasher& hasher, const std::vector<float>& embedding);
 
-    Sequence(const Sequence& seq, const uint64_t id) :
+    // drops hashes of blocks which are not full anymore after generated tokens were removed
+    void _truncate_hashes(size_t generated_len);
+
+    // allows std::allocate_shared to call constructors, while only create() and fork() can name it
+    struct PrivateTag {
+        explicit PrivateTag() = default;
+    };
+
+public:
+    using Ptr = std::shared_ptr<Sequence>;
+    using CPtr = std::shared_ptr<const Sequence>;
+
+    Sequence(PrivateTag, const uint64_t id, const SequenceGroupType type, const size_t hidden_size) : m_grouped_id(id), m_type(type), m_hidden_size(hidden_size) {}
+
+    Sequence(PrivateTag, const Sequence& seq, const uint64_t id) :
         m_generated_ids(seq.m_generated_ids),
         m_generated_log_probs(seq.m_generated_log_probs),
         m_grouped_id(id),
@@ -78,6 +102,8 @@ class Sequence {
         m_type(seq.m_type),
         m_hidden_size(seq.m_hidden_size),
         m_prefix_hashes(seq.m_prefix_hashes),
+        m_partial_block_hasher(seq.m_partial_block_hasher),
+        m_partial_block_content_len(seq.m_partial_block_content_len),
         m_generated_ids_embeds(seq.m_generated_ids_embeds),
         m_position_ids_list(seq.m_position_ids_list),
         m_rope_delta(seq.m_rope_delta)
@@ -85,16 +111,13 @@ class Sequence {
         OPENVINO_ASSERT(seq.m_id != m_id);
     }
 
-public:
-    using Ptr = std::shared_ptr<Sequence>;
-    using CPtr = std::shared_ptr<const Sequence>;
-
+    // sequences are created and released with every request and beam, so they are taken from a pool
     static Sequence::Ptr create(const uint64_t id, const SequenceGroupType type = SequenceGroupType::TOKENS, const size_t hidden_size = 0) {
-        return Sequence::Ptr(new Sequence(id, type, hidden_size));
+        return std::allocate_shared<Sequence>(PoolAllocator<Sequence>(), PrivateTag(), id, type, hidden_size);
     }
 
     static Sequence::Ptr fork(Sequence::CPtr sequence, const uint64_t id) {
-        return Sequence::Ptr(new Sequence(*sequence, id));
+        return std::allocate_shared<Sequence>(PoolAllocator<Sequence>(), PrivateTag(), *sequence, id);
     }
 
     bool operator ==(const Sequence& other) const {
@@ -140,8 +163,8 @@ public:
     // appends new tokens to a generated part
     void append_token(int64_t token_id, float log_prob) {
         m_cumulative_log_prob += log_prob;
-        m_generated_log_probs.push_back(log_prob);
-        m_generated_ids.push_back(token_id);
+        m_generated_log_probs.edit().push_back(log_prob);
+        m_generated_ids.edit().push_back(token_id);
     }
 
     void update_hidden_state(const ov::Tensor& tensor) {
@@ -156,11 +179,17 @@ public:
     // used to remove stop_string from the output
     void remove_last_tokens(int n) {
         OPENVINO_ASSERT(m_generated_ids.size() >= n, "Cannot remove more tokens than has been generated");
+        if (n == 0) {
+            return;
+        }
+        auto& generated_log_probs = m_generated_log_probs.edit();
+        auto& generated_ids = m_generated_ids.edit();
         for (int i = 0; i < n; i++) {
-            m_cumulative_log_prob -= m_generated_log_probs.back();
-            m_generated_log_probs.pop_back();
-            m_generated_ids.pop_back();
+            m_cumulative_log_prob -= generated_log_probs.back();
+            generated_log_probs.pop_back();
+            generated_ids.pop_back();
         }
+        _truncate_hashes(generated_ids.size());
     }
 
     GenerationOutput get_last_generation_output(size_t token_cnt = 1, size_t num_token_to_ignore = 0) {
@@ -169,8 +198,8 @@ public:
             OPENVINO_ASSERT(m_generated_ids.size());
             output.score = get_cumulative_log_prob();
 
-            auto generated_token_id = get_generated_ids();
-            auto generated_log_probs = get_generated_log_probs();
+            const auto& generated_token_id = get_generated_ids();
+            const auto& generated_log_probs = get_generated_log_probs();
 
             OPENVINO_ASSERT(get_generated_len() >= token_cnt);
             if (get_generated_len() > num_token_to_ignore) {
@@ -193,11 +222,11 @@ public:
     }
 
     const TokenIds & get_generated_ids() const {
-        return m_generated_ids;
+        return m_generated_ids.get();
     }
 
     const LogProbs & get_generated_log_probs() const {
-        return m_generated_log_probs;
+        return m_generated_log_probs.get();
     }
 
     float get_cumulative_log_prob() const {
@@ -206,7 +235,7 @@ public:
 
     void update_generated_log_prob(size_t idx, float log_prob) {
         OPENVINO_ASSERT(idx < m_generated_log_probs.size());
-        m_generated_log_probs[idx] = log_prob;
+        m_generated_log_probs.edit()[idx] = log_prob;
     }
 
     float get_beam_search_score(const ov::genai::GenerationConfig& sampling_params) const {
@@ -221,9 +250,15 @@ public:
         m_sequence_group = sequence_group;
     }
 
-    const std::vector<std::vector<float>>& get_generated_ids_embeds() const {
+    size_t get_num_generated_ids_embeds() const {
+        OPENVINO_ASSERT(m_type == ov::genai::SequenceGroupType::EMBEDDINGS);
+        return m_generated_ids_embeds.size();
+    }
+
+    const std::vector<float>& get_generated_ids_embed(size_t idx) const {
         OPENVINO_ASSERT(m_type == ov::genai::SequenceGroupType::EMBEDDINGS);
-        return m_generated_ids_embeds;
+        OPENVINO_ASSERT(idx < m_generated_ids_embeds.size());
+        return *m_generated_ids_embeds[idx];
     }
 
     void append_generated_ids_embeds(ov::Tensor generated_ids_embeds) {
@@ -231,20 +266,21 @@ public:
         auto embeds_count = generated_ids_embeds.get_shape()[1];
         OPENVINO_ASSERT(m_hidden_size == generated_ids_embeds.get_shape()[2]);
 
-        auto current_embeds_size = m_generated_ids_embeds.size();
-        for (size_t i = current_embeds_size, idx = 0; i < current_embeds_size + embeds_count; i++, idx++) {
-            m_generated_ids_embeds.emplace_back(std::vector<float>());
-            m_generated_ids_embeds[i].resize(m_hidden_size);
-            std::copy_n(generated_ids_embeds.data<float>() + idx * m_hidden_size, m_hidden_size, m_generated_ids_embeds[i].begin());
-
+        auto& generated_ids_embeds_list = m_generated_ids_embeds.edit();
+        const float* embeds_data = generated_ids_embeds.data<float>();
+        for (size_t idx = 0; idx < embeds_count; idx++) {
+            const float* embed_data = embeds_data + idx * m_hidden_size;
+            generated_ids_embeds_list.push_back(std::allocate_shared<std::vector<float>>(
+                PoolAllocator<std::vector<float>>(), embed_data, embed_data + m_hidden_size));
         }
     }
 
     void append_position_ids(const ov::Tensor& position_ids) {
         size_t seq_len_shape_idx = position_ids.get_shape().size() == 3 ? 2 : 1;
         size_t position_ids_len = position_ids.get_shape()[seq_len_shape_idx];
+        auto& position_ids_list = m_position_ids_list.edit();
         if (position_ids_len == 1) {
-            m_position_ids_list.push_back(position_ids);
+            position_ids_list.push_back(position_ids);
             return;
         }
         ov::Shape position_ids_elem_shape = position_ids.get_shape();
@@ -257,7 +293,7 @@ public:
 
             ov::Tensor src_roi(position_ids, begin, end);
             src_roi.copy_to(position_ids_elem);
-            m_position_ids_list.push_back(position_ids_elem);
+            position_ids_list.push_back(position_ids_elem);
         }
     }
 
@@ -267,7 +303,7 @@ public:
 
     const std::vector<ov::Tensor>& get_position_ids_list() const {
         OPENVINO_ASSERT(m_type == ov::genai::SequenceGroupType::EMBEDDINGS);
-        return m_position_ids_list;
+        return m_position_ids_list.get();
     }
 
     const int64_t get_rope_delta() const {
@@ -280,7 +316,12 @@ public:
     // Each KV block can be uniquely identified by
     // the tokens within the block and the tokens in the prefix before the block.
     // hash(prefix tokens + block tokens) <--> KV Block
-    size_t get_hash(size_t content_length = 0);
+    // Hashes of full blocks are computed once, the last partially filled block is hashed incrementally.
+    BlockHash get_hash(size_t content_length = 0);
+
+    const std::vector<BlockHash>& get_prefix_hashes() const {
+        return m_prefix_hashes.get();
+    }
 
     static std::pair<ov::Coordinate, ov::Coordinate> get_position_ids_elem_coordinates(const ov::Shape& position_ids_elem_shape, size_t idx, bool need_batch_dimention) {
 
@@ -343,6 +384,18 @@ class SequenceGroup  : public std::enable_shared_from_this<SequenceGroup> {
 
     size_t m_num_streamed_tokens = 0, m_stream_window_size = 0;
 
+    // LoRA slot holding adapters of this request when several adapter configs are served in a batch, -1 if no adapters are applied
+    int32_t m_adapter_slot = -1;
+    // id of the adapter config in the same case, 0 if no adapters are applied
+    size_t m_adapter_config_id = 0;
+
+    // request timeline for latency metrics of the pipeline
+    std::chrono::steady_clock::time_point m_arrival_time = std::chrono::steady_clock::now();
+    std::optional<std::chrono::steady_clock::time_point> m_first_schedule_time;
+    std::optional<std::chrono::steady_clock::time_point> m_last_token_time;
+    // number of generated tokens at m_last_token_time
+    size_t m_num_timed_tokens = 0;
+
     SequenceGroup(uint64_t request_id, const ov::genai::GenerationConfig& sampling_params, std::size_t block_size)
         : m_request_id(request_id),
           m_sampling_params(sampling_params),
@@ -421,6 +474,12 @@ public:
         add_sequence(sequence);
     }
 
+    // requests are created and released continuously by pipelines, so they are taken from a pool
+    template <typename... Args>
+    static SequenceGroup::Ptr create(Args&&... args) {
+        return std::allocate_shared<SequenceGroup>(PoolAllocator<SequenceGroup>(), std::forward<Args>(args)...);
+    }
+
     void add_sequence(const Sequence::Ptr & sequence) {
         sequence->set_sequence_group_ptr(this);
         m_sequences.emplace_back(sequence);
@@ -749,6 +808,47 @@ public:
         return m_sampling_params;
     }
 
+    int32_t get_adapter_slot() const {
+        return m_adapter_slot;
+    }
+
+    void set_adapter_slot(int32_t slot) {
+        m_adapter_slot = slot;
+    }
+
+    size_t get_adapter_config_id() const {
+        return m_adapter_config_id;
+    }
+
+    void set_adapter_config_id(size_t config_id) {
+        m_adapter_config_id = config_id;
+    }
+
+    std::chrono::steady_clock::time_point get_arrival_time() const {
+        return m_arrival_time;
+    }
+
+    const std::optional<std::chrono::steady_clock::time_point>& get_first_schedule_time() const {
+        return m_first_schedule_time;
+    }
+
+    void set_first_schedule_time(std::chrono::steady_clock::time_point time) {
+        m_first_schedule_time = time;
+    }
+
+    const std::optional<std::chrono::steady_clock::time_point>& get_last_token_time() const {
+        return m_last_token_time;
+    }
+
+    size_t get_num_timed_tokens() const {
+        return m_num_timed_tokens;
+    }
+
+    void set_last_token_time(std::chrono::steady_clock::time_point time, size_t num_generated_tokens) {
+        m_last_token_time = time;
+        m_num_timed_tokens = num_generated_tokens;
+    }
+
     void set_out_of_memory() {
         for (size_t seq_id = 0; seq_id < m_sequences.size(); ++seq_id) {
             if (m_sequences[seq_id]->is_running()) {
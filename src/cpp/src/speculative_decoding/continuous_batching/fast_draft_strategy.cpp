@@ -87,6 +87,8 @@ ContinuousBatchingPipeline::SpeculativeDecodingImpl::init_speculative_models(con
         draft_scheduler_config.dynamic_split_fuse = main_scheduler_config_updated.dynamic_split_fuse;
         draft_scheduler_config.max_num_batched_tokens = main_scheduler_config_updated.max_num_batched_tokens;
     }
+    // main and draft models have different prefix caches, while prompts have to be admitted by both at the same step
+    main_scheduler_config_updated.prefix_aware_admission_window = draft_scheduler_config.prefix_aware_admission_window = 0;
 
     return std::make_pair(main_scheduler_config_updated, draft_scheduler_config);
 }
@@ -113,6 +115,7 @@ ContinuousBatchingPipeline::SpeculativeDecodingImpl::SpeculativeDecodingImpl(con
     m_draft_pipeline = std::make_shared<ContinuousBatchingForSpeculativeDecodingImpl>(
         draft_model_desc.model, draft_model_tokenizer, draft_model_desc.generation_config,
         scheduler_configs.second, draft_device, draft_properties, false);
+    m_metrics_collector = m_main_pipeline->get_metrics_collector();
 
     m_perf_metrics = ov::genai::SDPerModelsPerfMetrics();
     m_draft_pipeline->raw_perf_metrics.m_inference_durations =  {{ MicroSeconds(0.0f) }};
@@ -219,6 +222,8 @@ void ContinuousBatchingPipeline::SpeculativeDecodingImpl::step() {
         float acceptance_rate = 1 - static_cast<float>(updated_seq_info.removed_tokens_cnt) / updated_seq_info.inserted_tokens_cnt;
         m_sd_metrics.update_acceptance_rate(request_id, acceptance_rate * 100);
         m_sd_metrics.update_draft_accepted_tokens(request_id, (updated_seq_info.inserted_tokens_cnt - updated_seq_info.removed_tokens_cnt));
+        m_metrics_collector->draft_tokens += updated_seq_info.inserted_tokens_cnt;
+        m_metrics_collector->accepted_draft_tokens += updated_seq_info.inserted_tokens_cnt - updated_seq_info.removed_tokens_cnt;
     }
 
     const auto step_end = std::chrono::steady_clock::now();
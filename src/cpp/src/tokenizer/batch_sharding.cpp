@@ -0,0 +1,117 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "tokenizer/batch_sharding.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+#include "openvino/core/except.hpp"
+
+namespace ov {
+namespace genai {
+
+std::vector<std::vector<size_t>> shard_by_length(const std::vector<size_t>& lengths, size_t max_num_shards, size_t min_shard_size) {
+    const size_t batch_size = lengths.size();
+    const size_t num_shards = std::max<size_t>(1, std::min(max_num_shards, batch_size / std::max<size_t>(1, min_shard_size)));
+
+    std::vector<size_t> order(batch_size);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&lengths](size_t lhs, size_t rhs) {
+        return lengths[lhs] < lengths[rhs];
+    });
+
+    // every item also has fixed processing overhead, so empty strings are not free
+    constexpr size_t ITEM_OVERHEAD = 16;
+    size_t total_cost = 0;
+    for (size_t length : lengths)
+        total_cost += length + ITEM_OVERHEAD;
+
+    std::vector<std::vector<size_t>> shards(num_shards);
+    size_t shard = 0, cost = 0;
+    for (size_t i = 0; i < batch_size; ++i) {
+        const size_t items_left = batch_size - i, shards_left = num_shards - shard;
+        // close a shard once it reached its share of total cost, keeping enough items for the rest of shards
+        const bool shard_is_full = cost * num_shards >= total_cost * (shard + 1) && shards[shard].size() >= min_shard_size;
+        if (shard + 1 < num_shards && (shard_is_full || items_left <= (shards_left - 1) * min_shard_size)) {
+            ++shard;
+        }
+        shards[shard].push_back(order[i]);
+        cost += lengths[order[i]] + ITEM_OVERHEAD;
+    }
+
+    shards.erase(std::remove_if(shards.begin(), shards.end(), [](const std::vector<size_t>& indices) {
+        return indices.empty();
+    }), shards.end());
+    return shards;
+}
+
+std::optional<TokenizedInputs> merge_padded_shards(const std::vector<TokenizedInputs>& shards,
+                                                   const std::vector<std::vector<size_t>>& shard_indices,
+                                                   std::optional<bool> pad_right,
+                                                   int64_t pad_token_id) {
+    OPENVINO_ASSERT(shards.size() == shard_indices.size(), "Number of encoded shards doesn't match number of shards");
+
+    size_t batch_size = 0, max_length = 0;
+    bool same_length = true;
+    for (size_t shard = 0; shard < shards.size(); ++shard) {
+        const ov::Shape& shape = shards[shard].input_ids.get_shape();
+        OPENVINO_ASSERT(shape.size() == 2 && shape[0] == shard_indices[shard].size(), "Unexpected shape of encoded shard: ", shape);
+        OPENVINO_ASSERT(shards[shard].input_ids.get_element_type() == ov::element::i64 &&
+                        shards[shard].attention_mask.get_element_type() == ov::element::i64,
+                        "Encoded shards are expected to have i64 element type");
+        same_length = same_length && (shard == 0 || shape[1] == max_length);
+        batch_size += shape[0];
+        max_length = std::max(max_length, shape[1]);
+    }
+
+    if (!same_length) {
+        // padding of tokenizer output is the source of truth, since it depends on RaggedToDense attributes
+        bool padding_found = false;
+        for (size_t shard = 0; shard < shards.size() && !padding_found; ++shard) {
+            const size_t length = shards[shard].input_ids.get_shape()[1];
+            const int64_t* input_ids = shards[shard].input_ids.data<const int64_t>();
+            const int64_t* attention_mask = shards[shard].attention_mask.data<const int64_t>();
+            for (size_t row = 0; row < shard_indices[shard].size() && length > 0; ++row) {
+                const size_t first = row * length, last = first + length - 1;
+                // a row of padding only, e.g. an empty prompt without special tokens, doesn't tell the side
+                if ((attention_mask[first] == 0) != (attention_mask[last] == 0)) {
+                    pad_right = attention_mask[first] != 0;
+                    pad_token_id = input_ids[*pad_right ? last : first];
+                    padding_found = true;
+                    break;
+                }
+            }
+        }
+        if (!pad_right.has_value()) {
+            return std::nullopt;
+        }
+    }
+
+    ov::Tensor input_ids(ov::element::i64, {batch_size, max_length});
+    ov::Tensor attention_mask(ov::element::i64, {batch_size, max_length});
+    int64_t* input_ids_data = input_ids.data<int64_t>();
+    int64_t* attention_mask_data = attention_mask.data<int64_t>();
+
+    for (size_t shard = 0; shard < shards.size(); ++shard) {
+        const size_t length = shards[shard].input_ids.get_shape()[1];
+        const size_t offset = pad_right.value_or(true) ? 0 : max_length - length;
+        const int64_t* shard_input_ids = shards[shard].input_ids.data<const int64_t>();
+        const int64_t* shard_attention_mask = shards[shard].attention_mask.data<const int64_t>();
+
+        for (size_t row = 0; row < shard_indices[shard].size(); ++row) {
+            int64_t* row_input_ids = input_ids_data + shard_indices[shard][row] * max_length;
+            int64_t* row_attention_mask = attention_mask_data + shard_indices[shard][row] * max_length;
+
+            std::fill_n(row_input_ids, max_length, pad_token_id);
+            std::fill_n(row_attention_mask, max_length, 0);
+            std::copy_n(shard_input_ids + row * length, length, row_input_ids + offset);
+            std::copy_n(shard_attention_mask + row * length, length, row_attention_mask + offset);
+        }
+    }
+
+    return TokenizedInputs{input_ids, attention_mask};
+}
+
+}  // namespace genai
+}  // namespace ov
@@ -0,0 +1,35 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include "openvino/genai/tokenizer.hpp"
+
+namespace ov {
+namespace genai {
+
+/**
+ * Splits a batch into at most 'max_num_shards' shards of at least 'min_shard_size' items each, so that shards
+ * are processed by separate infer requests in parallel. Items are ordered by length, so a shard holds items
+ * of similar length and padding within it is minimal. Shards are balanced by total length rather than by count.
+ * Returns indices of items of every shard.
+ */
+std::vector<std::vector<size_t>> shard_by_length(const std::vector<size_t>& lengths, size_t max_num_shards, size_t min_shard_size);
+
+/**
+ * Merges padded [shard_size, shard_length] encodings of shards into [batch_size, max_shard_length] encoding
+ * with items in the original order. Rows of narrower shards are padded on the same side and with the same
+ * token as the tokenizer padded shards; 'pad_right' and 'pad_token_id' are used if no row of shards is padded
+ * on one side only, rows of padding only don't tell the side. Returns std::nullopt if padding side can't be determined.
+ */
+std::optional<TokenizedInputs> merge_padded_shards(const std::vector<TokenizedInputs>& shards,
+                                                   const std::vector<std::vector<size_t>>& shard_indices,
+                                                   std::optional<bool> pad_right,
+                                                   int64_t pad_token_id);
+
+}  // namespace genai
+}  // namespace ov
@@ -0,0 +1,71 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "tokenizer/chat_template_cache.hpp"
+
+namespace ov {
+namespace genai {
+
+ChatTemplateCache::ChatTemplateCache(size_t capacity)
+    : m_capacity(capacity) {
+}
+
+ChatTemplateCache& ChatTemplateCache::instance() {
+    static ChatTemplateCache cache;
+    return cache;
+}
+
+std::shared_ptr<const minja::chat_template> ChatTemplateCache::get(const std::string& chat_template,
+                                                                   const std::string& bos_token,
+                                                                   const std::string& eos_token) {
+    // special tokens are substituted by minja while parsing, so they are a part of key
+    std::string key;
+    key.reserve(chat_template.size() + bos_token.size() + eos_token.size() + 2);
+    key.append(chat_template).append(1, '\0').append(bos_token).append(1, '\0').append(eos_token);
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_index.find(key);
+        if (it != m_index.end()) {
+            m_entries.splice(m_entries.begin(), m_entries, it->second);
+            return it->second->second;
+        }
+    }
+
+    // parse outside of lock, so other templates are served meanwhile; concurrent misses of the same template
+    // may parse it twice, but only one instance is kept
+    auto parsed = std::make_shared<const minja::chat_template>(chat_template, bos_token, eos_token);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_index.find(key);
+    if (it != m_index.end()) {
+        m_entries.splice(m_entries.begin(), m_entries, it->second);
+        return it->second->second;
+    }
+
+    if (m_capacity == 0)
+        return parsed;
+
+    m_entries.emplace_front(key, parsed);
+    m_index.emplace(std::move(key), m_entries.begin());
+    while (m_entries.size() > m_capacity) {
+        m_index.erase(m_entries.back().first);
+        m_entries.pop_back();
+    }
+
+    return parsed;
+}
+
+size_t ChatTemplateCache::size() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_entries.size();
+}
+
+void ChatTemplateCache::clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.clear();
+    m_index.clear();
+}
+
+}  // namespace genai
+}  // namespace ov
@@ -0,0 +1,51 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "minja/chat-template.hpp"
+
+namespace ov {
+namespace genai {
+
+/**
+ * Process-wide bounded LRU cache of parsed chat templates.
+ * Construction of minja::chat_template parses Jinja source and renders it several times to detect template
+ * capabilities, which takes milliseconds for large tool-calling templates. Parsed templates are immutable and
+ * rendering is const, so a single instance is shared by all tokenizers and threads using the same template.
+ */
+class ChatTemplateCache {
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 32;
+
+    explicit ChatTemplateCache(size_t capacity = DEFAULT_CAPACITY);
+
+    static ChatTemplateCache& instance();
+
+    // Returns parsed template, parsing it on a miss; parsing errors are propagated and nothing is cached
+    std::shared_ptr<const minja::chat_template> get(const std::string& chat_template,
+                                                    const std::string& bos_token,
+                                                    const std::string& eos_token);
+
+    size_t size() const;
+
+    void clear();
+
+private:
+    using Entry = std::pair<std::string, std::shared_ptr<const minja::chat_template>>;
+
+    size_t m_capacity;
+    std::list<Entry> m_entries;  // most recently used entries go first
+    std::unordered_map<std::string, std::list<Entry>::iterator> m_index;
+    mutable std::mutex m_mutex;
+};
+
+}  // namespace genai
+}  // namespace ov
@@ -0,0 +1,113 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "tokenizer/chat_tokenization_cache.hpp"
+
+#include <algorithm>
+
+namespace ov {
+namespace genai {
+
+namespace {
+
+std::vector<int64_t> to_vector(const ov::Tensor& input_ids) {
+    const int64_t* data = input_ids.data<const int64_t>();
+    return std::vector<int64_t>(data, data + input_ids.get_size());
+}
+
+TokenizedInputs make_tokenized_inputs(const std::vector<int64_t>& tokens) {
+    ov::Tensor input_ids(ov::element::i64, {1, tokens.size()});
+    std::copy(tokens.begin(), tokens.end(), input_ids.data<int64_t>());
+    ov::Tensor attention_mask(ov::element::i64, {1, tokens.size()});
+    std::fill_n(attention_mask.data<int64_t>(), tokens.size(), 1);
+    return {input_ids, attention_mask};
+}
+
+}  // namespace
+
+TokenizedInputs ChatTokenizationCache::encode(Tokenizer& tokenizer, const std::string& templated_history) {
+    return encode([&tokenizer](const std::string& text) {
+        return to_vector(tokenizer.encode(text, ov::genai::add_special_tokens(false)).input_ids);
+    }, tokenizer.get_eos_token(), tokenizer.get_eos_token_id(), templated_history);
+}
+
+TokenizedInputs ChatTokenizationCache::encode(const EncodeFunction& encode_text, const std::string& eos_token, int64_t eos_token_id,
+                                              const std::string& templated_history) {
+    m_num_reused_tokens = 0;
+
+    if (!m_enabled || eos_token.empty() || eos_token_id < 0) {
+        return make_tokenized_inputs(encode_text(templated_history));
+    }
+
+    const size_t common_prefix_length = std::mismatch(m_text.begin(), m_text.end(),
+                                                      templated_history.begin(), templated_history.end()).first - m_text.begin();
+    // the last boundary within common prefix
+    auto boundary_it = std::upper_bound(m_boundaries.begin(), m_boundaries.end(), common_prefix_length,
+                                        [](size_t offset, const Boundary& boundary) { return offset < boundary.text_offset; });
+    if (boundary_it == m_boundaries.begin()) {
+        return encode_full(encode_text, templated_history, eos_token, eos_token_id);
+    }
+    const Boundary boundary = *std::prev(boundary_it);
+
+    // the suffix is encoded following the EOS token ending the reused tokens, which is replaced by the encoded one
+    std::vector<int64_t> tokens(m_tokens.begin(), m_tokens.begin() + boundary.num_tokens - 1);
+    const std::vector<int64_t> suffix = encode_text(eos_token + templated_history.substr(boundary.text_offset));
+    const bool eos_is_kept = !suffix.empty() && suffix.front() == eos_token_id;
+    tokens.insert(tokens.end(), suffix.begin(), suffix.end());
+
+    if (!m_verified || !eos_is_kept) {
+        // tokenizers which alter text at the beginning of input (e.g. add prefix space) can't be spliced
+        std::vector<int64_t> full = encode_text(templated_history);
+        if (full != tokens) {
+            m_enabled = false;
+            reset();
+            return make_tokenized_inputs(full);
+        }
+        m_verified = true;
+    }
+
+    m_text = templated_history;
+    m_tokens = std::move(tokens);
+    m_boundaries.erase(boundary_it, m_boundaries.end());
+    if (!append_boundaries(boundary.text_offset, boundary.num_tokens, eos_token, eos_token_id)) {
+        // EOS text was split or merged by tokenizer, so spliced tokens can't be trusted
+        return encode_full(encode_text, templated_history, eos_token, eos_token_id);
+    }
+
+    m_num_reused_tokens = boundary.num_tokens - 1;
+    return make_tokenized_inputs(m_tokens);
+}
+
+void ChatTokenizationCache::reset() {
+    m_text.clear();
+    m_tokens.clear();
+    m_boundaries.clear();
+    m_num_reused_tokens = 0;
+}
+
+TokenizedInputs ChatTokenizationCache::encode_full(const EncodeFunction& encode_text, const std::string& text, const std::string& eos_token, int64_t eos_token_id) {
+    m_text = text;
+    m_tokens = encode_text(text);
+    m_boundaries.clear();
+    if (!append_boundaries(0, 0, eos_token, eos_token_id)) {
+        m_boundaries.clear();
+    }
+    return make_tokenized_inputs(m_tokens);
+}
+
+bool ChatTokenizationCache::append_boundaries(size_t text_offset, size_t token_offset, const std::string& eos_token, int64_t eos_token_id) {
+    // k-th EOS text in the text corresponds to k-th EOS token in the tokens
+    size_t token_idx = token_offset;
+    for (size_t pos = m_text.find(eos_token, text_offset); pos != std::string::npos; pos = m_text.find(eos_token, pos + eos_token.size())) {
+        auto eos_it = std::find(m_tokens.begin() + token_idx, m_tokens.end(), eos_token_id);
+        if (eos_it == m_tokens.end()) {
+            return false;
+        }
+        token_idx = std::distance(m_tokens.begin(), eos_it) + 1;
+        m_boundaries.push_back({pos + eos_token.size(), token_idx});
+    }
+    return std::find(m_tokens.begin() + token_idx, m_tokens.end(), eos_token_id) == m_tokens.end();
+}
+
+}  // namespace genai
+}  // namespace ov
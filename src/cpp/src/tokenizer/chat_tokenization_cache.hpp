@@ -0,0 +1,72 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "openvino/genai/tokenizer.hpp"
+
+namespace ov {
+namespace genai {
+
+/**
+ * Tokenizes chat history rendered by chat template, reusing tokens of the history rendered on previous turn.
+ * Every turn re-renders the whole conversation, which is mostly a prefix of the previous rendered text.
+ * Text is split at EOS token occurrences ending messages: special tokens are never merged with neighbouring text,
+ * so tokens of everything up to the last such boundary within the common prefix are taken from the previous turn
+ * and only the rest of the text is encoded. This makes per-turn tokenization cost independent of history length.
+ * The rest of the text is encoded following the EOS token that ends the reused part, so effects of the EOS token on
+ * the text after it (e.g. stripping of whitespace by a special token) are the same as in the full text.
+ * Spliced result is validated: EOS tokens must be found in encoded suffix where EOS texts are, and the first
+ * splice is compared with tokenization of the full text. The first check is sufficient, since the remaining
+ * assumption that text before an EOS token doesn't affect tokens after it depends on the tokenizer only, not on
+ * the text: special tokens are split out before the text is tokenized, unless the tokenizer alters the beginning of
+ * input (e.g. adds prefix space), which the first check detects. On mismatch the cache falls back to full tokenization.
+ */
+class ChatTokenizationCache {
+public:
+    // Returns token ids of a given text encoded without special tokens added
+    using EncodeFunction = std::function<std::vector<int64_t>(const std::string& text)>;
+
+    // Returns the same input_ids and attention_mask as tokenizer.encode(templated_history, add_special_tokens(false))
+    TokenizedInputs encode(Tokenizer& tokenizer, const std::string& templated_history);
+
+    TokenizedInputs encode(const EncodeFunction& encode_text, const std::string& eos_token, int64_t eos_token_id,
+                           const std::string& templated_history);
+
+    // Drops cached history, e.g. when chat is restarted
+    void reset();
+
+    // Number of tokens reused from previous turn by the last encode() call
+    size_t get_num_reused_tokens() const {
+        return m_num_reused_tokens;
+    }
+
+private:
+    struct Boundary {
+        size_t text_offset;   // offset of text following EOS token
+        size_t num_tokens;    // number of tokens encoding text before 'text_offset'
+    };
+
+    // Encodes 'text' from scratch and caches it
+    TokenizedInputs encode_full(const EncodeFunction& encode_text, const std::string& text, const std::string& eos_token, int64_t eos_token_id);
+
+    // Appends boundaries found in m_text and m_tokens starting from given offsets.
+    // Returns false if EOS texts and EOS tokens do not match each other
+    bool append_boundaries(size_t text_offset, size_t token_offset, const std::string& eos_token, int64_t eos_token_id);
+
+    std::string m_text;
+    std::vector<int64_t> m_tokens;
+    std::vector<Boundary> m_boundaries;
+    size_t m_num_reused_tokens = 0;
+    bool m_verified = false;
+    bool m_enabled = true;
+};
+
+}  // namespace genai
+}  // namespace ov
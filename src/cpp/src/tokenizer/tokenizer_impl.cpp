@@ -1,10 +1,16 @@
 // Copyright (C) 2025 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 
+#include <future>
+#include <numeric>
+
 #include "tokenizer/tokenizer_impl.hpp"
+#include "tokenizer/batch_sharding.hpp"
+#include "tokenizer/chat_template_cache.hpp"
 #include "add_second_input_pass.hpp"
 #include "sampling/structured_output/structured_output_controller.hpp"
 #include "openvino/genai/version.hpp"
+#include "openvino/op/read_value.hpp"
 
 namespace ov {
 namespace genai {
@@ -38,6 +44,42 @@ ov::Core get_core_singleton() {
     return core;
 }
 
+namespace {
+
+// Batches are split between idle infer requests only if every request gets at least this number of inputs,
+// otherwise thread start-up costs more than tokenization of a shard. The number of infer requests is
+// ov::optimal_number_of_infer_requests, which is 1 under default LATENCY hint, so sharding requires THROUGHPUT hint
+constexpr size_t MIN_BATCH_SHARD_SIZE = 16;
+
+// State flags of all requests are registered in advance, since requests of a queue are used by several threads
+void register_state_flags(CircularBufferQueue<ov::InferRequest>& queue, std::unordered_map<ov::InferRequest*, ov::AnyMap>& request_to_state_flags) {
+    for (size_t i = 0; i < queue.size(); ++i) {
+        request_to_state_flags[&queue.get(static_cast<int>(i))];
+    }
+}
+
+// Calls fn(shard, infer_request_guard) for every shard, running shards in parallel on separate infer requests
+template <typename Fn>
+void run_sharded(CircularBufferQueue<ov::InferRequest>* queue, size_t num_shards, Fn&& fn) {
+    std::vector<std::future<void>> shard_futures;
+    shard_futures.reserve(num_shards);
+    for (size_t shard = 1; shard < num_shards; ++shard) {
+        shard_futures.push_back(std::async(std::launch::async, [queue, shard, &fn]() {
+            CircularBufferQueueElementGuard<ov::InferRequest> infer_request_guard(queue);
+            fn(shard, infer_request_guard);
+        }));
+    }
+    {
+        CircularBufferQueueElementGuard<ov::InferRequest> infer_request_guard(queue);
+        fn(0, infer_request_guard);
+    }
+    for (auto& shard_future : shard_futures) {
+        shard_future.get();
+    }
+}
+
+}  // namespace
+
 constexpr char bos_token_key_name[] = "bos_token";
 constexpr char eos_token_key_name[] = "eos_token";
 constexpr char pad_token_key_name[] = "pad_token";
@@ -404,6 +446,14 @@ void Tokenizer::TokenizerImpl::setup_tokenizer(const std::pair<std::shared_ptr<o
         manager.register_pass<MakeAddSpecialTokensSatateful>();
         manager.register_pass<MakePaddingSatateful>();
         manager.run_passes(ov_tokenizer);
+        for (const auto& op : ov_tokenizer->get_ops()) {
+            auto read_value = ov::as_type_ptr<ov::op::v6::ReadValue>(op);
+            if (read_value && read_value->get_variable_id() == PAD_RIGHT_VAR_ID) {
+                if (auto default_pad_right = ov::as_type_ptr<ov::op::v0::Constant>(read_value->get_input_node_shared_ptr(0))) {
+                    m_pad_right = default_pad_right->cast_vector<int32_t>().at(0) != 0;
+                }
+            }
+        }
         ov::CompiledModel tokenizer = core.compile_model(ov_tokenizer, device, properties);
         ov::genai::utils::print_compiled_model_properties(tokenizer, "OV Tokenizer");
 
@@ -412,6 +462,7 @@ void Tokenizer::TokenizerImpl::setup_tokenizer(const std::pair<std::shared_ptr<o
             [&tokenizer]() -> ov::InferRequest {
                 return tokenizer.create_infer_request();
             });
+        register_state_flags(*m_ireq_queue_tokenizer, m_request_to_state_flags);
 
         const ov::AnyMap& rt_info = ov_tokenizer->get_rt_info();
         m_pad_token_id = find_or_fallback(rt_info, "pad_token_id", m_pad_token_id);
@@ -439,6 +490,7 @@ void Tokenizer::TokenizerImpl::setup_tokenizer(const std::pair<std::shared_ptr<o
             [&detokenizer]() -> ov::InferRequest {
                 return detokenizer.create_infer_request();
             });
+        register_state_flags(*m_ireq_queue_detokenizer, m_request_to_state_flags);
 
         // Unset/-1 token causes exception in SentencePiece detokenization.
         if (m_pad_token_id != -1 && m_pad_token.empty())
@@ -652,6 +704,13 @@ TokenizedInputs Tokenizer::TokenizerImpl::encode(const std::vector<std::string>&
     OPENVINO_ASSERT(m_ireq_queue_tokenizer, "Either openvino_tokenizer.xml was not provided or it was not loaded correctly. "
                                             "Tokenizer::encode is not available");
 
+    const size_t max_num_shards = std::min(m_ireq_queue_tokenizer->size(), prompts.size() / MIN_BATCH_SHARD_SIZE);
+    if (max_num_shards > 1) {
+        if (auto encoded = encode_sharded(prompts, tokenization_params, max_num_shards)) {
+            return *encoded;
+        }
+    }
+
     TokenizedInputs unpadded;
     {
         CircularBufferQueueElementGuard<ov::InferRequest> infer_request_guard(this->m_ireq_queue_tokenizer.get());
@@ -678,6 +737,43 @@ TokenizedInputs Tokenizer::TokenizerImpl::encode(const std::vector<std::string>&
     return {unpadded.input_ids, unpadded.attention_mask};
 }
 
+std::optional<TokenizedInputs> Tokenizer::TokenizerImpl::encode_sharded(const std::vector<std::string>& prompts, const ov::AnyMap& tokenization_params, size_t max_num_shards) {
+    std::vector<size_t> lengths(prompts.size());
+    std::transform(prompts.begin(), prompts.end(), lengths.begin(), [](const std::string& prompt) {
+        return prompt.size();
+    });
+    const std::vector<std::vector<size_t>> shard_indices = shard_by_length(lengths, max_num_shards, MIN_BATCH_SHARD_SIZE);
+
+    std::vector<TokenizedInputs> encoded_shards(shard_indices.size());
+    run_sharded(m_ireq_queue_tokenizer.get(), shard_indices.size(), [&](size_t shard, CircularBufferQueueElementGuard<ov::InferRequest>& infer_request_guard) {
+        std::vector<std::string> shard_prompts;
+        shard_prompts.reserve(shard_indices[shard].size());
+        for (size_t idx : shard_indices[shard]) {
+            shard_prompts.push_back(prompts[idx]);
+        }
+
+        set_state_if_necessary(infer_request_guard, tokenization_params);
+        infer_request_guard.get().set_input_tensor(0, ov::Tensor{ov::element::string, {shard_prompts.size()}, shard_prompts.data()});
+        if (infer_request_guard.get().get_compiled_model().inputs().size() > 1) {
+            infer_request_guard.get().set_input_tensor(1, ov::Tensor{ov::element::string, {0}});
+        }
+        infer_request_guard.get().infer();
+
+        encoded_shards[shard] = get_copied_results(
+            infer_request_guard.get().get_tensor("input_ids"),
+            infer_request_guard.get().get_tensor("attention_mask")
+        );
+    });
+
+    std::optional<std::string> padding_side_val;
+    ov::genai::utils::read_anymap_param(tokenization_params, padding_side.name(), padding_side_val);
+    std::optional<bool> pad_right = m_pad_right;
+    if (padding_side_val.has_value()) {
+        pad_right = *padding_side_val == "right";
+    }
+    return merge_padded_shards(encoded_shards, shard_indices, pad_right, m_pad_token_id);
+}
+
 TokenizedInputs Tokenizer::TokenizerImpl::get_copied_results(ov::Tensor input_ids, ov::Tensor attention_mask) {
     ov::Tensor input_ids_ = ov::Tensor(input_ids.get_element_type(), input_ids.get_shape());
     ov::Tensor attention_mask_ = ov::Tensor(attention_mask.get_element_type(), attention_mask.get_shape());
@@ -703,6 +799,19 @@ std::vector<std::string> Tokenizer::TokenizerImpl::decode(const ov::Tensor& toke
     OPENVINO_ASSERT(tokens.get_element_type() == ov::element::i64, "tokens tensor element type should be an i64");
     OPENVINO_ASSERT(tokens.get_shape().size() == 2, "tokens tensor should of rank 2 with shape [batch_size, seq_len]");
 
+    const size_t batch_size = tokens.get_shape()[0], seq_len = tokens.get_shape()[1];
+    const size_t max_num_shards = std::min(m_ireq_queue_detokenizer->size(), batch_size / MIN_BATCH_SHARD_SIZE);
+    if (max_num_shards > 1) {
+        // rows are already padded to the same length, so shards are contiguous ranges of rows viewed in place
+        const std::vector<std::vector<size_t>> shard_indices = shard_by_length(std::vector<size_t>(batch_size, seq_len), max_num_shards, MIN_BATCH_SHARD_SIZE);
+        int64_t* tokens_data = const_cast<int64_t*>(tokens.data<const int64_t>());
+        std::vector<ov::Tensor> shard_tokens;
+        for (const auto& indices : shard_indices) {
+            shard_tokens.emplace_back(ov::element::i64, ov::Shape{indices.size(), seq_len}, tokens_data + indices.front() * seq_len);
+        }
+        return decode_sharded(shard_tokens, shard_indices, detokenization_params);
+    }
+
     CircularBufferQueueElementGuard<ov::InferRequest> infer_request_guard(this->m_ireq_queue_detokenizer.get());
     set_state_if_necessary(infer_request_guard, detokenization_params);
     infer_request_guard.get().set_input_tensor(tokens);
@@ -713,23 +822,45 @@ std::vector<std::string> Tokenizer::TokenizerImpl::decode(const ov::Tensor& toke
     return std::vector<std::string>(res_data, res_data + res.get_shape()[0]);
 }
 
-std::vector<std::string> Tokenizer::TokenizerImpl::decode(const std::vector<std::vector<int64_t>>& lines, const ov::AnyMap& detokenization_params) {
-    OPENVINO_ASSERT(m_ireq_queue_detokenizer, "Detokenizer model has not been provided. Tokenizer::decode is not available");
-
-    auto compare_lengths = [](const std::vector<int64_t>& a, const std::vector<int64_t>& b) {
-        return a.size() < b.size();
-    };
-    size_t max_len = std::max_element(lines.begin(), lines.end(), compare_lengths)->size();
+ov::Tensor Tokenizer::TokenizerImpl::pad_lines(const std::vector<std::vector<int64_t>>& lines, const std::vector<size_t>& indices) {
+    size_t max_len = 0;
+    for (size_t idx : indices) {
+        max_len = std::max(max_len, lines[idx].size());
+    }
 
-    ov::Tensor tokens = ov::Tensor{ov::element::i64, {lines.size(), max_len}};
+    ov::Tensor tokens = ov::Tensor{ov::element::i64, {indices.size(), max_len}};
     auto tokens_data = tokens.data<int64_t>();
 
-    for (size_t i = 0; i < lines.size(); ++i) {
-        const auto& line = lines[i];
+    for (size_t i = 0; i < indices.size(); ++i) {
+        const auto& line = lines[indices[i]];
         size_t line_len = line.size();
         std::copy(line.begin(), line.end(), tokens_data + i * max_len);
         std::fill(tokens_data + i * max_len + line_len, tokens_data + (i + 1) * max_len, m_pad_token_id);
     }
+    return tokens;
+}
+
+std::vector<std::string> Tokenizer::TokenizerImpl::decode(const std::vector<std::vector<int64_t>>& lines, const ov::AnyMap& detokenization_params) {
+    OPENVINO_ASSERT(m_ireq_queue_detokenizer, "Detokenizer model has not been provided. Tokenizer::decode is not available");
+
+    const size_t max_num_shards = std::min(m_ireq_queue_detokenizer->size(), lines.size() / MIN_BATCH_SHARD_SIZE);
+    if (max_num_shards > 1) {
+        // lines of similar length are decoded together, so less padding is processed
+        std::vector<size_t> lengths(lines.size());
+        std::transform(lines.begin(), lines.end(), lengths.begin(), [](const std::vector<int64_t>& line) {
+            return line.size();
+        });
+        const std::vector<std::vector<size_t>> shard_indices = shard_by_length(lengths, max_num_shards, MIN_BATCH_SHARD_SIZE);
+        std::vector<ov::Tensor> shard_tokens;
+        for (const auto& indices : shard_indices) {
+            shard_tokens.push_back(pad_lines(lines, indices));
+        }
+        return decode_sharded(shard_tokens, shard_indices, detokenization_params);
+    }
+
+    std::vector<size_t> indices(lines.size());
+    std::iota(indices.begin(), indices.end(), 0);
+    ov::Tensor tokens = pad_lines(lines, indices);
 
     CircularBufferQueueElementGuard<ov::InferRequest> infer_request_guard(this->m_ireq_queue_detokenizer.get());
     set_state_if_necessary(infer_request_guard, detokenization_params);
@@ -740,6 +871,30 @@ std::vector<std::string> Tokenizer::TokenizerImpl::decode(const std::vector<std:
     return std::vector<std::string>(res_data, res_data + res.get_shape()[0]);
 }
 
+std::vector<std::string> Tokenizer::TokenizerImpl::decode_sharded(const std::vector<ov::Tensor>& shard_tokens,
+                                                                  const std::vector<std::vector<size_t>>& shard_indices,
+                                                                  const ov::AnyMap& detokenization_params) {
+    size_t batch_size = 0;
+    for (const auto& indices : shard_indices) {
+        batch_size += indices.size();
+    }
+
+    std::vector<std::string> texts(batch_size);
+    run_sharded(m_ireq_queue_detokenizer.get(), shard_indices.size(), [&](size_t shard, CircularBufferQueueElementGuard<ov::InferRequest>& infer_request_guard) {
+        set_state_if_necessary(infer_request_guard, detokenization_params);
+        infer_request_guard.get().set_input_tensor(shard_tokens[shard]);
+        infer_request_guard.get().infer();
+
+        auto res = infer_request_guard.get().get_output_tensor();
+        auto res_data = res.data<std::string>();
+        OPENVINO_ASSERT(res.get_shape()[0] == shard_indices[shard].size(), "Unexpected number of detokenized strings");
+        for (size_t row = 0; row < shard_indices[shard].size(); ++row) {
+            texts[shard_indices[shard][row]] = std::move(res_data[row]);
+        }
+    });
+    return texts;
+}
+
 std::string Tokenizer::TokenizerImpl::apply_chat_template(
     const ChatHistory& history,
     bool add_generation_prompt,
@@ -761,8 +916,9 @@ std::string Tokenizer::TokenizerImpl::apply_chat_template(
     OPENVINO_ASSERT(resolved_extra_context.is_object(),
                     "Extra context should be an object-like JsonContainer, got: ", resolved_extra_context.type_name());
 
-    minja::chat_template minja_template(chat_tpl, m_bos_token, m_eos_token);
-    
+    // parsing is cached, since it's done on every chat turn and every chat request
+    std::shared_ptr<const minja::chat_template> minja_template = ChatTemplateCache::instance().get(chat_tpl, m_bos_token, m_eos_token);
+
     minja::chat_template_inputs minja_inputs;
     minja_inputs.messages = history.get_messages();
     if (!resolved_tools.empty()) {
@@ -779,7 +935,7 @@ std::string Tokenizer::TokenizerImpl::apply_chat_template(
     
     std::string result;
     try {
-        result = minja_template.apply(minja_inputs);
+        result = minja_template->apply(minja_inputs);
     } catch (const std::exception& error) {
         OPENVINO_THROW("Minja failed to apply chat template. Possible solutions are\n"
                         "* Provide a simplified chat template with set_chat_template().\n"
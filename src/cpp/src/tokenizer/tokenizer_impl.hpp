@@ -35,6 +35,8 @@ public:
     std::shared_ptr<void> m_shared_object_ov_tokenizers = nullptr;
     bool is_paired_input = false;
     bool m_older_than_24_5 = false;
+    // padding side of RaggedToDense, applied if encode is called without padding_side
+    std::optional<bool> m_pad_right;
     int64_t m_pad_token_id = -1;
     int64_t m_bos_token_id = -1;
     int64_t m_eos_token_id = -1;
@@ -67,12 +69,24 @@ public:
     TokenizedInputs encode(const std::vector<std::string>& prompts_1, const std::vector<std::string>& prompts_2, const ov::AnyMap& tokenization_params = {});
     TokenizedInputs encode(const std::vector<std::string>& prompts, const ov::AnyMap& tokenization_params = {});
 
+    // Encodes batch split into shards of similar length in parallel, one infer request per shard.
+    // Returns std::nullopt if shards can't be merged back, so batch has to be encoded at once
+    std::optional<TokenizedInputs> encode_sharded(const std::vector<std::string>& prompts, const ov::AnyMap& tokenization_params, size_t max_num_shards);
+
     TokenizedInputs get_copied_results(ov::Tensor input_ids, ov::Tensor attention_mask);
 
     std::string decode(const std::vector<int64_t>& tokens, const ov::AnyMap& detokenization_params = {});
     std::vector<std::string> decode(const ov::Tensor& tokens, const ov::AnyMap& detokenization_params = {});
     std::vector<std::string> decode(const std::vector<std::vector<int64_t>>& lines, const ov::AnyMap& detokenization_params = {});
 
+    // Decodes [shard_size, seq_len] tokens of every shard in parallel and places texts at 'shard_indices' positions
+    std::vector<std::string> decode_sharded(const std::vector<ov::Tensor>& shard_tokens,
+                                            const std::vector<std::vector<size_t>>& shard_indices,
+                                            const ov::AnyMap& detokenization_params);
+
+    // Packs lines with given indices into [indices.size(), max_len] tensor padded with pad token
+    ov::Tensor pad_lines(const std::vector<std::vector<int64_t>>& lines, const std::vector<size_t>& indices);
+
     std::string apply_chat_template(const ChatHistory& history,
                                     bool add_generation_prompt,
                                     const std::string& chat_template,
@@ -9,6 +9,12 @@ namespace ov::genai::utils {
 void validate_generation_config(const VideoGenerationConfig& config) {
     OPENVINO_ASSERT(config.guidance_scale > 1.0f || config.negative_prompt == std::nullopt,
                     "Guidance scale <= 1.0 ignores negative prompt");
+    OPENVINO_ASSERT(config.vae_tile_size == 0 || config.vae_tile_size > config.vae_tile_overlap,
+                    "'vae_tile_size' must be greater than 'vae_tile_overlap', got ", config.vae_tile_size, " and ", config.vae_tile_overlap);
+    OPENVINO_ASSERT(config.vae_tile_num_frames == 0 ||
+                    (config.vae_tile_frames_overlap >= 1 && config.vae_tile_num_frames > config.vae_tile_frames_overlap),
+                    "'vae_tile_num_frames' must be greater than 'vae_tile_frames_overlap', which must be at least 1, got ",
+                    config.vae_tile_num_frames, " and ", config.vae_tile_frames_overlap);
 }
 
 void update_generation_config(VideoGenerationConfig& config, const ov::AnyMap& properties) {
@@ -28,6 +34,10 @@ void update_generation_config(VideoGenerationConfig& config, const ov::AnyMap& p
     read_anymap_param(properties, "width", config.width);
     read_anymap_param(properties, "num_inference_steps", config.num_inference_steps);
     read_anymap_param(properties, "max_sequence_length", config.max_sequence_length);
+    read_anymap_param(properties, "vae_tile_size", config.vae_tile_size);
+    read_anymap_param(properties, "vae_tile_overlap", config.vae_tile_overlap);
+    read_anymap_param(properties, "vae_tile_num_frames", config.vae_tile_num_frames);
+    read_anymap_param(properties, "vae_tile_frames_overlap", config.vae_tile_frames_overlap);
 
     // 'generator' has higher priority than 'seed' parameter
     const bool have_generator_param =
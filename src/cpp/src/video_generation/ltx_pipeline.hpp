@@ -75,7 +75,7 @@ std::shared_ptr<IScheduler> cast_scheduler(std::shared_ptr<Scheduler>&& schedule
     return casted;
 }
 
-void check_inputs(const VideoGenerationConfig& generation_config, size_t vae_scale_factor) {
+void check_inputs(const VideoGenerationConfig& generation_config, size_t vae_scale_factor, size_t spatial_compression_ratio) {
     utils::validate_generation_config(generation_config);
     OPENVINO_ASSERT(generation_config.height > 0, "Height must be positive");
     OPENVINO_ASSERT(generation_config.height % 32 == 0,
@@ -92,6 +92,11 @@ void check_inputs(const VideoGenerationConfig& generation_config, size_t vae_sca
                         (generation_config.width % vae_scale_factor == 0 || generation_config.width < 0),
                     "Both 'width' and 'height' must be divisible by ",
                     vae_scale_factor);
+    // tiling options are used only by VAE decoder, but checked here not to waste the whole denoising loop
+    OPENVINO_ASSERT(generation_config.vae_tile_size % spatial_compression_ratio == 0 &&
+                        generation_config.vae_tile_overlap % spatial_compression_ratio == 0,
+                    "Both 'vae_tile_size' and 'vae_tile_overlap' must be divisible by ",
+                    spatial_compression_ratio);
 }
 
 // Unpacked latents of shape [B, C, F, H, W] are patched into tokens of shape [B, C, F // p_t, p_t, H // p, p, W // p,
@@ -280,6 +285,17 @@ class Text2VideoPipeline::LTXPipeline {
         return pack_latents(latents, transformer_spatial_patch_size, transformer_temporal_patch_size);
     }
 
+    ov::Tensor vae_decode(const ov::Tensor& latent, const VideoGenerationConfig& generation_config) {
+        if (generation_config.vae_tile_size > 0 || generation_config.vae_tile_num_frames > 0) {
+            return m_vae->decode_tiled(latent,
+                                       generation_config.vae_tile_size,
+                                       generation_config.vae_tile_overlap,
+                                       generation_config.vae_tile_num_frames,
+                                       generation_config.vae_tile_frames_overlap);
+        }
+        return m_vae->decode(latent);
+    }
+
     ov::Tensor postprocess_latents(const ov::Tensor& latent) {
         OPENVINO_ASSERT(m_latent_num_frames > 0 && m_latent_height > 0 && m_latent_width > 0,
                         "Latent sizes must be > 0 (got num_frames=",
@@ -499,7 +515,7 @@ public:
 
         const size_t vae_scale_factor = m_vae->get_vae_scale_factor();
         const auto& transformer_config = m_transformer->get_config();
-        check_inputs(merged_generation_config, vae_scale_factor);
+        check_inputs(merged_generation_config, vae_scale_factor, m_vae->get_spatial_compression_ratio());
 
         // use callback if defined
         std::shared_ptr<ThreadedCallbackWrapper> callback_ptr = nullptr;
@@ -565,7 +581,6 @@ public:
         ov::Tensor latent_cfg(ov::element::f32, latent_shape_cfg);
 
         // Denoising loop
-        ov::Tensor noisy_residual_tensor(ov::element::f32, {});
         for (size_t inference_step = 0; inference_step < timesteps.size(); ++inference_step) {
             auto step_start = std::chrono::steady_clock::now();
             // concat the same latent twice along a batch dimension in case of CFG
@@ -596,31 +611,14 @@ public:
             auto infer_duration = ov::genai::PerfMetrics::get_microsec(std::chrono::steady_clock::now() - infer_start);
             m_perf_metrics.raw_metrics.transformer_inference_durations.emplace_back(MicroSeconds(infer_duration));
 
-            ov::Shape noise_pred_shape = noise_pred_tensor.get_shape();
-            noise_pred_shape[0] /= batch_size_multiplier;
-
-            if (batch_size_multiplier > 1) {
-                noisy_residual_tensor.set_shape(noise_pred_shape);
-
-                // perform guidance
-                float* noisy_residual = noisy_residual_tensor.data<float>();
-                const float* noise_pred_uncond = noise_pred_tensor.data<const float>();
-                const float* noise_pred_text = noise_pred_uncond + noisy_residual_tensor.get_size();
-
-                for (size_t i = 0; i < noisy_residual_tensor.get_size(); ++i) {
-                    noisy_residual[i] = noise_pred_uncond[i] + merged_generation_config.guidance_scale *
-                                                                   (noise_pred_text[i] - noise_pred_uncond[i]);
-                }
-            } else {
-                noisy_residual_tensor = noise_pred_tensor;
-            }
-
             // TODO: support guidance_rescale
             OPENVINO_ASSERT(merged_generation_config.guidance_rescale <= 0,
                             "Parameter 'guidance_rescale' is not currently supported by LTX Pipeline. Please, contact OpenVINO GenAI developers.");
 
-            auto scheduler_step_result =
-                m_scheduler->step(noisy_residual_tensor, latent, inference_step, merged_generation_config.generator);
+            // perform guidance fused with scheduler step
+            auto scheduler_step_result = batch_size_multiplier > 1 ?
+                m_scheduler->guided_step(noise_pred_tensor, merged_generation_config.guidance_scale, latent, inference_step, merged_generation_config.generator) :
+                m_scheduler->step(noise_pred_tensor, latent, inference_step, merged_generation_config.generator);
             latent = scheduler_step_result["latent"];
 
             if (callback_ptr && callback_ptr->has_callback() && callback_ptr->write(inference_step, timesteps.size(), latent) == CallbackStatus::STOP) {
@@ -650,7 +648,7 @@ public:
                             "Parameter 'timestep_conditioning' is not currently supported by AutoencoderKLLTX. Please, contact OpenVINO GenAI developers.");
 
         const auto decode_start = std::chrono::steady_clock::now();
-        ov::Tensor video = m_vae->decode(latent);
+        ov::Tensor video = vae_decode(latent, merged_generation_config);
         m_perf_metrics.vae_decoder_inference_duration =
             std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - decode_start)
                 .count();
@@ -665,7 +663,7 @@ public:
         ov::Tensor postprocessed = postprocess_latents(latent);
 
         const auto decode_start = std::chrono::steady_clock::now();
-        ov::Tensor video = m_vae->decode(postprocessed);
+        ov::Tensor video = vae_decode(postprocessed, m_generation_config);
         m_perf_metrics.vae_decoder_inference_duration =
             std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - decode_start)
                 .count();
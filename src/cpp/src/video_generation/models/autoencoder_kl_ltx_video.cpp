@@ -17,6 +17,7 @@
 
 #include "utils.hpp"
 #include "json_utils.hpp"
+#include "image_generation/vae_tiling.hpp"
 #include "lora/helper.hpp"
 
 using namespace ov::genai;
@@ -144,16 +145,8 @@ AutoencoderKLLTXVideo& AutoencoderKLLTXVideo::reshape(int64_t batch_size,
     // TODO: for img2video
     // if (m_encoder_model) {...}
 
-    int64_t spatial_compression_ratio =
-        get_config().patch_size *
-        std::pow(
-            2,
-            std::accumulate(get_config().spatio_temporal_scaling.begin(), get_config().spatio_temporal_scaling.end(), 0));
-    int64_t temporal_compression_ratio =
-        get_config().patch_size_t *
-        std::pow(
-            2,
-            std::accumulate(get_config().spatio_temporal_scaling.begin(), get_config().spatio_temporal_scaling.end(), 0));
+    int64_t spatial_compression_ratio = get_spatial_compression_ratio();
+    int64_t temporal_compression_ratio = get_temporal_compression_ratio();
 
     num_frames = ((num_frames - 1) / temporal_compression_ratio + 1) / m_transformer_patch_size_t;
     height /= (spatial_compression_ratio * m_transformer_patch_size);
@@ -174,6 +167,41 @@ ov::Tensor AutoencoderKLLTXVideo::decode(const ov::Tensor& latent) {
     return m_decoder_request.get_output_tensor();
 }
 
+ov::Tensor AutoencoderKLLTXVideo::decode_tiled(const ov::Tensor& latent,
+                                                size_t tile_size,
+                                                size_t tile_overlap,
+                                                size_t tile_num_frames,
+                                                size_t tile_frames_overlap,
+                                                const std::function<void(size_t, const ov::Tensor&)>& callback) {
+    OPENVINO_ASSERT(m_decoder_request, "VAE decoder model must be compiled first. Cannot infer non-compiled model");
+
+    const size_t spatial_ratio = get_spatial_compression_ratio();
+    OPENVINO_ASSERT(tile_size % spatial_ratio == 0 && tile_overlap % spatial_ratio == 0,
+                    "Both tile size and tile overlap must be divisible by ", spatial_ratio);
+
+    auto decode_spatial = [&] (const ov::Tensor& latent_chunk) -> ov::Tensor {
+        if (tile_size == 0) {
+            return decode(latent_chunk);
+        }
+        return vae_tiling::spatial_tiled_decode(latent_chunk, spatial_ratio, tile_size / spatial_ratio, tile_overlap / spatial_ratio,
+            [this] (const ov::Tensor& latent_tile) {
+                return decode(latent_tile);
+            });
+    };
+
+    if (tile_num_frames == 0 || latent.get_shape()[2] <= tile_num_frames) {
+        ov::Tensor video = decode_spatial(latent);
+        if (callback) {
+            callback(0, video);
+            return ov::Tensor();
+        }
+        return video;
+    }
+
+    return vae_tiling::temporal_tiled_decode(latent, get_temporal_compression_ratio(), tile_num_frames, tile_frames_overlap,
+                                             decode_spatial, callback);
+}
+
 const AutoencoderKLLTXVideo::Config& AutoencoderKLLTXVideo::get_config() const {
     return m_config;
 }
@@ -182,6 +210,16 @@ size_t AutoencoderKLLTXVideo::get_vae_scale_factor() const {  // TODO: compare w
     return std::pow(2, m_config.block_out_channels.size() - 1);
 }
 
+size_t AutoencoderKLLTXVideo::get_spatial_compression_ratio() const {
+    const auto& scaling = m_config.spatio_temporal_scaling;
+    return m_config.patch_size * std::pow(2, std::accumulate(scaling.begin(), scaling.end(), 0));
+}
+
+size_t AutoencoderKLLTXVideo::get_temporal_compression_ratio() const {
+    const auto& scaling = m_config.spatio_temporal_scaling;
+    return m_config.patch_size_t * std::pow(2, std::accumulate(scaling.begin(), scaling.end(), 0));
+}
+
 void AutoencoderKLLTXVideo::merge_vae_video_post_processing() const {
     ov::preprocess::PrePostProcessor ppp(m_decoder_model);
 
@@ -121,6 +121,33 @@ std::vector<std::vector<size_t>> CDPruner::select_tokens(const ov::Tensor& visua
             visual_first_half = visual_features;
         }
 
+        bool use_on_demand_kernel = m_config.use_on_demand_kernel;
+#ifdef ENABLE_OPENCL_DPP
+        // OpenCL DPP consumes the dense kernel matrix
+        use_on_demand_kernel = use_on_demand_kernel && !m_config.use_cl_kernel;
+#endif
+        if (use_on_demand_kernel) {
+            // Kernel rows are computed during DPP selection, only their factors are built here
+            auto dpp_start = std::chrono::high_resolution_clock::now();
+
+            ConditionalKernelFactors factors_first = m_kernel_builder.build_factors(visual_first_half, text_features);
+            if (use_splitting) {
+                ConditionalKernelFactors factors_second =
+                    m_kernel_builder.build_factors(visual_second_half, text_features);
+                selected_tokens =
+                    m_dpp_selector.select(factors_first, factors_second, num_tokens_to_keep, split_point);
+            } else {
+                selected_tokens = m_dpp_selector.select(factors_first, num_tokens_to_keep);
+            }
+
+            auto dpp_end = std::chrono::high_resolution_clock::now();
+            auto dpp_duration = std::chrono::duration_cast<std::chrono::milliseconds>(dpp_end - dpp_start).count();
+            if (!silent) {
+                GENAI_DEBUG("DPP selection with on demand kernel time: %ld ms", dpp_duration);
+            }
+            return selected_tokens;
+        }
+
         ov::Tensor kernel_matrix_first;
         ov::Tensor kernel_matrix_second;
 
@@ -31,13 +31,19 @@ void Config::update_from_env() {
         std::string val(env);
         enable_frame_chunking = (val == "1" || val == "true" || val == "TRUE");
     }
+
+    // CDPRUNER_ON_DEMAND_KERNEL
+    if (const char* env = std::getenv("CDPRUNER_ON_DEMAND_KERNEL")) {
+        std::string val(env);
+        use_on_demand_kernel = (val == "1" || val == "true" || val == "TRUE");
+    }
 }
 
 bool Config::operator==(const Config& other) const {
     return pruning_ratio == other.pruning_ratio && std::abs(relevance_weight - other.relevance_weight) < 1e-6f &&
            device == other.device && std::abs(numerical_threshold - other.numerical_threshold) < 1e-9f &&
            use_negative_relevance == other.use_negative_relevance && split_threshold == other.split_threshold &&
-           enable_frame_chunking == other.enable_frame_chunking;
+           enable_frame_chunking == other.enable_frame_chunking && use_on_demand_kernel == other.use_on_demand_kernel;
 }
 
 bool Config::operator!=(const Config& other) const {
@@ -25,6 +25,7 @@ struct Config {
      *   - CDPRUNER_SPLIT_THRESHOLD: Threshold for splitting large kernel matrices (integer).
      *   - CDPRUNER_ENABLE_FRAME_CHUNKING: Enable frame-level chunking for multi-frame video processing (boolean, "0" or
      * "1").
+     *   - CDPRUNER_ON_DEMAND_KERNEL: Compute kernel rows on demand during CPU DPP selection (boolean, "0" or "1").
      *
      * If an environment variable is not set, the default value specified in the Config struct is used.
      */
@@ -56,6 +57,13 @@ struct Config {
     /// Default: true
     bool enable_frame_chunking = true;
 
+    /// @brief Compute conditional kernel rows on demand during CPU DPP selection
+    /// If true, only rows of selected tokens are computed from normalized features and relevance scores
+    /// instead of building the dense [B, N, N] kernel with the OpenVINO ops model. This trades
+    /// O(N²) kernel memory for O(T·N·D) CPU work, which pays off for high pruning ratios and long sequences.
+    /// Not applied when OpenCL DPP is used since it consumes the dense kernel.
+    bool use_on_demand_kernel = false;
+
     /// @brief Compare two Config structures for equality
     /// @param other The other Config to compare with
     /// @return true if all configuration parameters are equal, false otherwise
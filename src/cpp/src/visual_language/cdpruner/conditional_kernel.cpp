@@ -6,16 +6,28 @@
 #include <algorithm>
 #include <cmath>
 #include <stdexcept>
+#include <vector>
 
 #include "logger.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/op/ops.hpp"
 #include "openvino/op/parameter.hpp"
 #include "openvino/op/result.hpp"
 #include "openvino/openvino.hpp"
 #include "utils.hpp"
+#include "vector_ops.hpp"
 
 namespace ov::genai::cdpruner {
 
+namespace {
+
+// Tile of the similarity matrix computed by a task: 64 rows and columns of 256 features each take 128 KB,
+// so both operand tiles stay in L2 cache while the output tile is accumulated
+constexpr size_t TOKENS_PER_BLOCK = 64;
+constexpr size_t FEATURES_PER_BLOCK = 256;
+
+}  // namespace
+
 ConditionalKernelBuilder::ConditionalKernelBuilder(const Config& config)
     : m_config(config),
       m_requests_initialized(false) {
@@ -108,6 +120,61 @@ ov::Tensor ConditionalKernelBuilder::build_with_normal_pipeline(const ov::Tensor
     return conditional_kernel;
 }
 
+ConditionalKernelFactors ConditionalKernelBuilder::build_factors(const ov::Tensor& visual_features,
+                                                                const ov::Tensor& text_features) {
+    OPENVINO_ASSERT(visual_features.get_shape().size() == 3, "Visual features must be 3D tensor [B, N, D]");
+    OPENVINO_ASSERT(text_features.get_shape().size() == 2, "Text features must be 2D tensor [M, D]");
+
+    auto visual_shape = visual_features.get_shape();
+    auto text_shape = text_features.get_shape();
+    size_t batch_size = visual_shape[0];
+    size_t num_tokens = visual_shape[1];
+    size_t feature_dim = visual_shape[2];
+    size_t num_text_tokens = text_shape[0];
+
+    OPENVINO_ASSERT(text_shape[1] == feature_dim, "Visual and text features must have same feature dimension");
+    OPENVINO_ASSERT(num_text_tokens > 0, "Text features must not be empty");
+
+    ConditionalKernelFactors factors;
+    factors.relevance_weight = m_config.relevance_weight;
+    factors.normalized_features = l2_normalize_features(visual_features);
+
+    // Mean cosine similarity over text tokens equals the dot product with the mean of normalized text features,
+    // which replaces the [B, N, M] similarity matrix of the OV model with a single [D] vector
+    std::vector<float> mean_text_features(feature_dim, 0.0f);
+    const float* text_data = text_features.data<const float>();
+    for (size_t m = 0; m < num_text_tokens; ++m) {
+        const float* text_row = text_data + m * feature_dim;
+        float norm = std::sqrt(simd_dot_product(text_row, text_row, feature_dim) + m_config.numerical_threshold);
+        for (size_t k = 0; k < feature_dim; ++k) {
+            mean_text_features[k] += text_row[k] / norm;
+        }
+    }
+    simd_vector_mul_scalar(mean_text_features.data(), 1.0f / static_cast<float>(num_text_tokens), feature_dim);
+
+    factors.relevance_scores = ov::Tensor(ov::element::f32, {batch_size, num_tokens});
+    float* relevance_data = factors.relevance_scores.data<float>();
+    const float* normalized_data = factors.normalized_features.data<const float>();
+    ov::parallel_for(batch_size * num_tokens, [&](size_t token) {
+        float relevance =
+            simd_dot_product(normalized_data + token * feature_dim, mean_text_features.data(), feature_dim);
+        relevance_data[token] = m_config.use_negative_relevance ? -relevance : relevance;
+    });
+
+    // Min-max normalization: (r - min) / (max - min + eps)
+    for (size_t b = 0; b < batch_size; ++b) {
+        float* batch_relevance = relevance_data + b * num_tokens;
+        auto [min_it, max_it] = std::minmax_element(batch_relevance, batch_relevance + num_tokens);
+        float min_val = *min_it;
+        float range = *max_it - min_val + m_config.numerical_threshold;
+        for (size_t i = 0; i < num_tokens; ++i) {
+            batch_relevance[i] = (batch_relevance[i] - min_val) / range;
+        }
+    }
+
+    return factors;
+}
+
 // GPU-accelerated similarity matrix computation using OpenVINO
 ov::Tensor ConditionalKernelBuilder::compute_similarity_matrix_with_model(const ov::Tensor& features) {
     // features: [B, N, D] - normalized visual features
@@ -152,24 +219,30 @@ ov::Tensor ConditionalKernelBuilder::compute_similarity_matrix(const ov::Tensor&
     const float* features_data = features.data<const float>();
     float* similarity_data = similarity_matrix.data<float>();
 
-    // Compute similarity matrix for each batch
-    for (size_t b = 0; b < batch_size; ++b) {
-        for (size_t i = 0; i < num_tokens; ++i) {
-            for (size_t j = 0; j < num_tokens; ++j) {
-                float dot_product = 0.0f;
-
-                // Compute dot product between token i and token j in batch b
-                for (size_t k = 0; k < feature_dim; ++k) {
-                    size_t idx_i = b * num_tokens * feature_dim + i * feature_dim + k;
-                    size_t idx_j = b * num_tokens * feature_dim + j * feature_dim + k;
-                    dot_product += features_data[idx_i] * features_data[idx_j];
+    // Compute similarity matrix tile by tile, every task owns a block of rows of one batch
+    const size_t num_row_blocks = (num_tokens + TOKENS_PER_BLOCK - 1) / TOKENS_PER_BLOCK;
+    ov::parallel_for(batch_size * num_row_blocks, [&](size_t task) {
+        size_t b = task / num_row_blocks;
+        size_t row_begin = (task % num_row_blocks) * TOKENS_PER_BLOCK;
+        size_t row_end = std::min(row_begin + TOKENS_PER_BLOCK, num_tokens);
+        const float* batch_features = features_data + b * num_tokens * feature_dim;
+        float* batch_similarity = similarity_data + b * num_tokens * num_tokens;
+
+        std::fill(batch_similarity + row_begin * num_tokens, batch_similarity + row_end * num_tokens, 0.0f);
+        for (size_t col_begin = 0; col_begin < num_tokens; col_begin += TOKENS_PER_BLOCK) {
+            size_t col_end = std::min(col_begin + TOKENS_PER_BLOCK, num_tokens);
+            for (size_t k = 0; k < feature_dim; k += FEATURES_PER_BLOCK) {
+                size_t length = std::min(FEATURES_PER_BLOCK, feature_dim - k);
+                for (size_t i = row_begin; i < row_end; ++i) {
+                    const float* features_i = batch_features + i * feature_dim + k;
+                    float* similarity_row = batch_similarity + i * num_tokens;
+                    for (size_t j = col_begin; j < col_end; ++j) {
+                        similarity_row[j] += simd_dot_product(features_i, batch_features + j * feature_dim + k, length);
+                    }
                 }
-
-                size_t sim_idx = b * num_tokens * num_tokens + i * num_tokens + j;
-                similarity_data[sim_idx] = dot_product;
             }
         }
-    }
+    });
 
     return similarity_matrix;
 }
@@ -257,23 +330,22 @@ ov::Tensor ConditionalKernelBuilder::l2_normalize_features(const ov::Tensor& fea
     const float* input_data = features.data<const float>();
     float* output_data = normalized_features.data<float>();
 
-    for (size_t b = 0; b < batch_size; ++b) {
-        for (size_t i = 0; i < num_tokens; ++i) {
-            // Compute L2 norm for token (b, i)
-            float norm = 0.0f;
-            for (size_t j = 0; j < feature_dim; ++j) {
-                size_t idx = b * num_tokens * feature_dim + i * feature_dim + j;
-                norm += input_data[idx] * input_data[idx];
-            }
-            norm = std::sqrt(norm + m_config.numerical_threshold);  // Add epsilon for stability
+    ov::parallel_for(batch_size * num_tokens, [&](size_t token) {
+        const float* input_row = input_data + token * feature_dim;
+        float* output_row = output_data + token * feature_dim;
 
-            // Normalize token (b, i)
-            for (size_t j = 0; j < feature_dim; ++j) {
-                size_t idx = b * num_tokens * feature_dim + i * feature_dim + j;
-                output_data[idx] = input_data[idx] / norm;
-            }
+        // Compute L2 norm for the token
+        float norm = 0.0f;
+        for (size_t j = 0; j < feature_dim; ++j) {
+            norm += input_row[j] * input_row[j];
         }
-    }
+        norm = std::sqrt(norm + m_config.numerical_threshold);  // Add epsilon for stability
+
+        // Normalize the token
+        for (size_t j = 0; j < feature_dim; ++j) {
+            output_row[j] = input_row[j] / norm;
+        }
+    });
 
     return normalized_features;
 }
@@ -312,33 +384,32 @@ ov::Tensor ConditionalKernelBuilder::compute_conditional_kernel_normal(const ov:
         alpha = w / (2.0f * (1.0f - w));
     }
 
-    for (size_t b = 0; b < batch_size; ++b) {
-        for (size_t i = 0; i < num_tokens; ++i) {
-            for (size_t j = 0; j < num_tokens; ++j) {
-                size_t sim_idx = b * num_tokens * num_tokens + i * num_tokens + j;
-                size_t rel_i_idx = b * num_tokens + i;
-                size_t rel_j_idx = b * num_tokens + j;
-
-                float base_similarity = sim_data[sim_idx];
-
-                if (w == 0.0f) {
-                    // Pure similarity matrix (no relevance weighting)
-                    kernel_data[sim_idx] = base_similarity;
-                } else if (w == 1.0f) {
-                    // Pure CDPruner conditional weighting (no exponential transform)
-                    // Direct multiplication: relevance[i] × similarity[i,j] × relevance[j]
-                    float conditional_weight = rel_data[rel_i_idx] * base_similarity * rel_data[rel_j_idx];
-                    kernel_data[sim_idx] = conditional_weight;
-                } else {
-                    // CDPruner with exponential relevance transformation (0 < w < 1)
-                    float weighted_rel_i = std::exp(alpha * rel_data[rel_i_idx]);
-                    float weighted_rel_j = std::exp(alpha * rel_data[rel_j_idx]);
-                    kernel_data[sim_idx] = weighted_rel_i * base_similarity * weighted_rel_j;
-                }
-            }
+    // Per token weights are computed once instead of for every kernel element:
+    // w == 0 - pure similarity matrix (no relevance weighting),
+    // w == 1 - direct multiplication relevance[i] × similarity[i,j] × relevance[j],
+    // 0 < w < 1 - exponential relevance transformation
+    std::vector<float> weighted_relevance(batch_size * num_tokens);
+    for (size_t idx = 0; idx < weighted_relevance.size(); ++idx) {
+        if (w == 0.0f) {
+            weighted_relevance[idx] = 1.0f;
+        } else if (w == 1.0f) {
+            weighted_relevance[idx] = rel_data[idx];
+        } else {
+            weighted_relevance[idx] = std::exp(alpha * rel_data[idx]);
         }
     }
 
+    ov::parallel_for(batch_size * num_tokens, [&](size_t row) {
+        size_t b = row / num_tokens;
+        const float* batch_weights = weighted_relevance.data() + b * num_tokens;
+        const float* sim_row = sim_data + row * num_tokens;
+        float* kernel_row = kernel_data + row * num_tokens;
+        float weight_i = weighted_relevance[row];
+        for (size_t j = 0; j < num_tokens; ++j) {
+            kernel_row[j] = weight_i * sim_row[j] * batch_weights[j];
+        }
+    });
+
     return conditional_kernel;
 }
 
@@ -12,6 +12,21 @@
 
 namespace ov::genai::cdpruner {
 
+/**
+ * @brief Factors of the conditional kernel L̃ = (1 - w) · L + w · diag(r) · L · diag(r), where L = V · Vᵀ
+ *
+ * Kernel rows are computed from these factors on demand, so the dense [B, N, N] matrix
+ * is never materialized: L̃[i, j] = ((1 - w) + w · r[i] · r[j]) · (V[i] · V[j]).
+ */
+struct ConditionalKernelFactors {
+    /// @brief L2 normalized visual features V [B, N, D]
+    ov::Tensor normalized_features;
+    /// @brief Min-max normalized relevance scores r [B, N]
+    ov::Tensor relevance_scores;
+    /// @brief Relevance weight w
+    float relevance_weight = 0.5f;
+};
+
 /**
  * @brief Builder for conditional kernel matrices used in DPP-based token selection
  *
@@ -42,6 +57,12 @@ public:
     ov::Tensor compute_conditional_kernel_with_model(const ov::Tensor& visual_features,
                                                      const ov::Tensor& text_features);
 
+    /// @brief Compute factors of the conditional kernel on CPU, following the OpenVINO ops model
+    /// @param visual_features Visual feature embeddings [B, N, D]
+    /// @param text_features Text feature embeddings [M, D]
+    /// @return Normalized features and relevance scores the kernel rows are computed from
+    ConditionalKernelFactors build_factors(const ov::Tensor& visual_features, const ov::Tensor& text_features);
+
 private:
     /// @brief Build conditional kernel using OpenVINO ops model
     /// @param visual_features Visual feature embeddings [B, N, D]
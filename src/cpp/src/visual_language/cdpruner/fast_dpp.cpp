@@ -17,91 +17,23 @@
 
 #include "logger.hpp"
 #include "openvino/openvino.hpp"
+#include "openvino/core/parallel.hpp"
 #include "utils.hpp"
+#include "vector_ops.hpp"
 
 #ifdef ENABLE_OPENCL_DPP
 #    include "fast_dpp_cl.hpp"
 #endif
 
-// SIMD headers
-#if defined(OPENVINO_ARCH_X86_64)
-#    ifdef _MSC_VER
-#        include <intrin.h>
-#    else
-#        include <x86intrin.h>
-#    endif
-#endif
-
 namespace ov::genai::cdpruner {
 
-/**
- * Performs element-wise subtraction of a scaled input vector from an output vector:
- *     out[i] -= scalar * in[i]   for i in [0, size)
- *
- * Parameters:
- *   - out: Pointer to the output array of floats. Must have at least 'size' elements.
- *   - in: Pointer to the input array of floats. Must have at least 'size' elements.
- *   - scalar: Scalar multiplier applied to each element of 'in'.
- *   - size: Number of elements to process.
- */
-inline void simd_vector_sub_scalar_mul(float* out, const float* in, float scalar, size_t size) {
-    size_t i = 0;
-
-#ifdef __AVX__
-    // AVX: Process 8 floats at a time
-    const __m256 scalar_vec = _mm256_set1_ps(scalar);
-    for (; i + 8 <= size; i += 8) {
-        __m256 out_vec = _mm256_loadu_ps(&out[i]);
-        __m256 in_vec = _mm256_loadu_ps(&in[i]);
-        __m256 mul_result = _mm256_mul_ps(scalar_vec, in_vec);
-        __m256 result = _mm256_sub_ps(out_vec, mul_result);
-        _mm256_storeu_ps(&out[i], result);
-    }
-#elif defined(__SSE2__)
-    // SSE2: Process 4 floats at a time
-    const __m128 scalar_vec = _mm_set1_ps(scalar);
-    for (; i + 4 <= size; i += 4) {
-        __m128 out_vec = _mm_loadu_ps(&out[i]);
-        __m128 in_vec = _mm_loadu_ps(&in[i]);
-        __m128 mul_result = _mm_mul_ps(scalar_vec, in_vec);
-        __m128 result = _mm_sub_ps(out_vec, mul_result);
-        _mm_storeu_ps(&out[i], result);
-    }
-#endif
-
-    // Process remaining elements with scalar code
-    for (; i < size; ++i) {
-        out[i] -= scalar * in[i];
-    }
-}
-
-// SIMD optimized vector multiplication by scalar: out[i] *= scalar
-inline void simd_vector_mul_scalar(float* out, float scalar, size_t size) {
-    size_t i = 0;
+namespace {
 
-#ifdef __AVX__
-    // AVX: Process 8 floats at a time
-    const __m256 scalar_vec = _mm256_set1_ps(scalar);
-    for (; i + 8 <= size; i += 8) {
-        __m256 out_vec = _mm256_loadu_ps(&out[i]);
-        __m256 result = _mm256_mul_ps(out_vec, scalar_vec);
-        _mm256_storeu_ps(&out[i], result);
-    }
-#elif defined(__SSE2__)
-    // SSE2: Process 4 floats at a time
-    const __m128 scalar_vec = _mm_set1_ps(scalar);
-    for (; i + 4 <= size; i += 4) {
-        __m128 out_vec = _mm_loadu_ps(&out[i]);
-        __m128 result = _mm_mul_ps(out_vec, scalar_vec);
-        _mm_storeu_ps(&out[i], result);
-    }
-#endif
+// Columns of a block processed by a task: 1 KB of every orthogonal vector, so the block of the
+// vector being computed stays in L1 cache while all previous vectors are subtracted from it
+constexpr size_t COLUMNS_PER_BLOCK = 256;
 
-    // Process remaining elements with scalar code
-    for (; i < size; ++i) {
-        out[i] *= scalar;
-    }
-}
+}  // namespace
 
 FastGreedyDPP::FastGreedyDPP(const Config& config) : m_config(config) {
     // Load config from env
@@ -199,6 +131,13 @@ std::vector<std::vector<size_t>> FastGreedyDPP::select_parallel(const ov::Tensor
     auto selected_first_batches = dpp_first_future.get();
     auto selected_second_batches = dpp_second_future.get();
 
+    return merge_split_selection(selected_first_batches, selected_second_batches, split_point);
+}
+
+std::vector<std::vector<size_t>> FastGreedyDPP::merge_split_selection(
+    const std::vector<std::vector<size_t>>& selected_first_batches,
+    const std::vector<std::vector<size_t>>& selected_second_batches,
+    size_t split_point) {
     // Process all batches, not just the first one
     std::vector<std::vector<size_t>> batch_results;
 
@@ -402,50 +341,167 @@ std::vector<size_t> FastGreedyDPP::select_single_batch(const ov::Tensor& kernel,
     auto shape = kernel.get_shape();
     size_t total_tokens = shape[1];
 
-    // Get kernel data pointer once for reuse
-    const float* kernel_data = kernel.data<const float>();
+    // Get batch-specific kernel data pointer
+    const float* batch_kernel_data = kernel.data<const float>() + batch_idx * total_tokens * total_tokens;
 
-    // Initialize working tensors for this batch
-    // cis: Orthogonalized vectors [T, N] where T is the number of selected tokens
-    ov::Tensor cis(ov::element::f32, {num_tokens, total_tokens});
+    // Copy diagonal elements from kernel for this batch
+    std::vector<float> di2s(total_tokens);
+    for (size_t i = 0; i < total_tokens; ++i) {
+        di2s[i] = batch_kernel_data[i * total_tokens + i];
+    }
 
-    // di2s: Diagonal elements (marginal gains) [N]
-    ov::Tensor di2s(ov::element::f32, {total_tokens});
+    return greedy_select(total_tokens, num_tokens, std::move(di2s), [&](size_t row, size_t begin, size_t end, float* out) {
+        std::memcpy(out + begin, batch_kernel_data + row * total_tokens + begin, (end - begin) * sizeof(float));
+    });
+}
 
-    // Copy diagonal elements from kernel for this batch
-    float* di2s_data = di2s.data<float>();
+std::vector<std::vector<size_t>> FastGreedyDPP::select(const ConditionalKernelFactors& factors, size_t num_tokens) {
+    const auto& shape = factors.normalized_features.get_shape();
+    OPENVINO_ASSERT(shape.size() == 3, "Normalized features must be 3D tensor [B, N, D]");
+    size_t batch_size = shape[0];
+    size_t total_tokens = shape[1];
+    size_t feature_dim = shape[2];
+    OPENVINO_ASSERT(factors.relevance_scores.get_shape() == ov::Shape({batch_size, total_tokens}),
+                    "Relevance scores must be 2D tensor [B, N]");
+    OPENVINO_ASSERT(num_tokens <= total_tokens,
+                    "Cannot select more tokens [",
+                    num_tokens,
+                    "] than available [",
+                    total_tokens,
+                    "]");
 
-    for (size_t i = 0; i < total_tokens; ++i) {
-        size_t diag_idx = batch_idx * total_tokens * total_tokens + i * total_tokens + i;
-        di2s_data[i] = kernel_data[diag_idx];
+    GENAI_DEBUG("[CDPruner] Using DPP native CPU implementation with on demand kernel rows for selection");
+
+    // L̃[i, j] = (1 - w) · S[i, j] + w · r[i] · S[i, j] · r[j], same as the dense OV kernel model
+    const float weight = factors.relevance_weight;
+    const float one_minus_weight = 1.0f - weight;
+
+    std::vector<std::vector<size_t>> batch_results(batch_size);
+    for (size_t b = 0; b < batch_size; ++b) {
+        const float* features = factors.normalized_features.data<const float>() + b * total_tokens * feature_dim;
+        const float* relevance = factors.relevance_scores.data<const float>() + b * total_tokens;
+        auto kernel_entry = [&](size_t i, size_t j) {
+            float similarity = simd_dot_product(features + i * feature_dim, features + j * feature_dim, feature_dim);
+            return similarity * one_minus_weight + relevance[i] * similarity * relevance[j] * weight;
+        };
+
+        std::vector<float> di2s(total_tokens);
+        ov::parallel_for(total_tokens, [&](size_t i) {
+            di2s[i] = kernel_entry(i, i);
+        });
+
+        batch_results[b] =
+            greedy_select(total_tokens, num_tokens, std::move(di2s), [&](size_t row, size_t begin, size_t end, float* out) {
+                for (size_t j = begin; j < end; ++j) {
+                    out[j] = kernel_entry(row, j);
+                }
+            });
     }
+    return batch_results;
+}
+
+std::vector<std::vector<size_t>> FastGreedyDPP::select(const ConditionalKernelFactors& factors_first,
+                                                       const ConditionalKernelFactors& factors_second,
+                                                       size_t num_tokens_to_keep,
+                                                       size_t split_point) {
+    size_t tokens_first_half = num_tokens_to_keep / 2;
+    size_t tokens_second_half = num_tokens_to_keep - tokens_first_half;
+
+    std::future<std::vector<std::vector<size_t>>> dpp_first_future = std::async(std::launch::async, [&]() {
+        return this->select(factors_first, tokens_first_half);
+    });
+    auto selected_second_batches = this->select(factors_second, tokens_second_half);
+    auto selected_first_batches = dpp_first_future.get();
+
+    return merge_split_selection(selected_first_batches, selected_second_batches, split_point);
+}
+
+std::vector<size_t> FastGreedyDPP::greedy_select(size_t total_tokens,
+                                                 size_t num_tokens,
+                                                 std::vector<float> di2s,
+                                                 const KernelRowFn& kernel_row) {
+    constexpr float NEG_INF = -std::numeric_limits<float>::infinity();
+    const size_t num_blocks = (total_tokens + COLUMNS_PER_BLOCK - 1) / COLUMNS_PER_BLOCK;
+
+    // cis: Orthogonalized vectors [T, N] where T is the number of selected tokens
+    std::vector<float> cis(num_tokens * total_tokens, 0.0f);
+    // Values of previous orthogonal vectors at the selected token, cis[:t, best_idx]
+    std::vector<float> cis_selected(num_tokens);
+    // Per block maximum of marginal gains and its index
+    std::vector<std::pair<float, size_t>> block_max(num_blocks);
+
+    // Find index with maximum value, first one on ties
+    auto argmax = [&](size_t begin, size_t end) {
+        std::pair<float, size_t> best{NEG_INF, begin};
+        for (size_t j = begin; j < end; ++j) {
+            if (di2s[j] > best.first) {
+                best = {di2s[j], j};
+            }
+        }
+        return best;
+    };
+    OPENVINO_ASSERT(total_tokens > 0 || num_tokens == 0, "Cannot find argmax of empty tensor");
+    size_t best_idx = argmax(0, total_tokens).second;
 
     std::vector<size_t> selected_indices;
     selected_indices.reserve(num_tokens);
 
-    float* cis_data = cis.data<float>();
-    std::memset(cis_data, 0, cis.get_byte_size());
-
     // Greedy selection loop - this is the core DPP algorithm
     for (size_t t = 0; t < num_tokens; ++t) {
-        // Find the token with maximum marginal gain
-        size_t best_idx = argmax(di2s);
-        selected_indices.push_back(best_idx);
+        const size_t selected_idx = best_idx;
+        selected_indices.push_back(selected_idx);
 
-        // Get batch-specific kernel data pointer and tensor data pointers
-        const float* batch_kernel_data = kernel_data + batch_idx * total_tokens * total_tokens;
-        float* cis_data = cis.data<float>();
+        // eis = (kernel[selected_idx] - sum(cis[:t] * cis[:t, selected_idx])) / sqrt(di2s[selected_idx])
+        const float inv_norm = 1.0f / std::sqrt(di2s[selected_idx] + m_config.numerical_threshold);
+        for (size_t prev_t = 0; prev_t < t; ++prev_t) {
+            cis_selected[prev_t] = cis[prev_t * total_tokens + selected_idx];
+        }
+        float* cis_out = cis.data() + t * total_tokens;
+
+        ov::parallel_for(num_blocks, [&](size_t block) {
+            const size_t begin = block * COLUMNS_PER_BLOCK;
+            const size_t end = std::min(begin + COLUMNS_PER_BLOCK, total_tokens);
+            const size_t length = end - begin;
+
+            // Compute the new orthogonalized vector e_i for the block of columns
+            kernel_row(selected_idx, begin, end, cis_out);
+            for (size_t prev_t = 0; prev_t < t; ++prev_t) {
+                float cis_sel = cis_selected[prev_t];
+                if (std::abs(cis_sel) < m_config.numerical_threshold)
+                    continue;
+                // SIMD optimized vector subtraction: cis_out[j] -= cis_sel * cis_prev_row[j]
+                simd_vector_sub_scalar_mul(cis_out + begin, cis.data() + prev_t * total_tokens + begin, cis_sel, length);
+            }
+            // SIMD optimized vector multiplication: cis_out[j] *= inv_norm
+            simd_vector_mul_scalar(cis_out + begin, inv_norm, length);
+
+            // Update marginal gains by subtracting the squared new orthogonal vector: di2s -= square(eis)
+            for (size_t j = begin; j < end; ++j) {
+                // Skip updating if this token is already selected (marked as negative infinity)
+                if (di2s[j] <= NEG_INF) {
+                    continue;
+                }
+                // Compute new marginal gain and handle NaN
+                float new_di2s = di2s[j] - cis_out[j] * cis_out[j];
+                di2s[j] = std::isnan(new_di2s) ? -std::numeric_limits<float>::max() : new_di2s;
+            }
 
-        // Compute the new orthogonalized vector e_i
-        // eis = (kernel[batch, best_idx] - sum(cis[:t] * cis[:t, best_idx])) / sqrt(di2s[best_idx])
-        update_orthogonal_vector(batch_kernel_data, total_tokens, best_idx, t, cis_data, di2s_data);
+            // Set the selected token's gain to negative infinity to prevent re-selection
+            if (selected_idx >= begin && selected_idx < end) {
+                di2s[selected_idx] = NEG_INF;
+            }
 
-        // Update marginal gains by subtracting the squared new orthogonal vector
-        // di2s -= square(eis)
-        update_marginal_gains(t, total_tokens, cis_data, di2s_data);
+            block_max[block] = argmax(begin, end);
+        });
 
-        // Set the selected token's gain to negative infinity to prevent re-selection
-        di2s_data[best_idx] = -std::numeric_limits<float>::infinity();
+        // Find the token with maximum marginal gain for the next iteration
+        std::pair<float, size_t> best{NEG_INF, 0};
+        for (const auto& candidate : block_max) {
+            if (candidate.first > best.first) {
+                best = candidate;
+            }
+        }
+        best_idx = best.second;
     }
 
     return selected_indices;
@@ -521,85 +577,4 @@ std::vector<size_t> FastGreedyDPP::select_single_batch_opencl(const ov::Tensor&
 }
 #endif
 
-size_t FastGreedyDPP::argmax(const ov::Tensor& scores) {
-    const float* data = scores.data<const float>();
-    size_t size = scores.get_size();
-
-    OPENVINO_ASSERT(size > 0, "Cannot find argmax of empty tensor");
-
-    size_t best_idx = 0;
-    float best_value = -std::numeric_limits<float>::infinity();
-
-    for (size_t i = 0; i < size; ++i) {
-        if (data[i] > best_value) {
-            best_value = data[i];
-            best_idx = i;
-        }
-    }
-
-    return best_idx;
-}
-
-void FastGreedyDPP::update_orthogonal_vector(const float* batch_kernel_data,
-                                             size_t total_tokens,
-                                             size_t selected_idx,
-                                             size_t iteration,
-                                             float* cis_data,
-                                             const float* di2s_data) {
-    // This implements the key DPP orthogonalization step:
-    // eis = (kernel[batch, selected_idx] - sum(cis[:iteration] * cis[:iteration, selected_idx])) /
-    // sqrt(di2s[selected_idx])
-
-    // Get the normalization factor
-    float norm_factor = std::sqrt(di2s_data[selected_idx] + m_config.numerical_threshold);
-    float inv_norm = 1.0f / norm_factor;
-
-    // Get kernel row for selected token (already offset to correct batch)
-    const float* kernel_row = batch_kernel_data + selected_idx * total_tokens;
-
-    // Get output position in cis matrix
-    float* cis_out = cis_data + iteration * total_tokens;
-
-    // Copy kernel row to cis output
-    std::memcpy(cis_out, kernel_row, total_tokens * sizeof(float));
-
-    // Subtract projections from all previous orthogonal vectors
-    for (size_t prev_t = 0; prev_t < iteration; ++prev_t) {
-        const float* cis_prev_row = cis_data + prev_t * total_tokens;
-        float cis_sel = cis_prev_row[selected_idx];
-
-        if (std::abs(cis_sel) < m_config.numerical_threshold)
-            continue;
-
-        // SIMD optimized vector subtraction: cis_out[j] -= cis_sel * cis_prev_row[j]
-        simd_vector_sub_scalar_mul(cis_out, cis_prev_row, cis_sel, total_tokens);
-    }
-
-    // SIMD optimized vector multiplication: cis_out[j] *= inv_norm
-    simd_vector_mul_scalar(cis_out, inv_norm, total_tokens);
-}
-
-void FastGreedyDPP::update_marginal_gains(size_t iteration,
-                                          size_t total_tokens,
-                                          const float* cis_data,
-                                          float* di2s_data) {
-    // This implements: di2s -= square(eis)
-    // where eis is the newly computed orthogonal vector cis[iteration, :]
-
-    // Update marginal gains for all tokens
-    for (size_t j = 0; j < total_tokens; ++j) {
-        // Skip updating if this token is already selected (marked as negative infinity)
-        if (di2s_data[j] <= -std::numeric_limits<float>::infinity()) {
-            continue;
-        }
-
-        size_t cis_idx = iteration * total_tokens + j;
-        float eis_j = cis_data[cis_idx];
-
-        // Compute new marginal gain and handle NaN
-        float new_di2s = di2s_data[j] - eis_j * eis_j;
-        di2s_data[j] = std::isnan(new_di2s) ? -std::numeric_limits<float>::max() : new_di2s;
-    }
-}
-
 }  // namespace ov::genai::cdpruner
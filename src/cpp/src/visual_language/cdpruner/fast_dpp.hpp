@@ -3,9 +3,11 @@
 
 #pragma once
 
+#include <functional>
 #include <vector>
 
 #include "cdpruner_config.hpp"
+#include "conditional_kernel.hpp"
 #include "openvino/openvino.hpp"
 
 #ifdef ENABLE_OPENCL_DPP
@@ -27,6 +29,9 @@ namespace ov::genai::cdpruner {
  * 2. Greedily select tokens with maximum marginal gain
  * 3. Update orthogonalized vectors using Gram-Schmidt process
  * 4. Update marginal gains by subtracting orthogonal projections
+ *
+ * Steps 2-4 of an iteration are fused and run in parallel over cache sized blocks of columns,
+ * so the block of the new orthogonal vector stays in cache while previous vectors are subtracted.
  */
 class FastGreedyDPP {
 public:
@@ -55,7 +60,59 @@ public:
                                             size_t num_tokens_to_keep,
                                             size_t split_point);
 
+    /**
+     * @brief Select diverse tokens computing kernel rows on demand from kernel factors
+     *
+     * Only rows of selected tokens are computed, which takes O(T·N·D) instead of O(N²·D)
+     * for the dense kernel and O(N·D) memory instead of O(N²). CPU only.
+     * @param factors Factors of the conditional kernel for [B, N] tokens
+     * @param num_tokens Number of tokens to select
+     * @return Selected token indices for each batch [B, T]
+     */
+    std::vector<std::vector<size_t>> select(const ConditionalKernelFactors& factors, size_t num_tokens);
+
+    /**
+     * @brief Perform parallel on demand DPP selection on two halves of tokens
+     * @param factors_first Kernel factors of the first half
+     * @param factors_second Kernel factors of the second half
+     * @param num_tokens_to_keep Total number of tokens to keep
+     * @param split_point Split point for adjusting second half indices
+     * @return Selected token indices for each batch [B, T]
+     */
+    std::vector<std::vector<size_t>> select(const ConditionalKernelFactors& factors_first,
+                                            const ConditionalKernelFactors& factors_second,
+                                            size_t num_tokens_to_keep,
+                                            size_t split_point);
+
 private:
+    /// @brief Writes kernel[row, begin:end) to out[begin:end)
+    using KernelRowFn = std::function<void(size_t row, size_t begin, size_t end, float* out)>;
+
+    /**
+     * @brief Greedy DPP selection over a kernel accessed by rows
+     * @param total_tokens Total number of tokens N
+     * @param num_tokens Number of tokens to select
+     * @param di2s Diagonal of the kernel (initial marginal gains) [N]
+     * @param kernel_row Provider of kernel rows, called concurrently for disjoint column blocks
+     * @return Selected token indices in order of selection
+     */
+    std::vector<size_t> greedy_select(size_t total_tokens,
+                                      size_t num_tokens,
+                                      std::vector<float> di2s,
+                                      const KernelRowFn& kernel_row);
+
+    /**
+     * @brief Merge selections of two halves into sorted absolute token indices
+     * @param selected_first_batches Selected indices of the first half [B, T1]
+     * @param selected_second_batches Selected indices of the second half [B, T2]
+     * @param split_point Split point for adjusting second half indices
+     * @return Merged selected token indices for each batch [B, T1 + T2]
+     */
+    static std::vector<std::vector<size_t>> merge_split_selection(
+        const std::vector<std::vector<size_t>>& selected_first_batches,
+        const std::vector<std::vector<size_t>>& selected_second_batches,
+        size_t split_point);
+
     /**
      * @brief Select tokens for a single batch
      * @param kernel Kernel matrix [B, N, N]
@@ -124,38 +181,6 @@ private:
                                                             size_t split_point);
 #endif
 
-    /**
-     * @brief Find index with maximum value
-     * @param scores Score tensor [N]
-     * @return Index of maximum value
-     */
-    size_t argmax(const ov::Tensor& scores);
-
-    /**
-     * @brief Update orthogonal vector using Gram-Schmidt process
-     * @param batch_kernel_data Pre-computed kernel data pointer for specific batch
-     * @param total_tokens Total number of tokens
-     * @param selected_idx Newly selected token index
-     * @param iteration Current iteration (number of previously selected tokens)
-     * @param cis_data Orthogonalized vectors data pointer [T, N]
-     * @param di2s_data Current diagonal scores data pointer [N]
-     */
-    void update_orthogonal_vector(const float* batch_kernel_data,
-                                  size_t total_tokens,
-                                  size_t selected_idx,
-                                  size_t iteration,
-                                  float* cis_data,
-                                  const float* di2s_data);
-
-    /**
-     * @brief Update marginal gains after selecting a token
-     * @param iteration Current iteration
-     * @param total_tokens Total number of tokens
-     * @param cis_data Orthogonalized vectors data pointer [T, N]
-     * @param di2s_data Diagonal scores data pointer to update [N]
-     */
-    void update_marginal_gains(size_t iteration, size_t total_tokens, const float* cis_data, float* di2s_data);
-
     Config m_config;
 
 #ifdef ENABLE_OPENCL_DPP
@@ -0,0 +1,121 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+
+// SIMD headers
+#if defined(OPENVINO_ARCH_X86_64)
+#    ifdef _MSC_VER
+#        include <intrin.h>
+#    else
+#        include <x86intrin.h>
+#    endif
+#endif
+
+namespace ov::genai::cdpruner {
+
+/**
+ * Performs element-wise subtraction of a scaled input vector from an output vector:
+ *     out[i] -= scalar * in[i]   for i in [0, size)
+ *
+ * Parameters:
+ *   - out: Pointer to the output array of floats. Must have at least 'size' elements.
+ *   - in: Pointer to the input array of floats. Must have at least 'size' elements.
+ *   - scalar: Scalar multiplier applied to each element of 'in'.
+ *   - size: Number of elements to process.
+ */
+inline void simd_vector_sub_scalar_mul(float* out, const float* in, float scalar, size_t size) {
+    size_t i = 0;
+
+#ifdef __AVX__
+    // AVX: Process 8 floats at a time
+    const __m256 scalar_vec = _mm256_set1_ps(scalar);
+    for (; i + 8 <= size; i += 8) {
+        __m256 out_vec = _mm256_loadu_ps(&out[i]);
+        __m256 in_vec = _mm256_loadu_ps(&in[i]);
+        __m256 mul_result = _mm256_mul_ps(scalar_vec, in_vec);
+        __m256 result = _mm256_sub_ps(out_vec, mul_result);
+        _mm256_storeu_ps(&out[i], result);
+    }
+#elif defined(__SSE2__)
+    // SSE2: Process 4 floats at a time
+    const __m128 scalar_vec = _mm_set1_ps(scalar);
+    for (; i + 4 <= size; i += 4) {
+        __m128 out_vec = _mm_loadu_ps(&out[i]);
+        __m128 in_vec = _mm_loadu_ps(&in[i]);
+        __m128 mul_result = _mm_mul_ps(scalar_vec, in_vec);
+        __m128 result = _mm_sub_ps(out_vec, mul_result);
+        _mm_storeu_ps(&out[i], result);
+    }
+#endif
+
+    // Process remaining elements with scalar code
+    for (; i < size; ++i) {
+        out[i] -= scalar * in[i];
+    }
+}
+
+// SIMD optimized vector multiplication by scalar: out[i] *= scalar
+inline void simd_vector_mul_scalar(float* out, float scalar, size_t size) {
+    size_t i = 0;
+
+#ifdef __AVX__
+    // AVX: Process 8 floats at a time
+    const __m256 scalar_vec = _mm256_set1_ps(scalar);
+    for (; i + 8 <= size; i += 8) {
+        __m256 out_vec = _mm256_loadu_ps(&out[i]);
+        __m256 result = _mm256_mul_ps(out_vec, scalar_vec);
+        _mm256_storeu_ps(&out[i], result);
+    }
+#elif defined(__SSE2__)
+    // SSE2: Process 4 floats at a time
+    const __m128 scalar_vec = _mm_set1_ps(scalar);
+    for (; i + 4 <= size; i += 4) {
+        __m128 out_vec = _mm_loadu_ps(&out[i]);
+        __m128 result = _mm_mul_ps(out_vec, scalar_vec);
+        _mm_storeu_ps(&out[i], result);
+    }
+#endif
+
+    // Process remaining elements with scalar code
+    for (; i < size; ++i) {
+        out[i] *= scalar;
+    }
+}
+
+// SIMD optimized dot product: sum(a[i] * b[i])
+inline float simd_dot_product(const float* a, const float* b, size_t size) {
+    size_t i = 0;
+    float result = 0.0f;
+
+#ifdef __AVX__
+    // AVX: Process 8 floats at a time, reduce lanes at the end
+    __m256 acc = _mm256_setzero_ps();
+    for (; i + 8 <= size; i += 8) {
+        acc = _mm256_add_ps(acc, _mm256_mul_ps(_mm256_loadu_ps(&a[i]), _mm256_loadu_ps(&b[i])));
+    }
+    __m128 sum = _mm_add_ps(_mm256_castps256_ps128(acc), _mm256_extractf128_ps(acc, 1));
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1));
+    result = _mm_cvtss_f32(sum);
+#elif defined(__SSE2__)
+    // SSE2: Process 4 floats at a time, reduce lanes at the end
+    __m128 acc = _mm_setzero_ps();
+    for (; i + 4 <= size; i += 4) {
+        acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(&a[i]), _mm_loadu_ps(&b[i])));
+    }
+    acc = _mm_add_ps(acc, _mm_movehl_ps(acc, acc));
+    acc = _mm_add_ss(acc, _mm_shuffle_ps(acc, acc, 1));
+    result = _mm_cvtss_f32(acc);
+#endif
+
+    // Process remaining elements with scalar code
+    for (; i < size; ++i) {
+        result += a[i] * b[i];
+    }
+    return result;
+}
+
+}  // namespace ov::genai::cdpruner
@@ -4,8 +4,12 @@
 // Based on clip.cpp
 
 #include "clip.hpp"
+#include <algorithm>
+#include <array>
 #include <cmath>
 
+#include "openvino/core/parallel.hpp"
+
 clip_image_u8 tensor_to_clip_image_u8(const ov::Tensor& image_tensor) {
     clip_image_u8 image{
         int(image_tensor.get_shape().at(2)),
@@ -140,19 +144,74 @@ static Coeffs1D precompute_pillow_coeffs_1d(int inSize, int outSize, double base
     return c;
 }
 
+// Rows are resampled in blocks by parallel tasks to amortize scheduling overhead on small images.
+static constexpr size_t ROWS_PER_TASK = 8;
+
+template <typename RowFn>
+static void parallel_for_rows(int num_rows, const RowFn& row_fn) {
+    const size_t num_tasks = (static_cast<size_t>(num_rows) + ROWS_PER_TASK - 1) / ROWS_PER_TASK;
+    ov::parallel_for(num_tasks, [&](size_t task) {
+        const int first = static_cast<int>(task * ROWS_PER_TASK);
+        const int last = std::min(num_rows, first + static_cast<int>(ROWS_PER_TASK));
+        for (int row = first; row < last; ++row) {
+            row_fn(row);
+        }
+    });
+}
+
+// Resamples a single RGB row.
+static void resample_horizontal_row(const uint8_t* src, uint8_t* dst, const Coeffs1D& cx) {
+    for (int xx = 0; xx < cx.outSize; ++xx) {
+        const int32_t* k = &cx.kk[static_cast<size_t>(xx) * cx.ksize];
+        const uint8_t* p = src + static_cast<size_t>(cx.bounds_xmin[xx]) * 3;
+
+        // Pillow uses rounding bias: 1<<(PRECISION_BITS-1).
+        int ss0 = 1 << (PRECISION_BITS - 1);
+        int ss1 = 1 << (PRECISION_BITS - 1);
+        int ss2 = 1 << (PRECISION_BITS - 1);
+        for (int i = 0; i < cx.bounds_count[xx]; ++i, p += 3) {
+            ss0 += int(p[0]) * k[i];
+            ss1 += int(p[1]) * k[i];
+            ss2 += int(p[2]) * k[i];
+        }
+        dst[xx * 3] = clip8_from_fixed(ss0);
+        dst[xx * 3 + 1] = clip8_from_fixed(ss1);
+        dst[xx * 3 + 2] = clip8_from_fixed(ss2);
+    }
+}
+
+// Computes output row 'yy' as a weighted sum of whole source rows. Channels are interleaved, so a row is processed
+// as a flat array of bytes and the inner loop is vectorized by compiler. Integer sums don't depend on order of
+// accumulation, so the result is bit-exact with per-pixel computation.
+static void resample_vertical_row(const uint8_t* src, size_t row_bytes, uint8_t* dst, const Coeffs1D& cy, int yy, int32_t* acc) {
+    const int32_t* k = &cy.kk[static_cast<size_t>(yy) * cy.ksize];
+    std::fill_n(acc, row_bytes, 1 << (PRECISION_BITS - 1));
+    for (int i = 0; i < cy.bounds_count[yy]; ++i) {
+        const uint8_t* p = src + static_cast<size_t>(cy.bounds_xmin[yy] + i) * row_bytes;
+        const int32_t w = k[i];
+        for (size_t b = 0; b < row_bytes; ++b) {
+            acc[b] += int32_t(p[b]) * w;
+        }
+    }
+    for (size_t b = 0; b < row_bytes; ++b) {
+        dst[b] = clip8_from_fixed(acc[b]);
+    }
+}
+
 // base_support is a factor for determining the kernel size of the filter to use.
 // See it's use within precompute_pillow_coeffs_1d above.
 // For bilinear, it is set to 1.0.
 // For bicubic, it is set to 2.0.
 // ref:
 // https://github.com/python-pillow/Pillow/blob/12.1.0/src/libImaging/Resample.c#L82C1-L86C54
-template <typename FilterFn>
+// Every resized RGB row is passed to row_sink(y, row), which may be called concurrently for different rows.
+template <typename FilterFn, typename RowSink>
 static void resize_pillow_like(const clip_image_u8& img,
-                               clip_image_u8& dst,
                                int target_width,
                                int target_height,
                                double base_support,
-                               FilterFn filter_fn) {
+                               FilterFn filter_fn,
+                               const RowSink& row_sink) {
     const int inW = img.nx;
     const int inH = img.ny;
     const int outW = target_width;
@@ -163,96 +222,68 @@ static void resize_pillow_like(const clip_image_u8& img,
     OPENVINO_ASSERT(outW > 0);
     OPENVINO_ASSERT(outH > 0);
 
-    dst.nx = outW;
-    dst.ny = outH;
-    dst.buf.resize(static_cast<size_t>(outW) * outH * 3);
+    const size_t in_row_bytes = static_cast<size_t>(inW) * 3;
+    const size_t out_row_bytes = static_cast<size_t>(outW) * 3;
 
     // Trivial copy
     if (outW == inW && outH == inH) {
-        dst.buf = img.buf;
+        parallel_for_rows(outH, [&](int y) {
+            row_sink(y, &img.buf[y * in_row_bytes]);
+        });
         return;
     }
 
     const bool do_h = (outW != inW);
     const bool do_v = (outH != inH);
 
-    // tmp buffer is used when scaling in both horizontal & vertical directions
-    clip_image_u8 tmp;
-    tmp.nx = outW;
-    tmp.ny = inH;
-    if (do_h && do_v) {
-        tmp.buf.resize(static_cast<size_t>(outW) * inH * 3);
-    }
-
-    // 1) Horizontal pass from src -> tmp (or dst if do_v is false).
+    // 1) Horizontal pass from src -> tmp, or directly to row_sink if do_v is false.
+    std::vector<uint8_t> tmp;
     if (do_h) {
         // Precompute horizontal coefficient tables
         const Coeffs1D cx = precompute_pillow_coeffs_1d(inW, outW, base_support, filter_fn);
-
-        // This pass writes to the tmp buffer unless we're not doing vertical pass.
-        // In that case, it writes directly to the dst.
-        uint8_t* dst_h = do_v ? tmp.buf.data() : dst.buf.data();
-
-        for (int y = 0; y < inH; ++y) {
-            for (int xx = 0; xx < outW; ++xx) {
-                const int xmin = cx.bounds_xmin[xx];
-                const int count = cx.bounds_count[xx];
-                const int32_t* k = &cx.kk[static_cast<size_t>(xx) * cx.ksize];
-
-                // Pillow uses rounding bias: 1<<(PRECISION_BITS-1).
-                int ss0 = 1 << (PRECISION_BITS - 1);
-                int ss1 = 1 << (PRECISION_BITS - 1);
-                int ss2 = 1 << (PRECISION_BITS - 1);
-
-                for (int i = 0; i < count; ++i) {
-                    const int x = xmin + i;
-                    const uint8_t* p = &img.buf[(y * inW + x) * 3];
-                    ss0 += int(p[0]) * k[i];
-                    ss1 += int(p[1]) * k[i];
-                    ss2 += int(p[2]) * k[i];
-                }
-                uint8_t* outp = &dst_h[(y * outW + xx) * 3];
-                outp[0] = clip8_from_fixed(ss0);
-                outp[1] = clip8_from_fixed(ss1);
-                outp[2] = clip8_from_fixed(ss2);
-            }
+        if (!do_v) {
+            parallel_for_rows(outH, [&](int y) {
+                thread_local std::vector<uint8_t> row;
+                row.resize(out_row_bytes);
+                resample_horizontal_row(&img.buf[y * in_row_bytes], row.data(), cx);
+                row_sink(y, row.data());
+            });
+            return;
         }
+        tmp.resize(out_row_bytes * inH);
+        parallel_for_rows(inH, [&](int y) {
+            resample_horizontal_row(&img.buf[y * in_row_bytes], &tmp[y * out_row_bytes], cx);
+        });
     }
 
-    // 2) Vertical pass from tmp (or src if do_h is false) -> dst.
-    if (do_v) {
-        // Precompute vertical coefficient tables
-        const Coeffs1D cy = precompute_pillow_coeffs_1d(inH, outH, base_support, filter_fn);
-
-        // This pass reads from the tmp buffer unless we didn't do horizontal pass.
-        // In that case, it reads directly from the source img.
-        const clip_image_u8& src_h_img = do_h ? tmp : img;
-
-        for (int yy = 0; yy < outH; ++yy) {
-            const int ymin = cy.bounds_xmin[yy];
-            const int count = cy.bounds_count[yy];
-            const int32_t* k = &cy.kk[static_cast<size_t>(yy) * cy.ksize];
-
-            for (int x = 0; x < outW; ++x) {
-                int ss0 = 1 << (PRECISION_BITS - 1);
-                int ss1 = 1 << (PRECISION_BITS - 1);
-                int ss2 = 1 << (PRECISION_BITS - 1);
-
-                for (int i = 0; i < count; ++i) {
-                    const int y = ymin + i;
-                    const uint8_t* p = &src_h_img.buf[(y * outW + x) * 3];
-                    ss0 += int(p[0]) * k[i];
-                    ss1 += int(p[1]) * k[i];
-                    ss2 += int(p[2]) * k[i];
-                }
+    // 2) Vertical pass from tmp (or src if do_h is false) -> row_sink.
+    const Coeffs1D cy = precompute_pillow_coeffs_1d(inH, outH, base_support, filter_fn);
+    const uint8_t* src_v = do_h ? tmp.data() : img.buf.data();
+    parallel_for_rows(outH, [&](int yy) {
+        thread_local std::vector<int32_t> acc;
+        thread_local std::vector<uint8_t> row;
+        acc.resize(out_row_bytes);
+        row.resize(out_row_bytes);
+        resample_vertical_row(src_v, out_row_bytes, row.data(), cy, yy, acc.data());
+        row_sink(yy, row.data());
+    });
+}
 
-                uint8_t* outp = &dst.buf[(yy * outW + x) * 3];
-                outp[0] = clip8_from_fixed(ss0);
-                outp[1] = clip8_from_fixed(ss1);
-                outp[2] = clip8_from_fixed(ss2);
-            }
-        }
-    }
+template <typename FilterFn>
+static void resize_pillow_like(const clip_image_u8& img,
+                               clip_image_u8& dst,
+                               int target_width,
+                               int target_height,
+                               double base_support,
+                               FilterFn filter_fn) {
+    OPENVINO_ASSERT(&img != &dst, "In-place resize is not supported");
+    const size_t out_row_bytes = static_cast<size_t>(target_width) * 3;
+    dst.nx = target_width;
+    dst.ny = target_height;
+    dst.buf.resize(out_row_bytes * target_height);
+    resize_pillow_like(img, target_width, target_height, base_support, filter_fn, [&](int y, const uint8_t* row) {
+        std::copy_n(row, out_row_bytes, &dst.buf[y * out_row_bytes]);
+    });
 }
 
 void bicubic_resize(const clip_image_u8& img, clip_image_u8& dst, int target_width, int target_height) {
@@ -263,6 +294,73 @@ void bilinear_resize(const clip_image_u8& img, clip_image_u8& dst, int target_wi
     resize_pillow_like(img, dst, target_width, target_height, 1.0, pillow_bilinear_filter);
 }
 
+namespace {
+
+// Normalized value of every uint8_t value per channel, so normalization is a table lookup
+using NormalizationTable = std::array<std::array<float, 256>, 3>;
+
+NormalizationTable make_normalization_table(const clip_ctx& ctx) {
+    NormalizationTable table;
+    for (size_t c = 0; c < 3; ++c) {
+        for (size_t v = 0; v < 256; ++v) {
+            table[c][v] = ((float(v) / 255.0f) - ctx.image_mean[c]) / ctx.image_std[c];
+        }
+    }
+    return table;
+}
+
+NormalizationTable make_normalization_table(const clip_ctx_double& ctx) {
+    NormalizationTable table;
+    for (size_t c = 0; c < 3; ++c) {
+        for (size_t v = 0; v < 256; ++v) {
+            // perform division in double values, to align with python,
+            // as some models are sensitive to small values deviations, like llava-next-video
+            table[c][v] = (double(v) - ctx.image_mean[c]) / ctx.image_std[c];
+        }
+    }
+    return table;
+}
+
+// Normalizes an RGB row and writes it to row 'y' of every channel plane of CHW image
+void normalize_row_to_chw(const uint8_t* row, int y, const NormalizationTable& table, clip_image_f32& res) {
+    const size_t plane_size = static_cast<size_t>(res.nx) * res.ny;
+    for (size_t c = 0; c < 3; ++c) {
+        float* out = res.buf.data() + c * plane_size + static_cast<size_t>(y) * res.nx;
+        const float* channel_table = table[c].data();
+        for (int x = 0; x < res.nx; ++x) {
+            out[x] = channel_table[row[x * 3 + c]];
+        }
+    }
+}
+
+clip_image_f32 make_chw_image(int nx, int ny) {
+    clip_image_f32 res;
+    res.nx = nx;
+    res.ny = ny;
+    res.buf.resize(3 * static_cast<size_t>(nx) * ny);
+    return res;
+}
+
+}  // namespace
+
+clip_image_f32 bicubic_resize_and_preprocess(const clip_ctx& ctx, const clip_image_u8& img, int target_width, int target_height) {
+    const NormalizationTable table = make_normalization_table(ctx);
+    clip_image_f32 res = make_chw_image(target_width, target_height);
+    resize_pillow_like(img, target_width, target_height, 2.0, pillow_bicubic_filter, [&](int y, const uint8_t* row) {
+        normalize_row_to_chw(row, y, table, res);
+    });
+    return res;
+}
+
+clip_image_f32 bilinear_resize_and_preprocess(const clip_ctx& ctx, const clip_image_u8& img, int target_width, int target_height) {
+    const NormalizationTable table = make_normalization_table(ctx);
+    clip_image_f32 res = make_chw_image(target_width, target_height);
+    resize_pillow_like(img, target_width, target_height, 1.0, pillow_bilinear_filter, [&](int y, const uint8_t* row) {
+        normalize_row_to_chw(row, y, table, res);
+    });
+    return res;
+}
+
 // llava-1.6 type of resize_and_pad (black by default)
 clip_image_u8 resize_and_pad_image(const clip_image_u8& image, const std::pair<int, int>& target_resolution, uint8_t pad_value) {
     int target_width = target_resolution.first;
@@ -339,72 +437,12 @@ std::pair<int, int> select_best_resolution(const std::pair<int, int> & original_
 
 // returns the normalized float tensor for llava-1.5, for spatial_unpad with anyres processing for llava-1.6 it returns the normalized image patch tensors as a vector
 clip_image_f32 clip_image_preprocess(clip_ctx& ctx, const clip_image_u8& img) {
-    bool pad_to_square = true;
-
-    clip_image_u8 temp;  // we will keep the input image data here temporarily
-    temp.nx = img.nx;
-    temp.ny = img.ny;
-    temp.buf.resize(img.buf.size());
-    memcpy(temp.buf.data(), img.buf.data(), temp.buf.size());
-
-
-    const int nx = temp.nx;
-    const int ny = temp.ny;
-
-    const int nx2 = temp.nx;
-    const int ny2 = temp.ny;
-
-    clip_image_f32 res;
-    res.nx = nx2;
-    res.ny = ny2;
-    res.buf.resize(3 * nx2 * ny2);
-
-    const int nx3 = nx;
-    const int ny3 = ny;
-
-    const auto& m3 = ctx.image_mean; // {0.48145466f, 0.4578275f, 0.40821073f};
-    const auto& s3 = ctx.image_std;  // {0.26862954f, 0.26130258f, 0.27577711f};
-
-    for (int y = 0; y < ny3; y++) {
-        for (int x = 0; x < nx3; x++) {
-            for (int c = 0; c < 3; c++) {
-                // linear interpolation
-                const float sx = x;
-                const float sy = y;
-
-                const int x0 = std::max(0, (int)std::floor(sx));
-                const int y0 = std::max(0, (int)std::floor(sy));
-
-                const int x1 = std::min(x0 + 1, nx - 1);
-                const int y1 = std::min(y0 + 1, ny - 1);
-
-                const float dx = sx - x0;
-                const float dy = sy - y0;
-
-                const int j00 = 3 * (y0 * nx + x0) + c;
-                const int j01 = 3 * (y0 * nx + x1) + c;
-                const int j10 = 3 * (y1 * nx + x0) + c;
-                const int j11 = 3 * (y1 * nx + x1) + c;
-
-                const float v00 = temp.buf[j00];
-                const float v01 = temp.buf[j01];
-                const float v10 = temp.buf[j10];
-                const float v11 = temp.buf[j11];
-
-                const float v0 = v00 * (1.0f - dx) + v01 * dx;
-                const float v1 = v10 * (1.0f - dx) + v11 * dx;
-
-                const float v = v0 * (1.0f - dy) + v1 * dy;
-
-                const uint8_t v2 = std::min(std::max(std::round(v), 0.0f), 255.0f);
-
-                //rgb hwc ->chw
-                const int i = (y * nx3 + x) + c * nx3 * ny3;
-
-                res.buf[i] = ((float(v2) / 255.0f) - m3[c]) / s3[c];
-            }
-        }
-    }
+    const NormalizationTable table = make_normalization_table(ctx);
+    clip_image_f32 res = make_chw_image(img.nx, img.ny);
+    const size_t row_bytes = static_cast<size_t>(img.nx) * 3;
+    parallel_for_rows(img.ny, [&](int y) {
+        normalize_row_to_chw(&img.buf[y * row_bytes], y, table, res);
+    });
     return res;
 }
 
@@ -430,28 +468,12 @@ clip_image_u8 center_crop(const clip_image_u8& image, size_t crop_height, size_t
 }
 
 clip_image_f32 normalize_and_convert_to_chw(const clip_image_u8& img, const clip_ctx_double& image_mean_std) {
-    const size_t nx = img.nx;
-    const size_t ny = img.ny;
-    const auto& image_mean = image_mean_std.image_mean;
-    const auto& image_std = image_mean_std.image_std;
-
-    clip_image_f32 res;
-    res.nx = nx;
-    res.ny = ny;
-    res.buf.resize(3 * nx * ny);
-
-    for (size_t y = 0; y < ny; y++) {
-        for (size_t x = 0; x < nx; x++) {
-            for (size_t c = 0; c < 3; c++) {
-                const uint8_t val = img.buf[3 * (y * nx + x) + c];
-                const size_t i = (y * nx + x) + c * nx * ny;
-
-                // perform division in double values, to align with python,
-                // as some models are sensitive to small values deviations, like llava-next-video
-                res.buf[i] = (double(val) - image_mean[c]) / image_std[c];
-            }
-        }
-    }
+    const NormalizationTable table = make_normalization_table(image_mean_std);
+    clip_image_f32 res = make_chw_image(img.nx, img.ny);
+    const size_t row_bytes = static_cast<size_t>(img.nx) * 3;
+    parallel_for_rows(img.ny, [&](int y) {
+        normalize_row_to_chw(&img.buf[y * row_bytes], y, table, res);
+    });
     return res;
 }
 
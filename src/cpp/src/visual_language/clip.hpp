@@ -60,6 +60,17 @@ void bilinear_resize(const clip_image_u8& src, clip_image_u8& dst, int target_wi
 /** preprocess img and store the result in res_imgs, pad_to_square may be overridden to false depending on model configuration */
 clip_image_f32 clip_image_preprocess(struct clip_ctx& ctx, const clip_image_u8& img);
 
+/**
+ * @brief Fused bicubic_resize() and clip_image_preprocess(): resized rows are normalized and written
+ * to CHW layout in the same pass without an intermediate resized image. The result is the same as of separate calls.
+ */
+clip_image_f32 bicubic_resize_and_preprocess(const clip_ctx& ctx, const clip_image_u8& img, int target_width, int target_height);
+
+/**
+ * @brief Fused bilinear_resize() and clip_image_preprocess().
+ */
+clip_image_f32 bilinear_resize_and_preprocess(const clip_ctx& ctx, const clip_image_u8& img, int target_width, int target_height);
+
 std::vector<clip_image_u8> get_image_patches(
     const clip_image_u8& image, 
     const std::vector<std::pair<int, int>>& image_grid_pinpoints,
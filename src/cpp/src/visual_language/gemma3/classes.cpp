@@ -12,17 +12,12 @@ namespace {
 
 clip_image_f32 preprocess_clip_image_gemma3(const clip_image_u8& image, const ProcessorConfig& config) {
 
-    // Resize
-    clip_image_u8 resized_image;
-    bilinear_resize(image, resized_image, config.size_width, config.size_height);
-
-    // Normalize
     clip_ctx ctx;
     std::copy(config.image_mean.begin(), config.image_mean.end(), ctx.image_mean);
     std::copy(config.image_std.begin(), config.image_std.end(), ctx.image_std);
 
-    clip_image_f32 normalized_image = clip_image_preprocess(ctx, resized_image);
-    return normalized_image;
+    // Resize and normalize in a single pass
+    return bilinear_resize_and_preprocess(ctx, image, config.size_width, config.size_height);
 }
 
 ov::Tensor get_pixel_values_gemma3(const ov::Tensor& image, const ProcessorConfig& config) {
@@ -72,17 +67,8 @@ bool InputsEmbedderGemma3::has_token_type_ids() const {
 }
 
 std::vector<ov::genai::EncodedImage> InputsEmbedderGemma3::encode_images(const std::vector<ov::Tensor>& images) {
-    std::vector<EncodedImage> embeds;
-
     ov::AnyMap vision_config = {{"patch_size", m_vlm_config.vision_config_patch_size}};
-
-    std::vector<ov::Tensor> single_images = to_single_image_tensors(images);
-    embeds.reserve(single_images.size());
-    for (const ov::Tensor& image : single_images) {
-        embeds.emplace_back(m_vision_encoder->encode(image, vision_config));
-    }
-    
-    return embeds;
+    return m_vision_encoder->encode_batch(to_single_image_tensors(images), vision_config);
 }
 
 NormalizedPrompt InputsEmbedderGemma3::normalize_prompt(const std::string& prompt, size_t base_id, const std::vector<EncodedImage>& images) const {
@@ -1,11 +1,14 @@
 // Copyright (C) 2023-2026 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 
+#include <atomic>
+
 #include "openvino/genai/visual_language/perf_metrics.hpp"
 #include "visual_language/inputs_embedder.hpp"
 
 #include "visual_language/clip.hpp"
 #include "visual_language/vision_encoder.hpp"
+#include "visual_language/vision_embeddings_cache.hpp"
 #include "visual_language/embedding_model.hpp"
 
 #include "visual_language/qwen2vl/classes.hpp"
@@ -41,6 +44,7 @@ void InputsEmbedder::IInputsEmbedder::start_chat(const std::string& system_messa
     if (!m_kv_cache_state.get_state().empty()) {
         m_kv_cache_state.reset_state();
     }
+    m_chat_tokenization_cache.reset();
     if (system_message.empty()) {
         return;
     }
@@ -61,6 +65,7 @@ void InputsEmbedder::IInputsEmbedder::update_chat_history(const std::string& dec
 void InputsEmbedder::IInputsEmbedder::finish_chat() {
     m_is_chat_conversation = false;
     m_kv_cache_state.reset_state();
+    m_chat_tokenization_cache.reset();
 }
 
 InputsEmbedder::IInputsEmbedder::IInputsEmbedder(
@@ -104,7 +109,9 @@ ov::Tensor InputsEmbedder::IInputsEmbedder::apply_chat_template_tokenize(const s
     if (m_is_chat_conversation) {
         std::string prompt_to_encode = prompt;
         auto start_tokenizer_time = std::chrono::steady_clock::now();
-        ov::Tensor new_chat_tokens = m_tokenizer.encode(prompt_to_encode, ov::genai::add_special_tokens(add_special_tokens)).input_ids;
+        ov::Tensor new_chat_tokens = add_special_tokens
+            ? m_tokenizer.encode(prompt_to_encode, ov::genai::add_special_tokens(true)).input_ids
+            : m_chat_tokenization_cache.encode(m_tokenizer, prompt_to_encode).input_ids;
         auto end_tokenizer_time = std::chrono::steady_clock::now();
         metrics.raw_metrics.tokenization_durations.emplace_back(PerfMetrics::get_microsec(end_tokenizer_time - start_tokenizer_time));
         return new_chat_tokens;
@@ -174,11 +181,8 @@ std::vector<ov::Tensor> InputsEmbedder::IInputsEmbedder::to_single_image_tensors
 }
 
 std::vector<ov::genai::EncodedImage> InputsEmbedder::IInputsEmbedder::encode_images(const std::vector<ov::Tensor>& images) {
-    std::vector<EncodedImage> encoded_images;
     std::vector<ov::Tensor> single_images = to_single_image_tensors(images);
-    for (const ov::Tensor& image : single_images) {
-        encoded_images.emplace_back(m_vision_encoder->encode(image));
-    }
+    std::vector<EncodedImage> encoded_images = m_vision_encoder->encode_batch(single_images);
     OPENVINO_ASSERT(images.size() == encoded_images.size(), "Input images size and encoded images size mismatch!");
     return encoded_images;
 }
@@ -274,6 +278,8 @@ InputsEmbedder::InputsEmbedder(const std::filesystem::path& model_dir,
     } else {
         OPENVINO_THROW("Unsupported model type in VLM InputsEmbedder class. Please, create feature request on new model support");
     }
+
+    m_vision_cache_model_key = VisionEmbeddingsCache::make_model_key(std::filesystem::absolute(model_dir).string(), model_dir, vlm_config, device, device_config);
 }
 
 InputsEmbedder::InputsEmbedder(const ModelsMap& models_map,
@@ -308,6 +314,10 @@ InputsEmbedder::InputsEmbedder(const ModelsMap& models_map,
     } else {
         OPENVINO_THROW("Unsupported model type in VLM InputsEmbedder class. Please, create feature request on new model support");
     }
+
+    // weights of in-memory models are not hashed, so their encodings are shared by this instance only
+    static std::atomic<size_t> in_memory_model_counter{0};
+    m_vision_cache_model_key = VisionEmbeddingsCache::make_model_key("in-memory-model-" + std::to_string(in_memory_model_counter++), config_dir_path, vlm_config, device, device_config);
 }
 
 ov::Tensor InputsEmbedder::get_inputs_embeds(const std::string& prompt, const std::vector<ov::genai::EncodedImage>& images, ov::genai::VLMPerfMetrics& metrics, bool recalculate_merged_embeddings, const std::vector<size_t>& image_sequence) {
@@ -369,10 +379,77 @@ std::vector<ov::genai::EncodedImage> InputsEmbedder::encode_images(const std::ve
     return m_impl->encode_images(images);
 }
 
+std::vector<ov::genai::EncodedImage> InputsEmbedder::encode_images(const std::vector<ov::Tensor>& images, VLMPerfMetrics& metrics) {
+    VisionEmbeddingsCache& cache = VisionEmbeddingsCache::instance();
+    if (cache.get_capacity() == 0) {
+        return m_impl->encode_images(images);
+    }
+
+    // a batch of images in a single tensor is encoded into several images and is not cached
+    auto is_batch = [](const ov::Tensor& image) {
+        const ov::Shape& shape = image.get_shape();
+        return shape.size() == 4 && shape[0] > 1;
+    };
+    std::vector<std::vector<EncodedImage>> encoded_per_input(images.size());
+    std::vector<uint8_t> hits(images.size(), 0);
+    // cache lookups run concurrently, so misses of a multi-image prompt are encoded on several infer requests at once;
+    // encoding blocks on the infer requests queue, so more workers than requests would only wait
+    run_concurrently(images.size(), m_impl->get_num_vision_encoder_requests(), [&](size_t i) {
+        const ov::Tensor& image = images[i];
+        if (is_batch(image)) {
+            encoded_per_input[i] = m_impl->encode_images({image});
+            return;
+        }
+        bool hit = false;
+        encoded_per_input[i].push_back(cache.get_or_encode_image(
+            VisionEmbeddingsCache::make_key(m_vision_cache_model_key, VisionType::IMAGE, image),
+            [&]() {
+                std::vector<EncodedImage> encoded = m_impl->encode_images({image});
+                OPENVINO_ASSERT(encoded.size() == 1, "Expected a single encoded image, got ", encoded.size());
+                return encoded.front();
+            },
+            hit));
+        hits[i] = hit;
+    });
+
+    std::vector<EncodedImage> encoded_images;
+    for (size_t i = 0; i < images.size(); ++i) {
+        encoded_images.insert(encoded_images.end(), encoded_per_input[i].begin(), encoded_per_input[i].end());
+        if (hits[i]) {
+            ++metrics.vlm_raw_metrics.vision_cache_hits;
+        } else {
+            metrics.vlm_raw_metrics.vision_cache_misses += encoded_per_input[i].size();
+        }
+    }
+    return encoded_images;
+}
+
 std::vector<ov::genai::EncodedVideo> InputsEmbedder::encode_videos(const std::vector<ov::Tensor>& videos) {
     return m_impl->encode_videos(videos);
 }
 
+std::vector<ov::genai::EncodedVideo> InputsEmbedder::encode_videos(const std::vector<ov::Tensor>& videos, VLMPerfMetrics& metrics) {
+    VisionEmbeddingsCache& cache = VisionEmbeddingsCache::instance();
+    if (cache.get_capacity() == 0) {
+        return m_impl->encode_videos(videos);
+    }
+
+    std::vector<EncodedVideo> encoded_videos;
+    for (const ov::Tensor& video : videos) {
+        bool hit = false;
+        encoded_videos.push_back(cache.get_or_encode_video(
+            VisionEmbeddingsCache::make_key(m_vision_cache_model_key, VisionType::VIDEO, video),
+            [&]() {
+                std::vector<EncodedVideo> encoded = m_impl->encode_videos({video});
+                OPENVINO_ASSERT(encoded.size() == 1, "Expected a single encoded video, got ", encoded.size());
+                return encoded.front();
+            },
+            hit));
+        ++(hit ? metrics.vlm_raw_metrics.vision_cache_hits : metrics.vlm_raw_metrics.vision_cache_misses);
+    }
+    return encoded_videos;
+}
+
 std::pair<ov::Tensor, std::optional<int64_t>> InputsEmbedder::get_position_ids(const size_t inputs_embeds_size, const size_t history_size) {
     return m_impl->get_position_ids(inputs_embeds_size, history_size);
 }
@@ -10,6 +10,7 @@
 
 #include "utils.hpp"
 #include "lm_encoding.hpp"
+#include "tokenizer/chat_tokenization_cache.hpp"
 #include "openvino/genai/tokenizer.hpp"
 #include "openvino/genai/visual_language/pipeline.hpp"
 #include "openvino/runtime/tensor.hpp"
@@ -72,8 +73,13 @@ public:
 
     std::vector<ov::genai::EncodedImage> encode_images(const std::vector<ov::Tensor>& images);
 
+    // encodes images reusing encodings shared across pipelines via VisionEmbeddingsCache, counts cache hits in metrics
+    std::vector<ov::genai::EncodedImage> encode_images(const std::vector<ov::Tensor>& images, ov::genai::VLMPerfMetrics& metrics);
+
     std::vector<ov::genai::EncodedVideo> encode_videos(const std::vector<ov::Tensor>& videos);
 
+    std::vector<ov::genai::EncodedVideo> encode_videos(const std::vector<ov::Tensor>& videos, ov::genai::VLMPerfMetrics& metrics);
+
     // compute position ids for language model input
     std::pair<ov::Tensor, std::optional<int64_t>> get_position_ids(const size_t inputs_embeds_size, const size_t history_size);
 
@@ -144,6 +150,8 @@ private:
         ov::genai::GenerationStatus m_chat_generation_finish_status = ov::genai::GenerationStatus::RUNNING;
         // reflection of tokens contained in the kv cache
         utils::KVCacheState m_kv_cache_state;
+        // tokens of templated history from previous iteration, so only new messages are tokenized
+        ChatTokenizationCache m_chat_tokenization_cache;
         // length of attention_mask/kv cache at the beginning of generation()
         size_t m_prev_hist_length = 0;
         // True if tokenizer should add special tokens
@@ -184,6 +192,11 @@ private:
 
         virtual std::vector<ov::genai::EncodedVideo> encode_videos(const std::vector<ov::Tensor>& videos);
 
+        // number of images which can be encoded concurrently
+        size_t get_num_vision_encoder_requests() const {
+            return m_vision_encoder ? m_vision_encoder->get_num_infer_requests() : 1;
+        }
+
         virtual std::pair<ov::Tensor, std::optional<int64_t>> get_position_ids(const size_t inputs_embeds_size, const size_t history_size);
         
         void set_position_ids(const ov::Tensor& position_ids) {
@@ -320,6 +333,9 @@ private:
 
     std::shared_ptr<IInputsEmbedder> m_impl;
 
+    // identifies model and preprocessing configuration in VisionEmbeddingsCache keys
+    std::string m_vision_cache_model_key;
+
     friend class InputsEmbedderMiniCPM;
     friend class InputsEmbedderLLaVA;
     friend class InputsEmbedderNanoLLaVA;
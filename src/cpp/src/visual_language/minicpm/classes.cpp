@@ -704,19 +704,25 @@ ov::Tensor InputsEmbedderMiniCPM::get_inputs_embeds(const std::string& unified_p
 ov::Tensor VisionEncoderMiniCPM::resample(const ov::Tensor& encoded_image, const ImageSize& target_size, size_t pad_to_max) {
     size_t bs = encoded_image.get_shape().at(0);
     size_t patch_len = target_size.height * target_size.width;
-    adjust_pos_cache(
-        {target_size},
-        m_vlm_config.hidden_size,
-        m_pos_embed_cache
-    );
+    ov::Tensor pos_embed_cache;
+    {
+        // a grown cache is a new tensor, so the local handle stays valid after the lock is released
+        std::lock_guard<std::mutex> lock(m_pos_embed_cache_mutex);
+        adjust_pos_cache(
+            {target_size},
+            m_vlm_config.hidden_size,
+            m_pos_embed_cache
+        );
+        pos_embed_cache = m_pos_embed_cache;
+    }
     ov::Tensor key_padding_mask(ov::element::f32, {bs, pad_to_max});
     float* mask_data = key_padding_mask.data<float>();
-    size_t embed_len = m_pos_embed_cache.get_shape().at(2);
+    size_t embed_len = pos_embed_cache.get_shape().at(2);
     ov::Tensor pos_embed(ov::element::f32, {pad_to_max, bs, embed_len});  // BLD => L * B * D
     float* pos_embed_data = pos_embed.data<float>();
-    float* cache_data = m_pos_embed_cache.data<float>();
-    size_t _d0 = m_pos_embed_cache.get_shape().at(0);
-    size_t _d1 = m_pos_embed_cache.get_shape().at(1);
+    const float* cache_data = pos_embed_cache.data<const float>();
+    size_t _d0 = pos_embed_cache.get_shape().at(0);
+    size_t _d1 = pos_embed_cache.get_shape().at(1);
     for (size_t i = 0; i < bs; ++i) {
         size_t target_h = target_size.height;
         size_t target_w = target_size.width;
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <filesystem>
+#include <mutex>
 
 #include "visual_language/vlm_config.hpp"
 
@@ -21,6 +22,8 @@ class VisionEncoderMiniCPM : public VisionEncoder {
     // [70, 70, hidden_size]. 70 is the initial guess of the image
     // height and width after dividing by patch_size.
     ov::Tensor m_pos_embed_cache;
+    // Guards growth of m_pos_embed_cache when images are encoded concurrently.
+    std::mutex m_pos_embed_cache_mutex;
     // VLM config
     VLMConfig m_vlm_config;
 
@@ -128,14 +128,8 @@ InputsEmbedderNanoLLaVA::InputsEmbedderNanoLLaVA(
     IInputsEmbedder(vlm_config, models_map, tokenizer, config_dir_path, device, device_config) { }
 
 std::vector<ov::genai::EncodedImage> InputsEmbedderNanoLLaVA::encode_images(const std::vector<ov::Tensor>& images) {
-    std::vector<EncodedImage> embeds;
     ov::AnyMap vision_config = {{"patch_size", m_vlm_config.vision_config_patch_size}};
-    std::vector<ov::Tensor> single_images = to_single_image_tensors(images);
-    embeds.reserve(single_images.size());
-    for (const ov::Tensor& image : single_images) {
-        embeds.emplace_back(m_vision_encoder->encode(image, vision_config));
-    }
-    return embeds;
+    return m_vision_encoder->encode_batch(to_single_image_tensors(images), vision_config);
 }
 
 NormalizedPrompt InputsEmbedderNanoLLaVA::normalize_prompt(const std::string& prompt, size_t base_id, const std::vector<EncodedImage>& images) const {
@@ -11,12 +11,19 @@ MeanStdPair VLMPerfMetrics::get_prepare_embeddings_duration() {
     return prepare_embeddings_duration;
 }
 
+float VLMPerfMetrics::get_vision_cache_hit_rate() {
+    evaluate_statistics();
+    return vision_cache_hit_rate;
+}
+
 void VLMPerfMetrics::evaluate_statistics(std::optional<TimePoint> start_time) {
     if (m_evaluated) {
         return;
     }
 
     prepare_embeddings_duration = ov::genai::calc_mean_and_std(vlm_raw_metrics.prepare_embeddings_durations);
+    const size_t num_encoded = vlm_raw_metrics.vision_cache_hits + vlm_raw_metrics.vision_cache_misses;
+    vision_cache_hit_rate = num_encoded ? static_cast<float>(vlm_raw_metrics.vision_cache_hits) / num_encoded : 0.0f;
     PerfMetrics::evaluate_statistics(start_time);
 };
 
@@ -31,6 +38,10 @@ VLMPerfMetrics VLMPerfMetrics::operator+(const VLMPerfMetrics& right) const {
     result_prepare_embeddings_durations.insert(result_prepare_embeddings_durations.end(),
                                                 right_prepare_embeddings_durations.begin(),
                                                 right_prepare_embeddings_durations.end());
+    result.vlm_raw_metrics.vision_cache_hits += right.vlm_raw_metrics.vision_cache_hits;
+    result.vlm_raw_metrics.vision_cache_misses += right.vlm_raw_metrics.vision_cache_misses;
+    result.vlm_raw_metrics.pruned_vision_tokens += right.vlm_raw_metrics.pruned_vision_tokens;
+    result.vlm_raw_metrics.saved_kv_blocks += right.vlm_raw_metrics.saved_kv_blocks;
     return result;
 }
 }
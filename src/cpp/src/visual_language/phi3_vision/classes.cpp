@@ -6,6 +6,7 @@
 
 #include "visual_language/clip.hpp"
 #include "openvino/opsets/opset13.hpp"
+#include "openvino/core/parallel.hpp"
 
 #include "utils.hpp"
 
@@ -87,13 +88,14 @@ void bicubic_resize_phi3(const clip_image_u8& img, clip_image_u8& dst, int targe
     constexpr float _1_3 = 1.0f / 3.0f;
     constexpr float _1_6 = 1.0f / 6.0f;
 
-    float pixels[4];
-
     auto clip_coord = [](int x, int lower, int upper) -> int {
         return std::max(lower, std::min(x, upper));
     };
 
-    for (int i = 0; i < target_height; i++) {
+    // rows are independent, so they are computed in parallel
+    ov::parallel_for(static_cast<size_t>(target_height), [&](size_t row) {
+        const int i = static_cast<int>(row);
+        float pixels[4];
         const float fy = ty * i;
         const int y = static_cast<int>(fy);
         const float dy = fy - y;
@@ -157,50 +159,7 @@ void bicubic_resize_phi3(const clip_image_u8& img, clip_image_u8& dst, int targe
                 );
             }
         }
-    }
-}
-
-ov::Tensor mean_scale(const ov::Tensor& uint8, const ProcessorConfig& config) {
-    auto uint_8_data = uint8.data<uint8_t>();
-    ov::Tensor float_normalized{ov::element::f32, uint8.get_shape()};
-    float* float_data = float_normalized.data<float>();
-    OPENVINO_ASSERT(0 == uint8.get_size() % 3, "RGB");
-    for (size_t idx = 0; idx < uint8.get_size(); idx += 3) {
-        float_data[idx] = (float(uint_8_data[idx]) / 255.0f - config.image_mean[0]) / config.image_std[0];
-        float_data[idx + 1] = (float(uint_8_data[idx + 1]) / 255.0f - config.image_mean[1]) / config.image_std[1];
-        float_data[idx + 2] = (float(uint_8_data[idx + 2]) / 255.0f - config.image_mean[2]) / config.image_std[2];
-    }
-    return float_normalized;
-}
-
-ov::Tensor channels_first(const ov::Tensor& _1hw3) {
-    const ov::Shape shape = _1hw3.get_shape();
-    const size_t height = shape.at(1);
-    const size_t width = shape.at(2);
-    const size_t hw = height * width;
-
-    ov::Tensor _13hw = ov::Tensor{ov::element::f32, {1, 3, height, width}};
-    const float* _1hw3_data = _1hw3.data<float>();
-    float* _13hw_data = _13hw.data<float>();
-
-    float* dst_channels[3] = {
-        _13hw_data,              // R channel
-        _13hw_data + hw,         // G channel
-        _13hw_data + 2 * hw      // B channel
-    };
-
-    for (size_t row = 0; row < height; ++row) {
-        const size_t row_offset = row * width;
-        const float* src_row = _1hw3_data + row_offset * 3;
-        for (size_t col = 0; col < width; ++col) {
-            const size_t dst_offset = row_offset + col;
-            const size_t src_offset = col * 3;
-            dst_channels[0][dst_offset] = src_row[src_offset];     // R
-            dst_channels[1][dst_offset] = src_row[src_offset + 1]; // G
-            dst_channels[2][dst_offset] = src_row[src_offset + 2]; // B
-        }
-    }
-    return _13hw;
+    });
 }
 
 // Reimplementation of Python im.reshape(1, 3, h//336, 336, w//336, 336).permute(0,2,4,1,3,5).reshape(-1, 3, 336, 336)
@@ -304,11 +263,12 @@ std::tuple<ov::Tensor, ImageSize> get_pixel_values_phi3_v(const ov::Tensor& imag
     clip_image_u8 img{int(hd_image.get_shape().at(2)), int(hd_image.get_shape().at(1)), {hd_image.data<uint8_t>(), hd_image.data<uint8_t>() + hd_image.get_size()}};
     clip_image_u8 dst;
     bicubic_resize_phi3(img, dst, INPUT_IMAGE_SIZE, INPUT_IMAGE_SIZE);
-    ov::Tensor global_image{ov::element::u8, {1, INPUT_IMAGE_SIZE, INPUT_IMAGE_SIZE, 3}, dst.buf.data()};
-    global_image = mean_scale(global_image, config);
-    hd_image = mean_scale(hd_image, config);
-    global_image = channels_first(global_image);
-    hd_image = channels_first(hd_image);
+    clip_ctx ctx;
+    std::copy(config.image_mean.begin(), config.image_mean.end(), ctx.image_mean);
+    std::copy(config.image_std.begin(), config.image_std.end(), ctx.image_std);
+    // normalizes and converts to channels first layout in a single pass
+    ov::Tensor global_image = clip_image_f32_to_tensor(clip_image_preprocess(ctx, dst));
+    hd_image = clip_image_f32_to_tensor(clip_image_preprocess(ctx, img));
     ov::Tensor slices = slice_image(hd_image);
     ov::Tensor concatenated = concatenate_batch(global_image, slices);
     ov::Tensor pixel_values = pad_to_max_num_crops_tensor(concatenated, config.phi3_v.num_crops);
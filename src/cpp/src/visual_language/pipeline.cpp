@@ -17,6 +17,7 @@
 #include "visual_language/pipeline_base.hpp"
 #include "visual_language/continuous_batching_adapter.hpp"
 
+#include "visual_language/vision_embeddings_cache.hpp"
 #include "visual_language/vision_registry.hpp"
 #include "visual_language/vlm_chat_context.hpp"
 
@@ -226,8 +227,8 @@ public:
         m_inputs_embedder->set_vision_token_pruning_config(generation_config.pruning_ratio,
                                                            generation_config.relevance_weight);
 
-        auto encoded_images = m_inputs_embedder->encode_images(images);
-        const auto encoded_videos = m_inputs_embedder->encode_videos(videos);
+        auto encoded_images = m_inputs_embedder->encode_images(images, perf_metrics);
+        const auto encoded_videos = m_inputs_embedder->encode_videos(videos, perf_metrics);
         auto [unified_prompt, image_sequence, video_sequence] = m_inputs_embedder->normalize_prompt(prompt, m_image_id, m_video_id, encoded_images, encoded_videos);
 
         if (m_is_chat_conversation) {
@@ -320,6 +321,8 @@ public:
             perf_metrics.vlm_raw_metrics.prepare_embeddings_durations.begin(),
             perf_metrics.vlm_raw_metrics.prepare_embeddings_durations.end()
         );
+        decoded.perf_metrics.vlm_raw_metrics.vision_cache_hits += perf_metrics.vlm_raw_metrics.vision_cache_hits;
+        decoded.perf_metrics.vlm_raw_metrics.vision_cache_misses += perf_metrics.vlm_raw_metrics.vision_cache_misses;
 
         // Evaluate statistics
         decoded.perf_metrics.m_evaluated = false;
@@ -360,7 +363,7 @@ public:
 
         VLMChatContext chat_context(history, m_vision_registry, *m_inputs_embedder);
 
-        auto processed_chat_data = chat_context.process(images, videos);
+        auto processed_chat_data = chat_context.process(images, videos, perf_metrics);
 
         bool use_full_history = processed_chat_data.needs_kv_cache_reset || m_use_full_chat_history;
 
@@ -437,6 +440,8 @@ public:
             perf_metrics.vlm_raw_metrics.prepare_embeddings_durations.begin(),
             perf_metrics.vlm_raw_metrics.prepare_embeddings_durations.end()
         );
+        decoded.perf_metrics.vlm_raw_metrics.vision_cache_hits += perf_metrics.vlm_raw_metrics.vision_cache_hits;
+        decoded.perf_metrics.vlm_raw_metrics.vision_cache_misses += perf_metrics.vlm_raw_metrics.vision_cache_misses;
 
         // Evaluate statistics
         decoded.perf_metrics.m_evaluated = false;
@@ -633,6 +638,7 @@ VLMPipeline::VLMPipeline(
     auto start_time = std::chrono::steady_clock::now();
 
     auto [properties, attention_backend] = utils::extract_attention_backend(user_properties);
+    VisionEmbeddingsCache::configure(properties);
     if (device == "NPU") {
         auto it = properties.find("scheduler_config");
         OPENVINO_ASSERT(it == properties.end(), "scheduler_config should be removed for VLMPipeline initialization");
@@ -676,6 +682,7 @@ VLMPipeline::VLMPipeline(
     auto start_time = std::chrono::steady_clock::now();
 
     auto [properties, attention_backend] = utils::extract_attention_backend(user_properties);
+    VisionEmbeddingsCache::configure(properties);
     if (device == "NPU") {
         auto it = properties.find("scheduler_config");
         OPENVINO_ASSERT(it == properties.end(), "scheduler_config should be removed for VLMPipeline initialization");
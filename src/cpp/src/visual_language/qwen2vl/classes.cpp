@@ -717,19 +717,13 @@ void VisionEncoderQwen2VL::encode_with_imagepreprocess_cpp(const std::vector<ov:
         const auto& image = images.size() > i ? images[i] : images[0];
 
         clip_image_u8 input_image = tensor_to_clip_image_u8(image);
-        clip_image_u8 resized_image;
-        bicubic_resize(input_image, resized_image, target_image_size.width, target_image_size.height);
 
         clip_ctx ctx;
         std::copy(config.image_mean.begin(), config.image_mean.end(), ctx.image_mean);
         std::copy(config.image_std.begin(), config.image_std.end(), ctx.image_std);
-        clip_image_f32 normalized_image = clip_image_preprocess(ctx, resized_image);
+        clip_image_f32 normalized_image = bicubic_resize_and_preprocess(ctx, input_image, target_image_size.width, target_image_size.height);
 
-        auto patch = clip_image_f32_to_tensor(normalized_image);
-
-        std::memcpy(tiled_patches.data<float>() + i * patch.get_byte_size() / sizeof(float),
-                    patch.data<float>(),
-                    patch.get_byte_size());
+        std::copy(normalized_image.buf.begin(), normalized_image.buf.end(), tiled_patches.data<float>() + i * normalized_image.buf.size());
     }
     auto patches = std::move(tiled_patches);
 
@@ -1166,6 +1160,7 @@ ov::Tensor InputsEmbedderQwen2VL::get_inputs_embeds(const std::string& unified_p
             merged_embeddings = pruning_result->pruned_embeddings;
             input_ids = pruning_result->pruned_input_ids;
             text_embeds = pruning_result->pruned_text_embeds;
+            metrics.vlm_raw_metrics.pruned_vision_tokens += pruning_result->original_visual_tokens - pruning_result->pruned_visual_tokens;
 
             if (pruning_result->updated_rope_delta.has_value()) {
                 m_rope_delta = pruning_result->updated_rope_delta.value();
@@ -1203,13 +1198,11 @@ std::vector<ov::genai::EncodedVideo> InputsEmbedderQwen2VL::encode_videos(const
 }
 
 std::vector<ov::genai::EncodedImage> InputsEmbedderQwen2VL::encode_images(const std::vector<ov::Tensor>& images) {
-    std::vector<EncodedImage> embeds;
     std::vector<ov::Tensor> single_images = to_single_image_tensors(images);
     for (ov::Tensor& image : single_images) {
         cvt_to_3_chn_image(image);
-        embeds.emplace_back(m_vision_encoder->encode(image));
     }
-    return embeds;
+    return m_vision_encoder->encode_batch(single_images);
 }
 
 void InputsEmbedderQwen2VL::cvt_to_3_chn_image(ov::Tensor& image) {
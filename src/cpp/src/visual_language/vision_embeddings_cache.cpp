@@ -0,0 +1,259 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "visual_language/vision_embeddings_cache.hpp"
+
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#include "block_hasher.hpp"
+#include "openvino/core/except.hpp"
+#include "openvino/genai/visual_language/pipeline.hpp"
+#include "utils.hpp"
+
+namespace ov::genai {
+
+namespace {
+
+constexpr size_t BYTES_IN_MB = 1024 * 1024;
+
+// 128-bit hash of the whole content. Unlike VisionRegistry::compute_hash() nothing is sampled, since a collision
+// would silently substitute embeddings of one image with another across unrelated requests.
+class ContentHasher {
+public:
+    void update(const void* data, size_t byte_size) {
+        m_hasher.update_bytes(data, byte_size);
+    }
+
+    void update(const std::string& str) {
+        update(str.data(), str.size());
+    }
+
+    std::string hex_digest() const {
+        const BlockHash hash = m_hasher.get_hash();
+        std::ostringstream stream;
+        stream << std::hex << std::setfill('0') << std::setw(16) << hash.low << std::setw(16) << hash.high;
+        return stream.str();
+    }
+
+private:
+    BlockHasher m_hasher;
+};
+
+std::string read_file_if_exists(const std::filesystem::path& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        return {};
+    }
+    std::ostringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+size_t get_byte_size(const ov::Tensor& tensor) {
+    return tensor ? tensor.get_byte_size() : 0;
+}
+
+size_t get_byte_size(const EncodedImage& image) {
+    size_t byte_size = get_byte_size(image.resized_source) + get_byte_size(image.images_features_projection) +
+                       get_byte_size(image.resampled_image.resampled_source);
+    for (const auto& slice_row : image.resampled_image.vision_embed_tensors) {
+        for (const ov::Tensor& tensor : slice_row) {
+            byte_size += get_byte_size(tensor);
+        }
+    }
+    return byte_size + sizeof(EncodedImage);
+}
+
+size_t get_byte_size(const EncodedVideo& video) {
+    return get_byte_size(video.video_features) + sizeof(EncodedVideo);
+}
+
+ov::Tensor deep_copy(const ov::Tensor& tensor) {
+    if (!tensor) {
+        return tensor;
+    }
+    ov::Tensor copy(tensor.get_element_type(), tensor.get_shape());
+    tensor.copy_to(copy);
+    return copy;
+}
+
+// callers own returned encodings and may modify them, so they never share memory with cached entries
+EncodedImage deep_copy(const EncodedImage& image) {
+    EncodedImage copy = image;
+    copy.resized_source = deep_copy(image.resized_source);
+    copy.images_features_projection = deep_copy(image.images_features_projection);
+    copy.resampled_image.resampled_source = deep_copy(image.resampled_image.resampled_source);
+    for (auto& slice_row : copy.resampled_image.vision_embed_tensors) {
+        for (ov::Tensor& tensor : slice_row) {
+            tensor = deep_copy(tensor);
+        }
+    }
+    return copy;
+}
+
+EncodedVideo deep_copy(const EncodedVideo& video) {
+    EncodedVideo copy = video;
+    copy.video_features = deep_copy(video.video_features);
+    return copy;
+}
+
+}  // namespace
+
+VisionEmbeddingsCache::VisionEmbeddingsCache(size_t capacity_bytes) : m_capacity_bytes(capacity_bytes) {}
+
+VisionEmbeddingsCache& VisionEmbeddingsCache::instance() {
+    static VisionEmbeddingsCache cache(DEFAULT_CAPACITY_MB * BYTES_IN_MB);
+    return cache;
+}
+
+void VisionEmbeddingsCache::configure(ov::AnyMap& properties) {
+    if (auto size_mb = utils::pop_option(properties, ov::genai::vision_embeddings_cache_size.name())) {
+        instance().set_capacity(size_mb->as<size_t>() * BYTES_IN_MB);
+    }
+}
+
+std::string VisionEmbeddingsCache::make_model_key(const std::string& model_id,
+                                                  const std::filesystem::path& config_dir_path,
+                                                  const VLMConfig& vlm_config,
+                                                  const std::string& device,
+                                                  const ov::AnyMap& properties) {
+    ContentHasher hasher;
+    hasher.update(model_id);
+    hasher.update(device);
+    // properties such as inference precision affect produced embeddings
+    for (const auto& [name, value] : properties) {
+        hasher.update(name);
+        try {
+            hasher.update(value.as<std::string>());
+        } catch (const ov::Exception&) {
+            // not printable property, e.g. a remote context
+        }
+    }
+    const auto model_type = static_cast<uint64_t>(vlm_config.model_type);
+    hasher.update(&model_type, sizeof(model_type));
+    // preprocessing implementation and parameters define encoder inputs
+    const char* vision_preprocess = std::getenv("VISION_PREPROCESS");
+    hasher.update(vision_preprocess ? vision_preprocess : "");
+    hasher.update(read_file_if_exists(config_dir_path / "config.json"));
+    hasher.update(read_file_if_exists(config_dir_path / "preprocessor_config.json"));
+    return hasher.hex_digest();
+}
+
+std::string VisionEmbeddingsCache::make_key(const std::string& model_key, VisionType type, const ov::Tensor& vision) {
+    ContentHasher hasher;
+    const ov::Shape& shape = vision.get_shape();
+    hasher.update(shape.data(), shape.size() * sizeof(ov::Shape::value_type));
+    const uint64_t element_type = vision.get_element_type().hash();
+    hasher.update(&element_type, sizeof(element_type));
+    hasher.update(vision.data(), vision.get_byte_size());
+    return model_key + (type == VisionType::IMAGE ? ":image:" : ":video:") + hasher.hex_digest();
+}
+
+EncodedImage VisionEmbeddingsCache::get_or_encode_image(const std::string& key, const std::function<EncodedImage()>& encode, bool& hit) {
+    return deep_copy(std::get<EncodedImage>(*get_or_encode(key, [&encode]() { return Value{encode()}; }, hit)));
+}
+
+EncodedVideo VisionEmbeddingsCache::get_or_encode_video(const std::string& key, const std::function<EncodedVideo()>& encode, bool& hit) {
+    return deep_copy(std::get<EncodedVideo>(*get_or_encode(key, [&encode]() { return Value{encode()}; }, hit)));
+}
+
+VisionEmbeddingsCache::ValuePtr VisionEmbeddingsCache::get_or_encode(const std::string& key, const std::function<Value()>& encode, bool& hit) {
+    std::promise<ValuePtr> promise;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (m_capacity_bytes == 0) {
+            lock.unlock();
+            hit = false;
+            return std::make_shared<const Value>(encode());
+        }
+
+        auto it = m_entries.find(key);
+        if (it != m_entries.end()) {
+            if (it->second.ready) {
+                m_lru.splice(m_lru.begin(), m_lru, it->second.lru_it);
+            }
+            std::shared_future<ValuePtr> value = it->second.value;
+            lock.unlock();
+            hit = true;
+            // waits for encoding started by another caller, rethrows its exception if it failed
+            return value.get();
+        }
+
+        Entry entry;
+        entry.value = promise.get_future().share();
+        m_entries.emplace(key, std::move(entry));
+    }
+
+    hit = false;
+    ValuePtr value;
+    try {
+        value = std::make_shared<const Value>(encode());
+    } catch (...) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_entries.erase(key);
+        }
+        promise.set_exception(std::current_exception());
+        throw;
+    }
+    promise.set_value(value);
+
+    const size_t byte_size = std::visit([](const auto& encoded) { return get_byte_size(encoded); }, *value);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_entries.find(key);
+    if (byte_size > m_capacity_bytes) {
+        m_entries.erase(it);
+        return value;
+    }
+    it->second.ready = true;
+    it->second.byte_size = byte_size;
+    it->second.lru_it = m_lru.insert(m_lru.begin(), key);
+    m_memory_usage += byte_size;
+    evict_if_needed();
+    return value;
+}
+
+void VisionEmbeddingsCache::evict_if_needed() {
+    while (m_memory_usage > m_capacity_bytes && !m_lru.empty()) {
+        auto it = m_entries.find(m_lru.back());
+        m_memory_usage -= it->second.byte_size;
+        m_entries.erase(it);
+        m_lru.pop_back();
+    }
+}
+
+void VisionEmbeddingsCache::set_capacity(size_t capacity_bytes) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_capacity_bytes = capacity_bytes;
+    evict_if_needed();
+}
+
+size_t VisionEmbeddingsCache::get_capacity() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_capacity_bytes;
+}
+
+size_t VisionEmbeddingsCache::size() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_lru.size();
+}
+
+size_t VisionEmbeddingsCache::get_memory_usage() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_memory_usage;
+}
+
+void VisionEmbeddingsCache::clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    // pending entries are kept, their owners complete them
+    for (const std::string& key : m_lru) {
+        m_entries.erase(key);
+    }
+    m_lru.clear();
+    m_memory_usage = 0;
+}
+
+}  // namespace ov::genai
@@ -0,0 +1,87 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <functional>
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <variant>
+
+#include "visual_language/vision_encoder.hpp"
+
+namespace ov::genai {
+
+/**
+ * Process-wide memory bounded LRU cache of encoded images and videos shared by all VLM pipelines,
+ * chat sessions and continuous batching requests.
+ * Entries are addressed by full content hash of a source image or video plus a key of the model and
+ * preprocessing configuration it was encoded with, so the same content is encoded once per model.
+ * Concurrent misses on the same key are coalesced: the first caller encodes, the others wait for its result.
+ * Returned encodings are deep copies, so callers may modify them without affecting cached entries.
+ * Caching is disabled by default, ov::genai::vision_embeddings_cache_size pipeline property enables it.
+ */
+class VisionEmbeddingsCache {
+public:
+    static constexpr size_t DEFAULT_CAPACITY_MB = 0;
+
+    explicit VisionEmbeddingsCache(size_t capacity_bytes);
+
+    static VisionEmbeddingsCache& instance();
+
+    // Pops ov::genai::vision_embeddings_cache_size from pipeline properties and applies it to the process-wide cache
+    static void configure(ov::AnyMap& properties);
+
+    // Identifies a model and preprocessing configuration; model_id is a models directory or in-memory model identity
+    static std::string make_model_key(const std::string& model_id,
+                                      const std::filesystem::path& config_dir_path,
+                                      const VLMConfig& vlm_config,
+                                      const std::string& device,
+                                      const ov::AnyMap& properties);
+
+    static std::string make_key(const std::string& model_key, VisionType type, const ov::Tensor& vision);
+
+    // Returns cached encoding of 'key' or calls 'encode' to compute it. 'hit' is set if encoding was reused
+    EncodedImage get_or_encode_image(const std::string& key, const std::function<EncodedImage()>& encode, bool& hit);
+
+    EncodedVideo get_or_encode_video(const std::string& key, const std::function<EncodedVideo()>& encode, bool& hit);
+
+    void set_capacity(size_t capacity_bytes);
+
+    size_t get_capacity() const;
+
+    // Number of ready entries
+    size_t size() const;
+
+    // Total byte size of tensors of ready entries
+    size_t get_memory_usage() const;
+
+    void clear();
+
+private:
+    using Value = std::variant<EncodedImage, EncodedVideo>;
+    using ValuePtr = std::shared_ptr<const Value>;
+
+    struct Entry {
+        std::shared_future<ValuePtr> value;
+        size_t byte_size = 0;
+        bool ready = false;
+        std::list<std::string>::iterator lru_it;  // valid only for ready entries
+    };
+
+    ValuePtr get_or_encode(const std::string& key, const std::function<Value()>& encode, bool& hit);
+
+    void evict_if_needed();
+
+    size_t m_capacity_bytes;
+    size_t m_memory_usage = 0;
+    std::list<std::string> m_lru;  // keys of ready entries, most recently used go first
+    std::unordered_map<std::string, Entry> m_entries;
+    mutable std::mutex m_mutex;
+};
+
+}  // namespace ov::genai
@@ -2,6 +2,10 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "vision_encoder.hpp"
+
+#include <atomic>
+#include <future>
+
 #include "utils.hpp"
 
 
@@ -47,10 +51,64 @@ VisionEncoder::VisionEncoder(
     m_processor_config = utils::from_config_json_if_exists<ProcessorConfig>(config_dir_path, "preprocessor_config.json");
 }
 
+void run_concurrently(size_t count, size_t num_workers, const std::function<void(size_t)>& fn) {
+    num_workers = std::min(count, num_workers);
+    if (num_workers <= 1) {
+        for (size_t i = 0; i < count; ++i) {
+            fn(i);
+        }
+        return;
+    }
+
+    std::atomic<size_t> next_item{0};
+    auto worker = [&]() {
+        for (size_t i = next_item++; i < count; i = next_item++) {
+            fn(i);
+        }
+    };
+    std::vector<std::future<void>> workers;
+    workers.reserve(num_workers - 1);
+    for (size_t i = 1; i < num_workers; ++i) {
+        workers.push_back(std::async(std::launch::async, worker));
+    }
+    std::exception_ptr error;
+    try {
+        worker();
+    } catch (...) {
+        error = std::current_exception();
+    }
+    // all workers must finish before rethrowing since they reference local state
+    for (auto& future : workers) {
+        try {
+            future.get();
+        } catch (...) {
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+std::vector<EncodedImage> VisionEncoder::encode_batch(const std::vector<ov::Tensor>& images, const ov::AnyMap& config_map) {
+    std::vector<EncodedImage> encoded_images(images.size());
+    // encode() blocks on the infer requests queue, so more workers than requests would only wait
+    run_concurrently(images.size(), m_ireq_queue_vision_encoder->size(), [&](size_t i) {
+        encoded_images[i] = encode(images[i], config_map);
+    });
+    return encoded_images;
+}
+
 ProcessorConfig VisionEncoder::get_processor_config() const {
     return m_processor_config;
 }
 
+size_t VisionEncoder::get_num_infer_requests() const {
+    return m_ireq_queue_vision_encoder->size();
+}
+
 VisionEncoder::Ptr VisionEncoder::create(const std::filesystem::path& model_dir, const VLMModelType model_type, const std::string& device, const ov::AnyMap properties) {
     if (model_type == VLMModelType::MINICPM) {
         return std::make_shared<VisionEncoderMiniCPM>(model_dir, device, properties);
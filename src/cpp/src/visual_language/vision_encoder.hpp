@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #pragma once
+#include <functional>
 #include <memory>
 #include "openvino/runtime/infer_request.hpp"
 
@@ -126,6 +127,16 @@ public:
     /// its slices.
     virtual EncodedImage encode(const ov::Tensor& image, const ov::AnyMap& config_map = {}) = 0;
 
+    /// @brief Compute embeddings of multiple images. Images are encoded
+    /// concurrently using idle infer requests of the pool, so a multi-image
+    /// prompt keeps all of them busy instead of a single one.
+    /// @param images Images to infer embeddings for, each of them must
+    /// satisfy encode() requirements.
+    /// @param config_map A config or its members values to follow
+    /// instead of the config obtained in constructors.
+    /// @return Resulting embeddings in the order of images.
+    std::vector<EncodedImage> encode_batch(const std::vector<ov::Tensor>& images, const ov::AnyMap& config_map = {});
+
     /// @brief Compute embeddings of a or multiple video given
     virtual EncodedVideo encode_frames(const std::vector<ov::Tensor>& frames, const ov::AnyMap& config_map = {}) {
         OPENVINO_THROW("The current model does not support 'video' input, please use 'images' instead.");
@@ -135,6 +146,10 @@ public:
     /// @return Processor config
     ProcessorConfig get_processor_config() const;
 
+    /// @brief Gets number of infer requests in the pool
+    /// @return Number of images which can be encoded concurrently
+    size_t get_num_infer_requests() const;
+
 protected:
     /// @brief  Infer requests queue for image encoding model.
     std::unique_ptr<CircularBufferQueue<ov::InferRequest>> m_ireq_queue_vision_encoder;
@@ -155,4 +170,9 @@ public:
         const ov::AnyMap properties);
 };
 
+/// @brief Calls fn for every index in [0, count) using up to num_workers
+/// threads including the calling one. The first thrown exception is
+/// rethrown after all workers finish.
+void run_concurrently(size_t count, size_t num_workers, const std::function<void(size_t)>& fn);
+
 } // namespace ov::genai
@@ -23,7 +23,8 @@ VLMChatContext::VLMChatContext(
 
 VLMChatContext::ProcessedChatData VLMChatContext::process(
     const std::vector<ov::Tensor>& new_images,
-    const std::vector<ov::Tensor>& new_videos
+    const std::vector<ov::Tensor>& new_videos,
+    VLMPerfMetrics& metrics
 ) {
     ProcessedChatData result;
     
@@ -37,7 +38,7 @@ VLMChatContext::ProcessedChatData VLMChatContext::process(
     std::vector<size_t> new_image_indices = m_history_state->register_images(new_images);
     std::vector<size_t> new_video_indices = m_history_state->register_videos(new_videos);
     
-    encode_visions_if_needed(new_image_indices, new_video_indices);
+    encode_visions_if_needed(new_image_indices, new_video_indices, metrics);
     
     fill_messages_metadata(matching_history_length, new_image_indices, new_video_indices);
     
@@ -77,13 +78,14 @@ void VLMChatContext::rollback() {
 
 void VLMChatContext::encode_visions_if_needed(
     const std::vector<size_t>& image_indices,
-    const std::vector<size_t>& video_indices
+    const std::vector<size_t>& video_indices,
+    VLMPerfMetrics& metrics
 ) {
     for (size_t idx : image_indices) {
         VisionID id = m_history_state->get_image_vision_id(idx);
         if (!m_vision_registry->has_encoded_image(id)) {
             const ov::Tensor& original = m_vision_registry->get_original(id);
-            const auto encoded = m_inputs_embedder.encode_images({original});
+            const auto encoded = m_inputs_embedder.encode_images({original}, metrics);
             m_vision_registry->set_encoded_image(id, std::move(encoded[0]));
         }
     }
@@ -92,7 +94,7 @@ void VLMChatContext::encode_visions_if_needed(
         VisionID id = m_history_state->get_video_vision_id(idx);
         if (!m_vision_registry->has_encoded_video(id)) {
             const ov::Tensor& original = m_vision_registry->get_original(id);
-            const auto encoded = m_inputs_embedder.encode_videos({original});
+            const auto encoded = m_inputs_embedder.encode_videos({original}, metrics);
             m_vision_registry->set_encoded_video(id, std::move(encoded[0]));
         }
     }
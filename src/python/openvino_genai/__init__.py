@@ -121,6 +121,7 @@ from .py_openvino_genai import (
     SparseAttentionConfig,
     KVCrushAnchorPointMode,
     KVCrushConfig,
+    get_prefix_block_hashes,
 )
 
 # RAG
@@ -5,7 +5,7 @@ from __future__ import annotations
 import collections.abc
 import openvino._pyopenvino
 import typing
-__all__: list[str] = ['Adapter', 'AdapterConfig', 'AdaptiveRKVConfig', 'AggregationMode', 'AutoencoderKL', 'AutoencoderKLLTXVideo', 'CLIPTextModel', 'CLIPTextModelWithProjection', 'CacheEvictionConfig', 'ChatHistory', 'ContinuousBatchingPipeline', 'CppStdGenerator', 'DecodedResults', 'DeepSeekR1ReasoningIncrementalParser', 'DeepSeekR1ReasoningParser', 'EncodedGenerationResult', 'EncodedResults', 'ExtendedPerfMetrics', 'FluxTransformer2DModel', 'GenerationConfig', 'GenerationFinishReason', 'GenerationHandle', 'GenerationOutput', 'GenerationResult', 'GenerationStatus', 'Generator', 'Image2ImagePipeline', 'ImageGenerationConfig', 'ImageGenerationPerfMetrics', 'IncrementalParser', 'InpaintingPipeline', 'KVCrushAnchorPointMode', 'KVCrushConfig', 'LLMPipeline', 'LTXVideoTransformer3DModel', 'Llama3JsonToolParser', 'Llama3PythonicToolParser', 'MeanStdPair', 'Parser', 'PerfMetrics', 'Phi4ReasoningIncrementalParser', 'Phi4ReasoningParser', 'PipelineMetrics', 'RawImageGenerationPerfMetrics', 'RawPerfMetrics', 'ReasoningIncrementalParser', 'ReasoningParser', 'SD3Transformer2DModel', 'SDPerModelsPerfMetrics', 'SDPerfMetrics', 'Scheduler', 'SchedulerConfig', 'SparseAttentionConfig', 'SparseAttentionMode', 'SpeechGenerationConfig', 'SpeechGenerationPerfMetrics', 'StopCriteria', 'StreamerBase', 'StreamingStatus', 'StructuralTagItem', 'StructuralTagsConfig', 'StructuredOutputConfig', 'SummaryStats', 'T5EncoderModel', 'Text2ImagePipeline', 'Text2SpeechDecodedResults', 'Text2SpeechPipeline', 'Text2VideoPipeline', 'TextEmbeddingPipeline', 'TextParserStreamer', 'TextRerankPipeline', 'TextStreamer', 'TokenizedInputs', 'Tokenizer', 'TorchGenerator', 'UNet2DConditionModel', 'VLLMParserWrapper', 'VLMDecodedResults', 'VLMPerfMetrics', 'VLMPipeline', 'VLMRawPerfMetrics', 'VideoGenerationConfig', 'VideoGenerationPerfMetrics', 'VideoGenerationResult', 'WhisperDecodedResultChunk', 'WhisperDecodedResults', 'WhisperGenerationConfig', 'WhisperPerfMetrics', 'WhisperPipeline', 'WhisperRawPerfMetrics', 'WhisperWordTiming', 'draft_model', 'get_version']
+__all__: list[str] = ['Adapter', 'AdapterConfig', 'AdaptiveRKVConfig', 'AggregationMode', 'AutoencoderKL', 'AutoencoderKLLTXVideo', 'CLIPTextModel', 'CLIPTextModelWithProjection', 'CacheEvictionConfig', 'ChatHistory', 'ContinuousBatchingPipeline', 'CppStdGenerator', 'DecodedResults', 'DeepSeekR1ReasoningIncrementalParser', 'DeepSeekR1ReasoningParser', 'EncodedGenerationResult', 'EncodedResults', 'ExtendedPerfMetrics', 'FluxTransformer2DModel', 'GenerationConfig', 'GenerationFinishReason', 'GenerationHandle', 'GenerationOutput', 'GenerationResult', 'GenerationStatus', 'Generator', 'Image2ImagePipeline', 'ImageGenerationConfig', 'ImageGenerationPerfMetrics', 'IncrementalParser', 'InpaintingPipeline', 'KVCrushAnchorPointMode', 'KVCrushConfig', 'LLMPipeline', 'LTXVideoTransformer3DModel', 'Llama3JsonToolParser', 'Llama3PythonicToolParser', 'MeanStdPair', 'MetricHistogram', 'Parser', 'PerfMetrics', 'Phi4ReasoningIncrementalParser', 'Phi4ReasoningParser', 'PipelineMetrics', 'RawImageGenerationPerfMetrics', 'RawPerfMetrics', 'ReasoningIncrementalParser', 'ReasoningParser', 'SD3Transformer2DModel', 'SDPerModelsPerfMetrics', 'SDPerfMetrics', 'Scheduler', 'SchedulerConfig', 'SparseAttentionConfig', 'SparseAttentionMode', 'SpeechGenerationConfig', 'SpeechGenerationPerfMetrics', 'StopCriteria', 'StreamerBase', 'StreamingStatus', 'StructuralTagItem', 'StructuralTagsConfig', 'StructuredOutputConfig', 'SummaryStats', 'T5EncoderModel', 'Text2ImagePipeline', 'Text2SpeechDecodedResults', 'Text2SpeechPipeline', 'Text2VideoPipeline', 'TextEmbeddingPipeline', 'TextParserStreamer', 'TextRerankPipeline', 'TextStreamer', 'TokenizedInputs', 'Tokenizer', 'TorchGenerator', 'UNet2DConditionModel', 'VLLMParserWrapper', 'VLMDecodedResults', 'VLMPerfMetrics', 'VLMPipeline', 'VLMRawPerfMetrics', 'VideoGenerationConfig', 'VideoGenerationPerfMetrics', 'VideoGenerationResult', 'WhisperDecodedResultChunk', 'WhisperDecodedResults', 'WhisperGenerationConfig', 'WhisperPerfMetrics', 'WhisperPipeline', 'WhisperRawPerfMetrics', 'WhisperWordTiming', 'draft_model', 'get_prefix_block_hashes', 'get_version']
 class Adapter:
     """
     Immutable LoRA Adapter that carries the adaptation matrices and serves as unique adapter identifier.
@@ -422,12 +422,16 @@ class CLIPTextModel:
         ...
     def get_output_tensor(self, idx: typing.SupportsInt) -> openvino._pyopenvino.Tensor:
         ...
+    def is_last_infer_cached(self) -> bool:
+        ...
     def infer(self, pos_prompt: str, neg_prompt: str, do_classifier_free_guidance: bool) -> openvino._pyopenvino.Tensor:
         ...
     def reshape(self, batch_size: typing.SupportsInt) -> CLIPTextModel:
         ...
     def set_adapters(self, adapters: openvino_genai.py_openvino_genai.AdapterConfig | None) -> None:
         ...
+    def set_embeddings_cache_size(self, size: typing.SupportsInt) -> None:
+        ...
 class CLIPTextModelWithProjection(CLIPTextModel):
     """
     CLIPTextModelWithProjection class.
@@ -638,8 +642,16 @@ class ContinuousBatchingPipeline:
         ...
     def start_chat(self, system_message: str = '') -> None:
         ...
+    def start_tracing(self, output_path: os.PathLike | str | bytes) -> None:
+        """
+        Starts recording a timeline of steps, scheduling decisions and requests of all continuous batching pipelines in the process. The trace is written to output_path by stop_tracing() in Chrome trace event JSON format.
+        """
     def step(self) -> None:
         ...
+    def stop_tracing(self) -> None:
+        """
+        Stops recording started by start_tracing() or OPENVINO_GENAI_TRACE_FILE environment variable and writes the trace.
+        """
 class CppStdGenerator(Generator):
     """
     This class wraps std::mt19937 pseudo-random generator.
@@ -1409,7 +1421,12 @@ class Image2ImagePipeline:
             generator: openvino_genai.TorchGenerator, openvino_genai.CppStdGenerator or class inherited from openvino_genai.Generator - random generator,
             adapters: LoRA adapters,
             strength: strength for image to image generation. 1.0f means initial image is fully noised,
-            max_sequence_length: int - length of t5_encoder_model input
+            max_sequence_length: int - length of t5_encoder_model input,
+            step_cache_threshold: float - accumulated relative change of denoiser input below which denoiser output is reused,
+            step_cache_interval: int - denoiser is inferred only on every N-th step,
+            vae_tile_size: int - tile size in pixels for tiled VAE decoding, 0 disables tiling,
+            vae_tile_overlap: int - overlap of neighbour tiles in pixels for tiled VAE decoding,
+            text_embeddings_cache_size: int - number of prompts whose text encoder outputs are cached, 0 disables caching
         
             :return: ov.Tensor with resulting images
             :rtype: ov.Tensor
@@ -1478,12 +1495,42 @@ class ImageGenerationConfig:
     def rng_seed(self, arg0: typing.SupportsInt) -> None:
         ...
     @property
+    def step_cache_interval(self) -> int:
+        ...
+    @step_cache_interval.setter
+    def step_cache_interval(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
+    def step_cache_threshold(self) -> float:
+        ...
+    @step_cache_threshold.setter
+    def step_cache_threshold(self, arg0: typing.SupportsFloat) -> None:
+        ...
+    @property
     def strength(self) -> float:
         ...
     @strength.setter
     def strength(self, arg0: typing.SupportsFloat) -> None:
         ...
     @property
+    def text_embeddings_cache_size(self) -> int:
+        ...
+    @text_embeddings_cache_size.setter
+    def text_embeddings_cache_size(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
+    def vae_tile_overlap(self) -> int:
+        ...
+    @vae_tile_overlap.setter
+    def vae_tile_overlap(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
+    def vae_tile_size(self) -> int:
+        ...
+    @vae_tile_size.setter
+    def vae_tile_size(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
     def width(self) -> int:
         ...
     @width.setter
@@ -1545,6 +1592,12 @@ class ImageGenerationPerfMetrics:
         :param get_transformer_infer_duration: Returns the mean and standard deviation of one transformer inference in milliseconds.
         :type get_transformer_infer_duration: MeanStdPair
     
+        :param get_num_cached_steps: Returns the number of denoising steps where cached unet / transformer output was reused.
+        :type get_num_cached_steps: int
+    
+        :param get_text_embeddings_cache_hits: Returns the number of text encoder inferences served from text embeddings cache.
+        :type get_text_embeddings_cache_hits: int
+    
         :param raw_metrics: A structure of RawImageGenerationPerfMetrics type that holds raw metrics.
         :type raw_metrics: RawImageGenerationPerfMetrics
     """
@@ -1564,6 +1617,10 @@ class ImageGenerationPerfMetrics:
         ...
     def get_load_time(self) -> float:
         ...
+    def get_num_cached_steps(self) -> int:
+        ...
+    def get_text_embeddings_cache_hits(self) -> int:
+        ...
     def get_text_encoder_infer_duration(self) -> dict[str, float]:
         ...
     def get_transformer_infer_duration(self) -> MeanStdPair:
@@ -1675,7 +1732,12 @@ class InpaintingPipeline:
             generator: openvino_genai.TorchGenerator, openvino_genai.CppStdGenerator or class inherited from openvino_genai.Generator - random generator,
             adapters: LoRA adapters,
             strength: strength for image to image generation. 1.0f means initial image is fully noised,
-            max_sequence_length: int - length of t5_encoder_model input
+            max_sequence_length: int - length of t5_encoder_model input,
+            step_cache_threshold: float - accumulated relative change of denoiser input below which denoiser output is reused,
+            step_cache_interval: int - denoiser is inferred only on every N-th step,
+            vae_tile_size: int - tile size in pixels for tiled VAE decoding, 0 disables tiling,
+            vae_tile_overlap: int - overlap of neighbour tiles in pixels for tiled VAE decoding,
+            text_embeddings_cache_size: int - number of prompts whose text encoder outputs are cached, 0 disables caching
         
             :return: ov.Tensor with resulting images
             :rtype: ov.Tensor
@@ -2032,6 +2094,41 @@ class MeanStdPair:
     @property
     def std(self) -> float:
         ...
+class MetricHistogram:
+    """
+    
+        Snapshot of a histogram with fixed buckets, which is used to report distributions of latencies and sizes in PipelineMetrics.
+    
+        :param upper_bounds: Inclusive upper bounds of buckets in ascending order.
+        :type upper_bounds: list[float]
+    
+        :param counts: Number of observations in each bucket, the last element counts observations above the last bound.
+        :type counts: list[int]
+    
+        :param count: Total number of observations.
+        :type count: int
+    
+        :param sum: Sum of observed values.
+        :type sum: float
+    """
+    def __init__(self) -> None:
+        ...
+    def get_mean(self) -> float:
+        ...
+    def get_quantile(self, quantile: typing.SupportsFloat) -> float:
+        ...
+    @property
+    def count(self) -> int:
+        ...
+    @property
+    def counts(self) -> list[int]:
+        ...
+    @property
+    def sum(self) -> float:
+        ...
+    @property
+    def upper_bounds(self) -> list[float]:
+        ...
 class Parser:
     def __init__(self) -> None:
         ...
@@ -2168,24 +2265,106 @@ class PipelineMetrics:
     
         :param avg_cache_usage: Running average of the KV cache usage (in %) during the lifetime of the pipeline, with max window size of 1000 steps
         :type avg_cache_usage: float
+    
+        :param ttft_ms: Time from adding a request to its first generated token in milliseconds.
+        :type ttft_ms: MetricHistogram
+    
+        :param tpot_ms: Time per output token after the first one in milliseconds.
+        :type tpot_ms: MetricHistogram
+    
+        :param queue_wait_ms: Time from adding a request to its first scheduling in milliseconds.
+        :type queue_wait_ms: MetricHistogram
+    
+        :param prefill_chunk_size: Number of prompt tokens of a request scheduled at a single generation step.
+        :type prefill_chunk_size: MetricHistogram
+    
+        :param batch_size: Number of requests scheduled at a single generation step.
+        :type batch_size: MetricHistogram
+    
+        :param step_duration_ms: Duration of generation steps in milliseconds.
+        :type step_duration_ms: MetricHistogram
+    
+        :param preemptions: Number of times requests were preempted to free KV cache blocks.
+        :type preemptions: int
+    
+        :param recomputed_tokens: Number of processed tokens dropped by preemption, which have to be computed again.
+        :type recomputed_tokens: int
+    
+        :param prefix_cache_hits: Number of prompt KV cache blocks restored from prefix cache.
+        :type prefix_cache_hits: int
+    
+        :param prefix_cache_misses: Number of prompt KV cache blocks which were not found in prefix cache.
+        :type prefix_cache_misses: int
+    
+        :param evicted_tokens: Number of tokens evicted from KV cache by cache eviction algorithm.
+        :type evicted_tokens: int
+    
+        :param draft_tokens: Number of candidate tokens proposed by draft model or prompt lookup in speculative decoding.
+        :type draft_tokens: int
+    
+        :param accepted_draft_tokens: Number of candidate tokens accepted by main model in speculative decoding.
+        :type accepted_draft_tokens: int
     """
     def __init__(self) -> None:
         ...
+    def to_prometheus_text(self, prefix: str = 'openvino_genai') -> str:
+        """
+        Formats metrics in Prometheus text exposition format, latencies are reported in seconds.
+        """
+    @property
+    def accepted_draft_tokens(self) -> int:
+        ...
     @property
     def avg_cache_usage(self) -> float:
         ...
     @property
+    def batch_size(self) -> MetricHistogram:
+        ...
+    @property
     def cache_usage(self) -> float:
         ...
     @property
+    def draft_tokens(self) -> int:
+        ...
+    @property
+    def evicted_tokens(self) -> int:
+        ...
+    @property
     def max_cache_usage(self) -> float:
         ...
     @property
+    def preemptions(self) -> int:
+        ...
+    @property
+    def prefill_chunk_size(self) -> MetricHistogram:
+        ...
+    @property
+    def prefix_cache_hits(self) -> int:
+        ...
+    @property
+    def prefix_cache_misses(self) -> int:
+        ...
+    @property
+    def queue_wait_ms(self) -> MetricHistogram:
+        ...
+    @property
+    def recomputed_tokens(self) -> int:
+        ...
+    @property
     def requests(self) -> int:
         ...
     @property
     def scheduled_requests(self) -> int:
         ...
+    @property
+    def step_duration_ms(self) -> MetricHistogram:
+        ...
+    @property
+    def tpot_ms(self) -> MetricHistogram:
+        ...
+    @property
+    def ttft_ms(self) -> MetricHistogram:
+        ...
 class RawImageGenerationPerfMetrics:
     """
     
@@ -2199,10 +2378,22 @@ class RawImageGenerationPerfMetrics:
     
         :param iteration_durations: Durations for each step iteration in microseconds.
         :type iteration_durations: list[float]
+    
+        :param cached_steps: Indices of denoising steps where cached unet / transformer output was reused.
+        :type cached_steps: list[int]
+    
+        :param cached_text_encoders: Names of text encoders whose outputs were taken from text embeddings cache.
+        :type cached_text_encoders: list[str]
     """
     def __init__(self) -> None:
         ...
     @property
+    def cached_steps(self) -> list[int]:
+        ...
+    @property
+    def cached_text_encoders(self) -> list[str]:
+        ...
+    @property
     def iteration_durations(self) -> list[float]:
         ...
     @property
@@ -2488,6 +2679,9 @@ class SchedulerConfig:
             This results in more RAM usage, maximum RAM usage is determined by cache_size or num_kv_blocks parameters.
             When turned off only KV-cache required for batch calculation is kept in memory and
             when a sequence has finished generation its cache is released.
+        prefix_aware_admission_window: Number of the oldest waiting prompts admitted in order of the number of KV blocks
+            their prefill requires after prefix cache lookup. With prefix caching, a prompt sharing a prefix with
+            a prompt computed at the same step waits for the prefix to be cached. 0 keeps arrival order.
         use_cache_eviction:         Whether to use cache eviction during generation.
         cache_eviction_config       Cache eviction configuration struct.
         use_sparse_attention        Whether to use sparse attention during prefill.
@@ -2527,6 +2721,12 @@ class SchedulerConfig:
     @num_kv_blocks.setter
     def num_kv_blocks(self, arg0: typing.SupportsInt) -> None:
         ...
+    @property
+    def prefix_aware_admission_window(self) -> int:
+        ...
+    @prefix_aware_admission_window.setter
+    def prefix_aware_admission_window(self, arg0: typing.SupportsInt) -> None:
+        ...
 class SparseAttentionConfig:
     """
     
@@ -3244,8 +3444,12 @@ class T5EncoderModel:
         """
     def get_output_tensor(self, idx: typing.SupportsInt) -> openvino._pyopenvino.Tensor:
         ...
+    def is_last_infer_cached(self) -> bool:
+        ...
     def infer(self, pos_prompt: str, neg_prompt: str, do_classifier_free_guidance: bool, max_sequence_length: typing.SupportsInt, **kwargs) -> openvino._pyopenvino.Tensor:
         ...
+    def set_embeddings_cache_size(self, size: typing.SupportsInt) -> None:
+        ...
     def reshape(self, batch_size: typing.SupportsInt, max_sequence_length: typing.SupportsInt) -> T5EncoderModel:
         ...
 class Text2ImagePipeline:
@@ -3342,7 +3546,12 @@ class Text2ImagePipeline:
             generator: openvino_genai.TorchGenerator, openvino_genai.CppStdGenerator or class inherited from openvino_genai.Generator - random generator,
             adapters: LoRA adapters,
             strength: strength for image to image generation. 1.0f means initial image is fully noised,
-            max_sequence_length: int - length of t5_encoder_model input
+            max_sequence_length: int - length of t5_encoder_model input,
+            step_cache_threshold: float - accumulated relative change of denoiser input below which denoiser output is reused,
+            step_cache_interval: int - denoiser is inferred only on every N-th step,
+            vae_tile_size: int - tile size in pixels for tiled VAE decoding, 0 disables tiling,
+            vae_tile_overlap: int - overlap of neighbour tiles in pixels for tiled VAE decoding,
+            text_embeddings_cache_size: int - number of prompts whose text encoder outputs are cached, 0 disables caching
         
             :return: ov.Tensor with resulting images
             :rtype: ov.Tensor
@@ -3954,6 +4163,9 @@ class VLMPerfMetrics(PerfMetrics):
         :param get_prepare_embeddings_duration: Returns mean and standard deviation of embeddings preparation duration in milliseconds
         :type get_prepare_embeddings_duration: MeanStdPair
     
+        :param get_vision_cache_hit_rate: Returns share of images and videos whose encodings were reused from the shared vision embeddings cache
+        :type get_vision_cache_hit_rate: float
+    
         :param vlm_raw_metrics: VLM specific raw metrics
         :type VLMRawPerfMetrics:
     """
@@ -3961,6 +4173,8 @@ class VLMPerfMetrics(PerfMetrics):
         ...
     def get_prepare_embeddings_duration(self) -> MeanStdPair:
         ...
+    def get_vision_cache_hit_rate(self) -> float:
+        ...
     @property
     def vlm_raw_metrics(self) -> VLMRawPerfMetrics:
         ...
@@ -4244,12 +4458,36 @@ class VLMRawPerfMetrics:
     
         :param prepare_embeddings_durations: Durations of embeddings preparation.
         :type prepare_embeddings_durations: list[MicroSeconds]
+    
+        :param vision_cache_hits: Number of images and videos whose encodings were reused from the shared vision embeddings cache.
+        :type vision_cache_hits: int
+    
+        :param vision_cache_misses: Number of images and videos which were encoded by the vision encoder.
+        :type vision_cache_misses: int
+    
+        :param pruned_vision_tokens: Number of visual tokens removed from the prompt by visual token pruning.
+        :type pruned_vision_tokens: int
+    
+        :param saved_kv_blocks: Number of KV-cache blocks the prompt did not occupy thanks to visual token pruning, reported by continuous batching.
+        :type saved_kv_blocks: int
     """
     def __init__(self) -> None:
         ...
     @property
     def prepare_embeddings_durations(self) -> list[float]:
         ...
+    @property
+    def pruned_vision_tokens(self) -> int:
+        ...
+    @property
+    def saved_kv_blocks(self) -> int:
+        ...
+    @property
+    def vision_cache_hits(self) -> int:
+        ...
+    @property
+    def vision_cache_misses(self) -> int:
+        ...
 class VideoGenerationConfig:
     generator: Generator
     negative_prompt: str | None
@@ -4304,6 +4542,30 @@ class VideoGenerationConfig:
     def num_videos_per_prompt(self, arg0: typing.SupportsInt) -> None:
         ...
     @property
+    def vae_tile_frames_overlap(self) -> int:
+        ...
+    @vae_tile_frames_overlap.setter
+    def vae_tile_frames_overlap(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
+    def vae_tile_num_frames(self) -> int:
+        ...
+    @vae_tile_num_frames.setter
+    def vae_tile_num_frames(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
+    def vae_tile_overlap(self) -> int:
+        ...
+    @vae_tile_overlap.setter
+    def vae_tile_overlap(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
+    def vae_tile_size(self) -> int:
+        ...
+    @vae_tile_size.setter
+    def vae_tile_size(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
     def width(self) -> int:
         ...
     @width.setter
@@ -4794,6 +5056,10 @@ def draft_model(models_path: os.PathLike | str | bytes, device: str = '', **kwar
     """
     device on which inference will be performed
     """
+def get_prefix_block_hashes(prompt_ids: collections.abc.Sequence[typing.SupportsInt], block_size: typing.SupportsInt) -> list:
+    """
+    Computes 128-bit hashes of full KV cache blocks of a prompt as prefix caching of ContinuousBatchingPipeline does for requests without LoRA adapters. Routers may match them with hashes of prompts sent to pipeline replicas to place a request where the longest prefix of it is cached.
+    """
 def get_version() -> str:
     """
     OpenVINO GenAI version
@@ -31,6 +31,8 @@ using ov::genai::GenerationFinishReason;
 using ov::genai::GenerationStatus;
 using ov::genai::SchedulerConfig;
 using ov::genai::PipelineMetrics;
+using ov::genai::BlockHash;
+using ov::genai::MetricHistogram;
 using ov::genai::KVCrushAnchorPointMode;
 using ov::genai::KVCrushConfig;
 using ov::genai::ChatHistory;
@@ -122,6 +124,9 @@ auto scheduler_config_docstring = R"(
         This results in more RAM usage, maximum RAM usage is determined by cache_size or num_kv_blocks parameters.
         When turned off only KV-cache required for batch calculation is kept in memory and
         when a sequence has finished generation its cache is released.
+    prefix_aware_admission_window: Number of the oldest waiting prompts admitted in order of the number of KV blocks
+        their prefill requires after prefix cache lookup. With prefix caching, a prompt sharing a prefix with
+        a prompt computed at the same step waits for the prefix to be cached. 0 keeps arrival order.
     use_cache_eviction:         Whether to use cache eviction during generation.
     cache_eviction_config       Cache eviction configuration struct.
     use_sparse_attention        Whether to use sparse attention during prefill.
@@ -166,6 +171,61 @@ auto pipeline_metrics_docstring = R"(
 
     :param avg_cache_usage: Running average of the KV cache usage (in %) during the lifetime of the pipeline, with max window size of 1000 steps
     :type avg_cache_usage: float
+
+    :param ttft_ms: Time from adding a request to its first generated token in milliseconds.
+    :type ttft_ms: MetricHistogram
+
+    :param tpot_ms: Time per output token after the first one in milliseconds.
+    :type tpot_ms: MetricHistogram
+
+    :param queue_wait_ms: Time from adding a request to its first scheduling in milliseconds.
+    :type queue_wait_ms: MetricHistogram
+
+    :param prefill_chunk_size: Number of prompt tokens of a request scheduled at a single generation step.
+    :type prefill_chunk_size: MetricHistogram
+
+    :param batch_size: Number of requests scheduled at a single generation step.
+    :type batch_size: MetricHistogram
+
+    :param step_duration_ms: Duration of generation steps in milliseconds.
+    :type step_duration_ms: MetricHistogram
+
+    :param preemptions: Number of times requests were preempted to free KV cache blocks.
+    :type preemptions: int
+
+    :param recomputed_tokens: Number of processed tokens dropped by preemption, which have to be computed again.
+    :type recomputed_tokens: int
+
+    :param prefix_cache_hits: Number of prompt KV cache blocks restored from prefix cache.
+    :type prefix_cache_hits: int
+
+    :param prefix_cache_misses: Number of prompt KV cache blocks which were not found in prefix cache.
+    :type prefix_cache_misses: int
+
+    :param evicted_tokens: Number of tokens evicted from KV cache by cache eviction algorithm.
+    :type evicted_tokens: int
+
+    :param draft_tokens: Number of candidate tokens proposed by draft model or prompt lookup in speculative decoding.
+    :type draft_tokens: int
+
+    :param accepted_draft_tokens: Number of candidate tokens accepted by main model in speculative decoding.
+    :type accepted_draft_tokens: int
+)";
+
+auto metric_histogram_docstring = R"(
+    Snapshot of a histogram with fixed buckets, which is used to report distributions of latencies and sizes in PipelineMetrics.
+
+    :param upper_bounds: Inclusive upper bounds of buckets in ascending order.
+    :type upper_bounds: list[float]
+
+    :param counts: Number of observations in each bucket, the last element counts observations above the last bound.
+    :type counts: list[int]
+
+    :param count: Total number of observations.
+    :type count: int
+
+    :param sum: Sum of observed values.
+    :type sum: float
 )";
 
 std::ostream& operator << (std::ostream& stream, const GenerationResult& generation_result) {
@@ -379,19 +439,59 @@ void init_continuous_batching_pipeline(py::module_& m) {
         .def_readwrite("dynamic_split_fuse", &SchedulerConfig::dynamic_split_fuse)
         .def_readwrite("max_num_seqs", &SchedulerConfig::max_num_seqs)
         .def_readwrite("enable_prefix_caching", &SchedulerConfig::enable_prefix_caching)
+        .def_readwrite("prefix_aware_admission_window", &SchedulerConfig::prefix_aware_admission_window)
         .def_readwrite("use_cache_eviction", &SchedulerConfig::use_cache_eviction)
         .def_readwrite("cache_eviction_config", &SchedulerConfig::cache_eviction_config)
         .def_readwrite("use_sparse_attention", &SchedulerConfig::use_sparse_attention)
         .def_readwrite("sparse_attention_config", &SchedulerConfig::sparse_attention_config)
         .def("to_string", &SchedulerConfig::to_string);
 
+    py::class_<MetricHistogram>(m, "MetricHistogram", metric_histogram_docstring)
+            .def(py::init<>())
+            .def_readonly("upper_bounds", &MetricHistogram::upper_bounds)
+            .def_readonly("counts", &MetricHistogram::counts)
+            .def_readonly("count", &MetricHistogram::count)
+            .def_readonly("sum", &MetricHistogram::sum)
+            .def("get_mean", &MetricHistogram::get_mean)
+            .def("get_quantile", &MetricHistogram::get_quantile, py::arg("quantile"));
+
     py::class_<PipelineMetrics>(m, "PipelineMetrics", pipeline_metrics_docstring)
             .def(py::init<>())
             .def_readonly("requests", &PipelineMetrics::requests)
             .def_readonly("scheduled_requests", &PipelineMetrics::scheduled_requests)
             .def_readonly("cache_usage", &PipelineMetrics::cache_usage)
             .def_readonly("avg_cache_usage", &PipelineMetrics::avg_cache_usage)
-            .def_readonly("max_cache_usage", &PipelineMetrics::max_cache_usage);
+            .def_readonly("max_cache_usage", &PipelineMetrics::max_cache_usage)
+            .def_readonly("ttft_ms", &PipelineMetrics::ttft_ms)
+            .def_readonly("tpot_ms", &PipelineMetrics::tpot_ms)
+            .def_readonly("queue_wait_ms", &PipelineMetrics::queue_wait_ms)
+            .def_readonly("prefill_chunk_size", &PipelineMetrics::prefill_chunk_size)
+            .def_readonly("batch_size", &PipelineMetrics::batch_size)
+            .def_readonly("step_duration_ms", &PipelineMetrics::step_duration_ms)
+            .def_readonly("preemptions", &PipelineMetrics::preemptions)
+            .def_readonly("recomputed_tokens", &PipelineMetrics::recomputed_tokens)
+            .def_readonly("prefix_cache_hits", &PipelineMetrics::prefix_cache_hits)
+            .def_readonly("prefix_cache_misses", &PipelineMetrics::prefix_cache_misses)
+            .def_readonly("evicted_tokens", &PipelineMetrics::evicted_tokens)
+            .def_readonly("draft_tokens", &PipelineMetrics::draft_tokens)
+            .def_readonly("accepted_draft_tokens", &PipelineMetrics::accepted_draft_tokens)
+            .def("to_prometheus_text", [](const PipelineMetrics& metrics, const std::string& prefix) {
+                return ov::genai::to_prometheus_text(metrics, prefix);
+            }, py::arg("prefix") = "openvino_genai", "Formats metrics in Prometheus text exposition format, latencies are reported in seconds.");
+
+    m.def("get_prefix_block_hashes", [](const std::vector<int64_t>& prompt_ids, size_t block_size) {
+            // 128-bit hashes are returned as Python integers
+            py::list hashes;
+            for (const BlockHash& hash : ov::genai::get_prefix_block_hashes(prompt_ids, block_size)) {
+                hashes.append(py::int_(hash.high).attr("__lshift__")(64).attr("__or__")(py::int_(hash.low)));
+            }
+            return hashes;
+        },
+        py::arg("prompt_ids"),
+        py::arg("block_size"),
+        "Computes 128-bit hashes of full KV cache blocks of a prompt as prefix caching of ContinuousBatchingPipeline does "
+        "for requests without LoRA adapters. Routers may match them with hashes of prompts sent to pipeline replicas "
+        "to place a request where the longest prefix of it is cached.");
 
     py::class_<ContinuousBatchingPipeline>(m, "ContinuousBatchingPipeline", "This class is used for generation with LLMs with continuous batchig")
         .def(py::init([](const std::filesystem::path& models_path, const SchedulerConfig& scheduler_config, const std::string& device, const std::map<std::string, py::object>& llm_plugin_config,
@@ -419,6 +519,11 @@ void init_continuous_batching_pipeline(py::module_& m) {
         .def("get_tokenizer", &ContinuousBatchingPipeline::get_tokenizer)
         .def("get_config", &ContinuousBatchingPipeline::get_config)
         .def("get_metrics", &ContinuousBatchingPipeline::get_metrics)
+        .def("start_tracing", &ContinuousBatchingPipeline::start_tracing, py::arg("output_path"),
+             "Starts recording a timeline of steps, scheduling decisions and requests of all continuous batching pipelines in the process. "
+             "The trace is written to output_path by stop_tracing() in Chrome trace event JSON format.")
+        .def("stop_tracing", &ContinuousBatchingPipeline::stop_tracing,
+             "Stops recording started by start_tracing() or OPENVINO_GENAI_TRACE_FILE environment variable and writes the trace.")
         .def("add_request", py::overload_cast<uint64_t, const ov::Tensor&, const ov::genai::GenerationConfig&>(&ContinuousBatchingPipeline::add_request), py::arg("request_id"), py::arg("input_ids"), py::arg("generation_config"))
         .def("add_request", py::overload_cast<uint64_t, const std::string&, const ov::genai::GenerationConfig&>(&ContinuousBatchingPipeline::add_request), py::arg("request_id"), py::arg("prompt"), py::arg("generation_config"))
         .def("add_request", py::overload_cast<uint64_t, const std::string&, const std::vector<ov::Tensor>&, const std::vector<ov::Tensor>&, const ov::genai::GenerationConfig&>(&ContinuousBatchingPipeline::add_request), py::arg("request_id"), py::arg("prompt"), py::arg("images"), py::arg("videos"), py::arg("generation_config"))
@@ -77,6 +77,8 @@ void init_clip_text_model(py::module_& m) {
             py::arg("neg_prompt"), 
             py::arg("do_classifier_free_guidance"))
         .def("get_output_tensor", &ov::genai::CLIPTextModel::get_output_tensor, py::arg("idx"))
+        .def("set_embeddings_cache_size", &ov::genai::CLIPTextModel::set_embeddings_cache_size, py::arg("size"))
+        .def("is_last_infer_cached", &ov::genai::CLIPTextModel::is_last_infer_cached)
         .def(
             "compile",
             [](ov::genai::CLIPTextModel& self,
@@ -204,6 +206,8 @@ void init_t5_encoder_model(py::module_& m) {
             py::arg("do_classifier_free_guidance"), 
             py::arg("max_sequence_length"))
         .def("get_output_tensor", &ov::genai::T5EncoderModel::get_output_tensor, py::arg("idx"))
+        .def("set_embeddings_cache_size", &ov::genai::T5EncoderModel::set_embeddings_cache_size, py::arg("size"))
+        .def("is_last_infer_cached", &ov::genai::T5EncoderModel::is_last_infer_cached)
         .def(
             "compile",
             [](ov::genai::T5EncoderModel& self,
@@ -54,7 +54,12 @@ auto text2image_generate_docstring = R"(
     generator: openvino_genai.TorchGenerator, openvino_genai.CppStdGenerator or class inherited from openvino_genai.Generator - random generator,
     adapters: LoRA adapters,
     strength: strength for image to image generation. 1.0f means initial image is fully noised,
-    max_sequence_length: int - length of t5_encoder_model input
+    max_sequence_length: int - length of t5_encoder_model input,
+    step_cache_threshold: float - accumulated relative change of denoiser input below which denoiser output is reused,
+    step_cache_interval: int - denoiser is inferred only on every N-th step,
+    vae_tile_size: int - tile size in pixels for tiled VAE decoding, 0 disables tiling,
+    vae_tile_overlap: int - overlap of neighbour tiles in pixels for tiled VAE decoding,
+    text_embeddings_cache_size: int - number of prompts whose text encoder outputs are cached, 0 disables caching
 
     :return: ov.Tensor with resulting images
     :rtype: ov.Tensor
@@ -71,6 +76,12 @@ auto raw_image_generation_perf_metrics_docstring = R"(
 
     :param iteration_durations: Durations for each step iteration in microseconds.
     :type iteration_durations: list[float]
+
+    :param cached_steps: Indices of denoising steps where cached unet / transformer output was reused.
+    :type cached_steps: list[int]
+
+    :param cached_text_encoders: Names of text encoders whose outputs were taken from text embeddings cache.
+    :type cached_text_encoders: list[str]
 )";
 
 auto image_generation_perf_metrics_docstring = R"(
@@ -127,6 +138,12 @@ auto image_generation_perf_metrics_docstring = R"(
     :param get_transformer_infer_duration: Returns the mean and standard deviation of one transformer inference in milliseconds.
     :type get_transformer_infer_duration: MeanStdPair
 
+    :param get_num_cached_steps: Returns the number of denoising steps where cached unet / transformer output was reused.
+    :type get_num_cached_steps: int
+
+    :param get_text_embeddings_cache_hits: Returns the number of text encoder inferences served from text embeddings cache.
+    :type get_text_embeddings_cache_hits: int
+
     :param raw_metrics: A structure of RawImageGenerationPerfMetrics type that holds raw metrics.
     :type raw_metrics: RawImageGenerationPerfMetrics
 )";
@@ -344,6 +361,11 @@ void init_image_generation_pipelines(py::module_& m) {
         .def_readwrite("adapters", &ov::genai::ImageGenerationConfig::adapters)
         .def_readwrite("strength", &ov::genai::ImageGenerationConfig::strength)
         .def_readwrite("max_sequence_length", &ov::genai::ImageGenerationConfig::max_sequence_length)
+        .def_readwrite("step_cache_threshold", &ov::genai::ImageGenerationConfig::step_cache_threshold)
+        .def_readwrite("step_cache_interval", &ov::genai::ImageGenerationConfig::step_cache_interval)
+        .def_readwrite("vae_tile_size", &ov::genai::ImageGenerationConfig::vae_tile_size)
+        .def_readwrite("vae_tile_overlap", &ov::genai::ImageGenerationConfig::vae_tile_overlap)
+        .def_readwrite("text_embeddings_cache_size", &ov::genai::ImageGenerationConfig::text_embeddings_cache_size)
         .def("validate", &ov::genai::ImageGenerationConfig::validate)
         .def("update_generation_config", [](
             ov::genai::ImageGenerationConfig& config,
@@ -361,7 +383,9 @@ void init_image_generation_pipelines(py::module_& m) {
         })
         .def_property_readonly("iteration_durations", [](const RawImageGenerationPerfMetrics &rw) { 
             return common_utils::get_ms(rw, &RawImageGenerationPerfMetrics::iteration_durations); 
-        });
+        })
+        .def_readonly("cached_steps", &RawImageGenerationPerfMetrics::cached_steps)
+        .def_readonly("cached_text_encoders", &RawImageGenerationPerfMetrics::cached_text_encoders);
 
     py::class_<ImageGenerationPerfMetrics>(m, "ImageGenerationPerfMetrics", image_generation_perf_metrics_docstring)
         .def(py::init<>())
@@ -391,6 +415,8 @@ void init_image_generation_pipelines(py::module_& m) {
             return py::make_tuple(first_infer_time, other_infer_avg_time);
         })
         .def("get_unet_infer_duration", &ImageGenerationPerfMetrics::get_unet_infer_duration)
+        .def("get_num_cached_steps", &ImageGenerationPerfMetrics::get_num_cached_steps)
+        .def("get_text_embeddings_cache_hits", &ImageGenerationPerfMetrics::get_text_embeddings_cache_hits)
         .def_readonly("raw_metrics", &ImageGenerationPerfMetrics::raw_metrics);
 
     auto text2image_pipeline = py::class_<ov::genai::Text2ImagePipeline>(m, "Text2ImagePipeline", "This class is used for generation with text-to-image models.")
@@ -92,6 +92,18 @@ auto raw_perf_metrics_docstring = R"(
 
     :param prepare_embeddings_durations: Durations of embeddings preparation.
     :type prepare_embeddings_durations: list[MicroSeconds]
+
+    :param vision_cache_hits: Number of images and videos whose encodings were reused from the shared vision embeddings cache.
+    :type vision_cache_hits: int
+
+    :param vision_cache_misses: Number of images and videos which were encoded by the vision encoder.
+    :type vision_cache_misses: int
+
+    :param pruned_vision_tokens: Number of visual tokens removed from the prompt by visual token pruning.
+    :type pruned_vision_tokens: int
+
+    :param saved_kv_blocks: Number of KV-cache blocks the prompt did not occupy thanks to visual token pruning, reported by continuous batching.
+    :type saved_kv_blocks: int
 )";
 
 auto perf_metrics_docstring = R"(
@@ -100,6 +112,9 @@ auto perf_metrics_docstring = R"(
     :param get_prepare_embeddings_duration: Returns mean and standard deviation of embeddings preparation duration in milliseconds
     :type get_prepare_embeddings_duration: MeanStdPair
 
+    :param get_vision_cache_hit_rate: Returns share of images and videos whose encodings were reused from the shared vision embeddings cache
+    :type get_vision_cache_hit_rate: float
+
     :param vlm_raw_metrics: VLM specific raw metrics
     :type VLMRawPerfMetrics:
 )";
@@ -157,11 +172,16 @@ void init_vlm_pipeline(py::module_& m) {
         .def(py::init<>())
         .def_property_readonly("prepare_embeddings_durations", [](const ov::genai::VLMRawPerfMetrics& rw) {
             return common_utils::get_ms(rw, &ov::genai::VLMRawPerfMetrics::prepare_embeddings_durations);
-        });
+        })
+        .def_readonly("vision_cache_hits", &ov::genai::VLMRawPerfMetrics::vision_cache_hits)
+        .def_readonly("vision_cache_misses", &ov::genai::VLMRawPerfMetrics::vision_cache_misses)
+        .def_readonly("pruned_vision_tokens", &ov::genai::VLMRawPerfMetrics::pruned_vision_tokens)
+        .def_readonly("saved_kv_blocks", &ov::genai::VLMRawPerfMetrics::saved_kv_blocks);
 
     py::class_<ov::genai::VLMPerfMetrics, ov::genai::PerfMetrics>(m, "VLMPerfMetrics", perf_metrics_docstring)
         .def(py::init<>())
         .def("get_prepare_embeddings_duration", &ov::genai::VLMPerfMetrics::get_prepare_embeddings_duration)
+        .def("get_vision_cache_hit_rate", &ov::genai::VLMPerfMetrics::get_vision_cache_hit_rate)
         .def_readonly("vlm_raw_metrics", &ov::genai::VLMPerfMetrics::vlm_raw_metrics);
 
     py::class_<ov::genai::VLMDecodedResults, ov::genai::DecodedResults>(m, "VLMDecodedResults", decoded_results_docstring)
@@ -0,0 +1,136 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// Measures CDPruner kernel construction and greedy DPP selection for high resolution images with 1-4k visual tokens.
+// Compared variants:
+//   sequential - dense kernel built by the OV model, single threaded row by row selection
+//   blocked    - dense kernel built by the OV model, parallel selection over blocks of columns
+//   on demand  - kernel factors only, rows of selected tokens computed during parallel selection
+//   opencl     - dense kernel built by the OV model, OpenCL selection (when built with ENABLE_OPENCL_DPP)
+// Usage: cdpruner_dpp_benchmark [num_iterations] [feature_dim]
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "visual_language/cdpruner/conditional_kernel.hpp"
+#include "visual_language/cdpruner/fast_dpp.hpp"
+
+using namespace ov::genai::cdpruner;
+
+namespace {
+
+ov::Tensor make_features(const ov::Shape& shape, uint32_t seed) {
+    std::mt19937 engine(seed);
+    std::normal_distribution<float> distribution(0.0f, 1.0f);
+    ov::Tensor features(ov::element::f32, shape);
+    float* data = features.data<float>();
+    for (size_t i = 0; i < features.get_size(); ++i) {
+        data[i] = distribution(engine);
+    }
+    return features;
+}
+
+// Single threaded selection as it was done before blocking, kept as a baseline
+std::vector<size_t> sequential_select(const ov::Tensor& kernel, size_t num_selected, float threshold) {
+    const size_t num_tokens = kernel.get_shape()[1];
+    const float* kernel_data = kernel.data<const float>();
+    std::vector<float> cis(num_selected * num_tokens, 0.0f);
+    std::vector<float> di2s(num_tokens);
+    for (size_t i = 0; i < num_tokens; ++i) {
+        di2s[i] = kernel_data[i * num_tokens + i];
+    }
+    std::vector<size_t> selected;
+    for (size_t t = 0; t < num_selected; ++t) {
+        size_t best = std::max_element(di2s.begin(), di2s.end()) - di2s.begin();
+        selected.push_back(best);
+        float* eis = cis.data() + t * num_tokens;
+        std::copy(kernel_data + best * num_tokens, kernel_data + (best + 1) * num_tokens, eis);
+        for (size_t prev = 0; prev < t; ++prev) {
+            float cis_sel = cis[prev * num_tokens + best];
+            if (std::abs(cis_sel) < threshold)
+                continue;
+            for (size_t j = 0; j < num_tokens; ++j) {
+                eis[j] -= cis_sel * cis[prev * num_tokens + j];
+            }
+        }
+        float inv_norm = 1.0f / std::sqrt(di2s[best] + threshold);
+        for (size_t j = 0; j < num_tokens; ++j) {
+            eis[j] *= inv_norm;
+            if (di2s[j] > -std::numeric_limits<float>::infinity()) {
+                di2s[j] -= eis[j] * eis[j];
+            }
+        }
+        di2s[best] = -std::numeric_limits<float>::infinity();
+    }
+    return selected;
+}
+
+double measure_ms(const std::function<void()>& fn, size_t num_iterations) {
+    fn();  // warm-up
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t iteration = 0; iteration < num_iterations; ++iteration) {
+        fn();
+    }
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / num_iterations;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    const size_t num_iterations = argc > 1 ? std::max(1, std::atoi(argv[1])) : 5;
+    const size_t feature_dim = argc > 2 ? std::max(1, std::atoi(argv[2])) : 1024;
+
+    Config config;
+    config.device = "CPU";
+    config.relevance_weight = 0.5f;
+    config.use_cl_kernel = false;
+    ConditionalKernelBuilder kernel_builder(config);
+    FastGreedyDPP cpu_dpp(config);
+
+    const ov::Tensor text_features = make_features({32, feature_dim}, 7);
+
+    std::cout << std::setw(8) << "tokens" << std::setw(8) << "keep" << std::setw(14) << "kernel, ms"
+              << std::setw(16) << "sequential, ms" << std::setw(14) << "blocked, ms" << std::setw(16) << "on demand, ms"
+#ifdef ENABLE_OPENCL_DPP
+              << std::setw(14) << "opencl, ms"
+#endif
+              << std::endl;
+
+    for (size_t num_tokens : {1024, 2048, 4096}) {
+        const ov::Tensor visual_features = make_features({1, num_tokens, feature_dim}, static_cast<uint32_t>(num_tokens));
+        for (size_t keep_percent : {50, 10}) {
+            const size_t num_selected = num_tokens * keep_percent / 100;
+
+            ov::Tensor kernel;
+            const double kernel_ms = measure_ms([&]() { kernel = kernel_builder.build(visual_features, text_features); }, num_iterations);
+            const double sequential_ms = measure_ms([&]() { sequential_select(kernel, num_selected, config.numerical_threshold); }, num_iterations);
+            const double blocked_ms = measure_ms([&]() { cpu_dpp.select(kernel, num_selected); }, num_iterations);
+            // factors are built as a part of the variant since they replace the dense kernel
+            const double on_demand_ms = measure_ms([&]() {
+                cpu_dpp.select(kernel_builder.build_factors(visual_features, text_features), num_selected);
+            }, num_iterations);
+
+            std::cout << std::fixed << std::setprecision(2) << std::setw(8) << num_tokens << std::setw(8) << num_selected
+                      << std::setw(14) << kernel_ms << std::setw(16) << sequential_ms << std::setw(14) << blocked_ms
+                      << std::setw(16) << on_demand_ms;
+#ifdef ENABLE_OPENCL_DPP
+            Config cl_config = config;
+            cl_config.use_cl_kernel = true;
+            FastGreedyDPP cl_dpp(cl_config);
+            std::cout << std::setw(14) << measure_ms([&]() { cl_dpp.select(kernel, num_selected); }, num_iterations);
+#endif
+            std::cout << std::endl;
+        }
+    }
+    return EXIT_SUCCESS;
+}
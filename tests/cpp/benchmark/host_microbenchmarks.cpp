@@ -0,0 +1,581 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// Microbenchmarks of host side components which run on every generation step: scheduling, KV cache block management
+// with prefix caching, lifetime of a request with beam forks, logit transforms and sampling, stop string matching,
+// eviction score aggregation, streaming detokenization and classifier-free guided denoising steps of image generation. Tokenizer dependent cases load a converted tokenizer from OPENVINO_GENAI_BENCHMARK_TOKENIZER_DIR
+// and are skipped when it is not set.
+// Usage: host_microbenchmarks [google benchmark flags] [--baseline=<json>] [--regression_threshold=<fraction>]
+//   --benchmark_out=<json> --benchmark_out_format=json stores results, which are used as a baseline by later runs.
+//   With --baseline the run fails if real time of any benchmark exceeds its baseline by more than the threshold (0.1).
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "continuous_batching/cache_eviction.hpp"
+#include "continuous_batching/scheduler.hpp"
+#include "image_generation/schedulers/step_kernels.hpp"
+#include "openvino/genai/text_streamer.hpp"
+#include "sampling/sampler.hpp"
+#include "sequence_group.hpp"
+#include "helper.hpp"
+#include "utils.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+// allocations through global operator new, reported per request by benchmarks of request lifetime
+std::atomic<size_t> num_allocations{0};
+std::atomic<size_t> num_allocated_bytes{0};
+
+}  // namespace
+
+void* operator new(std::size_t size) {
+    num_allocations.fetch_add(1, std::memory_order_relaxed);
+    num_allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size == 0 ? 1 : size))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+namespace {
+
+constexpr size_t SCHEDULER_BLOCK_SIZE = 32;
+constexpr size_t SCHEDULER_PROMPT_LEN = 16;
+// prompt and generated tokens of a sequence fit into a single KV cache block, so the cache is kept small at 1000 sequences
+constexpr size_t SCHEDULER_DECODE_STEPS = SCHEDULER_BLOCK_SIZE - SCHEDULER_PROMPT_LEN - 1;
+// sequences are recreated after a number of steps to keep their lengths and sampler state bounded
+constexpr size_t SAMPLER_RESET_STEPS = 1024;
+constexpr size_t SAMPLER_VOCAB_SIZE = 151936;
+
+const char SAMPLE_TEXT[] =
+    "Continuous batching schedules prompt and generation tokens of many requests into a single inference step. "
+    "The scheduler allocates KV cache blocks for every sequence, restores blocks of common prefixes from the cache "
+    "and preempts requests when the cache is exhausted. After the model step the sampler applies penalties, "
+    "temperature, top-p and top-k filtering to logits, selects next tokens and checks stop conditions, while the "
+    "streamer detokenizes new tokens and passes complete words to the user callback.";
+
+std::vector<int64_t> make_tokens(size_t size, uint32_t seed, int64_t vocab_size = 32000) {
+    std::mt19937 engine(seed);
+    std::uniform_int_distribution<int64_t> distribution(0, vocab_size - 1);
+    std::vector<int64_t> tokens(size);
+    for (int64_t& token : tokens) {
+        token = distribution(engine);
+    }
+    return tokens;
+}
+
+std::vector<float> make_logits(size_t size, uint32_t seed) {
+    std::mt19937 engine(seed);
+    std::normal_distribution<float> distribution(0.0f, 4.0f);
+    std::vector<float> logits(size);
+    for (float& logit : logits) {
+        logit = distribution(engine);
+    }
+    return logits;
+}
+
+GenerationConfig make_config(const ov::AnyMap& properties) {
+    GenerationConfig config;
+    config.update_generation_config(properties);
+    config.ignore_eos = true;
+    return config;
+}
+
+const char* get_tokenizer_dir(benchmark::State& state) {
+    const char* tokenizer_dir = std::getenv("OPENVINO_GENAI_BENCHMARK_TOKENIZER_DIR");
+    if (tokenizer_dir == nullptr) {
+        state.SkipWithError("OPENVINO_GENAI_BENCHMARK_TOKENIZER_DIR is not set");
+    }
+    return tokenizer_dir;
+}
+
+std::vector<int64_t> encode_sample_text(Tokenizer& tokenizer) {
+    const ov::Tensor input_ids = tokenizer.encode(std::string(SAMPLE_TEXT), ov::genai::add_special_tokens(false)).input_ids;
+    return std::vector<int64_t>(input_ids.data<int64_t>(), input_ids.data<int64_t>() + input_ids.get_size());
+}
+
+std::shared_ptr<CacheManager> make_cache_manager() {
+    ov::Core core;
+    ov::InferRequest request = core.compile_model(get_dummy_model(core, 1)).create_infer_request();
+    return std::make_shared<CacheManager>(request);
+}
+
+// Emulates a model step: every scheduled sequence gets a new token
+void run_scheduler_step(Scheduler& scheduler, std::vector<SequenceGroup::Ptr>& requests) {
+    scheduler.schedule(requests);
+    for (const auto& request : requests) {
+        if (!request->is_scheduled())
+            continue;
+        for (const auto& sequence : request->get_running_sequences()) {
+            sequence->append_token(1, 0.5f);
+        }
+        request->finish_iteration();
+    }
+}
+
+void free_requests(Scheduler& scheduler, std::vector<SequenceGroup::Ptr>& requests) {
+    for (const auto& request : requests) {
+        for (const auto& sequence : request->get_running_sequences()) {
+            sequence->set_status(SequenceStatus::FINISHED);
+            scheduler.free_sequence(sequence->get_id());
+        }
+    }
+    requests.clear();
+}
+
+// Measures schedule() of generation steps, including bookkeeping of the emulated model step
+void BM_SchedulerDecode(benchmark::State& state) {
+    const size_t num_requests = state.range(0);
+    SchedulerConfig config;
+    config.dynamic_split_fuse = state.range(1) != 0;
+    config.max_num_seqs = num_requests;
+    config.max_num_batched_tokens = std::max<size_t>(num_requests * SCHEDULER_PROMPT_LEN, 256);
+    config.num_kv_blocks = num_requests + 1;
+    Scheduler scheduler(SCHEDULER_BLOCK_SIZE, make_cache_manager(), config);
+
+    const GenerationConfig generation_config = make_config({});
+    const std::vector<int64_t> prompt = make_tokens(SCHEDULER_PROMPT_LEN, 0);
+    std::vector<SequenceGroup::Ptr> requests;
+    uint64_t request_id = 0;
+    size_t num_steps = SCHEDULER_DECODE_STEPS;
+    for (auto _ : state) {
+        if (num_steps == SCHEDULER_DECODE_STEPS) {
+            state.PauseTiming();
+            free_requests(scheduler, requests);
+            for (size_t i = 0; i < num_requests; ++i) {
+                requests.push_back(std::make_shared<SequenceGroup>(request_id++, prompt, generation_config, SCHEDULER_BLOCK_SIZE));
+            }
+            // prompt phase
+            run_scheduler_step(scheduler, requests);
+            num_steps = 0;
+            state.ResumeTiming();
+        }
+        run_scheduler_step(scheduler, requests);
+        ++num_steps;
+    }
+    state.SetItemsProcessed(state.iterations() * num_requests);
+}
+BENCHMARK(BM_SchedulerDecode)
+    ->ArgNames({"sequence_groups", "dynamic_split_fuse"})
+    ->ArgsProduct({{1, 10, 100, 1000}, {0, 1}})
+    ->Unit(benchmark::kMicrosecond);
+
+// Measures the lifetime of a request in BlockManager: prefix cache lookup, allocation of the rest of the prompt and free
+void BM_BlockManagerPrefixCaching(benchmark::State& state) {
+    const size_t prompt_len = state.range(0);
+    const bool is_shared_prompt = state.range(1) != 0;
+    const size_t block_size = 32;
+    const size_t num_blocks_per_prompt = (prompt_len + block_size - 1) / block_size;
+    BlockManager block_manager(static_cast<int>(4 * num_blocks_per_prompt), true, block_size);
+
+    const GenerationConfig generation_config = make_config({});
+    std::vector<int64_t> prompt = make_tokens(prompt_len, 0);
+    uint64_t request_id = 0;
+    size_t num_restored_blocks = 0;
+    for (auto _ : state) {
+        if (!is_shared_prompt) {
+            // the first token differs from previous prompts, so no blocks are restored and cached blocks are overwritten
+            prompt[0] = static_cast<int64_t>(request_id);
+        }
+        auto sequence_group = std::make_shared<SequenceGroup>(request_id++, prompt, generation_config, block_size);
+        num_restored_blocks += block_manager.restore_cached_blocks(sequence_group);
+        sequence_group->schedule_tokens(sequence_group->get_num_available_tokens_for_batching());
+        block_manager.append_slots(sequence_group);
+        block_manager.free_sequence((*sequence_group)[0]->get_id());
+    }
+    state.counters["restored_blocks"] = benchmark::Counter(static_cast<double>(num_restored_blocks), benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_BlockManagerPrefixCaching)
+    ->ArgNames({"prompt_len", "shared_prompt"})
+    ->ArgsProduct({{512, 4096}, {0, 1}})
+    ->Unit(benchmark::kMicrosecond);
+
+// Measures the lifetime of a beam search request: creation, generation with a beam replaced by a fork of the best one
+// at every step, block hashes for prefix caching and release. Allocations and allocated bytes are counted per request.
+void BM_SequenceGroupLifetime(benchmark::State& state) {
+    const size_t num_generated_tokens = state.range(0);
+    const size_t block_size = 32;
+    GenerationConfig generation_config = make_config({});
+    generation_config.num_beams = 4;
+    generation_config.num_return_sequences = 4;
+    const std::vector<int64_t> prompt = make_tokens(512, 0);
+    uint64_t request_id = 0;
+    size_t num_hashes = 0;
+    const size_t num_allocations_before = num_allocations.load();
+    const size_t num_allocated_bytes_before = num_allocated_bytes.load();
+    for (auto _ : state) {
+        auto sequence_group = SequenceGroup::create(request_id++, prompt, generation_config, block_size);
+        Sequence::Ptr best_sequence = (*sequence_group)[0];
+        for (size_t i = 1; i < generation_config.num_beams; ++i) {
+            sequence_group->fork_sequence(best_sequence);
+        }
+        for (size_t step = 0; step < num_generated_tokens; ++step) {
+            const uint64_t worst_sequence_id = sequence_group->get_running_sequences().back()->get_id();
+            sequence_group->remove_sequence(worst_sequence_id);
+            sequence_group->fork_sequence(best_sequence);
+            for (const auto& sequence : sequence_group->get_running_sequences()) {
+                sequence->append_token(static_cast<int64_t>(step), -0.5f);
+                const size_t content_len = prompt.size() + sequence->get_generated_len();
+                if (content_len % block_size == 0) {
+                    num_hashes += sequence->get_hash(content_len) != 0;
+                }
+            }
+        }
+    }
+    benchmark::DoNotOptimize(num_hashes);
+    state.counters["allocations"] = benchmark::Counter(static_cast<double>(num_allocations.load() - num_allocations_before),
+                                                       benchmark::Counter::kAvgIterations);
+    state.counters["allocated_bytes"] = benchmark::Counter(static_cast<double>(num_allocated_bytes.load() - num_allocated_bytes_before),
+                                                           benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_SequenceGroupLifetime)->ArgName("generated_tokens")->Arg(64)->Arg(512)->Unit(benchmark::kMicrosecond);
+
+// Measures logit transforms of a single sequence with 1024 prompt and 256 generated tokens seen by penalties.
+// The copy of source logits is included, since transforms modify logits in place.
+void BM_LogitProcessor(benchmark::State& state, const ov::AnyMap& properties) {
+    const size_t vocab_size = state.range(0);
+    LogitProcessor logit_processor(make_config(properties), make_tokens(1024, 0, vocab_size));
+    for (int64_t token : make_tokens(256, 1, vocab_size)) {
+        logit_processor.register_new_generated_token(token);
+    }
+    logit_processor.update_generated_len(256);
+
+    const std::vector<float> source = make_logits(vocab_size, 2);
+    std::vector<float> buffer(vocab_size);
+    for (auto _ : state) {
+        std::copy(source.begin(), source.end(), buffer.begin());
+        Logits logits(buffer.data(), vocab_size);
+        logit_processor.apply(logits);
+        benchmark::DoNotOptimize(logits.m_size);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_CAPTURE(BM_LogitProcessor, temperature, ov::AnyMap{ov::genai::do_sample(true), ov::genai::temperature(0.7f)})
+    ->ArgName("vocab_size")->Arg(32000)->Arg(SAMPLER_VOCAB_SIZE)->Arg(262144)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_LogitProcessor, top_p, ov::AnyMap{ov::genai::do_sample(true), ov::genai::top_p(0.9f)})
+    ->ArgName("vocab_size")->Arg(32000)->Arg(SAMPLER_VOCAB_SIZE)->Arg(262144)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_LogitProcessor, top_k, ov::AnyMap{ov::genai::do_sample(true), ov::genai::top_k(size_t{50})})
+    ->ArgName("vocab_size")->Arg(32000)->Arg(SAMPLER_VOCAB_SIZE)->Arg(262144)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_LogitProcessor, repetition_penalty, ov::AnyMap{ov::genai::repetition_penalty(1.1f)})
+    ->ArgName("vocab_size")->Arg(32000)->Arg(SAMPLER_VOCAB_SIZE)->Arg(262144)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_LogitProcessor, presence_penalty, ov::AnyMap{ov::genai::presence_penalty(0.5f)})
+    ->ArgName("vocab_size")->Arg(32000)->Arg(SAMPLER_VOCAB_SIZE)->Arg(262144)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_LogitProcessor, frequency_penalty, ov::AnyMap{ov::genai::frequency_penalty(0.5f)})
+    ->ArgName("vocab_size")->Arg(32000)->Arg(SAMPLER_VOCAB_SIZE)->Arg(262144)->Unit(benchmark::kMicrosecond);
+
+std::vector<SequenceGroup::Ptr> make_sampling_requests(size_t num_requests, const GenerationConfig& config) {
+    const std::vector<int64_t> prompt = make_tokens(SCHEDULER_PROMPT_LEN, 0);
+    std::vector<SequenceGroup::Ptr> requests;
+    for (size_t request_id = 0; request_id < num_requests; ++request_id) {
+        auto request = std::make_shared<SequenceGroup>(request_id, prompt, config, SCHEDULER_BLOCK_SIZE);
+        // the prompt is processed except the last token, so the next step samples the first generated token
+        request->update_processed_tokens_num(prompt.size() - 1);
+        requests.push_back(request);
+    }
+    return requests;
+}
+
+// Measures Sampler::sample of generation steps of a batch with a large vocabulary
+void BM_SamplerDecode(benchmark::State& state, const ov::AnyMap& properties) {
+    const size_t batch_size = state.range(0);
+    const GenerationConfig config = make_config(properties);
+    const std::vector<float> source = make_logits(batch_size * SAMPLER_VOCAB_SIZE, 0);
+    ov::Tensor logits(ov::element::f32, {batch_size, 1, SAMPLER_VOCAB_SIZE});
+
+    std::unique_ptr<Sampler> sampler;
+    std::vector<SequenceGroup::Ptr> requests;
+    size_t num_steps = SAMPLER_RESET_STEPS;
+    for (auto _ : state) {
+        state.PauseTiming();
+        if (num_steps == SAMPLER_RESET_STEPS) {
+            sampler = std::make_unique<Sampler>();
+            requests = make_sampling_requests(batch_size, config);
+            num_steps = 0;
+        }
+        for (const auto& request : requests) {
+            request->schedule_tokens(1);
+        }
+        // logit transforms modify logits in place
+        std::copy(source.begin(), source.end(), logits.data<float>());
+        state.ResumeTiming();
+
+        sampler->sample(requests, logits);
+        ++num_steps;
+    }
+    state.SetItemsProcessed(state.iterations() * batch_size);
+}
+BENCHMARK_CAPTURE(BM_SamplerDecode, greedy, ov::AnyMap{})
+    ->ArgName("batch_size")->Arg(1)->Arg(16)->Arg(64)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_SamplerDecode, multinomial, ov::AnyMap{ov::genai::do_sample(true), ov::genai::temperature(0.7f),
+                                                            ov::genai::top_p(0.9f), ov::genai::top_k(size_t{50})})
+    ->ArgName("batch_size")->Arg(1)->Arg(16)->Arg(64)->Unit(benchmark::kMicrosecond);
+
+// Measures a generation step of a single sequence with a number of stop strings which never match.
+// Zero stop strings gives the cost of the step without matching.
+void BM_StopStringMatching(benchmark::State& state) {
+    const char* tokenizer_dir = get_tokenizer_dir(state);
+    if (tokenizer_dir == nullptr)
+        return;
+    Tokenizer tokenizer(tokenizer_dir);
+    const size_t vocab_size = tokenizer.get_vocab_vector().size();
+    const std::vector<int64_t> tokens = encode_sample_text(tokenizer);
+
+    GenerationConfig config = make_config({});
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        config.stop_strings.insert("<|stop_" + std::to_string(i) + "|>");
+    }
+    std::vector<float> logits_data(vocab_size, 0.0f);
+    ov::Tensor logits(ov::element::f32, {1, 1, vocab_size}, logits_data.data());
+
+    std::unique_ptr<Sampler> sampler;
+    std::vector<SequenceGroup::Ptr> requests;
+    size_t num_steps = SAMPLER_RESET_STEPS;
+    for (auto _ : state) {
+        state.PauseTiming();
+        if (num_steps == SAMPLER_RESET_STEPS) {
+            sampler = std::make_unique<Sampler>(tokenizer);
+            requests = make_sampling_requests(1, config);
+            num_steps = 0;
+        }
+        requests[0]->schedule_tokens(1);
+        // greedy sampling generates the sample text token by token
+        std::fill(logits_data.begin(), logits_data.end(), 0.0f);
+        logits_data[tokens[num_steps % tokens.size()]] = 1.0f;
+        state.ResumeTiming();
+
+        sampler->sample(requests, logits);
+        ++num_steps;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_StopStringMatching)->ArgName("stop_strings")->Arg(0)->Arg(1)->Arg(8)->Arg(64)->Unit(benchmark::kMicrosecond);
+
+// Measures aggregation of attention scores of all layers after a generation step
+void BM_EvictionScoreAggregation(benchmark::State& state, AggregationMode aggregation_mode) {
+    const size_t seq_len = state.range(0);
+    const size_t num_layers = 32;
+    EvictionScoreManager score_manager(SCHEDULER_BLOCK_SIZE, num_layers, 8, aggregation_mode, 0);
+
+    AttentionScoresForEachDecoderLayer scores;
+    for (size_t layer_idx = 0; layer_idx < num_layers; ++layer_idx) {
+        const std::vector<float> layer_scores = make_logits(seq_len, static_cast<uint32_t>(layer_idx));
+        scores.emplace_back(ov::element::f32, ov::Shape{seq_len});
+        std::transform(layer_scores.begin(), layer_scores.end(), scores.back().data<float>(), [](float score) { return std::abs(score); });
+    }
+    for (auto _ : state) {
+        score_manager.register_new_token_scores(scores, {});
+    }
+    state.SetItemsProcessed(state.iterations() * num_layers * seq_len);
+}
+BENCHMARK_CAPTURE(BM_EvictionScoreAggregation, sum, AggregationMode::SUM)
+    ->ArgName("seq_len")->Arg(1024)->Arg(8192)->Arg(32768)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_EvictionScoreAggregation, norm_sum, AggregationMode::NORM_SUM)
+    ->ArgName("seq_len")->Arg(1024)->Arg(8192)->Arg(32768)->Unit(benchmark::kMicrosecond);
+
+// Measures TextStreamer::write() of a single token, the streamer is ended after every pass over the sample text
+void BM_TextStreamerWrite(benchmark::State& state) {
+    const char* tokenizer_dir = get_tokenizer_dir(state);
+    if (tokenizer_dir == nullptr)
+        return;
+    Tokenizer tokenizer(tokenizer_dir);
+    const std::vector<int64_t> tokens = encode_sample_text(tokenizer);
+
+    size_t num_streamed_chars = 0;
+    TextStreamer streamer(tokenizer, [&num_streamed_chars](std::string subword) {
+        num_streamed_chars += subword.size();
+        return StreamingStatus::RUNNING;
+    });
+    size_t position = 0;
+    for (auto _ : state) {
+        streamer.write(tokens[position]);
+        if (++position == tokens.size()) {
+            streamer.end();
+            position = 0;
+        }
+    }
+    benchmark::DoNotOptimize(num_streamed_chars);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TextStreamerWrite)->Unit(benchmark::kMicrosecond);
+
+// Measures classifier-free guidance with Euler step on SDXL-sized latents: separate loops with temporary tensors
+// (as schedulers did before) vs fused kernels updating latents in place
+void BM_GuidedEulerStep(benchmark::State& state, bool fused) {
+    const ov::Shape latent_shape{1, 4, 128, 128};
+    ov::Shape noise_pred_shape = latent_shape;
+    noise_pred_shape[0] *= 2;
+    std::mt19937 engine(42);
+    std::normal_distribution<float> distribution;
+    ov::Tensor latents(ov::element::f32, latent_shape), noise_pred(ov::element::f32, noise_pred_shape);
+    std::generate_n(latents.data<float>(), latents.get_size(), [&] { return distribution(engine); });
+    std::generate_n(noise_pred.data<float>(), noise_pred.get_size(), [&] { return distribution(engine); });
+    const size_t size = latents.get_size();
+    const float guidance_scale = 5.0f, sigma = 0.9f, dt = -0.05f;
+
+    ov::Tensor denoised;
+    for (auto _ : state) {
+        const float* uncond = noise_pred.data<const float>();
+        const float* text = uncond + size;
+        float* sample = latents.data<float>();
+        if (fused) {
+            step_kernels::ensure_buffer(denoised, latent_shape);
+            step_kernels::step_combination(denoised.data<float>(), 1.0f, sample, -sigma,
+                                           step_kernels::ModelOutput::guided(noise_pred, guidance_scale), size);
+            step_kernels::linear_combination<2>(sample, {1.0f + dt / sigma, -dt / sigma}, {sample, denoised.data<const float>()}, size);
+        } else {
+            ov::Tensor guided(ov::element::f32, latent_shape), reference_denoised(ov::element::f32, latent_shape), prev_sample(ov::element::f32, latent_shape);
+            for (size_t i = 0; i < size; ++i)
+                guided.data<float>()[i] = uncond[i] + guidance_scale * (text[i] - uncond[i]);
+            for (size_t i = 0; i < size; ++i)
+                reference_denoised.data<float>()[i] = sample[i] - sigma * guided.data<float>()[i];
+            for (size_t i = 0; i < size; ++i)
+                prev_sample.data<float>()[i] = (sample[i] - reference_denoised.data<float>()[i]) / sigma * dt + sample[i];
+            std::copy_n(prev_sample.data<const float>(), size, sample);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * size);
+}
+BENCHMARK_CAPTURE(BM_GuidedEulerStep, separate, false)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_GuidedEulerStep, fused, true)->Unit(benchmark::kMicrosecond);
+
+double get_ns_per_unit(const std::string& time_unit) {
+    static const std::map<std::string, double> ns_per_unit = {{"ns", 1.0}, {"us", 1e3}, {"ms", 1e6}, {"s", 1e9}};
+    const auto it = ns_per_unit.find(time_unit);
+    OPENVINO_ASSERT(it != ns_per_unit.end(), "Unknown time unit: ", time_unit);
+    return it->second;
+}
+
+double get_ns_per_unit(benchmark::TimeUnit time_unit) {
+    switch (time_unit) {
+    case benchmark::kNanosecond:
+        return 1.0;
+    case benchmark::kMicrosecond:
+        return 1e3;
+    case benchmark::kMillisecond:
+        return 1e6;
+    default:
+        return 1e9;
+    }
+}
+
+// Keeps the best real time of every benchmark in addition to the console output to compare it with a baseline
+class BaselineReporter : public benchmark::ConsoleReporter {
+public:
+    void ReportRuns(const std::vector<Run>& runs) override {
+        for (const Run& run : runs) {
+            if (run.error_occurred || run.run_type != Run::RT_Iteration)
+                continue;
+            const double real_time_ns = run.GetAdjustedRealTime() * get_ns_per_unit(run.time_unit);
+            const auto it = m_real_time_ns.emplace(run.benchmark_name(), real_time_ns).first;
+            it->second = std::min(it->second, real_time_ns);
+        }
+        ConsoleReporter::ReportRuns(runs);
+    }
+
+    const std::map<std::string, double>& get_real_time_ns() const {
+        return m_real_time_ns;
+    }
+
+private:
+    std::map<std::string, double> m_real_time_ns;
+};
+
+// Reads a google benchmark JSON output, keeping the best real time of every benchmark
+std::map<std::string, double> read_baseline(const std::string& path) {
+    std::ifstream file(path);
+    OPENVINO_ASSERT(file.is_open(), "Cannot open baseline file ", path);
+    const nlohmann::json baseline = nlohmann::json::parse(file);
+    std::map<std::string, double> real_time_ns;
+    for (const auto& run : baseline.at("benchmarks")) {
+        if (run.value("run_type", "iteration") != "iteration" || run.value("error_occurred", false))
+            continue;
+        const double run_real_time_ns = run.at("real_time").get<double>() * get_ns_per_unit(run.at("time_unit").get<std::string>());
+        const auto it = real_time_ns.emplace(run.at("name").get<std::string>(), run_real_time_ns).first;
+        it->second = std::min(it->second, run_real_time_ns);
+    }
+    return real_time_ns;
+}
+
+// Returns a number of benchmarks which are slower than the baseline by more than the threshold
+size_t compare_with_baseline(const std::map<std::string, double>& real_time_ns, const std::map<std::string, double>& baseline, double threshold) {
+    size_t num_regressions = 0;
+    std::cout << std::fixed << std::setprecision(3);
+    for (const auto& [name, time_ns] : real_time_ns) {
+        const auto it = baseline.find(name);
+        if (it == baseline.end()) {
+            std::cout << "[ NEW        ] " << name << std::endl;
+            continue;
+        }
+        const double ratio = time_ns / it->second;
+        const bool is_regression = ratio > 1.0 + threshold;
+        num_regressions += is_regression;
+        std::cout << (is_regression ? "[ REGRESSION ] " : "[ OK         ] ") << name << ": " << ratio << "x of baseline" << std::endl;
+    }
+    return num_regressions;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) try {
+    std::string baseline_path;
+    double regression_threshold = 0.1;
+    // own flags are removed before google benchmark parses the command line
+    std::vector<char*> args;
+    for (int i = 0; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg.rfind("--baseline=", 0) == 0) {
+            baseline_path = arg.substr(std::string("--baseline=").size());
+        } else if (arg.rfind("--regression_threshold=", 0) == 0) {
+            regression_threshold = std::stod(arg.substr(std::string("--regression_threshold=").size()));
+        } else {
+            args.push_back(argv[i]);
+        }
+    }
+    int num_args = static_cast<int>(args.size());
+    args.push_back(nullptr);
+    benchmark::Initialize(&num_args, args.data());
+    if (benchmark::ReportUnrecognizedArguments(num_args, args.data()))
+        return EXIT_FAILURE;
+
+    BaselineReporter reporter;
+    benchmark::RunSpecifiedBenchmarks(&reporter);
+    benchmark::Shutdown();
+
+    if (baseline_path.empty())
+        return EXIT_SUCCESS;
+    const size_t num_regressions = compare_with_baseline(reporter.get_real_time_ns(), read_baseline(baseline_path), regression_threshold);
+    if (num_regressions > 0) {
+        std::cout << num_regressions << " benchmarks regressed by more than " << regression_threshold * 100 << "%" << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+} catch (const std::exception& error) {
+    std::cerr << error.what() << std::endl;
+    return EXIT_FAILURE;
+}
@@ -0,0 +1,105 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// Measures host side image preprocessing of VLM vision encoders for a 4K image and a multi-frame video.
+// Every model family is represented by the sequence of resize and normalization kernels it runs.
+// Usage: vlm_preprocessing_benchmark [num_iterations]
+
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "visual_language/clip.hpp"
+
+namespace {
+
+clip_image_u8 make_image(int nx, int ny, uint32_t seed) {
+    std::mt19937 engine(seed);
+    clip_image_u8 image{nx, ny, std::vector<uint8_t>(static_cast<size_t>(nx) * ny * 3)};
+    for (uint8_t& value : image.buf) {
+        value = static_cast<uint8_t>(engine());
+    }
+    return image;
+}
+
+clip_ctx make_ctx() {
+    clip_ctx ctx;
+    const float mean[3] = {0.48145466f, 0.4578275f, 0.40821073f};
+    const float std[3] = {0.26862954f, 0.26130258f, 0.27577711f};
+    std::copy(mean, mean + 3, ctx.image_mean);
+    std::copy(std, std + 3, ctx.image_std);
+    return ctx;
+}
+
+double measure_ms(const std::function<void()>& fn, size_t num_iterations) {
+    fn();  // warm-up
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t iteration = 0; iteration < num_iterations; ++iteration) {
+        fn();
+    }
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / num_iterations;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    const size_t num_iterations = argc > 1 ? std::max(1, std::atoi(argv[1])) : 10;
+
+    const clip_image_u8 image = make_image(3840, 2160, 42);
+    std::vector<clip_image_u8> frames;
+    for (uint32_t frame = 0; frame < 32; ++frame) {
+        frames.push_back(make_image(1280, 720, frame));
+    }
+    clip_ctx ctx = make_ctx();
+    clip_ctx_double ctx_double;
+    std::copy(ctx.image_mean, ctx.image_mean + 3, ctx_double.image_mean);
+    std::copy(ctx.image_std, ctx.image_std + 3, ctx_double.image_std);
+
+    const std::vector<std::pair<std::string, std::function<void()>>> families = {
+        {"llava (resize 336, crop, normalize)", [&]() {
+            clip_image_u8 resized;
+            bicubic_resize(image, resized, 597, 336);
+            clip_image_preprocess(ctx, center_crop(resized, 336, 336));
+        }},
+        {"qwen2vl (fused resize 1288x728, normalize)", [&]() {
+            bicubic_resize_and_preprocess(ctx, image, 1288, 728);
+        }},
+        {"gemma3 (fused bilinear 896x896, normalize)", [&]() {
+            bilinear_resize_and_preprocess(ctx, image, 896, 896);
+        }},
+        {"phi3_v (HD bilinear 1344x756, global 336, normalize)", [&]() {
+            clip_image_u8 hd, global;
+            bilinear_resize(image, hd, 1344, 756);
+            bicubic_resize(hd, global, 336, 336);
+            clip_image_preprocess(ctx, global);
+            clip_image_preprocess(ctx, hd);
+        }},
+        {"minicpm (9 slices 448x252, normalize)", [&]() {
+            for (int slice = 0; slice < 9; ++slice) {
+                clip_image_u8 resized;
+                bicubic_resize(image, resized, 448, 252);
+                clip_image_preprocess(ctx, resized);
+            }
+        }},
+        {"llava_next_video (32 frames 336, normalize)", [&]() {
+            for (const clip_image_u8& frame : frames) {
+                clip_image_u8 resized;
+                bicubic_resize(frame, resized, 597, 336);
+                normalize_and_convert_to_chw(center_crop(resized, 336, 336), ctx_double);
+            }
+        }},
+    };
+
+    std::cout << std::left << std::setw(56) << "model family" << std::right << std::setw(12) << "time, ms" << std::endl;
+    for (const auto& [name, fn] : families) {
+        std::cout << std::left << std::setw(56) << name << std::right << std::fixed << std::setprecision(2)
+                  << std::setw(12) << measure_ms(fn, num_iterations) << std::endl;
+    }
+    return EXIT_SUCCESS;
+}
@@ -99,7 +99,7 @@ protected:
     size_t num_layers = 3;
     size_t initial_num_free_blocks = 10;
     ov::genai::BlockAllocator allocator;
-    std::map<uint64_t, ov::genai::BlocksPerLayer> cached_blocks_map;
+    std::map<ov::genai::BlockHash, ov::genai::BlocksPerLayer> cached_blocks_map;
 };
 
 TEST_F(PrefixCachingBlockAllocatorTest, OnlyAllocatesAndFreesBlocksFromAllLayers) {
@@ -107,7 +107,7 @@ TEST_F(PrefixCachingBlockAllocatorTest, OnlyAllocatesAndFreesBlocksFromAllLayers
     EXPECT_THROW(allocator.allocate_block(0), ov::Exception);
 
     // allocate one block so that there is something to free
-    auto blocks_per_layer = allocator.allocate_block(0, cached_blocks_map);
+    auto blocks_per_layer = allocator.allocate_block(ov::genai::BlockHash(0), cached_blocks_map);
 
     EXPECT_THROW(allocator.free(blocks_per_layer[0], 0), ov::Exception);
     EXPECT_NO_THROW(allocator.free(blocks_per_layer));
@@ -119,9 +119,9 @@ TEST_F(PrefixCachingBlockAllocatorTest, OnlyAllocatesAndFreesBlocksFromAllLayers
 
 TEST_F(PrefixCachingBlockAllocatorTest, HandlesFreesCorrectlyWithMixedHashFrees) {
     // allocate one block so that there is something to free
-    auto a = allocator.allocate_block(0, cached_blocks_map);
-    auto b = allocator.allocate_block(1, cached_blocks_map);
-    auto c = allocator.allocate_block(2, cached_blocks_map);
+    auto a = allocator.allocate_block(ov::genai::BlockHash(0), cached_blocks_map);
+    auto b = allocator.allocate_block(ov::genai::BlockHash(1), cached_blocks_map);
+    auto c = allocator.allocate_block(ov::genai::BlockHash(2), cached_blocks_map);
     ASSERT_EQ(allocator.num_free_blocks(0), 7);
 
     // allocator.free(cached_blocks_map);
@@ -129,8 +129,8 @@ TEST_F(PrefixCachingBlockAllocatorTest, HandlesFreesCorrectlyWithMixedHashFrees)
     {
         ov::genai::BlocksPerLayer mixed_hash_blocks;
         mixed_hash_blocks.reserve(num_layers);
-        auto hash_0_blocks = cached_blocks_map[0];
-        auto hash_1_blocks = cached_blocks_map[1];
+        auto hash_0_blocks = cached_blocks_map[ov::genai::BlockHash(0)];
+        auto hash_1_blocks = cached_blocks_map[ov::genai::BlockHash(1)];
         std::copy(hash_0_blocks.begin(), hash_0_blocks.begin() + num_layers / 2, std::back_inserter(mixed_hash_blocks));
         std::copy(hash_1_blocks.begin() + num_layers / 2, hash_1_blocks.end(), std::back_inserter(mixed_hash_blocks));
 
@@ -143,8 +143,8 @@ TEST_F(PrefixCachingBlockAllocatorTest, HandlesFreesCorrectlyWithMixedHashFrees)
     {
         ov::genai::BlocksPerLayer mixed_hash_blocks;
         mixed_hash_blocks.reserve(num_layers);
-        auto hash_0_blocks = cached_blocks_map[0];
-        auto hash_1_blocks = cached_blocks_map[1];
+        auto hash_0_blocks = cached_blocks_map[ov::genai::BlockHash(0)];
+        auto hash_1_blocks = cached_blocks_map[ov::genai::BlockHash(1)];
         std::copy(hash_0_blocks.begin() + num_layers / 2, hash_0_blocks.end(), std::back_inserter(mixed_hash_blocks));
         std::copy(hash_1_blocks.begin(), hash_1_blocks.begin() + num_layers / 2, std::back_inserter(mixed_hash_blocks));
 
@@ -158,24 +158,24 @@ TEST_F(PrefixCachingBlockAllocatorTest, HandlesFreesCorrectlyWithMixedHashFrees)
 }
 
 TEST_F(PrefixCachingBlockAllocatorTest, AllocatesFromOverwriteableBlocksWhenFreePoolIsExhausted) {
-    allocator.allocate_block(0, cached_blocks_map);
-    allocator.allocate_block(1, cached_blocks_map);
-    allocator.allocate_block(2, cached_blocks_map);
+    allocator.allocate_block(ov::genai::BlockHash(0), cached_blocks_map);
+    allocator.allocate_block(ov::genai::BlockHash(1), cached_blocks_map);
+    allocator.allocate_block(ov::genai::BlockHash(2), cached_blocks_map);
 
-    allocator.free(cached_blocks_map[0]);
-    allocator.free(cached_blocks_map[1]);
-    allocator.free(cached_blocks_map[2]);
+    allocator.free(cached_blocks_map[ov::genai::BlockHash(0)]);
+    allocator.free(cached_blocks_map[ov::genai::BlockHash(1)]);
+    allocator.free(cached_blocks_map[ov::genai::BlockHash(2)]);
 
     ASSERT_EQ(allocator.num_overwriteable_blocks(), 3);
 
     std::vector<ov::genai::BlocksPerLayer> block_to_release;
     for (size_t i = 0; i < initial_num_free_blocks - 3; i++) {
-        block_to_release.push_back(allocator.allocate_block(1337 + i, cached_blocks_map));
+        block_to_release.push_back(allocator.allocate_block(ov::genai::BlockHash(1337 + i), cached_blocks_map));
         EXPECT_EQ(allocator.num_overwriteable_blocks(), 3);
     }
 
     EXPECT_EQ(allocator.num_overwriteable_blocks(), 3);
-    block_to_release.push_back(allocator.allocate_block(31337, cached_blocks_map));
+    block_to_release.push_back(allocator.allocate_block(ov::genai::BlockHash(31337), cached_blocks_map));
     EXPECT_EQ(allocator.num_overwriteable_blocks(), 2);
 
     for (auto& block : block_to_release) {
@@ -186,13 +186,13 @@ TEST_F(PrefixCachingBlockAllocatorTest, AllocatesFromOverwriteableBlocksWhenFree
 TEST_F(PrefixCachingBlockAllocatorTest, ThrowsAtAllocationWhenFull) {
     std::vector<ov::genai::BlocksPerLayer> blocks_to_release;
     for (size_t i = 0; i < initial_num_free_blocks; i++) {
-        blocks_to_release.push_back(allocator.allocate_block(1337 + i, cached_blocks_map));
+        blocks_to_release.push_back(allocator.allocate_block(ov::genai::BlockHash(1337 + i), cached_blocks_map));
     }
 
     ASSERT_EQ(allocator.num_overwriteable_blocks(), 0);
     ASSERT_EQ(allocator.num_free_blocks(0), 0);
 
-    EXPECT_THROW(blocks_to_release.push_back(allocator.allocate_block(31337, cached_blocks_map)), ov::Exception);
+    EXPECT_THROW(blocks_to_release.push_back(allocator.allocate_block(ov::genai::BlockHash(31337), cached_blocks_map)), ov::Exception);
 
     for (auto& block : blocks_to_release) {
         allocator.free(block);
@@ -201,24 +201,24 @@ TEST_F(PrefixCachingBlockAllocatorTest, ThrowsAtAllocationWhenFull) {
 
 TEST_F(PrefixCachingBlockAllocatorTest, HandlesHashCollisionsAtFreeCorrectly) {
     // TODO (vshampor): also handle collisions during allocations (multimap instead of map?)
-    auto cached_blocks_map = std::map<uint64_t, ov::genai::BlocksPerLayer>{};
-    auto first_hash_0_block = allocator.allocate_block(0, cached_blocks_map);
+    auto cached_blocks_map = std::map<ov::genai::BlockHash, ov::genai::BlocksPerLayer>{};
+    auto first_hash_0_block = allocator.allocate_block(ov::genai::BlockHash(0), cached_blocks_map);
     allocator.free(first_hash_0_block);
     ASSERT_EQ(allocator.num_overwriteable_blocks(), 1);
 
     // double free
     ASSERT_THROW(allocator.free(first_hash_0_block), ov::Exception);
 
-    ov::genai::BlocksPerLayer blocks_to_release = allocator.allocate_block(1, cached_blocks_map);
-    auto second_hash_0_block = allocator.allocate_block(0, cached_blocks_map);
+    ov::genai::BlocksPerLayer blocks_to_release = allocator.allocate_block(ov::genai::BlockHash(1), cached_blocks_map);
+    auto second_hash_0_block = allocator.allocate_block(ov::genai::BlockHash(0), cached_blocks_map);
     EXPECT_EQ(allocator.num_overwriteable_blocks(), 1);
 
     // this "free" should replace the old block with the same hash in the overwritable store
     allocator.free(second_hash_0_block);
     EXPECT_EQ(allocator.num_overwriteable_blocks(), 1);
 
-    std::map<uint64_t, ov::genai::BlocksPerLayer> empty_map{};  // to force allocator to take the block from overwritable store
-    auto internal_overwriteable_block = allocator.get_cached_block(0, empty_map);
+    std::map<ov::genai::BlockHash, ov::genai::BlocksPerLayer> empty_map{};  // to force allocator to take the block from overwritable store
+    auto internal_overwriteable_block = allocator.get_cached_block(ov::genai::BlockHash(0), empty_map);
     for (size_t layer_idx = 0; layer_idx < internal_overwriteable_block.size(); layer_idx++) {
         EXPECT_EQ(internal_overwriteable_block[layer_idx], second_hash_0_block[layer_idx]);
     }
@@ -252,17 +252,17 @@ TEST(TestBlockAllocator, CalculatesUsagePercentageCorrectlyWithPrefixCaching) {
     auto allocator = ov::genai::BlockAllocator(initial_num_free_blocks, true, num_layers);
     ASSERT_NEAR(allocator.get_used_percentage(), 0.0, 1e-5);
 
-    std::map<uint64_t, ov::genai::BlocksPerLayer> prefix_hash_map;
+    std::map<ov::genai::BlockHash, ov::genai::BlocksPerLayer> prefix_hash_map;
     for (uint64_t mock_hash: {13, 42, 1337}) {
-        allocator.allocate_block(mock_hash, prefix_hash_map);
+        allocator.allocate_block(ov::genai::BlockHash(mock_hash), prefix_hash_map);
     }
     ASSERT_NEAR(allocator.get_used_percentage(), 30.0, 1e-5);
 
-    allocator.free(prefix_hash_map[13]);
-    prefix_hash_map.erase(13);
+    allocator.free(prefix_hash_map[ov::genai::BlockHash(13)]);
+    prefix_hash_map.erase(ov::genai::BlockHash(13));
     ASSERT_NEAR(allocator.get_used_percentage(), 20.0, 1e-5);
 
-    allocator.allocate_block(13, prefix_hash_map);
+    allocator.allocate_block(ov::genai::BlockHash(13), prefix_hash_map);
     ASSERT_NEAR(allocator.get_used_percentage(), 30.0, 1e-5);
     for (auto& allocated_block : prefix_hash_map) {
         allocator.free(prefix_hash_map[allocated_block.first]);
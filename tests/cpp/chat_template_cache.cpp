@@ -0,0 +1,43 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "tokenizer/chat_template_cache.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+const std::string simple_template = "{% for message in messages %}{{ message['role'] + ': ' + message['content'] }}\n{% endfor %}";
+
+} // namespace
+
+TEST(TestChatTemplateCache, reuses_parsed_template) {
+    ChatTemplateCache cache(2);
+    auto parsed = cache.get(simple_template, "<s>", "</s>");
+    EXPECT_EQ(parsed, cache.get(simple_template, "<s>", "</s>"));
+    // special tokens are substituted by parser
+    EXPECT_NE(parsed, cache.get(simple_template, "<bos>", "</s>"));
+    EXPECT_EQ(cache.size(), 2);
+
+    minja::chat_template_inputs inputs;
+    inputs.messages = nlohmann::ordered_json::array({{{"role", "user"}, {"content", "hi"}}});
+    EXPECT_EQ(parsed->apply(inputs), "user: hi\n");
+}
+
+TEST(TestChatTemplateCache, evicts_least_recently_used) {
+    ChatTemplateCache cache(1);
+    auto first = cache.get(simple_template, "<s>", "</s>");
+    cache.get("{{ messages[0]['content'] }}", "<s>", "</s>");
+    EXPECT_EQ(cache.size(), 1);
+    // evicted templates stay valid for their users, but are parsed again on next request
+    EXPECT_NE(first, cache.get(simple_template, "<s>", "</s>"));
+}
+
+TEST(TestChatTemplateCache, does_not_cache_invalid_templates) {
+    ChatTemplateCache cache;
+    EXPECT_ANY_THROW(cache.get("{% for message in messages %}", "<s>", "</s>"));
+    EXPECT_EQ(cache.size(), 0);
+}
@@ -0,0 +1,149 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "tokenizer/chat_tokenization_cache.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+const std::string EOS_TOKEN = "</s>";
+constexpr int64_t EOS_TOKEN_ID = 2, PREFIX_TOKEN_ID = 1;
+
+// Encodes every character as a token, EOS text is split out as a special token
+struct FakeTokenizer {
+    bool strip_after_eos = false;   // EOS token consumes whitespace following it
+    bool add_prefix = false;        // beginning of input is marked, as tokenizers adding prefix space do
+    size_t num_encoded_chars = 0;
+
+    std::vector<int64_t> operator()(const std::string& text) {
+        num_encoded_chars += text.size();
+        std::vector<int64_t> tokens;
+        if (add_prefix) {
+            tokens.push_back(PREFIX_TOKEN_ID);
+        }
+        for (size_t pos = 0; pos < text.size();) {
+            if (text.compare(pos, EOS_TOKEN.size(), EOS_TOKEN) == 0) {
+                tokens.push_back(EOS_TOKEN_ID);
+                pos += EOS_TOKEN.size();
+                while (strip_after_eos && pos < text.size() && text[pos] == ' ') {
+                    ++pos;
+                }
+            } else {
+                tokens.push_back(100 + static_cast<unsigned char>(text[pos++]));
+            }
+        }
+        return tokens;
+    }
+};
+
+std::vector<int64_t> to_vector(const ov::Tensor& input_ids) {
+    const int64_t* data = input_ids.data<const int64_t>();
+    return std::vector<int64_t>(data, data + input_ids.get_size());
+}
+
+std::string make_history(size_t num_turns, const std::string& separator = "") {
+    std::string history = "<|system|>You are a helpful assistant" + EOS_TOKEN;
+    for (size_t turn = 0; turn < num_turns; ++turn) {
+        history += separator + "<|user|>question " + std::to_string(turn) + EOS_TOKEN + separator + "<|assistant|>";
+        history += "answer " + std::to_string(turn) + EOS_TOKEN;
+    }
+    return history;
+}
+
+class ChatTokenizationCacheTest : public ::testing::Test {
+protected:
+    TokenizedInputs encode(const std::string& history) {
+        return cache.encode([this](const std::string& text) { return tokenizer(text); }, EOS_TOKEN, EOS_TOKEN_ID, history);
+    }
+
+    std::vector<int64_t> encode_reference(const std::string& history) {
+        FakeTokenizer reference = tokenizer;
+        return reference(history);
+    }
+
+    FakeTokenizer tokenizer;
+    ChatTokenizationCache cache;
+};
+
+} // namespace
+
+TEST_F(ChatTokenizationCacheTest, spliced_tokens_match_full_encoding_over_turns) {
+    for (size_t turn = 0; turn < 20; ++turn) {
+        const std::string history = make_history(turn) + "<|user|>question " + std::to_string(turn) + EOS_TOKEN + "<|assistant|>";
+        const size_t num_encoded_chars = tokenizer.num_encoded_chars;
+        TokenizedInputs encoded = encode(history);
+
+        ASSERT_EQ(to_vector(encoded.input_ids), encode_reference(history)) << "turn " << turn;
+        ASSERT_EQ(encoded.attention_mask.get_size(), encoded.input_ids.get_size());
+        if (turn > 0) {
+            EXPECT_GT(cache.get_num_reused_tokens(), 0) << "turn " << turn;
+        }
+        // the first splice is verified by full encoding, later turns encode the new messages only
+        if (turn > 1) {
+            EXPECT_LT(tokenizer.num_encoded_chars - num_encoded_chars, 100) << "turn " << turn;
+        }
+    }
+}
+
+TEST_F(ChatTokenizationCacheTest, spliced_tokens_keep_effects_of_eos_token_on_following_text) {
+    tokenizer.strip_after_eos = true;
+    for (size_t turn = 1; turn < 10; ++turn) {
+        const std::string history = make_history(turn, " ");
+        ASSERT_EQ(to_vector(encode(history).input_ids), encode_reference(history)) << "turn " << turn;
+        if (turn > 1) {
+            EXPECT_GT(cache.get_num_reused_tokens(), 0) << "turn " << turn;
+        }
+    }
+}
+
+TEST_F(ChatTokenizationCacheTest, diverged_history_is_encoded_from_the_last_common_boundary) {
+    encode(make_history(4));
+    encode(make_history(5));
+    const size_t num_reused_tokens = cache.get_num_reused_tokens();
+
+    // edited message in the middle of history
+    std::string edited = make_history(5);
+    edited.replace(edited.find("answer 2"), 8, "edited answer");
+    ASSERT_EQ(to_vector(encode(edited).input_ids), encode_reference(edited));
+    EXPECT_GT(cache.get_num_reused_tokens(), 0);
+    EXPECT_LT(cache.get_num_reused_tokens(), num_reused_tokens);
+
+    // truncated history
+    const std::string truncated = make_history(2) + "<|user|>new question";
+    ASSERT_EQ(to_vector(encode(truncated).input_ids), encode_reference(truncated));
+    EXPECT_GT(cache.get_num_reused_tokens(), 0);
+
+    // nothing in common up to the first boundary
+    const std::string other = "<|system|>Another system message" + EOS_TOKEN + "<|user|>question";
+    ASSERT_EQ(to_vector(encode(other).input_ids), encode_reference(other));
+    EXPECT_EQ(cache.get_num_reused_tokens(), 0);
+
+    // the cache follows the latest history
+    const std::string continued = other + EOS_TOKEN + "<|assistant|>answer";
+    ASSERT_EQ(to_vector(encode(continued).input_ids), encode_reference(continued));
+    EXPECT_GT(cache.get_num_reused_tokens(), 0);
+}
+
+TEST_F(ChatTokenizationCacheTest, reset_drops_history) {
+    encode(make_history(3));
+    encode(make_history(4));
+    EXPECT_GT(cache.get_num_reused_tokens(), 0);
+
+    cache.reset();
+    EXPECT_EQ(cache.get_num_reused_tokens(), 0);
+    ASSERT_EQ(to_vector(encode(make_history(5)).input_ids), encode_reference(make_history(5)));
+    EXPECT_EQ(cache.get_num_reused_tokens(), 0);
+}
+
+TEST_F(ChatTokenizationCacheTest, tokenizer_altering_beginning_of_input_disables_splicing) {
+    tokenizer.add_prefix = true;
+    for (size_t turn = 1; turn < 5; ++turn) {
+        const std::string history = make_history(turn);
+        ASSERT_EQ(to_vector(encode(history).input_ids), encode_reference(history)) << "turn " << turn;
+        EXPECT_EQ(cache.get_num_reused_tokens(), 0) << "turn " << turn;
+    }
+}
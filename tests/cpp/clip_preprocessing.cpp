@@ -0,0 +1,150 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+
+#include "visual_language/clip.hpp"
+
+namespace {
+
+clip_image_u8 make_random_image(int nx, int ny, uint32_t seed) {
+    std::mt19937 engine(seed);
+    std::uniform_int_distribution<int> distribution(0, 255);
+    clip_image_u8 image{nx, ny, std::vector<uint8_t>(static_cast<size_t>(nx) * ny * 3)};
+    for (uint8_t& value : image.buf) {
+        value = static_cast<uint8_t>(distribution(engine));
+    }
+    return image;
+}
+
+// Straightforward per-pixel Pillow resampling used as a reference
+clip_image_u8 reference_bicubic_resize(const clip_image_u8& img, int out_w, int out_h) {
+    constexpr int PRECISION_BITS = 32 - 8 - 2;
+    auto filter = [](double x) {
+        constexpr double a = -0.5;
+        x = std::abs(x);
+        if (x < 1.0)
+            return ((a + 2.0) * x - (a + 3.0)) * x * x + 1.0;
+        if (x < 2.0)
+            return (((x - 5.0) * x + 8.0) * x - 4.0) * a;
+        return 0.0;
+    };
+    // resamples 'count' lines of 'in_size' pixels along one axis
+    auto resample = [&](const std::vector<uint8_t>& src, int in_size, int out_size, int count, bool horizontal, int width) {
+        const double scale = double(in_size) / out_size;
+        const double filterscale = std::max(scale, 1.0);
+        const double support = 2.0 * filterscale;
+        std::vector<uint8_t> dst(static_cast<size_t>(horizontal ? out_size * count : out_size * width) * 3);
+        for (int o = 0; o < out_size; ++o) {
+            const double center = (o + 0.5) * scale;
+            const int xmin = std::max(0, int(center - support + 0.5));
+            const int xmax = std::min(in_size, int(center + support + 0.5));
+            std::vector<double> k;
+            double ww = 0.0;
+            for (int i = xmin; i < xmax; ++i) {
+                k.push_back(filter((i - center + 0.5) * (1.0 / filterscale)));
+                ww += k.back();
+            }
+            std::vector<int32_t> kk;
+            for (double w : k) {
+                const double v = w / ww;
+                kk.push_back(static_cast<int32_t>((v < 0.0 ? -0.5 : 0.5) + v * (1 << PRECISION_BITS)));
+            }
+            for (int line = 0; line < count; ++line) {
+                for (int c = 0; c < 3; ++c) {
+                    int ss = 1 << (PRECISION_BITS - 1);
+                    for (int i = xmin; i < xmax; ++i) {
+                        const size_t idx = horizontal ? (size_t(line) * in_size + i) * 3 + c : (size_t(i) * width + line) * 3 + c;
+                        ss += int(src[idx]) * kk[i - xmin];
+                    }
+                    const size_t out_idx = horizontal ? (size_t(line) * out_size + o) * 3 + c : (size_t(o) * width + line) * 3 + c;
+                    dst[out_idx] = static_cast<uint8_t>(std::clamp(ss >> PRECISION_BITS, 0, 255));
+                }
+            }
+        }
+        return dst;
+    };
+
+    std::vector<uint8_t> buf = img.buf;
+    int width = img.nx;
+    if (out_w != img.nx) {
+        buf = resample(buf, img.nx, out_w, img.ny, true, 0);
+        width = out_w;
+    }
+    if (out_h != img.ny) {
+        buf = resample(buf, img.ny, out_h, width, false, width);
+    }
+    return clip_image_u8{out_w, out_h, buf};
+}
+
+clip_ctx make_ctx() {
+    clip_ctx ctx;
+    const float mean[3] = {0.48145466f, 0.4578275f, 0.40821073f};
+    const float std[3] = {0.26862954f, 0.26130258f, 0.27577711f};
+    std::copy(mean, mean + 3, ctx.image_mean);
+    std::copy(std, std + 3, ctx.image_std);
+    return ctx;
+}
+
+}  // namespace
+
+class ClipResizeTest : public ::testing::TestWithParam<std::tuple<int, int, int, int>> {};
+
+TEST_P(ClipResizeTest, MatchesPerPixelReference) {
+    const auto [in_w, in_h, out_w, out_h] = GetParam();
+    const clip_image_u8 image = make_random_image(in_w, in_h, in_w * 31 + in_h);
+
+    clip_image_u8 resized;
+    bicubic_resize(image, resized, out_w, out_h);
+    const clip_image_u8 reference = reference_bicubic_resize(image, out_w, out_h);
+    ASSERT_EQ(resized.nx, out_w);
+    ASSERT_EQ(resized.ny, out_h);
+    EXPECT_EQ(resized.buf, reference.buf);
+}
+
+INSTANTIATE_TEST_SUITE_P(Shapes,
+                         ClipResizeTest,
+                         ::testing::Values(std::make_tuple(64, 48, 64, 48),     // copy
+                                           std::make_tuple(97, 53, 31, 53),     // horizontal only
+                                           std::make_tuple(40, 90, 40, 33),     // vertical only
+                                           std::make_tuple(333, 211, 224, 224), // downscale
+                                           std::make_tuple(17, 11, 70, 45)));   // upscale
+
+TEST(ClipPreprocess, FusedResizeMatchesSeparateSteps) {
+    clip_ctx ctx = make_ctx();
+    const clip_image_u8 image = make_random_image(157, 93, 7);
+
+    clip_image_u8 resized;
+    bicubic_resize(image, resized, 112, 84);
+    const clip_image_f32 expected = clip_image_preprocess(ctx, resized);
+    const clip_image_f32 fused = bicubic_resize_and_preprocess(ctx, image, 112, 84);
+    ASSERT_EQ(fused.nx, expected.nx);
+    ASSERT_EQ(fused.ny, expected.ny);
+    EXPECT_EQ(fused.buf, expected.buf);
+
+    bilinear_resize(image, resized, 60, 200);
+    EXPECT_EQ(bilinear_resize_and_preprocess(ctx, image, 60, 200).buf, clip_image_preprocess(ctx, resized).buf);
+}
+
+TEST(ClipPreprocess, NormalizesToChannelsFirst) {
+    clip_ctx ctx = make_ctx();
+    const clip_image_u8 image = make_random_image(13, 9, 3);
+    const clip_image_f32 normalized = clip_image_preprocess(ctx, image);
+
+    clip_ctx_double ctx_double;
+    std::copy(ctx.image_mean, ctx.image_mean + 3, ctx_double.image_mean);
+    std::copy(ctx.image_std, ctx.image_std + 3, ctx_double.image_std);
+    const clip_image_f32 normalized_double = normalize_and_convert_to_chw(image, ctx_double);
+
+    const size_t plane = 13 * 9;
+    for (size_t pixel = 0; pixel < plane; ++pixel) {
+        for (size_t c = 0; c < 3; ++c) {
+            const uint8_t value = image.buf[pixel * 3 + c];
+            EXPECT_EQ(normalized.buf[c * plane + pixel], ((float(value) / 255.0f) - ctx.image_mean[c]) / ctx.image_std[c]);
+            EXPECT_EQ(normalized_double.buf[c * plane + pixel], static_cast<float>((double(value) - ctx_double.image_mean[c]) / ctx_double.image_std[c]));
+        }
+    }
+}
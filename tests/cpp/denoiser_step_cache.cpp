@@ -0,0 +1,89 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <algorithm>
+
+#include "image_generation/denoiser_step_cache.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+ov::Tensor make_tensor(float value, size_t size = 8) {
+    ov::Tensor tensor(ov::element::f32, {1, size});
+    std::fill_n(tensor.data<float>(), size, value);
+    return tensor;
+}
+
+} // namespace
+
+TEST(TestDenoiserStepCache, disabled_by_default) {
+    ImageGenerationConfig config;
+    DenoiserStepCache cache(config, 10);
+    EXPECT_FALSE(cache.is_enabled());
+    for (size_t step = 0; step < 10; ++step) {
+        EXPECT_TRUE(cache.should_compute(step, make_tensor(1.0f)));
+    }
+}
+
+TEST(TestDenoiserStepCache, interval_policy) {
+    ImageGenerationConfig config;
+    config.step_cache_interval = 3;
+    const size_t num_steps = 8;
+    DenoiserStepCache cache(config, num_steps);
+
+    std::vector<bool> computed;
+    for (size_t step = 0; step < num_steps; ++step) {
+        ov::Tensor input = make_tensor(1.0f);
+        bool compute = cache.should_compute(step, input);
+        computed.push_back(compute);
+        if (compute) {
+            cache.update(make_tensor(static_cast<float>(step)));
+        } else {
+            // reused output is produced by the last computed step
+            EXPECT_EQ(cache.get_cached_output().data<float>()[0], static_cast<float>(step - step % 3));
+        }
+    }
+
+    // the last step is always computed
+    std::vector<bool> expected = {true, false, false, true, false, false, true, true};
+    EXPECT_EQ(computed, expected);
+}
+
+TEST(TestDenoiserStepCache, threshold_policy) {
+    ImageGenerationConfig config;
+    config.step_cache_threshold = 0.25f;
+    const size_t num_steps = 6;
+    DenoiserStepCache cache(config, num_steps);
+
+    // each step changes input by 10% relatively to previous one
+    std::vector<float> inputs = {1.0f, 1.1f, 1.21f, 1.331f, 1.4641f, 1.61051f};
+    std::vector<bool> computed;
+    for (size_t step = 0; step < num_steps; ++step) {
+        bool compute = cache.should_compute(step, make_tensor(inputs[step]));
+        computed.push_back(compute);
+        if (compute)
+            cache.update(make_tensor(inputs[step]));
+    }
+
+    std::vector<bool> expected = {true, false, false, true, false, true};
+    EXPECT_EQ(computed, expected);
+}
+
+TEST(TestDenoiserStepCache, reused_output_is_not_affected_by_inplace_updates) {
+    ImageGenerationConfig config;
+    config.step_cache_interval = 4;
+    DenoiserStepCache cache(config, 10);
+
+    ASSERT_TRUE(cache.should_compute(0, make_tensor(1.0f)));
+    cache.update(make_tensor(5.0f));
+
+    ASSERT_FALSE(cache.should_compute(1, make_tensor(1.0f)));
+    ov::Tensor reused = cache.get_cached_output();
+    reused.data<float>()[0] = -1.0f;
+
+    ASSERT_FALSE(cache.should_compute(2, make_tensor(1.0f)));
+    EXPECT_EQ(cache.get_cached_output().data<float>()[0], 5.0f);
+}
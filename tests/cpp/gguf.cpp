@@ -0,0 +1,189 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifdef ENABLE_GGUF
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+#include "gguf_utils/gguf.hpp"
+
+namespace {
+
+constexpr uint64_t ALIGNMENT = 32;  // GGUF default alignment of tensor data
+
+struct FixtureTensor {
+    std::string name;
+    std::vector<uint64_t> dims;  // GGML order, the innermost dimension goes first
+    uint32_t type;
+    std::vector<uint8_t> data;
+};
+
+uint64_t align(uint64_t offset) {
+    return (offset + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+}
+
+// Writes GGUF v3 file with a single string metadata entry and given tensors
+void write_gguf(const std::filesystem::path& path, const std::vector<FixtureTensor>& tensors) {
+    std::vector<uint8_t> bytes;
+    auto put = [&bytes](const auto& value) {
+        const uint8_t* begin = reinterpret_cast<const uint8_t*>(&value);
+        bytes.insert(bytes.end(), begin, begin + sizeof(value));
+    };
+    auto put_string = [&](const std::string& str) {
+        put(static_cast<uint64_t>(str.size()));
+        bytes.insert(bytes.end(), str.begin(), str.end());
+    };
+
+    bytes.insert(bytes.end(), {'G', 'G', 'U', 'F'});
+    put(uint32_t{3});
+    put(static_cast<uint64_t>(tensors.size()));
+    put(uint64_t{1});
+
+    put_string("general.architecture");
+    put(static_cast<uint32_t>(GGUF_VALUE_TYPE_STRING));
+    put_string("llama");
+
+    uint64_t data_offset = 0;
+    for (const auto& tensor : tensors) {
+        put_string(tensor.name);
+        put(static_cast<uint32_t>(tensor.dims.size()));
+        for (uint64_t dim : tensor.dims)
+            put(dim);
+        put(tensor.type);
+        put(data_offset);
+        data_offset = align(data_offset + tensor.data.size());
+    }
+
+    for (const auto& tensor : tensors) {
+        bytes.resize(align(bytes.size()), 0);
+        bytes.insert(bytes.end(), tensor.data.begin(), tensor.data.end());
+    }
+
+    std::ofstream file(path, std::ios::binary);
+    file.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+}
+
+std::vector<uint8_t> read_file(const std::filesystem::path& path) {
+    std::ifstream file(path, std::ios::binary);
+    return std::vector<uint8_t>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+template <typename T>
+std::vector<uint8_t> to_bytes(const std::vector<T>& values) {
+    const uint8_t* begin = reinterpret_cast<const uint8_t*>(values.data());
+    return std::vector<uint8_t>(begin, begin + values.size() * sizeof(T));
+}
+
+// Q8_0 blocks of 'num_blocks' x |f16 scale|32 x int8 weights| with weight j of block i equal to (i + j) % 256 - 128
+std::vector<uint8_t> make_q8_0_blocks(size_t num_blocks, float scale) {
+    std::vector<uint8_t> blocks;
+    for (size_t i = 0; i < num_blocks; ++i) {
+        const uint16_t scale_bits = ov::float16(scale * (i + 1)).to_bits();
+        blocks.push_back(scale_bits & 0xFF);
+        blocks.push_back(scale_bits >> 8);
+        for (size_t j = 0; j < 32; ++j)
+            blocks.push_back(static_cast<uint8_t>(static_cast<int8_t>((i + j) % 256 - 128)));
+    }
+    return blocks;
+}
+
+class GGUFLoadTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_path = std::filesystem::temp_directory_path() /
+                 ("genai_gguf_test_" + std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()) + ".gguf");
+
+        std::vector<float> embeddings(8);
+        for (size_t i = 0; i < embeddings.size(); ++i)
+            embeddings[i] = 0.5f * i - 1.0f;
+        std::vector<ov::float16> norm(4);
+        for (size_t i = 0; i < norm.size(); ++i)
+            norm[i] = ov::float16(1.0f + i);
+
+        // several quantized tensors, so they are repacked concurrently
+        write_gguf(m_path, {
+            {"token_embd.weight", {4, 2}, GGUF_TYPE_F32, to_bytes(embeddings)},
+            {"blk.0.attn_norm.weight", {4}, GGUF_TYPE_F16, to_bytes(norm)},
+            {"blk.0.attn_q.weight", {64, 2}, GGUF_TYPE_Q8_0, make_q8_0_blocks(4, 0.25f)},
+            {"blk.0.attn_k.weight", {32, 3}, GGUF_TYPE_Q8_0, make_q8_0_blocks(3, 0.5f)},
+        });
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(m_path);
+    }
+
+    // checks Q8_0 tensor repacked into u8 weights with f16 scales and biases, one per block of 32 weights
+    static void check_q8_0(const std::unordered_map<std::string, ov::Tensor>& arrays, const std::string& prefix, size_t num_blocks, float scale) {
+        const ov::Tensor& weights = arrays.at(prefix + ".weight");
+        const ov::Tensor& scales = arrays.at(prefix + ".scales");
+        const ov::Tensor& biases = arrays.at(prefix + ".biases");
+        ASSERT_EQ(weights.get_byte_size(), num_blocks * 32);
+        ASSERT_EQ(scales.get_size(), num_blocks);
+        ASSERT_EQ(biases.get_size(), num_blocks);
+
+        const uint8_t* weights_data = static_cast<const uint8_t*>(weights.data());
+        for (size_t i = 0; i < num_blocks; ++i) {
+            const float block_scale = static_cast<float>(scales.data<const ov::float16>()[i]);
+            EXPECT_EQ(block_scale, static_cast<float>(ov::float16(scale * (i + 1))));
+            EXPECT_EQ(static_cast<float>(biases.data<const ov::float16>()[i]), static_cast<float>(ov::float16(-128.f * block_scale)));
+            // weights are shifted by 128 from original int8 ones, which is compensated by biases
+            for (size_t j = 0; j < 32; ++j)
+                EXPECT_EQ(weights_data[i * 32 + j], (i + j) % 256) << prefix << " block " << i << " weight " << j;
+        }
+    }
+
+    std::filesystem::path m_path;
+};
+
+} // namespace
+
+TEST_F(GGUFLoadTest, loads_tensor_values_and_metadata) {
+    auto [metadata, arrays, qtypes] = get_gguf_data(m_path.string());
+
+    EXPECT_EQ(std::get<std::string>(metadata.at("general.architecture")), "llama");
+
+    const ov::Tensor& embeddings = arrays.at("token_embd.weight");
+    ASSERT_EQ(embeddings.get_element_type(), ov::element::f32);
+    ASSERT_EQ(embeddings.get_shape(), ov::Shape({2, 4}));
+    for (size_t i = 0; i < embeddings.get_size(); ++i)
+        EXPECT_EQ(embeddings.data<const float>()[i], 0.5f * i - 1.0f);
+
+    const ov::Tensor& norm = arrays.at("blk.0.attn_norm.weight");
+    ASSERT_EQ(norm.get_element_type(), ov::element::f16);
+    for (size_t i = 0; i < norm.get_size(); ++i)
+        EXPECT_EQ(static_cast<float>(norm.data<const ov::float16>()[i]), 1.0f + i);
+
+    check_q8_0(arrays, "blk.0.attn_q", 4, 0.25f);
+    check_q8_0(arrays, "blk.0.attn_k", 3, 0.5f);
+    EXPECT_EQ(qtypes.at("blk.0.attn_q.qtype"), GGUF_TYPE_Q8_0);
+    EXPECT_EQ(qtypes.at("token_embd.qtype"), GGUF_TYPE_F32);
+}
+
+TEST_F(GGUFLoadTest, loading_never_writes_to_mapped_file) {
+    const std::vector<uint8_t> original = read_file(m_path);
+    {
+        auto [metadata, arrays, qtypes] = get_gguf_data(m_path.string());
+        // tensors used in place keep their mapping alive after the loader released gguf contexts
+        ov::Tensor embeddings = arrays.at("token_embd.weight");
+        EXPECT_EQ(embeddings.data<const float>()[1], -0.5f);
+        EXPECT_EQ(read_file(m_path), original);
+#if GTEST_HAS_DEATH_TEST && !defined(_WIN32)
+        // weights used in place alias read-only mapping, so a write faults instead of reaching the file
+        EXPECT_DEATH(static_cast<float*>(embeddings.data())[0] = 42.0f, "");
+#endif
+    }
+    EXPECT_EQ(read_file(m_path), original);
+
+    // metadata only loading neither maps nor repacks tensors
+    auto [metadata, arrays, qtypes] = get_gguf_data(m_path.string(), true);
+    EXPECT_TRUE(arrays.empty());
+    EXPECT_EQ(read_file(m_path), original);
+}
+
+#endif // ENABLE_GGUF
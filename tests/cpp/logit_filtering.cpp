@@ -304,6 +304,70 @@ TEST(PresencePenaltyTransformInitializationTest, ThrowsForInvalidInputIds) {
     EXPECT_THROW(transform.apply(logits, {0, -1}), ov::Exception);
 }
 
+TEST(PenaltyTransformTest, FusedPenaltiesEqualToSequentialOnes) {
+    float fused_input[]{-1.0f, 2.0f, 3.0f, 0.5f};
+    float sequential_input[]{-1.0f, 2.0f, 3.0f, 0.5f};
+    const TokenIds prompt_ids{3};
+    const TokenIds generated_ids{1, 0, 1};
+
+    auto token_occurrences = std::make_shared<TokenOccurrences>();
+    for (auto prompt_id : prompt_ids) {
+        token_occurrences->add_prompt_token(prompt_id);
+    }
+    auto fused_transform = PenaltyTransform(1.5, 0.3, 0.2);
+    fused_transform.set_token_occurrences(token_occurrences);
+    Logits fused_logits(fused_input, 4);
+    fused_transform.apply(fused_logits, generated_ids);
+
+    auto repetition_occurrences = std::make_shared<TokenOccurrences>();
+    for (auto prompt_id : prompt_ids) {
+        repetition_occurrences->add_prompt_token(prompt_id);
+    }
+    auto repetition_transform = RepetitionPenaltyTransform(1.5);
+    repetition_transform.set_token_occurrences(repetition_occurrences);
+    Logits sequential_logits(sequential_input, 4);
+    repetition_transform.apply(sequential_logits, generated_ids);
+    PresencePenaltyTransform(0.3).apply(sequential_logits, generated_ids);
+    FrequencyPenaltyTransform(0.2).apply(sequential_logits, generated_ids);
+
+    for (size_t i = 0; i < 4; i++) {
+        EXPECT_NEAR(fused_logits.m_data[i], sequential_logits.m_data[i], 1e-6);
+    }
+    EXPECT_NEAR(fused_logits.m_data[2], 3.0f, 1e-6);
+}
+
+TEST(TokenOccurrencesTest, CountsGeneratedTokens) {
+    TokenOccurrences token_occurrences;
+    token_occurrences.add_prompt_token(7);
+    for (int64_t token_id = 0; token_id < 1000; ++token_id) {
+        token_occurrences.add_generated_token(token_id * 31);
+    }
+    token_occurrences.add_generated_token(31);
+    token_occurrences.remove_generated_token(0);
+
+    EXPECT_EQ(token_occurrences.get_generated_count(0), 0);
+    EXPECT_EQ(token_occurrences.get_generated_count(31), 2);
+    EXPECT_EQ(token_occurrences.get_generated_count(7), 0);
+    EXPECT_EQ(token_occurrences.get_generated_count(30), 0);
+    EXPECT_THROW(token_occurrences.remove_generated_token(30), ov::Exception);
+    // entries keep the order of first occurrence
+    ASSERT_EQ(token_occurrences.get_entries().size(), 1001);
+    EXPECT_EQ(token_occurrences.get_entries().front().token_id, 7);
+    EXPECT_TRUE(token_occurrences.get_entries().front().is_in_prompt);
+}
+
+TEST(TokenOccurrencesTest, RemovedTokensAreNotPenalized) {
+    float input[]{1.0f, 2.0f};
+    auto token_occurrences = std::make_shared<TokenOccurrences>();
+    token_occurrences->add_generated_token(1);
+    token_occurrences->remove_generated_token(1);
+    auto transform = PresencePenaltyTransform(0.5);
+    transform.set_token_occurrences(token_occurrences);
+    Logits logits(input, 2);
+    transform.apply(logits);
+    EXPECT_EQ(logits.m_data[1], 2.0f);
+}
+
 struct EOSPenaltyTransformTestStruct {
     static inline const size_t size = 3;
 
@@ -0,0 +1,67 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "lora/fused_delta_cache.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+// every delta takes 1 KB
+ov::Tensor make_delta(float value) {
+    ov::Tensor delta(ov::element::f32, {16, 16});
+    std::fill_n(delta.data<float>(), delta.get_size(), value);
+    return delta;
+}
+
+} // namespace
+
+TEST(TestFusedLoRADeltaCache, disabled_by_default) {
+    EXPECT_EQ(FusedLoRADeltaCache::DEFAULT_CAPACITY_MB, 0);
+}
+
+TEST(TestFusedLoRADeltaCache, returns_cached_delta) {
+    FusedLoRADeltaCache cache(4 * 1024);
+    EXPECT_FALSE(cache.get("a"));
+
+    ov::Tensor delta = make_delta(1.0f);
+    cache.put("a", delta);
+    ov::Tensor cached = cache.get("a");
+    ASSERT_TRUE(cached);
+    EXPECT_EQ(cached.data(), delta.data());
+    EXPECT_FALSE(cache.get("b"));
+
+    // the first delta of a key is kept
+    cache.put("a", make_delta(2.0f));
+    EXPECT_EQ(cache.get("a").data(), delta.data());
+    EXPECT_EQ(cache.size(), 1);
+    EXPECT_EQ(cache.get_memory_usage(), delta.get_byte_size());
+}
+
+TEST(TestFusedLoRADeltaCache, evicts_least_recently_used) {
+    FusedLoRADeltaCache cache(2 * 1024);
+    cache.put("a", make_delta(1.0f));
+    cache.put("b", make_delta(2.0f));
+    cache.get("a");  // "b" becomes least recently used
+    cache.put("c", make_delta(3.0f));
+
+    EXPECT_EQ(cache.size(), 2);
+    EXPECT_LE(cache.get_memory_usage(), cache.get_capacity());
+    EXPECT_TRUE(cache.get("a"));
+    EXPECT_FALSE(cache.get("b"));
+    EXPECT_TRUE(cache.get("c"));
+}
+
+TEST(TestFusedLoRADeltaCache, deltas_larger_than_capacity_are_not_kept) {
+    FusedLoRADeltaCache cache(512);
+    cache.put("a", make_delta(1.0f));
+    EXPECT_FALSE(cache.get("a"));
+    EXPECT_EQ(cache.size(), 0);
+
+    FusedLoRADeltaCache disabled(0);
+    disabled.put("a", make_delta(1.0f));
+    EXPECT_FALSE(disabled.get("a"));
+}
@@ -0,0 +1,62 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "lora/common.hpp"
+#include "lora/names_mapping.hpp"
+
+using namespace ov::genai::utils;
+
+namespace {
+
+const std::vector<std::string> lora_tensor_names = {
+    // PEFT
+    "base_model.model.model.layers.0.self_attn.q_proj.lora_A.weight",
+    "base_model.model.model.layers.0.self_attn.q_proj.lora_B.weight",
+    // kohya
+    "lora_unet_down_blocks_0_attentions_0_proj_in.lora_down.weight",
+    "lora_unet_down_blocks_0_attentions_0_proj_in.lora_up.weight",
+    "lora_te_text_model_encoder_layers_0_mlp_fc1.alpha",
+    // diffusers
+    "unet.down_blocks.0.attentions.0.proj_in.lora.down.weight",
+    "unet.down_blocks.0.attentions.0.proj_in.lora.up.weight",
+    "text_encoder.text_model.encoder.layers.0.self_attn.k_proj.lora_linear_layer.down.weight",
+    // legacy
+    "lora_te_text_model_encoder_layers_0_self_attn_q_proj.lora1.down.weight",
+    "lora_te_text_model_encoder_layers_0_self_attn_q_proj.lora2.up.weight",
+    "transformer.lora.down.weight",
+    "lora1.down.weight",
+    // not matching
+    "layer.lora_C.weight",
+    "layer.lora_A.bias",
+    "layer-lora_A.weight",
+    "layer.loraA.weight",
+    "lora_A.weight",
+    ".lora_A.weight",
+    "layer.lora3.down.weight",
+    "layer.xlora1.down.weight",
+    "layer.lora1_down.weight",
+    "layer.lora_up.weight.weight",
+    "lora.weight",
+    "",
+};
+
+} // namespace
+
+TEST(TestLoRANames, parse_lora_weight_name_matches_former_regular_expressions) {
+    const RegexParser A_regex("((.*)[_.](lora[_.](A|down)\\.weight))|((.*lora[12])\\.(down\\.weight))", {2, 6});
+    const RegexParser B_regex("((.*)[_.](lora[_.](B|up)\\.weight))|((.*lora[12])\\.(up\\.weight))", {2, 6});
+    for (const std::string& name : lora_tensor_names) {
+        EXPECT_EQ(parse_lora_weight_name(name, {"A", "down"}, "down"), A_regex(name)) << name;
+        EXPECT_EQ(parse_lora_weight_name(name, {"B", "up"}, "up"), B_regex(name)) << name;
+    }
+}
+
+TEST(TestLoRANames, parse_lora_weight_name_captures_layer_name) {
+    EXPECT_EQ(parse_lora_weight_name("model.layers.0.q_proj.lora_A.weight", {"A", "down"}, "down"), "model.layers.0.q_proj");
+    EXPECT_EQ(parse_lora_weight_name("proj_in_lora_down.weight", {"A", "down"}, "down"), "proj_in");
+    EXPECT_EQ(parse_lora_weight_name("proj_in.lora1.down.weight", {"A", "down"}, "down"), "proj_in.lora1");
+    EXPECT_EQ(parse_lora_weight_name("proj_in.lora_up.weight", {"A", "down"}, "down"), std::nullopt);
+}
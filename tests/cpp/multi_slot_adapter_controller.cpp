@@ -0,0 +1,163 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <cstring>
+
+#include "openvino/runtime/core.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
+#include "lora/multi_slot_adapter_controller.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+struct LoRAMatrices {
+    ov::Shape A_shape;
+    std::vector<float> A;
+    ov::Shape B_shape;
+    std::vector<float> B;
+};
+
+// Serializes A and B of "layer" in Safetensors format: 8 bytes of header size, JSON header and raw data
+Adapter make_adapter(const LoRAMatrices& matrices) {
+    auto shape_to_json = [](const ov::Shape& shape) {
+        return "[" + std::to_string(shape[0]) + "," + std::to_string(shape[1]) + "]";
+    };
+    const size_t A_bytes = matrices.A.size() * sizeof(float), B_bytes = matrices.B.size() * sizeof(float);
+    std::string header = "{\"layer.lora_A.weight\":{\"dtype\":\"F32\",\"shape\":" + shape_to_json(matrices.A_shape) +
+        ",\"data_offsets\":[0," + std::to_string(A_bytes) + "]}," +
+        "\"layer.lora_B.weight\":{\"dtype\":\"F32\",\"shape\":" + shape_to_json(matrices.B_shape) +
+        ",\"data_offsets\":[" + std::to_string(A_bytes) + "," + std::to_string(A_bytes + B_bytes) + "]}}";
+    header.resize((header.size() + 7) / 8 * 8, ' ');
+
+    ov::Tensor safetensor(ov::element::u8, {sizeof(uint64_t) + header.size() + A_bytes + B_bytes});
+    uint8_t* data = safetensor.data<uint8_t>();
+    const uint64_t header_size = header.size();
+    std::memcpy(data, &header_size, sizeof(header_size));
+    data += sizeof(header_size);
+    std::memcpy(data, header.data(), header.size());
+    data += header.size();
+    std::memcpy(data, matrices.A.data(), A_bytes);
+    std::memcpy(data + A_bytes, matrices.B.data(), B_bytes);
+    return Adapter(safetensor);
+}
+
+// y = x * W^T with identity W of 2x2, tokens are stacked along the first dimension
+std::shared_ptr<ov::Model> make_model() {
+    auto x = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{ov::Dimension::dynamic(), 2});
+    x->get_output_tensor(0).set_names({"x"});
+    auto weight = ov::op::v0::Constant::create(ov::element::f32, {2, 2}, {1.0f, 0.0f, 0.0f, 1.0f});
+    auto matmul = std::make_shared<ov::op::v0::MatMul>(x, weight, false, true);
+    matmul->set_friendly_name("layer");
+    return std::make_shared<ov::Model>(ov::OutputVector{matmul}, ov::ParameterVector{x});
+}
+
+// rank 1: delta = [0, x0]
+const LoRAMatrices lora_rank_1{{1, 2}, {1.0f, 0.0f}, {2, 1}, {0.0f, 1.0f}};
+// rank 2: delta = [x1, 0]
+const LoRAMatrices lora_rank_2{{2, 2}, {0.0f, 1.0f, 1.0f, 0.0f}, {2, 2}, {1.0f, 0.0f, 0.0f, 0.0f}};
+// rank 4, exceeds the slot rank of the adapters above
+const LoRAMatrices lora_rank_4{{4, 2}, std::vector<float>(8, 1.0f), {2, 4}, std::vector<float>(8, 1.0f)};
+
+} // namespace
+
+TEST(TestMultiSlotAdapterController, acquire_release_and_lru_eviction) {
+    Adapter adapter_1 = make_adapter(lora_rank_1), adapter_2 = make_adapter(lora_rank_2);
+    MultiSlotAdapterController controller(make_model(), AdapterConfig({adapter_1, adapter_2}), 2);
+    ASSERT_EQ(controller.get_num_slots(), 2);
+
+    const AdapterConfig config_1(adapter_1, 1.0f), config_2(adapter_2, 1.0f);
+    const AdapterConfig config_12({{adapter_1, 1.0f}, {adapter_2, 1.0f}});
+
+    EXPECT_EQ(controller.acquire(config_1), 0);
+    EXPECT_EQ(controller.acquire(config_2), 1);
+    // all slots are used by running requests
+    EXPECT_FALSE(controller.acquire(config_12).has_value());
+    // a resident config is shared
+    EXPECT_EQ(controller.acquire(config_1), 0);
+
+    controller.release(1);
+    // a config of several adapters fits a slot
+    EXPECT_EQ(controller.acquire(config_12), 1);
+
+    controller.release(0);
+    controller.release(0);
+    controller.release(1);
+    EXPECT_THROW(controller.release(1), ov::Exception);
+
+    // slot 0 is used less recently than slot 1
+    EXPECT_EQ(controller.acquire(config_2), 0);
+    // a released config stays resident until its slot is reused
+    EXPECT_EQ(controller.acquire(config_12), 1);
+    controller.release(0);
+    controller.release(1);
+
+    // an adapter that was not passed to the controller doesn't fit a slot
+    EXPECT_THROW(controller.acquire(AdapterConfig(make_adapter(lora_rank_4), 1.0f)), ov::Exception);
+}
+
+TEST(TestMultiSlotAdapterController, config_ids_are_forgotten_on_eviction_and_never_reused) {
+    Adapter adapter_1 = make_adapter(lora_rank_1), adapter_2 = make_adapter(lora_rank_2);
+    MultiSlotAdapterController controller(make_model(), AdapterConfig({adapter_1, adapter_2}), 1);
+    const AdapterConfig config_1(adapter_1, 1.0f), config_2(adapter_2, 1.0f);
+
+    const size_t id_1 = controller.get_config_id(config_1), id_2 = controller.get_config_id(config_2);
+    EXPECT_NE(id_1, id_2);
+    EXPECT_EQ(controller.get_config_id(AdapterConfig(adapter_1, 1.0f)), id_1);
+
+    ASSERT_EQ(controller.acquire(config_1), 0);
+    controller.release(0);
+    // config_2 replaces config_1 in the only slot
+    ASSERT_EQ(controller.acquire(config_2), 0);
+    controller.release(0);
+
+    EXPECT_EQ(controller.get_config_id(config_2), id_2);
+    const size_t new_id_1 = controller.get_config_id(config_1);
+    EXPECT_NE(new_id_1, id_1);
+    EXPECT_NE(new_id_1, id_2);
+}
+
+TEST(TestMultiSlotAdapterController, slot_mask_applies_slot_of_each_token) {
+    Adapter adapter_1 = make_adapter(lora_rank_1), adapter_2 = make_adapter(lora_rank_2);
+    auto model = make_model();
+    MultiSlotAdapterController controller(model, AdapterConfig({adapter_1, adapter_2}), 2);
+    ASSERT_TRUE(controller.has_state_name("lora_slot_state_layer.A"));
+
+    const auto slot_1 = controller.acquire(AdapterConfig(adapter_1, 2.0f));
+    const auto slot_12 = controller.acquire(AdapterConfig({{adapter_1, 1.0f}, {adapter_2, 3.0f}}));
+    ASSERT_TRUE(slot_1 && slot_12);
+
+    ov::Core core;
+    ov::InferRequest request = core.compile_model(model, "CPU").create_infer_request();
+    controller.apply(request);
+
+    const size_t num_tokens = 3;
+    ov::Tensor x(ov::element::f32, {num_tokens, 2});
+    for (size_t token = 0; token < num_tokens; ++token) {
+        x.data<float>()[token * 2] = 1.0f;
+        x.data<float>()[token * 2 + 1] = 2.0f;
+    }
+    ov::Tensor slot_ids(ov::element::i32, {num_tokens});
+    slot_ids.data<int32_t>()[0] = static_cast<int32_t>(*slot_1);
+    slot_ids.data<int32_t>()[1] = static_cast<int32_t>(*slot_12);
+    slot_ids.data<int32_t>()[2] = MultiSlotAdapterController::NO_SLOT;
+    request.set_tensor("x", x);
+    request.set_tensor(MultiSlotAdapterController::SLOT_IDS_INPUT_NAME, slot_ids);
+    request.infer();
+
+    const std::vector<float> ref = {
+        1.0f, 2.0f + 2.0f * 1.0f,           // x + 2 * [0, x0]
+        1.0f + 3.0f * 2.0f, 2.0f + 1.0f,    // x + [0, x0] + 3 * [x1, 0]
+        1.0f, 2.0f,                         // no adapters
+    };
+    ov::Tensor y = request.get_output_tensor(0);
+    ASSERT_EQ(y.get_size(), ref.size());
+    for (size_t i = 0; i < ref.size(); ++i) {
+        EXPECT_FLOAT_EQ(y.data<float>()[i], ref[i]) << "at " << i;
+    }
+}
@@ -0,0 +1,90 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <thread>
+#include "continuous_batching/pipeline_metrics.hpp"
+
+using namespace ov::genai;
+
+TEST(TestPipelineMetrics, histogram_counts_observations_per_bucket) {
+    AtomicHistogram histogram({1.0f, 10.0f, 100.0f});
+    for (double value : {0.5, 1.0, 5.0, 50.0, 500.0, 1000.0}) {
+        histogram.observe(value);
+    }
+    const MetricHistogram snapshot = histogram.snapshot();
+    EXPECT_EQ(snapshot.counts, std::vector<size_t>({2, 1, 1, 2}));
+    EXPECT_EQ(snapshot.count, 6);
+    EXPECT_DOUBLE_EQ(snapshot.sum, 1556.5);
+    EXPECT_FLOAT_EQ(snapshot.get_mean(), 1556.5f / 6);
+}
+
+TEST(TestPipelineMetrics, histogram_quantiles_are_interpolated_within_bucket) {
+    AtomicHistogram histogram({10.0f, 20.0f});
+    for (size_t i = 0; i < 4; ++i) {
+        histogram.observe(15.0);
+    }
+    const MetricHistogram snapshot = histogram.snapshot();
+    EXPECT_FLOAT_EQ(snapshot.get_quantile(0.5f), 15.0f);
+    EXPECT_FLOAT_EQ(snapshot.get_quantile(1.0f), 20.0f);
+    EXPECT_FLOAT_EQ(MetricHistogram{}.get_quantile(0.5f), 0.0f);
+
+    histogram.observe(100.0);
+    EXPECT_FLOAT_EQ(histogram.snapshot().get_quantile(1.0f), 20.0f);
+}
+
+TEST(TestPipelineMetrics, concurrent_observations_are_not_lost) {
+    AtomicHistogram histogram({1.0f});
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < 4; ++t) {
+        threads.emplace_back([&histogram]() {
+            for (size_t i = 0; i < 10000; ++i) {
+                histogram.observe(1.0);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    const MetricHistogram snapshot = histogram.snapshot();
+    EXPECT_EQ(snapshot.count, 40000);
+    EXPECT_DOUBLE_EQ(snapshot.sum, 40000.0);
+}
+
+TEST(TestPipelineMetrics, collector_fills_snapshot) {
+    PipelineMetricsCollector collector;
+    collector.ttft_ms.observe(42.0);
+    collector.preemptions += 2;
+    collector.prefix_cache_hits += 3;
+
+    PipelineMetrics metrics;
+    metrics.requests = 5;
+    collector.fill(metrics);
+    EXPECT_EQ(metrics.requests, 5);
+    EXPECT_EQ(metrics.ttft_ms.count, 1);
+    EXPECT_EQ(metrics.tpot_ms.count, 0);
+    EXPECT_EQ(metrics.preemptions, 2);
+    EXPECT_EQ(metrics.prefix_cache_hits, 3);
+}
+
+TEST(TestPipelineMetrics, prometheus_text_format) {
+    PipelineMetricsCollector collector;
+    collector.ttft_ms.observe(2.0);
+    collector.ttft_ms.observe(70000.0);
+    collector.evicted_tokens += 16;
+
+    PipelineMetrics metrics;
+    metrics.requests = 3;
+    collector.fill(metrics);
+    const std::string text = to_prometheus_text(metrics, "genai");
+
+    EXPECT_NE(text.find("# TYPE genai_requests gauge\ngenai_requests 3\n"), std::string::npos);
+    EXPECT_NE(text.find("# TYPE genai_time_to_first_token_seconds histogram\n"), std::string::npos);
+    EXPECT_NE(text.find("genai_time_to_first_token_seconds_bucket{le=\"0.001\"} 0\n"), std::string::npos);
+    EXPECT_NE(text.find("genai_time_to_first_token_seconds_bucket{le=\"0.0025\"} 1\n"), std::string::npos);
+    EXPECT_NE(text.find("genai_time_to_first_token_seconds_bucket{le=\"60\"} 1\n"), std::string::npos);
+    EXPECT_NE(text.find("genai_time_to_first_token_seconds_bucket{le=\"+Inf\"} 2\n"), std::string::npos);
+    EXPECT_NE(text.find("genai_time_to_first_token_seconds_count 2\n"), std::string::npos);
+    EXPECT_NE(text.find("# TYPE genai_evicted_tokens_total counter\ngenai_evicted_tokens_total 16\n"), std::string::npos);
+}
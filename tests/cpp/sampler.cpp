@@ -301,3 +301,36 @@ TEST(SamplerValidationMode, prompt_phase) {
              expected{0, 1, 2, 3};
     ASSERT_EQ(sequence_groups.front()->get_sequences().front()->get_generated_ids(), expected);
 }
+
+TEST(SamplerLogSoftmaxTopK, equal_to_sorted_log_softmax) {
+    const size_t vocab_size = 1000;
+    std::vector<float> logits(vocab_size);
+    for (size_t i = 0; i < vocab_size; ++i) {
+        logits[i] = std::sin(static_cast<float>(i) * 0.37f) * 10.0f;
+    }
+    ov::Tensor logits_tensor(ov::element::f32, ov::Shape{1, 1, vocab_size}, logits.data());
+    std::vector<Token> expected = log_softmax(logits_tensor, 0);
+    std::sort(expected.begin(), expected.end(), [](const Token& left, const Token& right) {
+        return left.m_log_prob > right.m_log_prob;
+    });
+
+    std::vector<Token> actual = log_softmax_top_k(logits.data(), vocab_size, 8);
+    ASSERT_EQ(actual.size(), 8);
+    for (size_t i = 0; i < actual.size(); ++i) {
+        EXPECT_EQ(actual[i].m_index, expected[i].m_index);
+        EXPECT_NEAR(actual[i].m_log_prob, expected[i].m_log_prob, 1e-5);
+    }
+}
+
+TEST(SamplerLogSoftmaxTopK, adjustments_are_applied_after_normalization) {
+    std::vector<float> logits{1.0f, 4.0f, 3.0f, 2.0f};
+    const float log_norm = 4.0f + std::log(std::exp(-3.0f) + 1.0f + std::exp(-1.0f) + std::exp(-2.0f));
+    // the best token is banned, the third one is penalized below the last one
+    std::vector<Token> tokens = log_softmax_top_k(logits.data(), logits.size(), 3, {{1, -std::numeric_limits<float>::infinity()}, {2, -1.5f}});
+    ASSERT_EQ(tokens.size(), 3);
+    EXPECT_EQ(tokens[0].m_index, 3);
+    EXPECT_NEAR(tokens[0].m_log_prob, 2.0f - log_norm, 1e-5);
+    EXPECT_EQ(tokens[1].m_index, 2);
+    EXPECT_NEAR(tokens[1].m_log_prob, 1.5f - log_norm, 1e-5);
+    EXPECT_EQ(tokens[2].m_index, 0);
+}
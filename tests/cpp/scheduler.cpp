@@ -9,6 +9,7 @@
 #include "openvino/genai/generation_config.hpp"
 #include "sequence_group.hpp"
 #include "continuous_batching/scheduler.hpp"
+#include "sampling/sampler.hpp"
 #include "helper.hpp"
 #include "utils.hpp"
 
@@ -1097,10 +1098,11 @@ TEST(TestScheduler, prefix_caching_embeddings_test) {
             sequence->set_status(SequenceStatus::FINISHED);
             auto idx0 = sequence->get_id();
             scheduler.free_sequence(idx0);
-            auto generated_embeddings = sequence->get_generated_ids_embeds();
 
             histrory_embeddings.insert(histrory_embeddings.end(), prompt_embeddings.begin(), prompt_embeddings.end());
-            histrory_embeddings.insert(histrory_embeddings.end(), generated_embeddings.begin(), generated_embeddings.end());
+            for (size_t idx = 0; idx < sequence->get_num_generated_ids_embeds(); idx++) {
+                histrory_embeddings.push_back(sequence->get_generated_ids_embed(idx));
+            }
 
             for (auto& seq : sequence_group->get_sequences()) {
                 if (seq->get_id() == idx0) {
@@ -1111,3 +1113,240 @@ TEST(TestScheduler, prefix_caching_embeddings_test) {
          }
     }
 }
+
+TEST(TestScheduler, prefix_caching_embeddings_hash_depends_on_position_ids) {
+    // pruned visual tokens with equal embeddings keep different 3D positions
+    const size_t block_size = 4, prompt_len = 8, hidden_size = 16;
+    const ov::Tensor embeddings = embeds_matrix_to_tensor(std::vector<std::vector<float>>(prompt_len, std::vector<float>(hidden_size, 1.0f)));
+    auto make_position_ids = [&](int64_t shift) {
+        ov::Tensor position_ids(ov::element::i64, {3, 1, prompt_len});
+        int64_t* data = position_ids.data<int64_t>();
+        for (size_t i = 0; i < position_ids.get_size(); ++i) {
+            data[i] = static_cast<int64_t>(i % prompt_len) + (i >= prompt_len ? shift : 0);
+        }
+        return position_ids;
+    };
+    auto get_hash = [&](const ov::Tensor& position_ids, size_t content_length) {
+        auto sequence_group = std::make_shared<SequenceGroup>(0, embeddings, utils::get_greedy_config(), block_size, std::nullopt, position_ids);
+        return sequence_group->get_sequences()[0]->get_hash(content_length);
+    };
+
+    EXPECT_EQ(get_hash(make_position_ids(0), block_size), get_hash(make_position_ids(0), block_size));
+    EXPECT_EQ(get_hash(make_position_ids(0), prompt_len), get_hash(make_position_ids(0), prompt_len));
+    EXPECT_NE(get_hash(make_position_ids(0), block_size), get_hash(make_position_ids(3), block_size));
+    EXPECT_NE(get_hash(make_position_ids(0), prompt_len), get_hash(make_position_ids(3), prompt_len));
+}
+
+TEST(TestScheduler, prefix_aware_admission_prefers_cached_prompts) {
+    std::array<SchedulerConfig, 2> configs = {SchedulerConfig(), SchedulerConfig()};
+    configs.at(0).max_num_batched_tokens = 16;
+    configs.at(0).num_kv_blocks = 100;
+    configs.at(0).dynamic_split_fuse = false;
+    configs.at(0).max_num_seqs = 5;
+    configs.at(0).enable_prefix_caching = true;
+    configs.at(0).prefix_aware_admission_window = 4;
+    configs.at(1).max_num_batched_tokens = 16;
+    configs.at(1).num_kv_blocks = 100;
+    configs.at(1).dynamic_split_fuse = true;
+    configs.at(1).max_num_seqs = 5;
+    configs.at(1).enable_prefix_caching = true;
+    configs.at(1).prefix_aware_admission_window = 4;
+    for (auto scheduler_config: configs) {
+        Scheduler scheduler = Scheduler(4, init_cache_manager(scheduler_config), scheduler_config);
+
+        // compute and cache a prefix of 2 blocks
+        std::vector<uint64_t> prefix_tokens = {0,1,2,3,4,5,6,7};
+        SequenceGroup::Ptr prefix_group = std::make_shared<SequenceGroup>(0, ov::Tensor(ov::element::i64, {prefix_tokens.size()}, prefix_tokens.data()),
+                                                                          utils::get_greedy_config(), 4);
+        std::vector<SequenceGroup::Ptr> prefix_requests = {prefix_group};
+        scheduler.schedule(prefix_requests);
+        prefix_group->get_running_sequences()[0]->append_token(23, 0.7);
+        prefix_group->finish_iteration();
+        prefix_group->get_running_sequences()[0]->set_status(SequenceStatus::FINISHED);
+        scheduler.free_sequence(prefix_group->get_sequences()[0]->get_id());
+
+        std::vector<uint64_t> uncached_tokens = {10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25};
+        std::vector<uint64_t> cached_tokens = {0,1,2,3,4,5,6,7,8,9,10,11};
+        SequenceGroup::Ptr uncached_group = std::make_shared<SequenceGroup>(1, ov::Tensor(ov::element::i64, {uncached_tokens.size()}, uncached_tokens.data()),
+                                                                            utils::get_greedy_config(), 4);
+        SequenceGroup::Ptr cached_group = std::make_shared<SequenceGroup>(2, ov::Tensor(ov::element::i64, {cached_tokens.size()}, cached_tokens.data()),
+                                                                          utils::get_greedy_config(), 4);
+        std::vector<SequenceGroup::Ptr> requests = {uncached_group, cached_group};
+        for (auto request: requests) {
+            scheduler.restore_cached_blocks(request);
+        }
+        EXPECT_EQ(cached_group->get_num_processed_tokens(), 8);
+
+        // the later prompt requires 1 new block instead of 4 and is admitted first,
+        // the earlier one gets the rest of the batch in case of dynamic split fuse
+        auto out = scheduler.schedule(requests);
+        EXPECT_EQ(cached_group->get_num_scheduled_tokens(), cached_tokens.size() - 8);
+        EXPECT_EQ(uncached_group->get_num_scheduled_tokens(), scheduler_config.dynamic_split_fuse ? 12 : 0);
+        // scheduled groups are reported in order of requests
+        std::vector<uint64_t> ref_ids = scheduler_config.dynamic_split_fuse ? std::vector<uint64_t>{0, 1} : std::vector<uint64_t>{1};
+        EXPECT_EQ(out.m_scheduled_sequence_groups_ids, ref_ids);
+
+        for (auto request: requests) {
+            for (auto& seq : request->get_sequences()) {
+                scheduler.free_sequence(seq->get_id());
+            }
+        }
+    }
+}
+
+TEST(TestScheduler, prefix_aware_admission_keeps_logits_of_requests) {
+    SchedulerConfig scheduler_config;
+    scheduler_config.max_num_batched_tokens = 32;
+    scheduler_config.num_kv_blocks = 100;
+    scheduler_config.dynamic_split_fuse = true;
+    scheduler_config.enable_prefix_caching = true;
+    scheduler_config.prefix_aware_admission_window = 4;
+    Scheduler scheduler = Scheduler(4, init_cache_manager(scheduler_config), scheduler_config);
+
+    std::vector<uint64_t> prefix_tokens = {0,1,2,3,4,5,6,7};
+    SequenceGroup::Ptr prefix_group = std::make_shared<SequenceGroup>(0, ov::Tensor(ov::element::i64, {prefix_tokens.size()}, prefix_tokens.data()),
+                                                                      utils::get_greedy_config(), 4);
+    std::vector<SequenceGroup::Ptr> prefix_requests = {prefix_group};
+    scheduler.schedule(prefix_requests);
+    prefix_group->get_running_sequences()[0]->append_token(23, 0.7);
+    prefix_group->finish_iteration();
+    prefix_group->get_running_sequences()[0]->set_status(SequenceStatus::FINISHED);
+    scheduler.free_sequence(prefix_group->get_sequences()[0]->get_id());
+
+    std::vector<uint64_t> uncached_tokens = {10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25};
+    std::vector<uint64_t> cached_tokens = {0,1,2,3,4,5,6,7,8,9,10,11};
+    SequenceGroup::Ptr uncached_group = std::make_shared<SequenceGroup>(1, ov::Tensor(ov::element::i64, {uncached_tokens.size()}, uncached_tokens.data()),
+                                                                        utils::get_greedy_config(), 4);
+    SequenceGroup::Ptr cached_group = std::make_shared<SequenceGroup>(2, ov::Tensor(ov::element::i64, {cached_tokens.size()}, cached_tokens.data()),
+                                                                      utils::get_greedy_config(), 4);
+    std::vector<SequenceGroup::Ptr> requests = {uncached_group, cached_group};
+    for (auto request: requests) {
+        scheduler.restore_cached_blocks(request);
+    }
+
+    // the cached prompt is admitted first, both prompts are completed at this step
+    auto out = scheduler.schedule(requests);
+    ASSERT_EQ(out.m_scheduled_sequence_groups_ids.size(), 2);
+
+    // model runner outputs logits of scheduled tokens in order of scheduled groups
+    const size_t vocab_size = 8;
+    const int64_t uncached_token = 3, cached_token = 5;
+    std::vector<float> logits;
+    for (uint64_t sequence_group_id : out.m_scheduled_sequence_groups_ids) {
+        const SequenceGroup::Ptr& sequence_group = requests[sequence_group_id];
+        const int64_t token = sequence_group == cached_group ? cached_token : uncached_token;
+        for (size_t i = 0; i < sequence_group->get_output_seq_len(); ++i) {
+            std::vector<float> token_logits(vocab_size, 0.0f);
+            token_logits[token] = 1.0f;
+            logits.insert(logits.end(), token_logits.begin(), token_logits.end());
+        }
+    }
+
+    Sampler sampler;
+    sampler.sample(requests, ov::Tensor(ov::element::f32, {logits.size() / vocab_size, 1, vocab_size}, logits.data()));
+    EXPECT_EQ(uncached_group->get_sequences()[0]->get_generated_ids(), TokenIds({uncached_token}));
+    EXPECT_EQ(cached_group->get_sequences()[0]->get_generated_ids(), TokenIds({cached_token}));
+
+    for (auto request: requests) {
+        request->finish_iteration();
+        for (auto& seq : request->get_sequences()) {
+            scheduler.free_sequence(seq->get_id());
+        }
+    }
+}
+
+TEST(TestScheduler, prefix_aware_admission_does_not_bypass_oldest_prompt_beyond_window) {
+    for (size_t window : {2, 8}) {
+        SchedulerConfig scheduler_config;
+        scheduler_config.max_num_batched_tokens = 16;
+        scheduler_config.num_kv_blocks = 100;
+        scheduler_config.dynamic_split_fuse = false;
+        scheduler_config.max_num_seqs = 5;
+        scheduler_config.prefix_aware_admission_window = window;
+        Scheduler scheduler = Scheduler(4, init_cache_manager(scheduler_config), scheduler_config);
+
+        std::vector<uint64_t> long_tokens(16, 1), short_tokens(12, 2);
+        auto create_group = [&](uint64_t request_id, std::vector<uint64_t>& tokens) {
+            return std::make_shared<SequenceGroup>(request_id, ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()),
+                                                   utils::get_greedy_config(), 4);
+        };
+        std::vector<SequenceGroup::Ptr> requests = {create_group(0, long_tokens), create_group(1, short_tokens)};
+
+        // the short prompt bypasses the long one
+        auto out1 = scheduler.schedule(requests);
+        EXPECT_EQ(out1.m_scheduled_sequence_groups_ids, std::vector<uint64_t>({1}));
+        requests[1]->get_running_sequences()[0]->append_token(23, 0.7);
+        requests[1]->finish_iteration();
+
+        // one more short prompt arrives, the long prompt has been bypassed by window - 1 prompts when window is 2
+        requests.push_back(create_group(2, short_tokens));
+        auto out2 = scheduler.schedule(requests);
+        EXPECT_EQ(out2.m_scheduled_sequence_groups_ids, std::vector<uint64_t>({window == 2 ? 0u : 2u}));
+
+        for (auto request: requests) {
+            for (auto& seq : request->get_sequences()) {
+                if (scheduler.has_block_table(seq->get_id()))
+                    scheduler.free_sequence(seq->get_id());
+            }
+        }
+    }
+}
+
+TEST(TestScheduler, prefix_aware_admission_computes_common_prefix_once) {
+    std::array<SchedulerConfig, 3> configs = {SchedulerConfig(), SchedulerConfig(), SchedulerConfig()};
+    configs.at(0).max_num_batched_tokens = 32;
+    configs.at(0).dynamic_split_fuse = false;
+    configs.at(1).max_num_batched_tokens = 32;
+    configs.at(1).dynamic_split_fuse = true;
+    // the prompt is computed by chunks ending inside blocks
+    configs.at(2).max_num_batched_tokens = 6;
+    configs.at(2).dynamic_split_fuse = true;
+    for (auto& scheduler_config: configs) {
+        scheduler_config.num_kv_blocks = 100;
+        scheduler_config.max_num_seqs = 5;
+        scheduler_config.enable_prefix_caching = true;
+        scheduler_config.prefix_aware_admission_window = 4;
+        Scheduler scheduler = Scheduler(4, init_cache_manager(scheduler_config), scheduler_config);
+
+        std::vector<uint64_t> tokens1 = {0,1,2,3,4,5,6,7,100,101,102,103};
+        std::vector<uint64_t> tokens2 = {0,1,2,3,4,5,6,7,200,201,202,203};
+        SequenceGroup::Ptr sequence_group1 = std::make_shared<SequenceGroup>(0, ov::Tensor(ov::element::i64, {tokens1.size()}, tokens1.data()),
+                                                                             utils::get_greedy_config(), 4);
+        SequenceGroup::Ptr sequence_group2 = std::make_shared<SequenceGroup>(1, ov::Tensor(ov::element::i64, {tokens2.size()}, tokens2.data()),
+                                                                             utils::get_greedy_config(), 4);
+        std::vector<SequenceGroup::Ptr> requests = {sequence_group1, sequence_group2};
+        for (auto request: requests) {
+            scheduler.restore_cached_blocks(request);
+        }
+
+        size_t num_computed_prompt_tokens = 0;
+        while (!sequence_group2->can_generate_tokens()) {
+            auto out = scheduler.schedule(requests);
+            for (auto request: requests) {
+                if (request->is_scheduled() && !request->can_generate_tokens()) {
+                    num_computed_prompt_tokens += request->get_num_scheduled_tokens();
+                }
+            }
+            for (auto request: requests) {
+                if (request->is_scheduled() && request->get_num_processed_tokens() + request->get_num_scheduled_tokens() >= request->get_prompt_len()) {
+                    request->get_running_sequences()[0]->append_token(23, 0.7);
+                }
+                request->finish_iteration();
+            }
+        }
+
+        // the common prefix of 2 blocks is computed once, the last prompt token is recomputed to get logits
+        EXPECT_EQ(num_computed_prompt_tokens, tokens1.size() + tokens2.size() - 8);
+        auto block_table1 = scheduler.get_block_tables(*(*sequence_group1)[0])[0];
+        auto block_table2 = scheduler.get_block_tables(*(*sequence_group2)[0])[0];
+        EXPECT_EQ(block_table1[0], block_table2[0]);
+        EXPECT_EQ(block_table1[1], block_table2[1]);
+        EXPECT_NE(block_table1[2], block_table2[2]);
+
+        for (auto request: requests) {
+            for (auto& seq : request->get_sequences()) {
+                scheduler.free_sequence(seq->get_id());
+            }
+        }
+    }
+}
@@ -0,0 +1,175 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "openvino/genai/generation_config.hpp"
+#include "pooled_storage.hpp"
+#include "sequence_group.hpp"
+#include "utils.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+SequenceGroup::Ptr create_sequence_group(TokenIds prompt_ids, size_t block_size = 4) {
+    return SequenceGroup::create(0, ov::Tensor(ov::element::i64, {prompt_ids.size()}, prompt_ids.data()),
+                                 utils::get_beam_search_config(), block_size);
+}
+
+}  // namespace
+
+TEST(TestPooledStorage, released_blocks_are_reused) {
+    PoolAllocator<Sequence> allocator;
+    Sequence* first = allocator.allocate(1);
+    allocator.deallocate(first, 1);
+    Sequence* second = allocator.allocate(1);
+    EXPECT_EQ(first, second);
+    allocator.deallocate(second, 1);
+}
+
+TEST(TestPooledStorage, copy_on_write_vector) {
+    CopyOnWriteVector<int64_t> original;
+    EXPECT_TRUE(original.empty());
+    original.edit() = {1, 2, 3};
+
+    CopyOnWriteVector<int64_t> copy = original;
+    EXPECT_TRUE(copy.is_shared());
+    EXPECT_EQ(copy.get().data(), original.get().data());
+
+    copy.edit().push_back(4);
+    EXPECT_FALSE(copy.is_shared());
+    EXPECT_FALSE(original.is_shared());
+    EXPECT_EQ(original.get(), std::vector<int64_t>({1, 2, 3}));
+    EXPECT_EQ(copy.get(), std::vector<int64_t>({1, 2, 3, 4}));
+
+    // the only owner is modified in place
+    const int64_t* data = original.get().data();
+    original.edit()[0] = 5;
+    EXPECT_EQ(original.get().data(), data);
+}
+
+TEST(TestSequenceGroup, forked_sequence_shares_tokens_until_modified) {
+    auto sequence_group = create_sequence_group({1, 2, 3, 4, 5});
+    auto parent = sequence_group->get_sequences()[0];
+    parent->append_token(10, -0.5f);
+    parent->append_token(11, -0.25f);
+    const BlockHash parent_hash = parent->get_hash(7);
+
+    auto child = sequence_group->fork_sequence(parent);
+    EXPECT_EQ(child->get_generated_ids().data(), parent->get_generated_ids().data());
+    EXPECT_EQ(child->get_hash(7), parent_hash);
+
+    child->append_token(12, -1.0f);
+    parent->remove_last_tokens(1);
+    EXPECT_EQ(child->get_generated_ids(), TokenIds({10, 11, 12}));
+    EXPECT_EQ(child->get_generated_log_probs(), LogProbs({-0.5f, -0.25f, -1.0f}));
+    EXPECT_FLOAT_EQ(child->get_cumulative_log_prob(), -1.75f);
+    EXPECT_EQ(parent->get_generated_ids(), TokenIds({10}));
+    EXPECT_EQ(parent->get_generated_log_probs(), LogProbs({-0.5f}));
+
+    child->update_generated_log_prob(0, -2.0f);
+    EXPECT_EQ(parent->get_generated_log_probs(), LogProbs({-0.5f}));
+}
+
+TEST(TestSequenceGroup, forked_sequence_keeps_hashes_of_shared_prefix) {
+    auto sequence_group = create_sequence_group({1, 2, 3, 4, 5, 6});
+    auto parent = sequence_group->get_sequences()[0];
+    parent->append_token(7, 0.0f);
+    const BlockHash prefix_hash = parent->get_hash(4);
+
+    auto child = sequence_group->fork_sequence(parent);
+    parent->append_token(8, 0.0f);
+    child->append_token(9, 0.0f);
+    const BlockHash parent_hash = parent->get_hash(8);
+    EXPECT_EQ(child->get_hash(4), prefix_hash);
+    EXPECT_NE(child->get_hash(8), parent_hash);
+    EXPECT_EQ(parent->get_hash(8), parent_hash);
+}
+
+TEST(TestSequenceGroup, forked_sequence_shares_embeddings) {
+    const size_t hidden_size = 8;
+    std::vector<float> prompt_embeds(2 * hidden_size, 0.5f);
+    auto sequence_group = SequenceGroup::create(0, ov::Tensor(ov::element::f32, {1, 2, hidden_size}, prompt_embeds.data()),
+                                                utils::get_beam_search_config(), 4);
+    auto parent = sequence_group->get_sequences()[0];
+    std::vector<float> embed(hidden_size, 1.0f);
+    parent->append_token(1, 0.0f);
+    parent->append_generated_ids_embeds(ov::Tensor(ov::element::f32, {1, 1, hidden_size}, embed.data()));
+
+    auto child = sequence_group->fork_sequence(parent);
+    std::fill(embed.begin(), embed.end(), 2.0f);
+    child->append_token(2, 0.0f);
+    child->append_generated_ids_embeds(ov::Tensor(ov::element::f32, {1, 1, hidden_size}, embed.data()));
+
+    EXPECT_EQ(parent->get_num_generated_ids_embeds(), 1);
+    ASSERT_EQ(child->get_num_generated_ids_embeds(), 2);
+    // embeddings appended before the fork are not copied
+    EXPECT_EQ(child->get_generated_ids_embed(0).data(), parent->get_generated_ids_embed(0).data());
+    EXPECT_EQ(child->get_generated_ids_embed(1), std::vector<float>(hidden_size, 2.0f));
+}
+
+TEST(TestSequenceGroup, block_hashes_are_chained) {
+    const size_t block_size = 4;
+    const TokenIds prompt_ids = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+    auto sequence_group = create_sequence_group(prompt_ids, block_size);
+    auto sequence = sequence_group->get_sequences()[0];
+    const auto hashes = get_prefix_block_hashes(prompt_ids, block_size);
+    ASSERT_EQ(hashes.size(), 2);
+    EXPECT_EQ(sequence->get_hash(4), hashes[0]);
+    EXPECT_EQ(sequence->get_hash(8), hashes[1]);
+    EXPECT_EQ(sequence->get_prefix_hashes(), hashes);
+
+    // the same block after a different prefix has a different hash
+    const auto other_hashes = get_prefix_block_hashes({0, 2, 3, 4, 5, 6, 7, 8}, block_size);
+    EXPECT_NE(other_hashes[0], hashes[0]);
+    EXPECT_NE(other_hashes[1], hashes[1]);
+}
+
+TEST(TestSequenceGroup, partial_block_hash_is_incremental) {
+    const TokenIds prompt_ids = {1, 2, 3, 4, 5};
+    auto sequence_group = create_sequence_group(prompt_ids);
+    auto reference_group = create_sequence_group(prompt_ids);
+    auto sequence = sequence_group->get_sequences()[0];
+    auto reference = reference_group->get_sequences()[0];
+    for (int64_t token = 10; token < 20; ++token) {
+        sequence->append_token(token, 0.0f);
+        reference->append_token(token, 0.0f);
+        const size_t content_len = prompt_ids.size() + sequence->get_generated_len();
+        EXPECT_EQ(sequence->get_hash(content_len), reference->get_hash(content_len));
+        // hashes of shorter content within the same block do not break the incremental state
+        EXPECT_EQ(sequence->get_hash(content_len - 1), reference->get_hash(content_len - 1));
+    }
+}
+
+TEST(TestSequenceGroup, removed_tokens_invalidate_block_hashes) {
+    const TokenIds prompt_ids = {1, 2, 3};
+    auto sequence_group = create_sequence_group(prompt_ids);
+    auto sequence = sequence_group->get_sequences()[0];
+    sequence->append_token(4, 0.0f);
+    sequence->append_token(5, 0.0f);
+    sequence->append_token(6, 0.0f);
+    const BlockHash full_block_hash = sequence->get_hash(4);
+    const BlockHash hash = sequence->get_hash(6);
+
+    // speculative decoding rejects tokens and generates others
+    sequence->remove_last_tokens(3);
+    sequence->append_token(7, 0.0f);
+    sequence->append_token(5, 0.0f);
+    sequence->append_token(6, 0.0f);
+    EXPECT_NE(sequence->get_hash(4), full_block_hash);
+    EXPECT_NE(sequence->get_hash(6), hash);
+    auto reference_group = create_sequence_group({1, 2, 3, 7, 5, 6});
+    EXPECT_EQ(sequence->get_hash(6), reference_group->get_sequences()[0]->get_hash(6));
+}
+
+TEST(TestSequenceGroup, adapters_change_block_hashes) {
+    const TokenIds prompt_ids = {1, 2, 3, 4, 5, 6, 7, 8};
+    auto sequence_group = create_sequence_group(prompt_ids);
+    sequence_group->set_adapter_config_id(1);
+    auto sequence = sequence_group->get_sequences()[0];
+    const auto hashes = get_prefix_block_hashes(prompt_ids, 4);
+    EXPECT_NE(sequence->get_hash(4), hashes[0]);
+    EXPECT_NE(sequence->get_hash(8), hashes[1]);
+}
@@ -0,0 +1,174 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+
+#include "image_generation/schedulers/lcm.hpp"
+#include "image_generation/schedulers/step_kernels.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+ov::Tensor make_random_tensor(const ov::Shape& shape, std::mt19937& engine) {
+    std::normal_distribution<float> distribution;
+    ov::Tensor tensor(ov::element::f32, shape);
+    float* data = tensor.data<float>();
+    for (size_t i = 0; i < tensor.get_size(); ++i)
+        data[i] = distribution(engine);
+    return tensor;
+}
+
+} // namespace
+
+TEST(TestStepKernels, linear_combination_matches_reference) {
+    std::mt19937 engine(42);
+    // covers scalar tail, vectorized body and multiple parallel chunks
+    for (size_t size : {size_t(7), size_t(64), size_t(100003)}) {
+        ov::Tensor a = make_random_tensor({size}, engine), b = make_random_tensor({size}, engine),
+                   c = make_random_tensor({size}, engine), out(ov::element::f32, {size});
+        const float* a_data = a.data<const float>();
+        const float* b_data = b.data<const float>();
+        const float* c_data = c.data<const float>();
+
+        step_kernels::linear_combination<3>(out.data<float>(), {0.5f, -2.0f, 0.25f}, {a_data, b_data, c_data}, size);
+        for (size_t i = 0; i < size; ++i)
+            ASSERT_NEAR(out.data<float>()[i], 0.5f * a_data[i] - 2.0f * b_data[i] + 0.25f * c_data[i], 1e-5f) << "size " << size << ", index " << i;
+    }
+}
+
+TEST(TestStepKernels, linear_combination_in_place) {
+    std::mt19937 engine(42);
+    const size_t size = 50001;
+    ov::Tensor sample = make_random_tensor({size}, engine), model_output = make_random_tensor({size}, engine);
+    ov::Tensor expected(ov::element::f32, {size});
+    for (size_t i = 0; i < size; ++i)
+        expected.data<float>()[i] = sample.data<float>()[i] + 0.1f * model_output.data<float>()[i];
+
+    float* sample_data = sample.data<float>();
+    step_kernels::linear_combination<2>(sample_data, {1.0f, 0.1f}, {sample_data, model_output.data<const float>()}, size);
+
+    for (size_t i = 0; i < size; ++i)
+        ASSERT_FLOAT_EQ(sample_data[i], expected.data<float>()[i]);
+}
+
+TEST(TestStepKernels, guided_step_combination_matches_separate_guidance) {
+    std::mt19937 engine(42);
+    const ov::Shape latent_shape{1, 4, 32, 32};
+    ov::Shape noise_pred_shape = latent_shape;
+    noise_pred_shape[0] *= 2;
+
+    ov::Tensor latents = make_random_tensor(latent_shape, engine), noise_pred = make_random_tensor(noise_pred_shape, engine);
+    const float guidance_scale = 7.5f, sigma_diff = -0.05f;
+    const size_t size = latents.get_size();
+
+    // reference: materialize guided noise prediction, then perform flow matching Euler step
+    const float* noise_pred_uncond = noise_pred.data<const float>();
+    const float* noise_pred_text = noise_pred_uncond + size;
+    std::vector<float> expected(size);
+    for (size_t i = 0; i < size; ++i) {
+        float guided = noise_pred_uncond[i] + guidance_scale * (noise_pred_text[i] - noise_pred_uncond[i]);
+        expected[i] = latents.data<float>()[i] + sigma_diff * guided;
+    }
+
+    float* latents_data = latents.data<float>();
+    step_kernels::step_combination(latents_data, 1.0f, latents_data, sigma_diff,
+                                   step_kernels::ModelOutput::guided(noise_pred, guidance_scale), size);
+
+    for (size_t i = 0; i < size; ++i)
+        ASSERT_NEAR(latents_data[i], expected[i], 1e-5f);
+}
+
+TEST(TestStepKernels, ensure_buffer_reuses_memory) {
+    ov::Tensor buffer;
+    step_kernels::ensure_buffer(buffer, {2, 4, 8, 8});
+    ASSERT_TRUE(buffer);
+    const float* data = buffer.data<const float>();
+
+    step_kernels::ensure_buffer(buffer, {2, 4, 8, 8});
+    EXPECT_EQ(buffer.data<const float>(), data);
+
+    step_kernels::ensure_buffer(buffer, {1, 4, 8, 8});
+    EXPECT_EQ(buffer.get_shape(), ov::Shape({1, 4, 8, 8}));
+}
+
+// Classifier-free guidance with Euler step as schedulers compute it: fused kernels updating latents in place
+// give the same result as separate loops with temporary tensors
+TEST(TestStepKernels, fused_guided_euler_step_matches_separate_loops) {
+    std::mt19937 engine(42);
+    const ov::Shape latent_shape{1, 4, 32, 32};
+    ov::Shape noise_pred_shape = latent_shape;
+    noise_pred_shape[0] *= 2;
+
+    ov::Tensor latents = make_random_tensor(latent_shape, engine), noise_pred = make_random_tensor(noise_pred_shape, engine);
+    const size_t size = latents.get_size();
+    const float guidance_scale = 5.0f, sigma = 0.9f, dt = -0.05f;
+
+    const float* uncond = noise_pred.data<const float>();
+    const float* text = uncond + size;
+    const float* sample = latents.data<const float>();
+    std::vector<float> guided(size), denoised(size), expected(size);
+    for (size_t i = 0; i < size; ++i)
+        guided[i] = uncond[i] + guidance_scale * (text[i] - uncond[i]);
+    for (size_t i = 0; i < size; ++i)
+        denoised[i] = sample[i] - sigma * guided[i];
+    for (size_t i = 0; i < size; ++i)
+        expected[i] = (sample[i] - denoised[i]) / sigma * dt + sample[i];
+
+    ov::Tensor fused_denoised;
+    step_kernels::ensure_buffer(fused_denoised, latent_shape);
+    float* latents_data = latents.data<float>();
+    step_kernels::step_combination(fused_denoised.data<float>(), 1.0f, latents_data, -sigma,
+                                   step_kernels::ModelOutput::guided(noise_pred, guidance_scale), size);
+    for (size_t i = 0; i < size; ++i)
+        ASSERT_NEAR(fused_denoised.data<const float>()[i], denoised[i], 1e-5f);
+
+    step_kernels::linear_combination<2>(latents_data, {1.0f + dt / sigma, -dt / sigma}, {latents_data, fused_denoised.data<const float>()}, size);
+    for (size_t i = 0; i < size; ++i)
+        ASSERT_NEAR(latents_data[i], expected[i], 1e-4f);
+}
+
+// LCM scheduler given model outputs of different parameterizations which describe the same original sample and noise
+// denoises latents to the same result
+TEST(TestStepKernels, lcm_step_supports_all_prediction_types) {
+    std::mt19937 engine(42);
+    const ov::Shape latent_shape{1, 4, 8, 8};
+    ov::Tensor original_sample = make_random_tensor(latent_shape, engine), noise = make_random_tensor(latent_shape, engine);
+    const size_t size = original_sample.get_size();
+
+    LCMScheduler::Config config;
+    const float beta = 0.001f;
+    config.trained_betas.assign(config.num_train_timesteps, beta);
+
+    std::vector<float> results[3];
+    const PredictionType prediction_types[] = {PredictionType::EPSILON, PredictionType::SAMPLE, PredictionType::V_PREDICTION};
+    for (size_t type = 0; type < 3; ++type) {
+        config.prediction_type = prediction_types[type];
+        LCMScheduler scheduler(config);
+        // single step is the final one, so no noise is injected and generator is not used
+        scheduler.set_timesteps(1, 1.0f);
+
+        const float alpha_prod_t = std::pow(1.0 - beta, scheduler.get_timesteps()[0] + 1);
+        const float alpha_sqrt = std::sqrt(alpha_prod_t), beta_sqrt = std::sqrt(1.0f - alpha_prod_t);
+
+        ov::Tensor latents(ov::element::f32, latent_shape), model_output(ov::element::f32, latent_shape);
+        for (size_t i = 0; i < size; ++i) {
+            const float x0 = original_sample.data<const float>()[i], eps = noise.data<const float>()[i];
+            latents.data<float>()[i] = alpha_sqrt * x0 + beta_sqrt * eps;
+            model_output.data<float>()[i] = prediction_types[type] == PredictionType::EPSILON ? eps :
+                                            prediction_types[type] == PredictionType::SAMPLE ? x0 :
+                                            alpha_sqrt * eps - beta_sqrt * x0;
+        }
+
+        ov::Tensor denoised = scheduler.step(model_output, latents, 0, nullptr).at("latent");
+        results[type].assign(denoised.data<const float>(), denoised.data<const float>() + size);
+    }
+
+    for (size_t i = 0; i < size; ++i) {
+        ASSERT_NEAR(results[1][i], results[0][i], 1e-4f);
+        ASSERT_NEAR(results[2][i], results[0][i], 1e-4f);
+    }
+}
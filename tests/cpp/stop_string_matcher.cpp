@@ -0,0 +1,150 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <map>
+#include "sampling/stop_string_matcher.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+// Detokenizer of a toy vocabulary, tokens 100 and 101 hold two bytes of "é" and are replaced with U+FFFD when decoded apart
+const std::map<int64_t, std::string> VOCAB = {
+    {1, "Hello"}, {2, " world"}, {3, "!"}, {4, " "}, {5, "\n"}, {6, "wor"}, {7, "ld"}, {8, "<|end|>"}, {9, ""},
+    {100, "\xC3"}, {101, "\xA9"}
+};
+
+std::string decode(const std::vector<int64_t>& tokens) {
+    std::string text;
+    for (int64_t token : tokens) {
+        text += VOCAB.at(token);
+    }
+    std::string result;
+    for (size_t pos = 0; pos < text.size(); ++pos) {
+        if (text[pos] == '\xC3' && pos + 1 < text.size() && text[pos + 1] == '\xA9') {
+            result += text.substr(pos++, 2);
+        } else if (text[pos] == '\xC3' || text[pos] == '\xA9') {
+            result += "\xEF\xBF\xBD";
+        } else {
+            result += text[pos];
+        }
+    }
+    return result;
+}
+
+StopStringMatcher create_matcher(const std::set<std::string>& stop_strings,
+                                 const std::vector<std::vector<int64_t>>& encoded_stop_strings,
+                                 bool is_include_to_output = false) {
+    return StopStringMatcher(std::make_shared<const CompiledStopStrings>(stop_strings, encoded_stop_strings),
+                             std::make_shared<TokenTextCache>(decode, std::vector<int64_t>{}),
+                             is_include_to_output);
+}
+
+}  // namespace
+
+TEST(TestAhoCorasickAutomaton, finds_longest_pattern_ending_at_each_symbol) {
+    // classes: h = 1, e = 2, s = 3, r = 4, i = 5
+    AhoCorasickAutomaton automaton({{1, 2}, {3, 1, 2}, {1, 5, 3}, {1, 2, 4, 3}}, 6);
+    // "ushers", u is not in patterns
+    std::vector<uint32_t> text = {0, 3, 1, 2, 4, 3};
+    std::vector<size_t> match_lens;
+    uint32_t state = AhoCorasickAutomaton::root;
+    for (uint32_t symbol_class : text) {
+        state = automaton.next(state, symbol_class);
+        match_lens.push_back(automaton.get_match_len(state));
+    }
+    EXPECT_EQ(match_lens, std::vector<size_t>({0, 0, 0, 3, 0, 4}));
+}
+
+TEST(TestAhoCorasickAutomaton, unknown_symbol_resets_to_root) {
+    AhoCorasickAutomaton automaton({{1, 1, 2}}, 3);
+    uint32_t state = automaton.next(automaton.next(AhoCorasickAutomaton::root, 1), 1);
+    EXPECT_EQ(automaton.next(state, 0), AhoCorasickAutomaton::root);
+    // "aaab" still matches after a failed continuation
+    state = automaton.next(state, 1);
+    EXPECT_EQ(automaton.get_match_len(automaton.next(state, 2)), 3);
+    EXPECT_EQ(AhoCorasickAutomaton().get_num_states(), 1);
+}
+
+TEST(TestStopStringMatcher, compiled_stop_strings_lengths) {
+    CompiledStopStrings compiled({"world", "!"}, {{3}, {6, 7}});
+    EXPECT_EQ(compiled.max_encoded_len, 2);
+    EXPECT_EQ(compiled.max_stop_string_len, 5);
+}
+
+TEST(TestStopStringMatcher, stop_string_split_between_tokens) {
+    StopStringMatcher matcher = create_matcher({"world"}, {{2}});
+    std::vector<int64_t> tokens = {1, 4};
+    EXPECT_FALSE(matcher.match(0, tokens).is_matched);
+    tokens.push_back(6);
+    EXPECT_FALSE(matcher.match(0, tokens).is_matched);
+    tokens.push_back(7);
+    auto result = matcher.match(0, tokens);
+    EXPECT_TRUE(result.is_matched);
+    // "Hello" is kept, trailing space is removed together with "wor" and "ld"
+    EXPECT_EQ(result.to_remove, 3);
+}
+
+TEST(TestStopStringMatcher, include_stop_string_to_output) {
+    StopStringMatcher matcher = create_matcher({"world"}, {{2}}, true);
+    auto result = matcher.match(0, {1, 2, 3});
+    EXPECT_TRUE(result.is_matched);
+    // the first token after the stop string is removed, since it is generated in the same step
+    EXPECT_EQ(result.to_remove, 1);
+}
+
+TEST(TestStopStringMatcher, replaced_tokens_roll_state_back) {
+    StopStringMatcher matcher = create_matcher({"Hello!"}, {{1, 3}});
+    EXPECT_FALSE(matcher.match(0, {1, 2}).is_matched);
+    // " world" is rejected and replaced with "!"
+    auto result = matcher.match(0, {1, 3});
+    EXPECT_TRUE(result.is_matched);
+    EXPECT_EQ(result.to_remove, 2);
+}
+
+TEST(TestStopStringMatcher, candidate_does_not_change_parent_state) {
+    StopStringMatcher matcher = create_matcher({"!"}, {{3}});
+    std::vector<int64_t> parent = {1, 2};
+    auto result = matcher.match_candidate(0, parent, 3);
+    EXPECT_TRUE(result.is_matched);
+    EXPECT_EQ(result.to_remove, 1);
+    EXPECT_FALSE(matcher.match_candidate(0, parent, 4).is_matched);
+    EXPECT_FALSE(matcher.match(0, parent).is_matched);
+}
+
+TEST(TestStopStringMatcher, token_stop_string_without_text) {
+    // special tokens may be skipped by detokenizer, so only token IDs match
+    StopStringMatcher matcher = create_matcher({"<|end|>"}, {{9}});
+    auto result = matcher.match(0, {1, 9});
+    EXPECT_TRUE(result.is_matched);
+    EXPECT_EQ(result.to_remove, 1);
+}
+
+TEST(TestStopStringMatcher, tokens_with_partial_characters_are_decoded_together) {
+    StopStringMatcher matcher = create_matcher({"\xC3\xA9!"}, {{100, 101, 3}});
+    std::vector<int64_t> tokens = {1, 100};
+    EXPECT_FALSE(matcher.match(0, tokens).is_matched);
+    tokens.push_back(101);
+    EXPECT_FALSE(matcher.match(0, tokens).is_matched);
+    tokens.push_back(3);
+    auto result = matcher.match(0, tokens);
+    EXPECT_TRUE(result.is_matched);
+    EXPECT_EQ(result.to_remove, 3);
+}
+
+TEST(TestStopStringMatcher, long_sequence_keeps_matching) {
+    StopStringMatcher matcher = create_matcher({"\nworld"}, {{5, 6, 7}});
+    std::vector<int64_t> tokens;
+    for (size_t i = 0; i < 100; ++i) {
+        tokens.push_back(1);
+        EXPECT_FALSE(matcher.match(0, tokens).is_matched);
+    }
+    tokens.insert(tokens.end(), {5, 6});
+    EXPECT_FALSE(matcher.match(0, tokens).is_matched);
+    tokens.push_back(7);
+    auto result = matcher.match(0, tokens);
+    EXPECT_TRUE(result.is_matched);
+    EXPECT_EQ(result.to_remove, 3);
+}
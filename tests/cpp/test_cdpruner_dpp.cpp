@@ -4,7 +4,9 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <cmath>
 #include <openvino/openvino.hpp>
+#include <random>
 #include <tuple>
 #include <vector>
 
@@ -285,6 +287,120 @@ std::string paramToString(const ::testing::TestParamInfo<DPPTestParams>& info) {
 // Instantiate parameterized tests
 INSTANTIATE_TEST_SUITE_P(CDPrunerTest, DPPParameterizedTest, ::testing::ValuesIn(generateTestParams()), paramToString);
 
+// =============================================================================
+// Blocked Selection and On Demand Kernel Tests
+// =============================================================================
+namespace {
+
+// Small dyadic feature values keep dot products exact regardless of summation order,
+// so dense and on demand kernel entries are bitwise equal
+ConditionalKernelFactors createExactKernelFactors(size_t batch_size, size_t num_tokens, size_t feature_dim) {
+    std::mt19937 engine(42);
+    std::uniform_int_distribution<int> value_distribution(-4, 4);
+    std::uniform_int_distribution<int> relevance_distribution(0, 8);
+
+    ConditionalKernelFactors factors;
+    factors.relevance_weight = 0.5f;
+    factors.normalized_features = ov::Tensor(ov::element::f32, {batch_size, num_tokens, feature_dim});
+    factors.relevance_scores = ov::Tensor(ov::element::f32, {batch_size, num_tokens});
+    float* features = factors.normalized_features.data<float>();
+    for (size_t i = 0; i < factors.normalized_features.get_size(); ++i) {
+        features[i] = value_distribution(engine) / 8.0f;
+    }
+    float* relevance = factors.relevance_scores.data<float>();
+    for (size_t i = 0; i < factors.relevance_scores.get_size(); ++i) {
+        relevance[i] = relevance_distribution(engine) / 8.0f;
+    }
+    return factors;
+}
+
+ov::Tensor createDenseKernel(const ConditionalKernelFactors& factors) {
+    const auto& shape = factors.normalized_features.get_shape();
+    size_t batch_size = shape[0], num_tokens = shape[1], feature_dim = shape[2];
+    const float w = factors.relevance_weight;
+
+    ov::Tensor kernel(ov::element::f32, {batch_size, num_tokens, num_tokens});
+    const float* features = factors.normalized_features.data<const float>();
+    const float* relevance = factors.relevance_scores.data<const float>();
+    float* kernel_data = kernel.data<float>();
+    for (size_t b = 0; b < batch_size; ++b) {
+        for (size_t i = 0; i < num_tokens; ++i) {
+            for (size_t j = 0; j < num_tokens; ++j) {
+                float similarity = 0.0f;
+                for (size_t k = 0; k < feature_dim; ++k) {
+                    similarity += features[(b * num_tokens + i) * feature_dim + k] *
+                                  features[(b * num_tokens + j) * feature_dim + k];
+                }
+                float r_i = relevance[b * num_tokens + i], r_j = relevance[b * num_tokens + j];
+                kernel_data[(b * num_tokens + i) * num_tokens + j] = similarity * (1.0f - w) + r_i * similarity * r_j * w;
+            }
+        }
+    }
+    return kernel;
+}
+
+// Sequential fast greedy DPP over a dense kernel, row by row as in the CDPruner paper
+std::vector<size_t> referenceGreedyDPP(const float* kernel, size_t num_tokens, size_t num_selected, float threshold) {
+    std::vector<float> cis(num_selected * num_tokens, 0.0f);
+    std::vector<float> di2s(num_tokens);
+    for (size_t i = 0; i < num_tokens; ++i) {
+        di2s[i] = kernel[i * num_tokens + i];
+    }
+    std::vector<size_t> selected;
+    for (size_t t = 0; t < num_selected; ++t) {
+        size_t best = std::max_element(di2s.begin(), di2s.end()) - di2s.begin();
+        selected.push_back(best);
+        float* eis = cis.data() + t * num_tokens;
+        std::copy(kernel + best * num_tokens, kernel + (best + 1) * num_tokens, eis);
+        for (size_t prev = 0; prev < t; ++prev) {
+            float cis_sel = cis[prev * num_tokens + best];
+            if (std::abs(cis_sel) < threshold)
+                continue;
+            for (size_t j = 0; j < num_tokens; ++j) {
+                eis[j] -= cis_sel * cis[prev * num_tokens + j];
+            }
+        }
+        float inv_norm = 1.0f / std::sqrt(di2s[best] + threshold);
+        for (size_t j = 0; j < num_tokens; ++j) {
+            eis[j] *= inv_norm;
+            if (di2s[j] > -std::numeric_limits<float>::infinity()) {
+                di2s[j] -= eis[j] * eis[j];
+            }
+        }
+        di2s[best] = -std::numeric_limits<float>::infinity();
+    }
+    return selected;
+}
+
+}  // namespace
+
+TEST_F(DPPTestBase, BlockedSelectionMatchesSequentialReference) {
+    // More tokens than a single block of columns processed by a task
+    const size_t batch_size = 2, num_tokens = 700, num_selected = 64;
+    ov::Tensor kernel = createDenseKernel(createExactKernelFactors(batch_size, num_tokens, 96));
+
+    base_config.use_cl_kernel = false;
+    FastGreedyDPP dpp(base_config);
+    auto selected = dpp.select(kernel, num_selected);
+
+    ASSERT_EQ(selected.size(), batch_size);
+    for (size_t b = 0; b < batch_size; ++b) {
+        const float* batch_kernel = kernel.data<const float>() + b * num_tokens * num_tokens;
+        EXPECT_EQ(selected[b], referenceGreedyDPP(batch_kernel, num_tokens, num_selected, base_config.numerical_threshold))
+            << "Batch " << b;
+    }
+}
+
+TEST_F(DPPTestBase, OnDemandKernelMatchesDenseKernel) {
+    ConditionalKernelFactors factors = createExactKernelFactors(2, 500, 64);
+    ov::Tensor kernel = createDenseKernel(factors);
+
+    base_config.use_cl_kernel = false;
+    FastGreedyDPP dpp(base_config);
+    EXPECT_EQ(dpp.select(factors, 48), dpp.select(kernel, 48));
+    EXPECT_EQ(dpp.select(factors, factors, 48, 500), dpp.select(kernel, kernel, 48, 500));
+}
+
 // =============================================================================
 // Integration Tests with CDPruner
 // =============================================================================
@@ -0,0 +1,86 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <algorithm>
+
+#include "image_generation/text_encoder_cache.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+ov::Tensor make_input_ids(std::vector<int64_t> tokens) {
+    ov::Tensor input_ids(ov::element::i64, {1, tokens.size()});
+    std::copy(tokens.begin(), tokens.end(), input_ids.data<int64_t>());
+    return input_ids;
+}
+
+ov::Tensor make_output(float value) {
+    ov::Tensor output(ov::element::f32, {1, 4});
+    std::fill_n(output.data<float>(), output.get_size(), value);
+    return output;
+}
+
+} // namespace
+
+TEST(TestTextEncoderCache, key_depends_on_content_and_shape) {
+    const std::string key = TextEncoderCache::make_key({make_input_ids({1, 2, 3})});
+    EXPECT_EQ(key, TextEncoderCache::make_key({make_input_ids({1, 2, 3})}));
+    EXPECT_NE(key, TextEncoderCache::make_key({make_input_ids({1, 2, 4})}));
+    EXPECT_NE(key, TextEncoderCache::make_key({make_input_ids({1, 2, 3, 0})}));
+
+    ov::Tensor input_ids_i32(ov::element::i32, {1, 6});
+    std::fill_n(input_ids_i32.data<int32_t>(), 6, 0);
+    ov::Tensor input_ids_i64(ov::element::i64, {1, 3});
+    std::fill_n(input_ids_i64.data<int64_t>(), 3, 0);
+    EXPECT_NE(TextEncoderCache::make_key({input_ids_i32}), TextEncoderCache::make_key({input_ids_i64}));
+}
+
+TEST(TestTextEncoderCache, stores_copies_of_outputs) {
+    TextEncoderCache cache(2);
+    const std::string key = TextEncoderCache::make_key({make_input_ids({1})});
+
+    EXPECT_FALSE(cache.find(key).has_value());
+
+    ov::Tensor output = make_output(1.0f);
+    cache.insert(key, {output});
+    // infer request reuses its output tensors
+    std::fill_n(output.data<float>(), output.get_size(), 2.0f);
+
+    auto cached = cache.find(key);
+    ASSERT_TRUE(cached.has_value());
+    ASSERT_EQ(cached->size(), 1);
+    EXPECT_EQ((*cached)[0].data<float>()[0], 1.0f);
+
+    // callers own found outputs
+    std::fill_n((*cached)[0].data<float>(), (*cached)[0].get_size(), 3.0f);
+    EXPECT_EQ(cache.find(key)->at(0).data<float>()[0], 1.0f);
+}
+
+TEST(TestTextEncoderCache, evicts_least_recently_used) {
+    TextEncoderCache cache(2);
+    const std::string key_a = TextEncoderCache::make_key({make_input_ids({1})}),
+                      key_b = TextEncoderCache::make_key({make_input_ids({2})}),
+                      key_c = TextEncoderCache::make_key({make_input_ids({3})});
+
+    cache.insert(key_a, {make_output(1.0f)});
+    cache.insert(key_b, {make_output(2.0f)});
+    // 'a' becomes most recently used, so 'b' is evicted
+    EXPECT_TRUE(cache.find(key_a).has_value());
+    cache.insert(key_c, {make_output(3.0f)});
+
+    EXPECT_EQ(cache.size(), 2);
+    EXPECT_TRUE(cache.find(key_a).has_value());
+    EXPECT_FALSE(cache.find(key_b).has_value());
+    EXPECT_TRUE(cache.find(key_c).has_value());
+
+    cache.set_capacity(1);
+    EXPECT_EQ(cache.size(), 1);
+    EXPECT_TRUE(cache.find(key_c).has_value());
+
+    cache.set_capacity(0);
+    cache.insert(key_a, {make_output(1.0f)});
+    EXPECT_EQ(cache.size(), 0);
+}
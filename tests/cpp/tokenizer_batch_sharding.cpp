@@ -0,0 +1,122 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <algorithm>
+
+#include "tokenizer/batch_sharding.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+TokenizedInputs make_padded(const std::vector<std::vector<int64_t>>& rows, size_t length, bool pad_right, int64_t pad_token_id) {
+    ov::Tensor input_ids(ov::element::i64, {rows.size(), length}), attention_mask(ov::element::i64, {rows.size(), length});
+    for (size_t row = 0; row < rows.size(); ++row) {
+        int64_t* ids = input_ids.data<int64_t>() + row * length;
+        int64_t* mask = attention_mask.data<int64_t>() + row * length;
+        std::fill_n(ids, length, pad_token_id);
+        std::fill_n(mask, length, 0);
+        const size_t offset = pad_right ? 0 : length - rows[row].size();
+        std::copy(rows[row].begin(), rows[row].end(), ids + offset);
+        std::fill_n(mask + offset, rows[row].size(), 1);
+    }
+    return {input_ids, attention_mask};
+}
+
+std::vector<int64_t> get_row(const ov::Tensor& tensor, size_t row) {
+    const size_t length = tensor.get_shape()[1];
+    const int64_t* data = tensor.data<const int64_t>() + row * length;
+    return std::vector<int64_t>(data, data + length);
+}
+
+} // namespace
+
+TEST(TestBatchSharding, groups_similar_lengths_and_covers_batch) {
+    std::vector<size_t> lengths;
+    for (size_t i = 0; i < 100; ++i)
+        lengths.push_back((i * 37) % 101);
+
+    const auto shards = shard_by_length(lengths, 4, 16);
+    ASSERT_EQ(shards.size(), 4);
+
+    std::vector<size_t> all_indices;
+    size_t prev_max_length = 0;
+    for (const auto& shard : shards) {
+        EXPECT_GE(shard.size(), 16);
+        size_t min_length = lengths[shard.front()], max_length = 0;
+        for (size_t idx : shard) {
+            min_length = std::min(min_length, lengths[idx]);
+            max_length = std::max(max_length, lengths[idx]);
+        }
+        // shards don't overlap by length
+        EXPECT_GE(min_length, prev_max_length);
+        prev_max_length = max_length;
+        all_indices.insert(all_indices.end(), shard.begin(), shard.end());
+    }
+    std::sort(all_indices.begin(), all_indices.end());
+    for (size_t i = 0; i < lengths.size(); ++i)
+        EXPECT_EQ(all_indices[i], i);
+}
+
+TEST(TestBatchSharding, small_batch_is_not_sharded) {
+    EXPECT_EQ(shard_by_length(std::vector<size_t>(20, 5), 8, 16).size(), 1);
+    EXPECT_EQ(shard_by_length(std::vector<size_t>(64, 5), 8, 16).size(), 4);
+}
+
+TEST(TestBatchSharding, merges_shards_in_original_order) {
+    // rows 0 and 2 are short, row 1 is long
+    const std::vector<std::vector<size_t>> shard_indices = {{0, 2}, {1}};
+    for (bool pad_right : {true, false}) {
+        const std::vector<TokenizedInputs> shards = {
+            make_padded({{1}, {2, 3}}, 2, pad_right, 0),
+            make_padded({{4, 5, 6, 7}}, 4, pad_right, 0),
+        };
+        // padding side is taken from shards, not from the hint
+        auto merged = merge_padded_shards(shards, shard_indices, !pad_right, -1);
+        ASSERT_TRUE(merged.has_value());
+        const TokenizedInputs expected = make_padded({{1}, {4, 5, 6, 7}, {2, 3}}, 4, pad_right, 0);
+        for (size_t row = 0; row < 3; ++row) {
+            EXPECT_EQ(get_row(merged->input_ids, row), get_row(expected.input_ids, row));
+            EXPECT_EQ(get_row(merged->attention_mask, row), get_row(expected.attention_mask, row));
+        }
+    }
+}
+
+TEST(TestBatchSharding, unpadded_shards_require_padding_side) {
+    const std::vector<std::vector<size_t>> shard_indices = {{1}, {0}};
+    const std::vector<TokenizedInputs> shards = {make_padded({{1}}, 1, true, 0), make_padded({{2, 3}}, 2, true, 0)};
+    EXPECT_FALSE(merge_padded_shards(shards, shard_indices, std::nullopt, 0).has_value());
+
+    auto merged = merge_padded_shards(shards, shard_indices, false, 9);
+    ASSERT_TRUE(merged.has_value());
+    EXPECT_EQ(get_row(merged->input_ids, 0), std::vector<int64_t>({2, 3}));
+    EXPECT_EQ(get_row(merged->input_ids, 1), std::vector<int64_t>({9, 1}));
+    EXPECT_EQ(get_row(merged->attention_mask, 1), std::vector<int64_t>({0, 1}));
+}
+
+TEST(TestBatchSharding, padding_only_rows_do_not_define_padding_side) {
+    // row 0 is an empty prompt without special tokens, so its row is padding only
+    const std::vector<std::vector<size_t>> shard_indices = {{0, 1}, {2}};
+    const std::vector<TokenizedInputs> shards = {
+        make_padded({{}, {1}}, 2, true, 0),
+        make_padded({{3, 4, 5}}, 3, true, 0),
+    };
+    auto merged = merge_padded_shards(shards, shard_indices, std::nullopt, 0);
+    ASSERT_TRUE(merged.has_value());
+    EXPECT_EQ(get_row(merged->input_ids, 1), std::vector<int64_t>({1, 0, 0}));
+    EXPECT_EQ(get_row(merged->attention_mask, 1), std::vector<int64_t>({1, 0, 0}));
+    EXPECT_EQ(get_row(merged->attention_mask, 0), std::vector<int64_t>({0, 0, 0}));
+
+    // without rows padded on one side the configured padding side is used
+    const std::vector<TokenizedInputs> unknown_side_shards = {
+        make_padded({{}, {}}, 2, true, 0),
+        make_padded({{3, 4, 5}}, 3, true, 0),
+    };
+    EXPECT_FALSE(merge_padded_shards(unknown_side_shards, shard_indices, std::nullopt, 0).has_value());
+    merged = merge_padded_shards(unknown_side_shards, shard_indices, true, 0);
+    ASSERT_TRUE(merged.has_value());
+    EXPECT_EQ(get_row(merged->input_ids, 2), std::vector<int64_t>({3, 4, 5}));
+    EXPECT_EQ(get_row(merged->attention_mask, 1), std::vector<int64_t>({0, 0, 0}));
+}
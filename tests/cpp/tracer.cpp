@@ -0,0 +1,83 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <sstream>
+#include <thread>
+#include "continuous_batching/tracer.hpp"
+
+using namespace ov::genai::tracing;
+
+namespace {
+
+std::string get_trace() {
+    std::stringstream stream;
+    Tracer::instance().write_chrome_trace(stream);
+    return stream.str();
+}
+
+size_t count_occurrences(const std::string& str, const std::string& pattern) {
+    size_t count = 0;
+    for (size_t pos = str.find(pattern); pos != std::string::npos; pos = str.find(pattern, pos + 1)) {
+        ++count;
+    }
+    return count;
+}
+
+}  // namespace
+
+TEST(TestTracer, records_spans_instants_and_counters) {
+    Tracer::instance().start();
+    {
+        TraceSpan span("forward");
+        span.arg("scheduled_tokens", 42);
+    }
+    trace_instant("admit", {{"request_id", 7}, {"prompt_len", 5}});
+    trace_counter("requests", 3);
+    Tracer::instance().stop();
+
+    const std::string trace = get_trace();
+    EXPECT_NE(trace.find("\"name\":\"forward\",\"cat\":\"genai\",\"ph\":\"X\""), std::string::npos);
+    EXPECT_NE(trace.find("\"args\":{\"scheduled_tokens\":42}"), std::string::npos);
+    EXPECT_NE(trace.find("\"ph\":\"i\""), std::string::npos);
+    EXPECT_NE(trace.find("\"args\":{\"request_id\":7,\"prompt_len\":5}"), std::string::npos);
+    EXPECT_NE(trace.find("\"args\":{\"value\":3}"), std::string::npos);
+}
+
+TEST(TestTracer, disabled_tracer_records_nothing) {
+    Tracer::instance().start();
+    Tracer::instance().stop();
+    {
+        TraceSpan span("schedule");
+    }
+    trace_instant("finish");
+    EXPECT_EQ(count_occurrences(get_trace(), "\"name\""), 0);
+}
+
+TEST(TestTracer, events_of_threads_are_kept_separately) {
+    Tracer::instance().start();
+    std::thread worker([]() { trace_instant("preempt"); });
+    worker.join();
+    trace_instant("preempt");
+    Tracer::instance().stop();
+
+    const std::string trace = get_trace();
+    ASSERT_EQ(count_occurrences(trace, "\"name\":\"preempt\""), 2);
+    const size_t first_tid = trace.find("\"tid\":");
+    const size_t second_tid = trace.find("\"tid\":", first_tid + 1);
+    EXPECT_NE(std::stoul(trace.substr(first_tid + 6)), std::stoul(trace.substr(second_tid + 6)));
+}
+
+TEST(TestTracer, ring_buffer_keeps_latest_events) {
+    Tracer::instance().start();
+    for (size_t i = 0; i < Tracer::BUFFER_CAPACITY + 10; ++i) {
+        trace_counter("requests", static_cast<int64_t>(i));
+    }
+    Tracer::instance().stop();
+
+    const std::string trace = get_trace();
+    EXPECT_EQ(count_occurrences(trace, "\"name\":\"requests\""), Tracer::BUFFER_CAPACITY);
+    EXPECT_EQ(trace.find("\"args\":{\"value\":9}"), std::string::npos);
+    EXPECT_NE(trace.find("\"args\":{\"value\":" + std::to_string(Tracer::BUFFER_CAPACITY + 9) + "}"), std::string::npos);
+}
@@ -0,0 +1,104 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <algorithm>
+
+#include "image_generation/vae_tiling.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+const size_t scale_factor = 4;
+
+// emulates VAE decoder: upsamples NCHW f32 latent to NHWC u8 image using nearest neighbour
+ov::Tensor fake_decode(const ov::Tensor& latent) {
+    const ov::Shape shape = latent.get_shape();
+    const size_t N = shape[0], C = shape[1], H = shape[2], W = shape[3];
+    ov::Tensor image(ov::element::u8, {N, H * scale_factor, W * scale_factor, C});
+    const float* src = latent.data<const float>();
+    uint8_t* dst = image.data<uint8_t>();
+    for (size_t n = 0; n < N; ++n)
+        for (size_t y = 0; y < H * scale_factor; ++y)
+            for (size_t x = 0; x < W * scale_factor; ++x)
+                for (size_t c = 0; c < C; ++c)
+                    dst[((n * H * scale_factor + y) * W * scale_factor + x) * C + c] =
+                        static_cast<uint8_t>(src[((n * C + c) * H + y / scale_factor) * W + x / scale_factor]);
+    return image;
+}
+
+ov::Tensor make_latent(size_t height, size_t width) {
+    ov::Tensor latent(ov::element::f32, {1, 3, height, width});
+    for (size_t i = 0; i < latent.get_size(); ++i)
+        latent.data<float>()[i] = static_cast<float>((i * 7) % 200);
+    return latent;
+}
+
+} // namespace
+
+TEST(TestVAETiling, split_into_tiles_covers_range) {
+    auto tiles = vae_tiling::split_into_tiles(37, 16, 4);
+    ASSERT_FALSE(tiles.empty());
+    EXPECT_EQ(tiles.front().first, 0);
+    EXPECT_EQ(tiles.back().first + tiles.back().second, 37);
+    for (size_t i = 1; i < tiles.size(); ++i) {
+        EXPECT_GE(tiles[i - 1].first + tiles[i - 1].second, tiles[i].first + 4);
+    }
+
+    tiles = vae_tiling::split_into_tiles(10, 16, 4);
+    ASSERT_EQ(tiles.size(), 1);
+    EXPECT_EQ(tiles[0], std::make_pair(size_t(0), size_t(10)));
+}
+
+TEST(TestVAETiling, spatial_tiled_decode_matches_full_decode) {
+    ov::Tensor latent = make_latent(37, 29);
+    ov::Tensor full = fake_decode(latent);
+    ov::Tensor tiled = vae_tiling::spatial_tiled_decode(latent, scale_factor, 16, 4, fake_decode);
+
+    ASSERT_EQ(tiled.get_shape(), full.get_shape());
+    EXPECT_TRUE(std::equal(full.data<uint8_t>(), full.data<uint8_t>() + full.get_size(), tiled.data<uint8_t>()));
+}
+
+TEST(TestVAETiling, spatial_tiled_decode_streams_rows) {
+    ov::Tensor latent = make_latent(37, 29);
+    ov::Tensor full = fake_decode(latent);
+    const size_t row_size = full.get_shape()[2] * full.get_shape()[3];
+
+    size_t num_rows = 0;
+    ov::Tensor result = vae_tiling::spatial_tiled_decode(latent, scale_factor, 16, 4, fake_decode,
+        [&] (size_t offset, const ov::Tensor& rows) {
+            ASSERT_EQ(offset, num_rows);
+            EXPECT_TRUE(std::equal(rows.data<uint8_t>(), rows.data<uint8_t>() + rows.get_size(), full.data<uint8_t>() + offset * row_size));
+            num_rows += rows.get_shape()[1];
+        });
+
+    EXPECT_FALSE(result);
+    EXPECT_EQ(num_rows, full.get_shape()[1]);
+}
+
+TEST(TestVAETiling, temporal_tiled_decode_produces_all_frames) {
+    const size_t num_latent_frames = 11, temporal_scale = 8;
+    ov::Tensor latent(ov::element::f32, {1, 2, num_latent_frames, 3, 3});
+    std::fill_n(latent.data<float>(), latent.get_size(), 5.0f);
+
+    auto decode_chunk = [&] (const ov::Tensor& chunk) {
+        ov::Tensor video(ov::element::u8, {1, (chunk.get_shape()[2] - 1) * temporal_scale + 1, 3, 3, 2});
+        std::fill_n(video.data<uint8_t>(), video.get_size(), 5);
+        return video;
+    };
+
+    const size_t expected_num_frames = (num_latent_frames - 1) * temporal_scale + 1;
+    ov::Tensor video = vae_tiling::temporal_tiled_decode(latent, temporal_scale, 4, 1, decode_chunk);
+    ASSERT_EQ(video.get_shape()[1], expected_num_frames);
+    EXPECT_TRUE(std::all_of(video.data<uint8_t>(), video.data<uint8_t>() + video.get_size(), [] (uint8_t v) { return v == 5; }));
+
+    size_t num_frames = 0;
+    vae_tiling::temporal_tiled_decode(latent, temporal_scale, 4, 2, decode_chunk,
+        [&] (size_t offset, const ov::Tensor& frames) {
+            ASSERT_EQ(offset, num_frames);
+            num_frames += frames.get_shape()[1];
+        });
+    EXPECT_EQ(num_frames, expected_num_frames);
+}
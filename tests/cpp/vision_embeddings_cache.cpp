@@ -0,0 +1,149 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+
+#include "openvino/genai/visual_language/pipeline.hpp"
+#include "visual_language/vision_embeddings_cache.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+ov::Tensor make_image(uint8_t value, size_t size = 8) {
+    ov::Tensor image(ov::element::u8, {1, size, size, 3});
+    std::fill_n(image.data<uint8_t>(), image.get_size(), value);
+    return image;
+}
+
+EncodedImage make_encoded(size_t num_floats, float value) {
+    EncodedImage encoded;
+    encoded.resized_source = ov::Tensor(ov::element::f32, {1, num_floats});
+    std::fill_n(encoded.resized_source.data<float>(), num_floats, value);
+    return encoded;
+}
+
+}  // namespace
+
+TEST(VisionEmbeddingsCache, KeyDependsOnContentShapeAndModel) {
+    ov::Tensor image = make_image(1);
+    const std::string key = VisionEmbeddingsCache::make_key("model", VisionType::IMAGE, image);
+
+    EXPECT_EQ(key, VisionEmbeddingsCache::make_key("model", VisionType::IMAGE, make_image(1)));
+    EXPECT_NE(key, VisionEmbeddingsCache::make_key("other_model", VisionType::IMAGE, image));
+    EXPECT_NE(key, VisionEmbeddingsCache::make_key("model", VisionType::VIDEO, image));
+    EXPECT_NE(key, VisionEmbeddingsCache::make_key("model", VisionType::IMAGE, make_image(1, 16)));
+
+    // a single changed byte far from sampled positions must change the key
+    ov::Tensor modified = make_image(1);
+    modified.data<uint8_t>()[modified.get_size() - 5] = 2;
+    EXPECT_NE(key, VisionEmbeddingsCache::make_key("model", VisionType::IMAGE, modified));
+}
+
+TEST(VisionEmbeddingsCache, ReusesEncodingAndEvictsLeastRecentlyUsed) {
+    // every entry takes a bit more than 1 KB
+    VisionEmbeddingsCache cache(3 * 1024);
+    size_t num_encoded = 0;
+    auto encode = [&num_encoded]() {
+        ++num_encoded;
+        return make_encoded(256, static_cast<float>(num_encoded));
+    };
+
+    bool hit = true;
+    EncodedImage first = cache.get_or_encode_image("a", encode, hit);
+    EXPECT_FALSE(hit);
+    EncodedImage reused = cache.get_or_encode_image("a", encode, hit);
+    EXPECT_TRUE(hit);
+    EXPECT_EQ(num_encoded, 1);
+    EXPECT_FLOAT_EQ(reused.resized_source.data<float>()[0], 1.0f);
+
+    cache.get_or_encode_image("b", encode, hit);
+    cache.get_or_encode_image("a", encode, hit);  // "b" becomes least recently used
+    cache.get_or_encode_image("c", encode, hit);
+    EXPECT_EQ(cache.size(), 2);
+    EXPECT_LE(cache.get_memory_usage(), cache.get_capacity());
+
+    cache.get_or_encode_image("a", encode, hit);
+    EXPECT_TRUE(hit);
+    cache.get_or_encode_image("b", encode, hit);
+    EXPECT_FALSE(hit);
+    EXPECT_EQ(num_encoded, 4);
+}
+
+TEST(VisionEmbeddingsCache, EntriesLargerThanCapacityAreNotKept) {
+    VisionEmbeddingsCache cache(512);
+    bool hit = true;
+    auto encode = []() { return make_encoded(1024, 1.0f); };
+    cache.get_or_encode_image("a", encode, hit);
+    cache.get_or_encode_image("a", encode, hit);
+    EXPECT_FALSE(hit);
+    EXPECT_EQ(cache.size(), 0);
+    EXPECT_EQ(cache.get_memory_usage(), 0);
+}
+
+TEST(VisionEmbeddingsCache, ConcurrentMissesEncodeOnce) {
+    VisionEmbeddingsCache cache(1024 * 1024);
+    std::atomic<size_t> num_encoded{0};
+    std::atomic<size_t> num_hits{0};
+    auto encode = [&num_encoded]() {
+        ++num_encoded;
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        return make_encoded(16, 1.0f);
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < 8; ++i) {
+        threads.emplace_back([&]() {
+            bool hit = false;
+            EncodedImage encoded = cache.get_or_encode_image("a", encode, hit);
+            EXPECT_FLOAT_EQ(encoded.resized_source.data<float>()[0], 1.0f);
+            num_hits += hit;
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(num_encoded, 1);
+    EXPECT_EQ(num_hits, 7);
+}
+
+TEST(VisionEmbeddingsCache, FailedEncodingIsNotCached) {
+    VisionEmbeddingsCache cache(1024 * 1024);
+    bool hit = false;
+    EXPECT_THROW(cache.get_or_encode_image("a", []() -> EncodedImage { throw std::runtime_error("failed"); }, hit), std::runtime_error);
+    cache.get_or_encode_image("a", []() { return make_encoded(16, 1.0f); }, hit);
+    EXPECT_FALSE(hit);
+    EXPECT_EQ(cache.size(), 1);
+}
+
+TEST(VisionEmbeddingsCache, ReturnedEncodingsDoNotShareMemoryWithCache) {
+    VisionEmbeddingsCache cache(1024 * 1024);
+    bool hit = false;
+    auto encode = []() { return make_encoded(16, 1.0f); };
+    EncodedImage first = cache.get_or_encode_image("a", encode, hit);
+    first.resized_source.data<float>()[0] = 2.0f;
+
+    EncodedImage second = cache.get_or_encode_image("a", encode, hit);
+    EXPECT_TRUE(hit);
+    EXPECT_NE(first.resized_source.data(), second.resized_source.data());
+    EXPECT_FLOAT_EQ(second.resized_source.data<float>()[0], 1.0f);
+}
+
+TEST(VisionEmbeddingsCache, DisabledUntilConfiguredByProperty) {
+    VisionEmbeddingsCache& cache = VisionEmbeddingsCache::instance();
+    EXPECT_EQ(cache.get_capacity(), 0);
+
+    ov::AnyMap properties{ov::genai::vision_embeddings_cache_size(8), {"OTHER_PROPERTY", 1}};
+    VisionEmbeddingsCache::configure(properties);
+    EXPECT_EQ(cache.get_capacity(), 8 * 1024 * 1024);
+    // the property is not passed further to compile_model()
+    EXPECT_EQ(properties.count(ov::genai::vision_embeddings_cache_size.name()), 0);
+    EXPECT_EQ(properties.size(), 1);
+
+    properties = {ov::genai::vision_embeddings_cache_size(0)};
+    VisionEmbeddingsCache::configure(properties);
+    EXPECT_EQ(cache.get_capacity(), 0);
+}
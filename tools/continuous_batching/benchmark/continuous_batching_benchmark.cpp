@@ -1,10 +1,15 @@
 // Copyright (C) 2023-2026 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 
+#include <algorithm>
+#include <cmath>
 #include <fstream>
 #include <cstdlib>
 #include <chrono>
+#include <condition_variable>
+#include <iomanip>
 #include <ostream>
+#include <queue>
 #include <random>
 #include <stdexcept>
 #include <thread>
@@ -21,67 +26,40 @@
 
 namespace {
 
-class AutoStartTimer {
-    const decltype(std::chrono::steady_clock::now()) m_start;
-public:
-    AutoStartTimer() :
-        m_start(std::chrono::steady_clock::now()) {
-    }
-
-    double current_in_milli() const {
-        auto m_end = std::chrono::steady_clock::now();
-        return std::chrono::duration<double, std::milli>(m_end - m_start).count();
-    }
-};
-
-struct Dataset {
-    std::vector<std::string> m_prompts;
-    std::vector<ov::genai::GenerationConfig> m_sampling_params;
-    std::vector<size_t> m_input_lens, m_output_lens;
-
-    size_t m_total_input_len = 0;
-    size_t m_total_output_len = 0;
+using Clock = std::chrono::steady_clock;
 
-    void reserve(const size_t size) {
-        m_prompts.reserve(size);
-        m_sampling_params.reserve(size);
-        m_input_lens.reserve(size);
-        m_output_lens.reserve(size);
-    }
-
-    void push_data(std::string prompt, ov::genai::GenerationConfig sampling_params) {
-        m_prompts.push_back(prompt);
-        m_sampling_params.push_back(sampling_params);
-    }
-
-    void push_lens(size_t input_len, size_t output_len) {
-        m_input_lens.push_back(input_len);
-        m_output_lens.push_back(output_len);
-
-        m_total_input_len += input_len;
-        m_total_output_len += output_len;
-    }
+double to_milli(Clock::duration duration) {
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
 
-    float get_average_input_len() const {
-        OPENVINO_ASSERT(!empty());
-        return static_cast<float>(m_total_input_len / size());
-    }
+// A single request of a session. Dataset workloads keep prompt text, synthetic workloads keep token ids.
+struct Turn {
+    std::string prompt;
+    std::vector<int64_t> input_ids;
+    size_t input_len = 0;
+    size_t output_len = 0;
+};
 
-    float get_average_output_len() const {
-        OPENVINO_ASSERT(!empty());
-        return static_cast<float>(m_total_output_len / size());
-    }
+// Turns of a session are sent one after another: a turn extends the prompt of the previous one with its answer
+// and a new question, so follow-up turns can reuse the prefix cache
+struct Session {
+    std::vector<Turn> turns;
+};
 
-    bool empty() const {
-        return size() == 0;
-    }
+struct Workload {
+    std::vector<Session> sessions;
 
-    size_t size() const {
-        return m_prompts.size();
+    size_t num_requests() const {
+        size_t num_requests = 0;
+        for (const auto& session : sessions) {
+            num_requests += session.turns.size();
+        }
+        return num_requests;
     }
 };
 
-Dataset filtered_dataset(const std::string& models_path, const std::string& dataset_path, const size_t num_prompts, const size_t max_input_len, const size_t max_output_len) {
+Workload sharegpt_workload(const std::string& models_path, const std::string& dataset_path, const size_t num_sessions, const size_t num_turns,
+                           const size_t max_input_len, const size_t max_output_len, std::mt19937& rng) {
     std::ifstream json_file(dataset_path.c_str());
     OPENVINO_ASSERT(json_file.is_open(), "Cannot open dataset file");
 
@@ -89,262 +67,433 @@ Dataset filtered_dataset(const std::string& models_path, const std::string& data
     const float dataset_size_coeff = 1.2f;
 
     nlohmann::json json_dataset = nlohmann::json::parse(json_file);
-    Dataset sampled_dataset, dataset;
-    const size_t num_prompt_candidates = static_cast<size_t>(num_prompts * dataset_size_coeff);
-    sampled_dataset.reserve(num_prompt_candidates);
-    dataset.reserve(num_prompt_candidates);
+    std::vector<Session> candidates;
+    const size_t num_candidates = static_cast<size_t>(num_sessions * dataset_size_coeff);
+    candidates.reserve(num_candidates);
 
     ov::genai::Tokenizer tokenizer(models_path);
 
-    for (auto json_data_iterator = json_dataset.begin(); json_data_iterator != json_dataset.end() && dataset.size() < num_prompt_candidates; ++json_data_iterator) {
-        auto & json_data = *json_data_iterator;
-
-        // Filter out the conversations with less than 2 turns.
-        if (json_data["conversations"].size() < 2)
-            continue;
-
-        // Only keep the first two turns of each conversation.
-        std::string human_question = json_data["conversations"][0]["value"];
-        std::string gpt_answer = json_data["conversations"][1]["value"];
-
-        ov::Tensor _input_ids_prompt = tokenizer.encode(human_question).input_ids;
-        size_t input_len = _input_ids_prompt.get_size();
-
-        ov::Tensor _input_ids_answer = tokenizer.encode(gpt_answer).input_ids;
-        size_t output_len = _input_ids_answer.get_size();
-
-        // Prune too short sequences.
-        if (input_len < 4 || output_len < 4)
-            continue;
-        // Prune too long sequences.
-        if (input_len > max_input_len || (input_len + output_len) > 2048)
-            continue;
-
-        ov::genai::GenerationConfig greedy_search;
-        greedy_search.max_new_tokens = std::min(max_output_len, output_len);
-        greedy_search.ignore_eos = true;
-
-        dataset.push_data(human_question, greedy_search);
-        dataset.push_lens(input_len, output_len);
+    for (auto json_data_iterator = json_dataset.begin(); json_data_iterator != json_dataset.end() && candidates.size() < num_candidates; ++json_data_iterator) {
+        const auto& conversations = (*json_data_iterator)["conversations"];
+
+        Session session;
+        std::string history;
+        // each turn is a pair of a question and an answer
+        for (size_t turn_id = 0; turn_id < num_turns && 2 * turn_id + 1 < conversations.size(); ++turn_id) {
+            const std::string human_question = conversations[2 * turn_id]["value"];
+            const std::string gpt_answer = conversations[2 * turn_id + 1]["value"];
+            const std::string prompt = history + human_question;
+
+            const size_t input_len = tokenizer.encode(prompt).input_ids.get_size();
+            const size_t output_len = tokenizer.encode(gpt_answer).input_ids.get_size();
+
+            // Prune too short sequences.
+            if (input_len < 4 || output_len < 4)
+                break;
+            // Prune too long sequences.
+            if (input_len > max_input_len || (input_len + output_len) > 2048)
+                break;
+
+            Turn turn;
+            turn.prompt = prompt;
+            turn.input_len = input_len;
+            turn.output_len = std::min(max_output_len, output_len);
+            session.turns.push_back(std::move(turn));
+            history = prompt + "\n" + gpt_answer + "\n";
+        }
+        if (!session.turns.empty()) {
+            candidates.push_back(std::move(session));
+        }
     }
+    OPENVINO_ASSERT(!candidates.empty(), "No conversations in the dataset satisfy length limits");
 
     // sample dataset
-    srand(42);
-
-    for (size_t selected_index = rand() % dataset.size(); sampled_dataset.size() < num_prompts; selected_index = rand() % dataset.size()) {
-        sampled_dataset.push_data(dataset.m_prompts[selected_index], dataset.m_sampling_params[selected_index]);
-        sampled_dataset.push_lens(dataset.m_input_lens[selected_index], dataset.m_output_lens[selected_index]);
+    Workload workload;
+    std::uniform_int_distribution<size_t> index_distribution(0, candidates.size() - 1);
+    while (workload.sessions.size() < num_sessions) {
+        workload.sessions.push_back(candidates[index_distribution(rng)]);
     }
-
-    return sampled_dataset;
+    return workload;
 }
 
-class GenerationInfo {
-
-    struct SequenceInfo {
-        std::chrono::milliseconds ttft;
-        std::chrono::milliseconds cumulated_tpot;
-        std::chrono::milliseconds mean_tpot;
-        size_t num_output_tokens;
-    
-        std::chrono::steady_clock::time_point start_time;
-        std::chrono::steady_clock::time_point last_read_time;
-
-        SequenceInfo(std::chrono::steady_clock::time_point& start_time) {
-            num_output_tokens = 0;
-            ttft = std::chrono::milliseconds::zero();
-            cumulated_tpot = std::chrono::milliseconds::zero();
-            this->start_time = start_time;
-        }
-
-        void update() {
-            std::chrono::steady_clock::time_point new_read_time = std::chrono::steady_clock::now();
-            if (last_read_time.time_since_epoch() == std::chrono::milliseconds::zero()) {
-                ttft = std::chrono::duration_cast<std::chrono::milliseconds>(new_read_time - start_time);
-            } else {
-                cumulated_tpot += std::chrono::duration_cast<std::chrono::milliseconds>(new_read_time - last_read_time);
-                mean_tpot = cumulated_tpot / num_output_tokens;
-
-            }
-            num_output_tokens++;
-            last_read_time = new_read_time;
-        }
-    };
-
-    struct GenerationMetrics {
-        std::chrono::milliseconds mean_ttft = std::chrono::milliseconds::zero();
-        std::chrono::milliseconds mean_tpot = std::chrono::milliseconds::zero();
-        size_t num_output_tokens = 0;
-        size_t num_input_tokens;
-    };
-
-    ov::genai::GenerationHandle generation_handle;
-    std::chrono::steady_clock::time_point start_time;
-    std::unordered_map<int64_t, SequenceInfo> sequences_info;
-    bool active = true;
-    size_t input_len;
+struct SyntheticConfig {
+    size_t input_len = 512;
+    size_t output_len = 128;
+    // fixed, uniform or lognormal
+    std::string len_distribution = "fixed";
+    // relative half-width of the uniform distribution or sigma of the lognormal one
+    double len_spread = 0.5;
+    // fraction of sessions which start with a long context prompt
+    double long_context_ratio = 0.0;
+    size_t long_input_len = 8192;
+    // sessions start with one of num_prefixes shared prefixes of prefix_len tokens
+    size_t num_prefixes = 1;
+    size_t prefix_len = 0;
+};
 
-public:
-    GenerationInfo(ov::genai::GenerationHandle generation_handle, size_t input_len) : input_len(input_len)
-    {
-        this->generation_handle = std::move(generation_handle);
-        start_time = std::chrono::steady_clock::now();
+// Synthetic token ids are drawn from a range which is a part of vocabularies of all supported models
+constexpr int64_t SYNTHETIC_TOKEN_BEGIN = 1000;
+constexpr int64_t SYNTHETIC_TOKEN_END = 10000;
+
+size_t sample_len(const SyntheticConfig& config, size_t mean_len, std::mt19937& rng) {
+    double len = static_cast<double>(mean_len);
+    if (config.len_distribution == "uniform") {
+        len = std::uniform_real_distribution<double>(len * (1.0 - config.len_spread), len * (1.0 + config.len_spread))(rng);
+    } else if (config.len_distribution == "lognormal") {
+        // mean of the distribution is kept equal to mean_len
+        const double sigma = config.len_spread;
+        len = std::lognormal_distribution<double>(std::log(len) - sigma * sigma / 2, sigma)(rng);
+    } else {
+        OPENVINO_ASSERT(config.len_distribution == "fixed", "Unknown length distribution: ", config.len_distribution);
     }
+    return std::max<size_t>(1, static_cast<size_t>(std::round(len)));
+}
 
-    void update_sequence(int64_t sequence_id) {
-        if (sequences_info.find(sequence_id) == sequences_info.end())
-            sequences_info.emplace(sequence_id, SequenceInfo(start_time));
-        sequences_info.at(sequence_id).update();
+void append_random_tokens(std::vector<int64_t>& tokens, size_t num_tokens, std::mt19937& rng) {
+    std::uniform_int_distribution<int64_t> token_distribution(SYNTHETIC_TOKEN_BEGIN, SYNTHETIC_TOKEN_END - 1);
+    for (size_t i = 0; i < num_tokens; ++i) {
+        tokens.push_back(token_distribution(rng));
     }
+}
 
-    void update(ov::genai::GenerationOutputs& outputs){
-        for (auto const& output: outputs) {
-            update_sequence(output.first);
+Workload synthetic_workload(const SyntheticConfig& config, const size_t num_sessions, const size_t num_turns, std::mt19937& rng) {
+    OPENVINO_ASSERT(config.num_prefixes > 0, "Number of shared prefixes must be positive");
+    std::vector<std::vector<int64_t>> prefixes(config.num_prefixes);
+    for (auto& prefix : prefixes) {
+        append_random_tokens(prefix, config.prefix_len, rng);
+    }
+
+    Workload workload;
+    std::uniform_int_distribution<size_t> prefix_distribution(0, config.num_prefixes - 1);
+    std::bernoulli_distribution long_context_distribution(config.long_context_ratio);
+    for (size_t session_id = 0; session_id < num_sessions; ++session_id) {
+        Session session;
+        std::vector<int64_t> history = prefixes[prefix_distribution(rng)];
+        const size_t first_input_len = long_context_distribution(rng) ? config.long_input_len : config.input_len;
+        for (size_t turn_id = 0; turn_id < num_turns; ++turn_id) {
+            Turn turn;
+            turn.input_ids = history;
+            append_random_tokens(turn.input_ids, sample_len(config, turn_id == 0 ? first_input_len : config.input_len, rng), rng);
+            turn.input_len = turn.input_ids.size();
+            turn.output_len = sample_len(config, config.output_len, rng);
+            // the reference answer stands for the generated one in the next turn
+            history = turn.input_ids;
+            append_random_tokens(history, turn.output_len, rng);
+            session.turns.push_back(std::move(turn));
         }
+        workload.sessions.push_back(std::move(session));
     }
+    return workload;
+}
 
-    ov::genai::GenerationOutputs read() {
-        return generation_handle->read();
+// Returns arrival times of sessions in seconds since the start of the benchmark
+std::vector<double> arrival_times(const std::string& arrival, const std::string& request_rate, double burstiness,
+                                  const std::string& trace_path, size_t num_sessions, std::mt19937& rng) {
+    std::vector<double> times;
+    times.reserve(num_sessions);
+    if (arrival == "trace") {
+        std::ifstream trace_file(trace_path);
+        OPENVINO_ASSERT(trace_file.is_open(), "Cannot open arrival trace file");
+        // an array of timestamps in seconds or objects with "timestamp" field
+        const nlohmann::json trace = nlohmann::json::parse(trace_file);
+        for (const auto& record : trace) {
+            times.push_back(record.is_object() ? record.at("timestamp").get<double>() : record.get<double>());
+        }
+        OPENVINO_ASSERT(!times.empty(), "Arrival trace is empty");
+        std::sort(times.begin(), times.end());
+        const double first_time = times.front();
+        for (auto& time : times) {
+            time -= first_time;
+        }
+        if (times.size() > num_sessions) {
+            times.resize(num_sessions);
+        }
+        return times;
     }
 
-    bool can_read() {
-        return generation_handle->can_read();
-    }
+    if (request_rate == "inf") {
+        times.assign(num_sessions, 0.0);
+        return times;
+    }
+    const double numeric_request_rate = std::stod(request_rate);
+    if (numeric_request_rate <= 0)
+        throw std::invalid_argument("request_rate must be a positive number or inf");
+
+    // gamma distributed gaps with shape 1 form a Poisson process, smaller shapes make arrivals burstier
+    OPENVINO_ASSERT(arrival == "poisson" || arrival == "gamma", "Unknown arrival process: ", arrival);
+    const double shape = arrival == "poisson" ? 1.0 : burstiness;
+    OPENVINO_ASSERT(shape > 0, "burstiness must be positive");
+    std::gamma_distribution<double> gap_distribution(shape, 1.0 / (numeric_request_rate * shape));
+    double time = 0.0;
+    for (size_t i = 0; i < num_sessions; ++i) {
+        times.push_back(time);
+        time += gap_distribution(rng);
+    }
+    return times;
+}
 
-    bool is_finished() {
-        return generation_handle->get_status() == ov::genai::GenerationStatus::FINISHED;
-    }
+struct RequestRecord {
+    size_t session_id = 0;
+    size_t turn_id = 0;
+    size_t input_len = 0;
+    size_t num_output_tokens = 0;
+    Clock::time_point submit_time;
+    Clock::time_point first_token_time;
+    Clock::time_point last_token_time;
+    ov::genai::GenerationStatus status = ov::genai::GenerationStatus::RUNNING;
+    ov::genai::GenerationHandle handle;
 
-    void set_inactive() {
-        active = false;
+    double ttft_ms() const {
+        return to_milli(first_token_time - submit_time);
     }
 
-    bool is_active() {
-        return active;
+    double tpot_ms() const {
+        return num_output_tokens > 1 ? to_milli(last_token_time - first_token_time) / (num_output_tokens - 1) : 0.0;
     }
 
-    GenerationMetrics get_metrics() {
-        GenerationMetrics generation_metrics;
-        if (!sequences_info.empty()) {
-            for (auto& sequenceInfoPair : sequences_info) {
-                generation_metrics.mean_ttft += sequenceInfoPair.second.ttft;
-                generation_metrics.mean_tpot += sequenceInfoPair.second.mean_tpot;
-                generation_metrics.num_output_tokens += sequenceInfoPair.second.num_output_tokens;
-            }
-            generation_metrics.mean_ttft /= sequences_info.size();
-            generation_metrics.mean_tpot /= sequences_info.size();
-            generation_metrics.num_input_tokens = input_len;
-        }
-        return generation_metrics;
+    double e2e_latency_ms() const {
+        return to_milli(last_token_time - submit_time);
     }
 };
 
-class GenerationInfoCollector {
-    std::mutex mutex;
-    std::vector<GenerationInfo> generations_info;
-    size_t num_finished = 0;
-    std::chrono::steady_clock::time_point start_time;
+// Submits requests at their arrival times. First turns of sessions follow the arrival process regardless of
+// the pipeline progress, following turns are sent after the previous turn of the session is finished and think time passed.
+class LoadGenerator {
+    struct PendingTurn {
+        Clock::time_point time;
+        size_t session_id;
+        size_t turn_id;
+
+        bool operator>(const PendingTurn& other) const {
+            return time > other.time;
+        }
+    };
+
+    const Workload& m_workload;
+    Clock::duration m_think_time;
+    bool m_is_speculative_decoding_enabled;
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::priority_queue<PendingTurn, std::vector<PendingTurn>, std::greater<PendingTurn>> m_pending;
+    std::vector<RequestRecord> m_records;
+    size_t m_num_finished = 0;
+    Clock::time_point m_start_time;
 
 public:
+    LoadGenerator(const Workload& workload, double think_time_ms, bool is_speculative_decoding_enabled) :
+        m_workload(workload),
+        m_think_time(std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double, std::milli>(think_time_ms))),
+        m_is_speculative_decoding_enabled(is_speculative_decoding_enabled) {
+        m_records.reserve(workload.num_requests());
+    }
+
+    void run(ov::genai::ContinuousBatchingPipeline* pipe, const std::vector<double>& session_arrival_times) {
+        const size_t num_requests = m_workload.num_requests();
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_start_time = Clock::now();
+        for (size_t session_id = 0; session_id < session_arrival_times.size(); ++session_id) {
+            const auto offset = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(session_arrival_times[session_id]));
+            m_pending.push({m_start_time + offset, session_id, 0});
+        }
+        std::cout << "Launching load generator with " << session_arrival_times.size() << " sessions" << std::endl;
 
-    void set_start_time(std::chrono::steady_clock::time_point start_time) {
-        this->start_time = start_time;
-    }
+        for (size_t num_submitted = 0; num_submitted < num_requests;) {
+            if (m_pending.empty()) {
+                m_cv.wait(lock);
+                continue;
+            }
+            const PendingTurn next = m_pending.top();
+            if (Clock::now() < next.time) {
+                m_cv.wait_until(lock, next.time);
+                continue;
+            }
+            m_pending.pop();
+
+            const Turn& turn = m_workload.sessions[next.session_id].turns[next.turn_id];
+            ov::genai::GenerationConfig sampling_params;
+            sampling_params.max_new_tokens = turn.output_len;
+            sampling_params.ignore_eos = true;
+            if (m_is_speculative_decoding_enabled) {
+                // to enable static speculative decoding
+                sampling_params.num_assistant_tokens = 5;
+            }
 
-    void add_generation(ov::genai::ContinuousBatchingPipeline* pipe, Dataset* dataset, size_t request_id, bool is_speculative_decoding_enabled) {
-        auto sampling_params = dataset->m_sampling_params[request_id];
-        if (is_speculative_decoding_enabled) {
-            // to enable static speculative decoding
-            sampling_params.num_assistant_tokens = 5;
-            // to enable dynamic speculative decoding
-            // sampling_params.assistant_confidence_threshold = 0.4f;
+            RequestRecord record;
+            record.session_id = next.session_id;
+            record.turn_id = next.turn_id;
+            record.input_len = turn.input_len;
+            const size_t request_id = m_records.size();
+            // a request is added with the lock released, so the statistics reporter is not blocked by tokenization
+            lock.unlock();
+            record.submit_time = Clock::now();
+            if (turn.input_ids.empty()) {
+                record.handle = pipe->add_request(request_id, turn.prompt, sampling_params);
+            } else {
+                ov::Tensor input_ids(ov::element::i64, {1, turn.input_ids.size()}, const_cast<int64_t*>(turn.input_ids.data()));
+                record.handle = pipe->add_request(request_id, input_ids, sampling_params);
+            }
+            lock.lock();
+            m_records.push_back(std::move(record));
+            ++num_submitted;
         }
-        ov::genai::GenerationHandle generation_handle = pipe->add_request(request_id, dataset->m_prompts[request_id], sampling_params);
-        std::lock_guard<std::mutex> lock(mutex);
-        generations_info.emplace_back(std::move(generation_handle), dataset->m_input_lens[request_id]);
+        std::cout << "All requests sent, load generation finished. Exiting thread." << std::endl;
     }
 
-    size_t run() {
-        std::lock_guard<std::mutex> lock(mutex);
-        for (GenerationInfo& generation_info : generations_info) {
-            if (!generation_info.is_active())
+    // Reads generated tokens of running requests, returns the number of finished requests
+    size_t poll() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (RequestRecord& record : m_records) {
+            if (record.status != ov::genai::GenerationStatus::RUNNING)
                 continue;
-            
-            if (generation_info.is_finished()) {
-                num_finished++;
-                generation_info.set_inactive();
-            } else if (generation_info.can_read()) {
-                auto outputs = generation_info.read();
-                generation_info.update(outputs);
+
+            if (record.handle->can_read()) {
+                const auto now = Clock::now();
+                size_t num_new_tokens = 0;
+                for (const auto& output : record.handle->read()) {
+                    num_new_tokens = std::max(num_new_tokens, output.second.generated_ids.size());
+                }
+                if (num_new_tokens > 0) {
+                    if (record.num_output_tokens == 0)
+                        record.first_token_time = now;
+                    record.last_token_time = now;
+                    record.num_output_tokens += num_new_tokens;
+                }
+            } else if (record.handle->get_status() != ov::genai::GenerationStatus::RUNNING) {
+                record.status = record.handle->get_status();
+                record.handle.reset();
+                ++m_num_finished;
+                const Session& session = m_workload.sessions[record.session_id];
+                if (record.turn_id + 1 < session.turns.size()) {
+                    m_pending.push({Clock::now() + m_think_time, record.session_id, record.turn_id + 1});
+                    m_cv.notify_one();
+                }
             }
         }
-        return num_finished;
-    }
-
-    void print_statistics() {
-        std::chrono::seconds total_duration = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now() - start_time);
-        std::chrono::milliseconds mean_ttft = std::chrono::milliseconds::zero();
-        std::chrono::milliseconds mean_tpot = std::chrono::milliseconds::zero();
-        size_t total_input_len = 0;
-        size_t total_output_len = 0;
-        
-    
-        for (GenerationInfo& generation_info : generations_info){
-            auto generation_metrics = generation_info.get_metrics();
-            mean_ttft += generation_metrics.mean_ttft;
-            mean_tpot += generation_metrics.mean_tpot;
-            total_input_len += generation_metrics.num_input_tokens;
-            total_output_len += generation_metrics.num_output_tokens;
-        }
-        mean_ttft /= generations_info.size();
-        mean_tpot /= generations_info.size();
-        std::cout << "Benchmark duration: " << total_duration.count() << " s" << std::endl;
-        std::cout << "Total number of input tokens: " << total_input_len << std::endl;
-        std::cout << "Total number of output tokens: " << total_output_len << std::endl;
-        std::cout << "Input throughput: " << total_input_len / total_duration.count() << " tokens / s" << std::endl;
-        std::cout << "Output throughput: " << total_output_len / total_duration.count() << " tokens / s" << std::endl;
-        std::cout << "Mean TTFT: " << mean_ttft.count() << " ms" << std::endl;
-        std::cout << "Mean TPOT: " << mean_tpot.count() << " ms" << std::endl; 
+        return m_num_finished;
+    }
+
+    Clock::time_point get_start_time() const {
+        return m_start_time;
+    }
+
+    const std::vector<RequestRecord>& get_records() const {
+        return m_records;
     }
 };
 
-void trafficSimulator(ov::genai::ContinuousBatchingPipeline* pipe, Dataset* dataset, std::string request_rate, GenerationInfoCollector* generation_info_collector, bool is_speculative_decoding_enabled) {
-    double numeric_request_rate;
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::exponential_distribution<> distribution;
+nlohmann::json percentiles(std::vector<double> values) {
+    nlohmann::json report = nlohmann::json::object();
+    if (values.empty()) {
+        return report;
+    }
+    std::sort(values.begin(), values.end());
+    auto percentile = [&values](double p) {
+        const double rank = p / 100.0 * (values.size() - 1);
+        const size_t lower = static_cast<size_t>(rank);
+        const size_t upper = std::min(lower + 1, values.size() - 1);
+        return values[lower] + (values[upper] - values[lower]) * (rank - lower);
+    };
+    double sum = 0.0;
+    for (double value : values) {
+        sum += value;
+    }
+    report["mean"] = sum / values.size();
+    report["p50"] = percentile(50);
+    report["p90"] = percentile(90);
+    report["p95"] = percentile(95);
+    report["p99"] = percentile(99);
+    report["max"] = values.back();
+    return report;
+}
 
-    if (request_rate == "inf") {
-        numeric_request_rate = -1.0;
-    } else {
-        numeric_request_rate = std::stod(request_rate);
-        if (numeric_request_rate < 0)
-            throw std::invalid_argument("request_rate cannot be a negative number");
+nlohmann::json histogram_percentiles(const ov::genai::MetricHistogram& histogram) {
+    return {{"count", histogram.count},
+            {"mean", histogram.get_mean()},
+            {"p50", histogram.get_quantile(0.5f)},
+            {"p90", histogram.get_quantile(0.9f)},
+            {"p99", histogram.get_quantile(0.99f)}};
+}
 
-        distribution = std::exponential_distribution<>(numeric_request_rate);
+// Summarizes client side latencies and goodput, i.e. the rate of requests which meet both TTFT and TPOT SLOs
+nlohmann::json make_report(const std::vector<RequestRecord>& records, Clock::duration duration, double slo_ttft_ms, double slo_tpot_ms,
+                           const ov::genai::PipelineMetrics& pipeline_metrics) {
+    const double duration_s = std::chrono::duration<double>(duration).count();
+    std::vector<double> ttfts, tpots, e2e_latencies;
+    size_t total_input_len = 0, total_output_len = 0, num_completed = 0, num_good = 0, good_output_len = 0;
+    for (const RequestRecord& record : records) {
+        total_input_len += record.input_len;
+        total_output_len += record.num_output_tokens;
+        if (record.status != ov::genai::GenerationStatus::FINISHED || record.num_output_tokens == 0)
+            continue;
+        ++num_completed;
+        ttfts.push_back(record.ttft_ms());
+        e2e_latencies.push_back(record.e2e_latency_ms());
+        if (record.num_output_tokens > 1)
+            tpots.push_back(record.tpot_ms());
+        if (record.ttft_ms() <= slo_ttft_ms && record.tpot_ms() <= slo_tpot_ms) {
+            ++num_good;
+            good_output_len += record.num_output_tokens;
+        }
     }
 
-    /*
-    std::cout << "Total input tokens: " << dataset->m_total_input_len << std::endl;
-    std::cout << "Total output tokens: " << dataset->m_total_output_len << std::endl;
-    std::cout << "Average input len: " << dataset->get_average_input_len() << " tokens" << std::endl;
-    std::cout << "Average output len: " << dataset->get_average_output_len() << " tokens" << std::endl;
-    */
+    nlohmann::json report;
+    report["duration_s"] = duration_s;
+    report["num_requests"] = records.size();
+    report["num_completed"] = num_completed;
+    report["total_input_tokens"] = total_input_len;
+    report["total_output_tokens"] = total_output_len;
+    report["request_throughput"] = num_completed / duration_s;
+    report["input_throughput"] = total_input_len / duration_s;
+    report["output_throughput"] = total_output_len / duration_s;
+    report["ttft_ms"] = percentiles(ttfts);
+    report["tpot_ms"] = percentiles(tpots);
+    report["e2e_latency_ms"] = percentiles(e2e_latencies);
+    report["slo"] = {{"ttft_ms", slo_ttft_ms},
+                     {"tpot_ms", slo_tpot_ms},
+                     {"num_good_requests", num_good},
+                     {"attainment", records.empty() ? 0.0 : static_cast<double>(num_good) / records.size()},
+                     {"goodput_requests_per_s", num_good / duration_s},
+                     {"goodput_output_tokens_per_s", good_output_len / duration_s}};
+    report["pipeline"] = {{"queue_wait_ms", histogram_percentiles(pipeline_metrics.queue_wait_ms)},
+                          {"step_duration_ms", histogram_percentiles(pipeline_metrics.step_duration_ms)},
+                          {"batch_size", histogram_percentiles(pipeline_metrics.batch_size)},
+                          {"preemptions", pipeline_metrics.preemptions},
+                          {"recomputed_tokens", pipeline_metrics.recomputed_tokens},
+                          {"prefix_cache_hits", pipeline_metrics.prefix_cache_hits},
+                          {"prefix_cache_misses", pipeline_metrics.prefix_cache_misses},
+                          {"evicted_tokens", pipeline_metrics.evicted_tokens},
+                          {"max_cache_usage", pipeline_metrics.max_cache_usage}};
+    return report;
+}
 
-    std::cout << "Launching traffic simulator thread with request_rate: " << request_rate << std::endl;
-    generation_info_collector->set_start_time(std::chrono::steady_clock::now());
-    for (size_t request_id = 0; request_id < dataset->size(); ++request_id) {
-        std::cout << "Traffic thread adding request to the queue..." << std::endl;
-        generation_info_collector->add_generation(pipe, dataset, request_id, is_speculative_decoding_enabled);
-        if (numeric_request_rate > 0)
-            std::this_thread::sleep_for(std::chrono::milliseconds(int(distribution(gen) * 1000)));
-    }
-    std::cout << "All requests sent, traffic simulation finished. Exiting thread." << std::endl;
+void print_report(const nlohmann::json& report) {
+    auto print_latency = [&report](const char* title, const char* key) {
+        const auto& latency = report[key];
+        if (latency.empty())
+            return;
+        std::cout << title << ": mean " << latency["mean"].get<double>() << " ms, p50 " << latency["p50"].get<double>()
+                  << " ms, p99 " << latency["p99"].get<double>() << " ms" << std::endl;
+    };
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "Benchmark duration: " << report["duration_s"].get<double>() << " s" << std::endl;
+    std::cout << "Completed requests: " << report["num_completed"] << " / " << report["num_requests"] << std::endl;
+    std::cout << "Total number of input tokens: " << report["total_input_tokens"] << std::endl;
+    std::cout << "Total number of output tokens: " << report["total_output_tokens"] << std::endl;
+    std::cout << "Input throughput: " << report["input_throughput"].get<double>() << " tokens / s" << std::endl;
+    std::cout << "Output throughput: " << report["output_throughput"].get<double>() << " tokens / s" << std::endl;
+    print_latency("TTFT", "ttft_ms");
+    print_latency("TPOT", "tpot_ms");
+    print_latency("E2E latency", "e2e_latency_ms");
+    const auto& slo = report["slo"];
+    std::cout << "SLO attainment (TTFT <= " << slo["ttft_ms"].get<double>() << " ms, TPOT <= " << slo["tpot_ms"].get<double>() << " ms): "
+              << slo["attainment"].get<double>() * 100 << " %" << std::endl;
+    std::cout << "Goodput: " << slo["goodput_requests_per_s"].get<double>() << " requests / s, "
+              << slo["goodput_output_tokens_per_s"].get<double>() << " tokens / s" << std::endl;
 }
 
-void llmEngineLoop(ov::genai::ContinuousBatchingPipeline* pipe, Dataset* dataset, std::atomic<bool>* finishThread) {
+void llmEngineLoop(ov::genai::ContinuousBatchingPipeline* pipe, std::atomic<bool>* finishThread) {
     std::cout << "Launching LLM engine thread" << std::endl;
-    size_t num_finished = 0;
 
     while (!(*finishThread)) {
         while (pipe->has_non_finished_requests()) {
@@ -354,14 +503,14 @@ void llmEngineLoop(ov::genai::ContinuousBatchingPipeline* pipe, Dataset* dataset
     std::cout << "All requests processed, LLM Engine loop escaped. Exiting thread." << std::endl;
 }
 
-void statisticsReporter(GenerationInfoCollector* generations_info_collector, int num_prompts) {
-    int num_finished = 0;
-    while (num_finished < num_prompts) {
-        num_finished = generations_info_collector->run();
+void statisticsReporter(LoadGenerator* load_generator, size_t num_requests) {
+    size_t num_finished = 0;
+    while (num_finished < num_requests) {
+        num_finished = load_generator->poll();
+        // let the load generator take the lock to submit requests
+        std::this_thread::yield();
     }
     std::cout << "Benchmark finished, summarizing statistics..." << std::endl;
-    generations_info_collector->print_statistics();
-
     std::cout << "Exiting statistics reporter thread." << std::endl;
 }
 
@@ -432,19 +581,39 @@ int main(int argc, char* argv[]) try {
     cxxopts::Options options("benchmark_sample", "Help command");
 
     options.add_options()
-    ("n,num_prompts", "A number of prompts", cxxopts::value<size_t>()->default_value("1000"))
+    ("n,num_prompts", "A number of sessions, each session sends num_turns requests", cxxopts::value<size_t>()->default_value("1000"))
     ("b,max_batch_size", "A maximum number of batched tokens", cxxopts::value<size_t>()->default_value("256"))
     ("dynamic_split_fuse", "Whether to use dynamic split-fuse or vLLM scheduling", cxxopts::value<bool>()->default_value("true"))
     ("m,model", "Path to model and tokenizers base directory", cxxopts::value<std::string>()->default_value("."))
     ("draft_model", "Path to assistant model directory", cxxopts::value<std::string>()->default_value(""))
+    ("scenario", "Workload scenario: sharegpt takes prompts from the dataset, synthetic generates random token ids", cxxopts::value<std::string>()->default_value("sharegpt"))
     ("dataset", "Path to dataset .json file", cxxopts::value<std::string>()->default_value("./ShareGPT_V3_unfiltered_cleaned_split.json"))
     ("max_input_len", "Max input length take from dataset", cxxopts::value<size_t>()->default_value("1024"))
     ("max_output_len", "Max output length", cxxopts::value<size_t>()->default_value("2048"))
-    ("request_rate", "Number of requests per second. If this is inf, then all the requests are sent at time 0. Otherwise, we use Poisson process to synthesize the request arrival times.", cxxopts::value<std::string>()->default_value("inf"))
+    ("num_turns", "Number of turns of a session. Each turn extends the previous prompt with the answer and a new question", cxxopts::value<size_t>()->default_value("1"))
+    ("think_time_ms", "Delay between the end of a turn and the next turn of the session", cxxopts::value<double>()->default_value("0"))
+    ("input_len", "Mean input length of synthetic requests", cxxopts::value<size_t>()->default_value("512"))
+    ("output_len", "Mean output length of synthetic requests", cxxopts::value<size_t>()->default_value("128"))
+    ("len_dist", "Distribution of synthetic lengths: fixed, uniform or lognormal", cxxopts::value<std::string>()->default_value("fixed"))
+    ("len_spread", "Relative half-width of uniform or sigma of lognormal length distribution", cxxopts::value<double>()->default_value("0.5"))
+    ("long_context_ratio", "Fraction of synthetic sessions starting with a long context prompt", cxxopts::value<double>()->default_value("0"))
+    ("long_input_len", "Input length of long context prompts", cxxopts::value<size_t>()->default_value("8192"))
+    ("prefix_len", "Length of prefixes shared between synthetic sessions", cxxopts::value<size_t>()->default_value("0"))
+    ("num_prefixes", "Number of distinct shared prefixes", cxxopts::value<size_t>()->default_value("1"))
+    ("arrival", "Arrival process of sessions: poisson, gamma or trace", cxxopts::value<std::string>()->default_value("poisson"))
+    ("request_rate", "Number of sessions per second. If this is inf, then all the sessions are started at time 0. Otherwise, arrival times are synthesized by the arrival process.", cxxopts::value<std::string>()->default_value("inf"))
+    ("burstiness", "Shape of gamma distributed gaps between arrivals. Values below 1 make arrivals burstier", cxxopts::value<double>()->default_value("1"))
+    ("trace", "Path to .json file with an array of arrival timestamps in seconds to replay", cxxopts::value<std::string>()->default_value(""))
+    ("seed", "Seed of dataset sampling and arrival times", cxxopts::value<uint32_t>()->default_value("42"))
+    ("slo_ttft_ms", "TTFT objective of a request to be counted in goodput", cxxopts::value<double>()->default_value("1000"))
+    ("slo_tpot_ms", "TPOT objective of a request to be counted in goodput", cxxopts::value<double>()->default_value("100"))
+    ("report", "Path to .json file to write latency percentiles, goodput and pipeline metrics", cxxopts::value<std::string>()->default_value(""))
     ("cache_size", "Size of memory used for KV cache in GB. Default: 16", cxxopts::value<size_t>()->default_value("16"))
     ("device", "Target device to run the model. Default: CPU", cxxopts::value<std::string>()->default_value("CPU"))
     ("device_config", "Plugin configuration JSON. Example: '{\"MODEL_DISTRIBUTION_POLICY\":\"TENSOR_PARALLEL\",\"PERF_COUNT\":true}' Default: {\"PERF_COUNT\":true}", cxxopts::value<std::string>()->default_value("{\"PERF_COUNT\":true}"))
     ("use_cache_eviction", "Whether to use cache eviction", cxxopts::value<bool>()->default_value("false"))
+    ("enable_prefix_caching", "Whether to reuse KV cache of common prompt prefixes", cxxopts::value<bool>()->default_value("false"))
+    ("admission_window", "Number of the oldest waiting prompts admitted in order of uncached prefill length, 0 keeps arrival order", cxxopts::value<size_t>()->default_value("0"))
     ("h,help", "Print usage");
 
     cxxopts::ParseResult result;
@@ -466,25 +635,62 @@ int main(int argc, char* argv[]) try {
     const bool dynamic_split_fuse = result["dynamic_split_fuse"].as<bool>();
     const std::string models_path = result["model"].as<std::string>();
     const std::string draft_model_path = result["draft_model"].as<std::string>();
+    const std::string scenario = result["scenario"].as<std::string>();
     const std::string dataset_path = result["dataset"].as<std::string>();
     const size_t max_input_len = result["max_input_len"].as<size_t>();
     const size_t max_output_len = result["max_output_len"].as<size_t>();
+    const size_t num_turns = result["num_turns"].as<size_t>();
+    const double think_time_ms = result["think_time_ms"].as<double>();
+    const std::string arrival = result["arrival"].as<std::string>();
     const std::string request_rate = result["request_rate"].as<std::string>();
+    const double burstiness = result["burstiness"].as<double>();
+    const std::string trace_path = result["trace"].as<std::string>();
+    const uint32_t seed = result["seed"].as<uint32_t>();
+    const double slo_ttft_ms = result["slo_ttft_ms"].as<double>();
+    const double slo_tpot_ms = result["slo_tpot_ms"].as<double>();
+    const std::string report_path = result["report"].as<std::string>();
     const std::string device = result["device"].as<std::string>();
     const std::string device_config = result["device_config"].as<std::string>();
     const size_t cache_size = result["cache_size"].as<size_t>();
     const bool use_cache_eviction = result["use_cache_eviction"].as<bool>();
+    const bool enable_prefix_caching = result["enable_prefix_caching"].as<bool>();
+    const size_t admission_window = result["admission_window"].as<size_t>();
 
+    OPENVINO_ASSERT(num_turns > 0, "num_turns must be positive");
     bool is_speculative_decoding_enabled = !draft_model_path.empty();
 
     // Create requests for generation
-    Dataset dataset = filtered_dataset(models_path, dataset_path, num_prompts, max_input_len, max_output_len);
+    std::mt19937 rng(seed);
+    Workload workload;
+    SyntheticConfig synthetic_config;
+    if (scenario == "sharegpt") {
+        workload = sharegpt_workload(models_path, dataset_path, num_prompts, num_turns, max_input_len, max_output_len, rng);
+    } else if (scenario == "synthetic") {
+        synthetic_config.input_len = result["input_len"].as<size_t>();
+        synthetic_config.output_len = result["output_len"].as<size_t>();
+        synthetic_config.len_distribution = result["len_dist"].as<std::string>();
+        synthetic_config.len_spread = result["len_spread"].as<double>();
+        synthetic_config.long_context_ratio = result["long_context_ratio"].as<double>();
+        synthetic_config.long_input_len = result["long_input_len"].as<size_t>();
+        synthetic_config.prefix_len = result["prefix_len"].as<size_t>();
+        synthetic_config.num_prefixes = result["num_prefixes"].as<size_t>();
+        workload = synthetic_workload(synthetic_config, num_prompts, num_turns, rng);
+    } else {
+        OPENVINO_THROW("Unknown scenario: ", scenario);
+    }
+
+    const std::vector<double> session_arrival_times = arrival_times(arrival, request_rate, burstiness, trace_path, workload.sessions.size(), rng);
+    // a replayed trace may be shorter than the requested number of sessions
+    workload.sessions.resize(session_arrival_times.size());
+    const size_t num_requests = workload.num_requests();
 
     // Perform the first inference
     ov::genai::SchedulerConfig scheduler_config;
     scheduler_config.max_num_batched_tokens = max_batch_size,
     scheduler_config.cache_size = cache_size,
     scheduler_config.dynamic_split_fuse = dynamic_split_fuse,
+    scheduler_config.enable_prefix_caching = enable_prefix_caching,
+    scheduler_config.prefix_aware_admission_window = admission_window,
     scheduler_config.max_num_seqs = 256; // not used if dynamic_split_fuse=True
     if (use_cache_eviction) {
         scheduler_config.use_cache_eviction = true;
@@ -497,8 +703,13 @@ int main(int argc, char* argv[]) try {
     if (!scheduler_config.dynamic_split_fuse) {
         std::cout << "\tMax number of batched sequences: " << scheduler_config.max_num_seqs << std::endl;
     }
-    std::cout << "Dataset parameters: " << std::endl;
-    std::cout << "\tNum prompts: " << num_prompts << std::endl;
+    std::cout << "\tPrefix caching: " << std::boolalpha << scheduler_config.enable_prefix_caching << std::endl;
+    std::cout << "\tAdmission window: " << scheduler_config.prefix_aware_admission_window << std::endl;
+    std::cout << "Workload parameters: " << std::endl;
+    std::cout << "\tScenario: " << scenario << std::endl;
+    std::cout << "\tNum sessions: " << workload.sessions.size() << std::endl;
+    std::cout << "\tNum requests: " << num_requests << std::endl;
+    std::cout << "\tArrival process: " << arrival << ", request rate: " << request_rate << std::endl;
     std::cout << "\tMax input length: " << max_input_len << std::endl;
     std::cout << "\tMax output length: " << max_output_len << std::endl;
     std::cout << "\tTarget device: " << device << std::endl;
@@ -512,31 +723,56 @@ int main(int argc, char* argv[]) try {
         std::cout << "ERROR: Wrong json parameter in device_config." << std::endl;
         return EXIT_FAILURE;
     }
-    
+
     // Benchmarking
     std::cout << "Loading models, creating pipelines, preparing environment..." << std::endl;
     ov::genai::ContinuousBatchingPipeline pipe(models_path, scheduler_config, device, device_config_map);
 
-    std::cout << "Setup finished, launching LLM executor, traffic simulation and statistics reporter threads" << std::endl;
+    std::cout << "Setup finished, launching LLM executor, load generator and statistics reporter threads" << std::endl;
 
-    GenerationInfoCollector generation_info_collector;
+    LoadGenerator load_generator(workload, think_time_ms, is_speculative_decoding_enabled);
 
     std::atomic<bool> finishGenerationThread{false};
-    if (request_rate == "inf") {
-        std::thread trafficSimulatorThread(trafficSimulator, &pipe, &dataset, request_rate, &generation_info_collector, is_speculative_decoding_enabled);
-        trafficSimulatorThread.join();
-    }
-    
-    std::thread lmmEngineThread(llmEngineLoop, &pipe, &dataset, &finishGenerationThread);
-    std::thread statisticsReporterThread(statisticsReporter, &generation_info_collector, num_prompts);
-    if (request_rate != "inf") {
-        std::thread trafficSimulatorThread(trafficSimulator, &pipe, &dataset, request_rate, &generation_info_collector, is_speculative_decoding_enabled);
-        trafficSimulatorThread.join();
-    }
+    std::thread lmmEngineThread(llmEngineLoop, &pipe, &finishGenerationThread);
+    std::thread statisticsReporterThread(statisticsReporter, &load_generator, num_requests);
+    std::thread loadGeneratorThread(&LoadGenerator::run, &load_generator, &pipe, std::cref(session_arrival_times));
+    loadGeneratorThread.join();
     statisticsReporterThread.join();
+    const Clock::duration duration = Clock::now() - load_generator.get_start_time();
     finishGenerationThread = true;
     lmmEngineThread.join();
 
+    nlohmann::json report = make_report(load_generator.get_records(), duration, slo_ttft_ms, slo_tpot_ms, pipe.get_metrics());
+    report["config"] = {{"scenario", scenario},
+                        {"num_sessions", workload.sessions.size()},
+                        {"num_turns", num_turns},
+                        {"arrival", arrival},
+                        {"request_rate", request_rate},
+                        {"burstiness", burstiness},
+                        {"seed", seed},
+                        {"max_num_batched_tokens", scheduler_config.max_num_batched_tokens},
+                        {"dynamic_split_fuse", scheduler_config.dynamic_split_fuse},
+                        {"enable_prefix_caching", scheduler_config.enable_prefix_caching},
+                        {"use_cache_eviction", scheduler_config.use_cache_eviction},
+                        {"cache_size", scheduler_config.cache_size},
+                        {"device", device}};
+    if (scenario == "synthetic") {
+        report["config"]["synthetic"] = {{"input_len", synthetic_config.input_len},
+                                         {"output_len", synthetic_config.output_len},
+                                         {"len_dist", synthetic_config.len_distribution},
+                                         {"long_context_ratio", synthetic_config.long_context_ratio},
+                                         {"long_input_len", synthetic_config.long_input_len},
+                                         {"prefix_len", synthetic_config.prefix_len},
+                                         {"num_prefixes", synthetic_config.num_prefixes}};
+    }
+    print_report(report);
+    if (!report_path.empty()) {
+        std::ofstream report_file(report_path);
+        OPENVINO_ASSERT(report_file.is_open(), "Cannot open report file ", report_path);
+        report_file << report.dump(4) << std::endl;
+        std::cout << "Report is written to " << report_path << std::endl;
+    }
+
     std::cout << "Benchmark finished" << std::endl;
 } catch (const std::exception& error) {
     try {
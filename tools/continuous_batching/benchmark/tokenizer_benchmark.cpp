@@ -0,0 +1,148 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+// Measures batch encode / decode throughput of a tokenizer depending on the number of infer requests
+// the batch is sharded across, i.e. scaling of batch tokenization versus number of used cores.
+
+#include <fstream>
+#include <cstdlib>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <thread>
+
+#include <cxxopts.hpp>
+
+#include "openvino/genai/tokenizer.hpp"
+
+namespace {
+
+std::vector<std::string> read_prompts(const std::string& prompts_path, size_t num_prompts) {
+    std::vector<std::string> lines;
+    if (!prompts_path.empty()) {
+        std::ifstream prompts_file(prompts_path);
+        if (!prompts_file.is_open()) {
+            throw std::runtime_error("Cannot open prompts file " + prompts_path);
+        }
+        for (std::string line; std::getline(prompts_file, line);) {
+            if (!line.empty())
+                lines.push_back(line);
+        }
+    }
+
+    // synthetic chunks of 16 - 1024 words, similar to RAG documents of different size
+    const std::vector<std::string> words = {"the", "model", "retrieval", "augmented", "generation", "of", "tokens",
+                                            "document", "chunk", "with", "context", "and", "question", "answer"};
+    std::mt19937 engine(42);
+    std::uniform_int_distribution<size_t> num_words_distribution(16, 1024), word_distribution(0, words.size() - 1);
+
+    std::vector<std::string> prompts;
+    prompts.reserve(num_prompts);
+    for (size_t i = 0; i < num_prompts; ++i) {
+        if (!lines.empty()) {
+            prompts.push_back(lines[i % lines.size()]);
+            continue;
+        }
+        std::string prompt;
+        for (size_t word = num_words_distribution(engine); word > 0; --word)
+            prompt.append(words[word_distribution(engine)]).append(" ");
+        prompts.push_back(std::move(prompt));
+    }
+    return prompts;
+}
+
+template <typename Fn>
+double measure_ms(Fn&& fn, size_t num_iterations) {
+    fn();  // warm-up
+    auto start = std::chrono::steady_clock::now();
+    for (size_t iteration = 0; iteration < num_iterations; ++iteration)
+        fn();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / num_iterations;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) try {
+    cxxopts::Options options("tokenizer_benchmark", "Help command");
+
+    options.add_options()
+    ("m,model", "Path to tokenizers directory", cxxopts::value<std::string>()->default_value("."))
+    ("n,num_prompts", "A number of prompts in a batch", cxxopts::value<size_t>()->default_value("10000"))
+    ("prompts", "Path to a text file with one prompt per line. Synthetic prompts are used if not set", cxxopts::value<std::string>()->default_value(""))
+    ("max_requests", "Maximum number of tokenizer infer requests. Default: number of hardware threads", cxxopts::value<size_t>()->default_value(std::to_string(std::thread::hardware_concurrency())))
+    ("num_iterations", "Number of measured iterations per configuration", cxxopts::value<size_t>()->default_value("3"))
+    ("h,help", "Print usage");
+
+    cxxopts::ParseResult result;
+    try {
+        result = options.parse(argc, argv);
+    } catch (const cxxopts::exceptions::exception& e) {
+        std::cout << e.what() << "\n\n";
+        std::cout << options.help() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (result.count("help")) {
+        std::cout << options.help() << std::endl;
+        return EXIT_SUCCESS;
+    }
+
+    const std::string models_path = result["model"].as<std::string>();
+    const size_t num_prompts = result["num_prompts"].as<size_t>();
+    const size_t max_requests = std::max<size_t>(1, result["max_requests"].as<size_t>());
+    const size_t num_iterations = std::max<size_t>(1, result["num_iterations"].as<size_t>());
+
+    const std::vector<std::string> prompts = read_prompts(result["prompts"].as<std::string>(), num_prompts);
+    size_t total_bytes = 0;
+    for (const auto& prompt : prompts)
+        total_bytes += prompt.size();
+
+    std::cout << "Benchmarking parameters: " << std::endl;
+    std::cout << "\tNum prompts: " << prompts.size() << std::endl;
+    std::cout << "\tAverage prompt length: " << total_bytes / std::max<size_t>(1, prompts.size()) << " bytes" << std::endl;
+    std::cout << "\tMax infer requests: " << max_requests << std::endl;
+    std::cout << std::endl;
+
+    std::cout << std::setw(10) << "requests" << std::setw(16) << "encode, ms" << std::setw(16) << "prompts/s"
+              << std::setw(10) << "speedup" << std::setw(16) << "decode, ms" << std::setw(10) << "speedup" << std::endl;
+
+    double base_encode_ms = 0.0, base_decode_ms = 0.0;
+    for (size_t num_requests = 1;; num_requests = std::min(num_requests * 2, max_requests)) {
+        // every infer request runs in its own stream, so batches are sharded across num_requests requests
+        ov::genai::Tokenizer tokenizer(models_path, {ov::hint::performance_mode(ov::hint::PerformanceMode::THROUGHPUT),
+                                                     ov::hint::num_requests(static_cast<uint32_t>(num_requests))});
+
+        ov::genai::TokenizedInputs encoded;
+        const double encode_ms = measure_ms([&]() { encoded = tokenizer.encode(prompts); }, num_iterations);
+        const double decode_ms = measure_ms([&]() { tokenizer.decode(encoded.input_ids); }, num_iterations);
+        if (num_requests == 1) {
+            base_encode_ms = encode_ms;
+            base_decode_ms = decode_ms;
+        }
+
+        std::cout << std::fixed << std::setprecision(2)
+                  << std::setw(10) << num_requests
+                  << std::setw(16) << encode_ms
+                  << std::setw(16) << prompts.size() * 1000.0 / encode_ms
+                  << std::setw(10) << base_encode_ms / encode_ms
+                  << std::setw(16) << decode_ms
+                  << std::setw(10) << base_decode_ms / decode_ms << std::endl;
+
+        if (num_requests == max_requests)
+            break;
+    }
+
+    return EXIT_SUCCESS;
+} catch (const std::exception& error) {
+    try {
+        std::cerr << error.what() << '\n';
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+} catch (...) {
+    try {
+        std::cerr << "Non-exception object thrown\n";
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+}